@@ -0,0 +1,92 @@
+/**
+ * @file bench.cpp
+ * @brief Memory hooks for the benchmark executables.
+ *
+ * Allocations carry a small header recording their size so that
+ * the benchmarks can report memory usage of the containers. The
+ * counters are updated atomically since benchmarks may allocate from
+ * several threads.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <stdlib.h>
+
+#include "bench_helper.h"
+
+namespace {
+    const size_t header_size = 16;
+
+    size_t s_live_bytes = 0;
+    size_t s_peak_bytes = 0;
+    size_t s_alloc_count = 0;
+
+    void add_live(size_t bytes) {
+        const size_t live = __atomic_add_fetch(&s_live_bytes, bytes, __ATOMIC_RELAXED);
+        size_t peak = __atomic_load_n(&s_peak_bytes, __ATOMIC_RELAXED);
+        while (live > peak && !__atomic_compare_exchange_n(
+                &s_peak_bytes, &peak, live, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+        }
+    }
+}
+
+namespace wlp {
+    namespace mem {
+        void *alloc(size_t bytes) {
+            char *block = static_cast<char *>(::malloc(bytes + header_size));
+            if (!block) {
+                return nullptr;
+            }
+            *reinterpret_cast<size_t *>(block) = bytes;
+            __atomic_add_fetch(&s_alloc_count, 1, __ATOMIC_RELAXED);
+            add_live(bytes);
+            return block + header_size;
+        }
+
+        void free(void *ptr) {
+            if (!ptr) {
+                return;
+            }
+            char *block = static_cast<char *>(ptr) - header_size;
+            __atomic_sub_fetch(&s_live_bytes, *reinterpret_cast<size_t *>(block), __ATOMIC_RELAXED);
+            ::free(block);
+        }
+
+        void *realloc(void *ptr, size_t bytes) {
+            if (!ptr) {
+                return alloc(bytes);
+            }
+            char *block = static_cast<char *>(ptr) - header_size;
+            size_t old_bytes = *reinterpret_cast<size_t *>(block);
+            block = static_cast<char *>(::realloc(block, bytes + header_size));
+            if (!block) {
+                return nullptr;
+            }
+            *reinterpret_cast<size_t *>(block) = bytes;
+            __atomic_sub_fetch(&s_live_bytes, old_bytes, __ATOMIC_RELAXED);
+            add_live(bytes);
+            return block + header_size;
+        }
+    }
+
+    namespace bench {
+        size_t live_bytes() {
+            return __atomic_load_n(&s_live_bytes, __ATOMIC_RELAXED);
+        }
+
+        size_t peak_bytes() {
+            return __atomic_load_n(&s_peak_bytes, __ATOMIC_RELAXED);
+        }
+
+        size_t alloc_count() {
+            return __atomic_load_n(&s_alloc_count, __ATOMIC_RELAXED);
+        }
+
+        void reset_counters() {
+            __atomic_store_n(&s_peak_bytes, __atomic_load_n(&s_live_bytes, __ATOMIC_RELAXED), __ATOMIC_RELAXED);
+            __atomic_store_n(&s_alloc_count, 0, __ATOMIC_RELAXED);
+        }
+    }
+}
@@ -0,0 +1,120 @@
+/**
+ * @file bench_helper.h
+ * @brief Timing and allocation accounting shared by the benchmarks.
+ *
+ * Each benchmark is its own executable with its own main. The memory
+ * hooks required by wlib are defined in bench.cpp and keep a running
+ * count of the bytes requested through @code create @endcode.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_BENCH_HELPER_H
+#define EMBEDDEDCPLUSPLUS_BENCH_HELPER_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <chrono>
+
+namespace wlp {
+    namespace bench {
+
+        /**
+         * @return the number of bytes currently allocated through wlib
+         */
+        size_t live_bytes();
+
+        /**
+         * @return the largest value of live bytes since the last reset
+         */
+        size_t peak_bytes();
+
+        /**
+         * @return the number of allocations since the last reset
+         */
+        size_t alloc_count();
+
+        /**
+         * Reset the peak and allocation counters. The live byte
+         * count is not affected.
+         */
+        void reset_counters();
+
+        /**
+         * Wall clock stopwatch started on construction.
+         */
+        class timer {
+        public:
+            typedef std::chrono::steady_clock clock_type;
+
+            timer()
+                    : m_start(clock_type::now()) {}
+
+            void reset() {
+                m_start = clock_type::now();
+            }
+
+            double elapsed_ns() const {
+                return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        clock_type::now() - m_start).count());
+            }
+
+        private:
+            clock_type::time_point m_start;
+        };
+
+        /**
+         * Prevent the compiler from discarding a computed value.
+         *
+         * @param value the value to keep alive
+         */
+        template<typename T>
+        inline void do_not_optimize(T const &value) {
+            asm volatile("" : : "r,m"(value) : "memory");
+        }
+
+        /**
+         * Small xorshift generator so that every benchmark produces
+         * the same inputs on every host.
+         */
+        class rng {
+        public:
+            explicit rng(uint32_t seed = 0x9e3779b9u)
+                    : m_state(seed ? seed : 1u) {}
+
+            uint32_t next() {
+                m_state ^= m_state << 13;
+                m_state ^= m_state >> 17;
+                m_state ^= m_state << 5;
+                return m_state;
+            }
+
+            uint32_t next(uint32_t bound) {
+                return next() % bound;
+            }
+
+        private:
+            uint32_t m_state;
+        };
+
+        inline void header(const char *title) {
+            printf("\n== %s ==\n", title);
+            printf("%-40s %14s %14s\n", "case", "ns/op", "Mops/s");
+        }
+
+        inline void report(const char *name, double total_ns, size_t ops) {
+            double per_op = ops ? total_ns / static_cast<double>(ops) : 0.0;
+            double mops = total_ns > 0 ? static_cast<double>(ops) * 1e3 / total_ns : 0.0;
+            printf("%-40s %14.2f %14.2f\n", name, per_op, mops);
+        }
+
+        inline void report_bytes(const char *name, size_t bytes) {
+            printf("%-40s %14zu bytes\n", name, bytes);
+        }
+
+    }
+}
+
+#endif //EMBEDDEDCPLUSPLUS_BENCH_HELPER_H
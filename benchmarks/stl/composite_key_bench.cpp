@@ -0,0 +1,89 @@
+/**
+ * @file composite_key_bench.cpp
+ * @brief Compare hash maps keyed by tuples and by concatenated strings.
+ *
+ * Sensor readings are keyed by station, channel, and sensor number.
+ * One map uses a tuple of the three numbers as its key; the other uses
+ * the numbers printed into a string, the way composite keys were built
+ * before tuples could be hashed, which formats and allocates a string
+ * for every insert and lookup.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <stdio.h>
+
+#include <wlib/stl/HashMap.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const uint32_t keys = 1 << 16;
+    const uint32_t lookups = 1 << 20;
+
+    typedef tuple<uint32_t, uint16_t, uint16_t> sensor_key;
+
+    struct sensor {
+        uint32_t station;
+        uint16_t channel;
+        uint16_t number;
+    };
+
+    sensor make_sensor(bench::rng &r) {
+        return sensor{r.next(4096), static_cast<uint16_t>(r.next(16)), static_cast<uint16_t>(r.next(64))};
+    }
+
+    sensor_key tuple_key(const sensor &s) {
+        return sensor_key(s.station, s.channel, s.number);
+    }
+
+    dynamic_string string_key(const sensor &s) {
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%u:%u:%u", s.station, static_cast<unsigned>(s.channel),
+                 static_cast<unsigned>(s.number));
+        return dynamic_string(buf);
+    }
+
+    template<typename Map, typename Key>
+    void run(const char *name, Key key) {
+        Map map(2 * keys);
+        bench::rng r;
+        bench::timer t;
+        for (uint32_t i = 0; i < keys; ++i) {
+            map[key(make_sensor(r))] = i;
+        }
+        char label[64];
+        snprintf(label, sizeof(label), "%s insert", name);
+        bench::report(label, t.elapsed_ns(), keys);
+
+        // the same generator again visits the inserted keys, and a
+        // second generator mixes in keys that may be missing
+        bench::rng hit;
+        bench::rng miss(7);
+        uint32_t found = 0;
+        t.reset();
+        for (uint32_t i = 0; i < lookups; ++i) {
+            if (i % keys == 0) {
+                hit = bench::rng();
+            }
+            const sensor s = make_sensor(i % 4 == 3 ? miss : hit);
+            found += map.find(key(s)) != map.end() ? 1 : 0;
+        }
+        bench::do_not_optimize(found);
+        snprintf(label, sizeof(label), "%s find", name);
+        bench::report(label, t.elapsed_ns(), lookups);
+    }
+
+}
+
+int main() {
+    bench::header("hash_map with three-field keys (per operation)");
+    run<hash_map<sensor_key, uint32_t, hash<sensor_key, uint32_t>>>("tuple key", tuple_key);
+    run<hash_map<dynamic_string, uint32_t, hash<dynamic_string, uint32_t>>>("string key", string_key);
+    return 0;
+}
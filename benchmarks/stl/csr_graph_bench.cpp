@@ -0,0 +1,150 @@
+/**
+ * @file csr_graph_bench.cpp
+ * @brief Compare graph searches on a CSR graph and a hash map of lists.
+ *
+ * The network is a grid of stations with some links missing and a few
+ * long links added, stored undirected. Breadth-first search and
+ * Dijkstra's search from one station run over a csr_graph and over a
+ * hash map from station to a linked list of neighbours, the layout
+ * the track network used before. Both searches use the same queue and
+ * outputs, so the difference is the adjacency layout.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <wlib/stl/CsrGraph.h>
+#include <wlib/stl/HashMap.h>
+#include <wlib/stl/LinkedList.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const uint32_t side = 256;
+    const uint32_t vertices = side * side;
+    const uint32_t rounds = 16;
+
+    typedef hash_map<uint32_t, linked_list<pair<uint32_t, uint32_t>>> list_graph;
+
+    void make_edges(array_list<graph_edge<uint32_t>> &edges) {
+        bench::rng r;
+        for (uint32_t x = 0; x < side; ++x) {
+            for (uint32_t y = 0; y < side; ++y) {
+                const uint32_t v = x * side + y;
+                if (x + 1 < side && r.next(10) != 0) {
+                    edges.push_back(graph_edge<uint32_t>{v, v + side, 1 + r.next(20)});
+                }
+                if (y + 1 < side && r.next(10) != 0) {
+                    edges.push_back(graph_edge<uint32_t>{v, v + 1, 1 + r.next(20)});
+                }
+                if (r.next(50) == 0) {
+                    edges.push_back(graph_edge<uint32_t>{v, r.next(vertices), 50 + r.next(200)});
+                }
+            }
+        }
+    }
+
+    void make_lists(list_graph &lists, const array_list<graph_edge<uint32_t>> &edges) {
+        for (uint32_t v = 0; v < vertices; ++v) {
+            lists[v];
+        }
+        for (size_t e = 0; e < edges.size(); ++e) {
+            const graph_edge<uint32_t> &edge = edges[e];
+            lists[edge.source].push_back(pair<uint32_t, uint32_t>(edge.target, edge.weight));
+            lists[edge.target].push_back(pair<uint32_t, uint32_t>(edge.source, edge.weight));
+        }
+    }
+
+    uint32_t bfs_lists(list_graph &lists, uint32_t source, uint32_t *depth, array_list<uint32_t> &queue) {
+        for (uint32_t v = 0; v < vertices; ++v) {
+            depth[v] = graph_unreached;
+        }
+        queue.clear();
+        depth[source] = 0;
+        queue.push_back(source);
+        for (size_t head = 0; head < queue.size(); ++head) {
+            const uint32_t v = queue[head];
+            linked_list<pair<uint32_t, uint32_t>> &out = *lists.find(v);
+            for (auto it = out.begin(); it != out.end(); ++it) {
+                const uint32_t t = it->first();
+                if (depth[t] == graph_unreached) {
+                    depth[t] = depth[v] + 1;
+                    queue.push_back(t);
+                }
+            }
+        }
+        return static_cast<uint32_t>(queue.size());
+    }
+
+    uint32_t dijkstra_lists(list_graph &lists, uint32_t source, uint32_t *distance) {
+        for (uint32_t v = 0; v < vertices; ++v) {
+            distance[v] = UINT32_MAX;
+        }
+        array_heap<__dijkstra_entry<uint32_t>, __dijkstra_order<uint32_t>> queue(vertices);
+        distance[source] = 0;
+        queue.push(__dijkstra_entry<uint32_t>{0, source});
+        uint32_t reached = 0;
+        while (!queue.empty()) {
+            const __dijkstra_entry<uint32_t> top = queue.top();
+            queue.pop();
+            if (distance[top.vertex] < top.distance) {
+                continue;
+            }
+            ++reached;
+            linked_list<pair<uint32_t, uint32_t>> &out = *lists.find(top.vertex);
+            for (auto it = out.begin(); it != out.end(); ++it) {
+                const uint32_t d = top.distance + it->second();
+                if (d < distance[it->first()]) {
+                    distance[it->first()] = d;
+                    queue.push(__dijkstra_entry<uint32_t>{d, it->first()});
+                }
+            }
+        }
+        return reached;
+    }
+
+    template<typename Search>
+    void run(const char *name, Search search) {
+        uint32_t reached = 0;
+        bench::timer t;
+        for (uint32_t r = 0; r < rounds; ++r) {
+            reached += search(r * 977 % vertices);
+        }
+        bench::do_not_optimize(reached);
+        bench::report(name, t.elapsed_ns(), static_cast<size_t>(rounds) * vertices);
+    }
+
+}
+
+int main() {
+    array_list<graph_edge<uint32_t>> edges(2 * vertices + vertices / 32);
+    make_edges(edges);
+
+    bench::header("build from the edge list (per edge)");
+    bench::timer t;
+    csr_graph<uint32_t> graph(vertices, edges.as_span(), true);
+    bench::report("csr_graph", t.elapsed_ns(), edges.size());
+    t.reset();
+    list_graph lists(2 * vertices);
+    make_lists(lists, edges);
+    bench::report("hash map of lists", t.elapsed_ns(), edges.size());
+
+    array_list<uint32_t> depth(vertices);
+    array_list<uint32_t> queue(vertices);
+    for (uint32_t v = 0; v < vertices; ++v) {
+        depth.push_back(0);
+    }
+
+    bench::header("breadth-first search (per vertex)");
+    run("csr_graph", [&](uint32_t s) { return breadth_first(graph, s, depth.as_span()); });
+    run("hash map of lists", [&](uint32_t s) { return bfs_lists(lists, s, depth.data(), queue); });
+
+    bench::header("dijkstra (per vertex)");
+    run("csr_graph", [&](uint32_t s) { return dijkstra(graph, s, depth.as_span()); });
+    run("hash map of lists", [&](uint32_t s) { return dijkstra_lists(lists, s, depth.data()); });
+    return 0;
+}
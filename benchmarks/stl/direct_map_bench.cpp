@@ -0,0 +1,160 @@
+/**
+ * @file direct_map_bench.cpp
+ * @brief Compare direct_map against hash_map and open_map.
+ *
+ * The workload is a register table with keys from 0 to 4095, half of
+ * which are in use, as when mirroring device registers or CAN message
+ * IDs. Every map receives the same keys in the same order.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <wlib/stl/DirectMap.h>
+#include <wlib/stl/HashMap.h>
+#include <wlib/stl/OpenMap.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const uint16_t max_key = 4095;
+    const uint32_t used = 2048;
+    const uint32_t rounds = 256;
+    const uint32_t probes = 1 << 20;
+
+    uint16_t keys[used];
+    uint16_t lookups[probes];
+
+    /**
+     * Pick half of the key range in random order, and a probe
+     * sequence over the whole range that hits half of the time.
+     */
+    void make_keys() {
+        bench::rng r;
+        uint16_t all[max_key + 1];
+        for (uint32_t k = 0; k <= max_key; ++k) {
+            all[k] = static_cast<uint16_t>(k);
+        }
+        for (uint32_t k = max_key; k > 0; --k) {
+            const uint32_t j = r.next(k + 1);
+            const uint16_t tmp = all[k];
+            all[k] = all[j];
+            all[j] = tmp;
+        }
+        for (uint32_t i = 0; i < used; ++i) {
+            keys[i] = all[i];
+        }
+        for (uint32_t i = 0; i < probes; ++i) {
+            lookups[i] = static_cast<uint16_t>(r.next(max_key + 1));
+        }
+    }
+
+    struct make_direct {
+        typedef direct_map<uint32_t, max_key> map_type;
+
+        static map_type *make() {
+            return new map_type();
+        }
+    };
+
+    struct make_hash {
+        typedef hash_map<uint16_t, uint32_t> map_type;
+
+        static map_type *make() {
+            return new map_type(2 * (max_key + 1));
+        }
+    };
+
+    struct make_open {
+        typedef open_map<uint16_t, uint32_t> map_type;
+
+        static map_type *make() {
+            return new map_type(2 * (max_key + 1));
+        }
+    };
+
+    template<typename Maker>
+    void run(const char *name) {
+        typedef typename Maker::map_type map_type;
+        char label[64];
+
+        double insert_ns = 0;
+        size_t allocs = 0;
+        size_t bytes = 0;
+        for (uint32_t k = 0; k < rounds; ++k) {
+            const size_t before = bench::live_bytes();
+            map_type *map = Maker::make();
+            bench::reset_counters();
+            bench::timer t;
+            for (uint32_t i = 0; i < used; ++i) {
+                map->insert(keys[i], static_cast<uint32_t>(i));
+            }
+            insert_ns += t.elapsed_ns();
+            allocs += bench::alloc_count();
+            bytes = bench::live_bytes() - before;
+            delete map;
+        }
+        snprintf(label, sizeof(label), "%s insert", name);
+        bench::report(label, insert_ns, static_cast<size_t>(used) * rounds);
+        snprintf(label, sizeof(label), "%s allocations per insert", name);
+        printf("%-40s %14.2f\n", label, static_cast<double>(allocs) / (static_cast<double>(used) * rounds));
+        snprintf(label, sizeof(label), "%s memory", name);
+        bench::report_bytes(label, bytes);
+
+        map_type *map = Maker::make();
+        for (uint32_t i = 0; i < used; ++i) {
+            map->insert(keys[i], static_cast<uint32_t>(i));
+        }
+        const map_type &cmap = *map;
+
+        bench::timer t;
+        size_t hits = 0;
+        for (uint32_t i = 0; i < probes; ++i) {
+            typename map_type::const_iterator it = cmap.find(lookups[i]);
+            if (it != cmap.end()) {
+                hits += *it;
+            }
+        }
+        snprintf(label, sizeof(label), "%s find", name);
+        bench::report(label, t.elapsed_ns(), probes);
+        bench::do_not_optimize(hits);
+
+        t.reset();
+        uint64_t sum = 0;
+        for (uint32_t k = 0; k < rounds; ++k) {
+            for (typename map_type::const_iterator it = cmap.begin(); it != cmap.end(); ++it) {
+                sum += *it;
+            }
+        }
+        snprintf(label, sizeof(label), "%s iterate (per entry)", name);
+        bench::report(label, t.elapsed_ns(), static_cast<size_t>(used) * rounds);
+        bench::do_not_optimize(sum);
+
+        t.reset();
+        for (uint32_t k = 0; k < rounds / 16; ++k) {
+            for (uint32_t i = 0; i < used; ++i) {
+                map->erase(keys[i]);
+            }
+            for (uint32_t i = 0; i < used; ++i) {
+                map->insert(keys[i], static_cast<uint32_t>(i));
+            }
+        }
+        snprintf(label, sizeof(label), "%s erase + reinsert", name);
+        bench::report(label, t.elapsed_ns(), static_cast<size_t>(used) * (rounds / 16));
+        delete map;
+    }
+
+}
+
+int main() {
+    make_keys();
+    bench::header("4096 keys, half occupied");
+    run<make_direct>("direct_map");
+    run<make_hash>("hash_map");
+    run<make_open>("open_map");
+    return 0;
+}
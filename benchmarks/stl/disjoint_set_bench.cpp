@@ -0,0 +1,124 @@
+/**
+ * @file disjoint_set_bench.cpp
+ * @brief Compare union-find component labeling with flood fills.
+ *
+ * Occupancy grids are filled at random near the density where most
+ * occupied cells join one large component, the worst case for the
+ * depth of a recursive flood fill. Each grid is labeled with a
+ * recursive flood fill, with a flood fill that keeps an explicit
+ * stack, and with label_components. The recursive fill is only run on
+ * the smaller grids, whose components fit on the stack.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <wlib/stl/Array2D.h>
+#include <wlib/stl/ArrayList.h>
+#include <wlib/stl/DisjointSet.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const uint32_t rounds = 8;
+    const size_t sides[] = {128, 512, 2048};
+    const size_t recursive_limit = 256;
+    const uint32_t density = 60;
+
+    // a functor rather than a function pointer, so that the call inlines
+    auto is_set = [](uint8_t cell) { return cell != 0; };
+
+    void fill_recursive(array2d<uint8_t> &grid, array2d<uint32_t> &labels, size_t x, size_t y, uint32_t label) {
+        if (x >= grid.x() || y >= grid.y() || grid[x][y] == 0 || labels[x][y] != 0) {
+            return;
+        }
+        labels[x][y] = label;
+        fill_recursive(grid, labels, x + 1, y, label);
+        fill_recursive(grid, labels, x - 1, y, label);
+        fill_recursive(grid, labels, x, y + 1, label);
+        fill_recursive(grid, labels, x, y - 1, label);
+    }
+
+    uint32_t label_recursive(array2d<uint8_t> &grid, array2d<uint32_t> &labels) {
+        labels.zero_clear();
+        uint32_t count = 0;
+        for (size_t x = 0; x < grid.x(); ++x) {
+            for (size_t y = 0; y < grid.y(); ++y) {
+                if (grid[x][y] != 0 && labels[x][y] == 0) {
+                    fill_recursive(grid, labels, x, y, ++count);
+                }
+            }
+        }
+        return count;
+    }
+
+    uint32_t label_stack(array2d<uint8_t> &grid, array2d<uint32_t> &labels, array_list<uint32_t> &stack) {
+        labels.zero_clear();
+        const uint32_t nx = static_cast<uint32_t>(grid.x());
+        const uint32_t ny = static_cast<uint32_t>(grid.y());
+        uint32_t count = 0;
+        for (uint32_t x0 = 0; x0 < nx; ++x0) {
+            for (uint32_t y0 = 0; y0 < ny; ++y0) {
+                if (grid[x0][y0] == 0 || labels[x0][y0] != 0) {
+                    continue;
+                }
+                labels[x0][y0] = ++count;
+                stack.clear();
+                stack.push_back(x0 * ny + y0);
+                while (!stack.empty()) {
+                    const uint32_t cell = stack[stack.size() - 1];
+                    stack.pop_back();
+                    const uint32_t x = cell / ny;
+                    const uint32_t y = cell % ny;
+                    const uint32_t near[4][2] = {{x + 1, y}, {x - 1, y}, {x, y + 1}, {x, y - 1}};
+                    for (const uint32_t (&n)[2] : near) {
+                        if (n[0] < nx && n[1] < ny && grid[n[0]][n[1]] != 0 && labels[n[0]][n[1]] == 0) {
+                            labels[n[0]][n[1]] = count;
+                            stack.push_back(n[0] * ny + n[1]);
+                        }
+                    }
+                }
+            }
+        }
+        return count;
+    }
+
+    template<typename Label>
+    void run(const char *name, size_t side, Label label) {
+        uint32_t count = 0;
+        bench::timer t;
+        for (uint32_t r = 0; r < rounds; ++r) {
+            count += label();
+        }
+        bench::do_not_optimize(count);
+        bench::report(name, t.elapsed_ns(), rounds * side * side);
+    }
+
+}
+
+int main() {
+    char title[96];
+    array_list<uint32_t> stack;
+    for (size_t side : sides) {
+        array2d<uint8_t> grid(side, side);
+        array2d<uint32_t> labels(side, side);
+        bench::rng r;
+        for (size_t x = 0; x < side; ++x) {
+            for (size_t y = 0; y < side; ++y) {
+                grid[x][y] = r.next(100) < density ? 1 : 0;
+            }
+        }
+        snprintf(title, sizeof(title), "%zu x %zu grid, %u%% occupied (per cell)", side, side, density);
+        bench::header(title);
+        if (side <= recursive_limit) {
+            run("recursive flood fill", side, [&]() { return label_recursive(grid, labels); });
+        }
+        run("flood fill with a stack", side, [&]() { return label_stack(grid, labels, stack); });
+        run("label_components", side, [&]() { return label_components(grid, labels, is_set); });
+    }
+    return 0;
+}
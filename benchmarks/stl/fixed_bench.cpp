@@ -0,0 +1,180 @@
+/**
+ * @file fixed_bench.cpp
+ * @brief Compare float and fixed-point instantiations of the same code.
+ *
+ * Every kernel is a template over the value type, so the float and
+ * fixed runs execute identical source. The host has an FPU, so the
+ * float numbers here are a lower bound on what a soft-float target
+ * would pay; the fixed numbers carry over to such a target directly.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <math.h>
+
+#include <wlib/stl/Array2D.h>
+#include <wlib/stl/Fixed.h>
+#include <wlib/stl/Vector2D.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const uint32_t count = 1 << 16;
+    const uint32_t rounds = 64;
+
+    inline double as_double(float v) {
+        return v;
+    }
+
+    inline double as_double(q15_16 v) {
+        return v.to_double();
+    }
+
+    template<typename T>
+    void fill_inputs(T *xs, T *ys) {
+        bench::rng r;
+        for (uint32_t i = 0; i < count; ++i) {
+            xs[i] = T(static_cast<double>(r.next(20000)) / 100.0 - 100.0);
+            ys[i] = T(static_cast<double>(r.next(20000)) / 100.0 - 100.0);
+        }
+    }
+
+    template<typename T>
+    double normalize(const T *xs, const T *ys, double &err) {
+        bench::timer t;
+        T acc(0);
+        for (uint32_t k = 0; k < rounds; ++k) {
+            for (uint32_t i = 0; i < count; ++i) {
+                vector2d<T> v(xs[i], ys[i] + T(1));
+                acc += v.n().x();
+            }
+        }
+        const double ns = t.elapsed_ns();
+        bench::do_not_optimize(acc);
+        err = 0;
+        for (uint32_t i = 0; i < count; ++i) {
+            const double x = as_double(xs[i]);
+            const double y = as_double(ys[i] + T(1));
+            const double e = fabs(as_double(vector2d<T>(xs[i], ys[i] + T(1)).n().x()) - x / ::sqrt(x * x + y * y));
+            err = e > err ? e : err;
+        }
+        return ns;
+    }
+
+    template<typename T>
+    double heading(const T *xs, const T *ys, double &err) {
+        bench::timer t;
+        T acc(0);
+        for (uint32_t k = 0; k < rounds; ++k) {
+            for (uint32_t i = 0; i < count; ++i) {
+                const T a = atan2(ys[i], xs[i]);
+                acc += sin(a) + cos(a);
+            }
+        }
+        const double ns = t.elapsed_ns();
+        bench::do_not_optimize(acc);
+        err = 0;
+        for (uint32_t i = 0; i < count; ++i) {
+            const double a = ::atan2(as_double(ys[i]), as_double(xs[i]));
+            const T f = atan2(ys[i], xs[i]);
+            const double e = fabs(as_double(sin(f) + cos(f)) - (::sin(a) + ::cos(a)));
+            err = e > err ? e : err;
+        }
+        return ns;
+    }
+
+    /**
+     * Exponential smoothing along every row of a map, as done when
+     * filtering range readings.
+     */
+    template<typename T>
+    double smooth(array2d<T, uint32_t> &grid) {
+        const uint32_t side = grid.x();
+        const T alpha(0.125);
+        bench::rng r;
+        for (uint32_t x = 0; x < side; ++x) {
+            for (uint32_t y = 0; y < side; ++y) {
+                grid[x][y] = T(static_cast<double>(r.next(1000)) / 10.0);
+            }
+        }
+        bench::timer t;
+        for (uint32_t k = 0; k < rounds / 8; ++k) {
+            for (uint32_t x = 0; x < side; ++x) {
+                T *row = grid.get()[x];
+                T state = row[0];
+                for (uint32_t y = 1; y < side; ++y) {
+                    state += alpha * (row[y] - state);
+                    row[y] = state;
+                }
+            }
+        }
+        const double ns = t.elapsed_ns();
+        bench::do_not_optimize(grid.get()[side - 1][side - 1]);
+        return ns;
+    }
+
+    template<typename T>
+    double reciprocals(const T *xs, double &err) {
+        bench::timer t;
+        T acc(0);
+        for (uint32_t k = 0; k < rounds; ++k) {
+            for (uint32_t i = 0; i < count; ++i) {
+                acc += reciprocal(xs[i] + T(200));
+            }
+        }
+        const double ns = t.elapsed_ns();
+        bench::do_not_optimize(acc);
+        err = 0;
+        for (uint32_t i = 0; i < count; ++i) {
+            const double e = fabs(as_double(reciprocal(xs[i] + T(200))) - 1.0 / (as_double(xs[i]) + 200.0));
+            err = e > err ? e : err;
+        }
+        return ns;
+    }
+
+    template<typename T>
+    void run(const char *name) {
+        T *xs = new T[count];
+        T *ys = new T[count];
+        fill_inputs(xs, ys);
+        char label[64];
+        double err;
+        const size_t ops = static_cast<size_t>(count) * rounds;
+
+        double ns = normalize(xs, ys, err);
+        snprintf(label, sizeof(label), "%s vector2d::n", name);
+        bench::report(label, ns, ops);
+        printf("%-40s %14.3g\n", "  max abs error", err);
+
+        ns = heading(xs, ys, err);
+        snprintf(label, sizeof(label), "%s atan2 + sin + cos", name);
+        bench::report(label, ns, ops);
+        printf("%-40s %14.3g\n", "  max abs error", err);
+
+        ns = reciprocals(xs, err);
+        snprintf(label, sizeof(label), "%s reciprocal", name);
+        bench::report(label, ns, ops);
+        printf("%-40s %14.3g\n", "  max abs error", err);
+
+        array2d<T, uint32_t> grid(512, 512);
+        ns = smooth(grid);
+        snprintf(label, sizeof(label), "%s array2d row smoothing", name);
+        bench::report(label, ns, static_cast<size_t>(512) * 511 * (rounds / 8));
+
+        delete[] xs;
+        delete[] ys;
+    }
+
+}
+
+int main() {
+    bench::header("float vs q15_16, per operation");
+    run<float>("float");
+    run<q15_16>("q15_16");
+    return 0;
+}
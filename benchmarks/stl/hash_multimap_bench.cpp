@@ -0,0 +1,110 @@
+/**
+ * @file hash_multimap_bench.cpp
+ * @brief Compare the hash multimap with equal keys chained in a table.
+ *
+ * Values are added under keys in random order and then every key's
+ * values are summed through its range. The multimap keeps one group
+ * per key; the chained table is the table of a hash map filled with
+ * insert_equal, which allocates a node per value and walks the nodes
+ * of a key's range. Both are run with thousands of values per key and
+ * with a few values per key.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <stdio.h>
+
+#include <wlib/stl/HashMap.h>
+#include <wlib/stl/HashMultimap.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const uint32_t values = 1 << 18;
+    const uint32_t rounds = 4;
+
+    typedef hash_multimap<uint32_t, uint32_t, hash<uint32_t, uint32_t>> grouped_map;
+    typedef hash_map<uint32_t, uint32_t, hash<uint32_t, uint32_t>>::table_type chained_table;
+
+    uint32_t fill_grouped(grouped_map &map, uint32_t keys) {
+        bench::rng r;
+        for (uint32_t i = 0; i < values; ++i) {
+            map.insert(r.next(keys), i);
+        }
+        return static_cast<uint32_t>(map.size());
+    }
+
+    uint32_t fill_chained(chained_table &table, uint32_t keys) {
+        bench::rng r;
+        for (uint32_t i = 0; i < values; ++i) {
+            table.insert_equal(make_tuple(r.next(keys), i));
+        }
+        return static_cast<uint32_t>(table.size());
+    }
+
+    uint32_t sum_grouped(const grouped_map &map, uint32_t keys) {
+        uint32_t sum = 0;
+        for (uint32_t k = 0; k < keys; ++k) {
+            span<const uint32_t> range = map.equal_range(k);
+            for (size_t i = 0; i < range.size(); ++i) {
+                sum += range[i];
+            }
+        }
+        return sum;
+    }
+
+    uint32_t sum_chained(const chained_table &table, uint32_t keys) {
+        uint32_t sum = 0;
+        for (uint32_t k = 0; k < keys; ++k) {
+            pair<chained_table::const_iterator, chained_table::const_iterator> range = table.equal_range(k);
+            for (chained_table::const_iterator it = range.first(); it != range.second(); ++it) {
+                sum += *it;
+            }
+        }
+        return sum;
+    }
+
+    template<typename Op>
+    void run(const char *name, Op op) {
+        uint32_t check = 0;
+        bench::timer t;
+        for (uint32_t r = 0; r < rounds; ++r) {
+            check += op();
+        }
+        bench::do_not_optimize(check);
+        bench::report(name, t.elapsed_ns(), static_cast<size_t>(rounds) * values);
+    }
+
+    void compare(uint32_t keys) {
+        char title[96];
+        snprintf(title, sizeof(title), "%u values under %u keys (per value)", values, keys);
+        bench::header(title);
+        run("hash_multimap insert", [&]() {
+            grouped_map map(keys);
+            return fill_grouped(map, keys);
+        });
+        run("insert_equal", [&]() {
+            chained_table table(keys);
+            return fill_chained(table, keys);
+        });
+
+        grouped_map map(keys);
+        fill_grouped(map, keys);
+        chained_table table(keys);
+        fill_chained(table, keys);
+        run("hash_multimap equal_range", [&]() { return sum_grouped(map, keys); });
+        run("insert_equal equal_range", [&]() { return sum_chained(table, keys); });
+    }
+
+}
+
+int main() {
+    compare(64);
+    compare(values / 4);
+    return 0;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file packed_sequence_bench.cpp
+ * @brief Compare packed_sequence against a raw array_list of values.
+ *
+ * Three telemetry shapes are measured: millisecond timestamps with
+ * jitter, a slowly varying counter, and uniformly random values,
+ * which do not compress and show the worst case overhead.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <wlib/stl/ArrayList.h>
+#include <wlib/stl/PackedSequence.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const uint32_t count = 1 << 22;
+    const uint32_t rounds = 8;
+
+    typedef uint32_t (*generator)(bench::rng &, uint32_t, uint32_t);
+
+    uint32_t timestamps(bench::rng &r, uint32_t, uint32_t prev) {
+        return prev + 10 + r.next(3);
+    }
+
+    uint32_t counter(bench::rng &r, uint32_t i, uint32_t) {
+        return 20000 + (i >> 10) + r.next(4);
+    }
+
+    uint32_t random_values(bench::rng &r, uint32_t, uint32_t) {
+        return static_cast<uint32_t>(r.next());
+    }
+
+    void run(const char *name, generator gen, bool sorted) {
+        bench::header(name);
+        bench::rng r;
+        array_list<uint32_t> list(count);
+        packed_sequence<> seq;
+        uint32_t prev = 0;
+
+        bench::timer t;
+        for (uint32_t i = 0; i < count; ++i) {
+            prev = gen(r, i, prev);
+            seq.push_back(prev);
+            list.push_back(prev);
+        }
+        bench::report("build both (per value)", t.elapsed_ns(), count);
+        const size_t raw_bytes = list.capacity() * sizeof(uint32_t);
+        bench::report_bytes("array_list memory", raw_bytes);
+        bench::report_bytes("packed_sequence memory, growing", seq.memory_usage());
+        seq.shrink();
+        bench::report_bytes("packed_sequence memory, shrunk", seq.memory_usage());
+        printf("%-40s %14.2f\n", "compression ratio", static_cast<double>(raw_bytes) / seq.memory_usage());
+        printf("%-40s %14.2f\n", "bits per value",
+               8.0 * static_cast<double>(seq.memory_usage()) / count);
+
+        uint32_t *out = create<uint32_t[]>(count);
+        t.reset();
+        for (uint32_t k = 0; k < rounds; ++k) {
+            seq.decode(out);
+            bench::do_not_optimize(out[k]);
+        }
+        double ns = t.elapsed_ns();
+        bench::report("packed decode (per value)", ns, static_cast<size_t>(count) * rounds);
+        printf("%-40s %14.2f\n", "packed decode GB/s", static_cast<double>(count) * rounds * 4 / ns);
+
+        t.reset();
+        uint64_t sum = 0;
+        for (uint32_t k = 0; k < rounds; ++k) {
+            for (packed_sequence<>::const_iterator it = seq.begin(); it != seq.end(); ++it) {
+                sum += *it;
+            }
+        }
+        ns = t.elapsed_ns();
+        bench::report("packed iterate + sum (per value)", ns, static_cast<size_t>(count) * rounds);
+
+        t.reset();
+        uint64_t raw_sum = 0;
+        for (uint32_t k = 0; k < rounds; ++k) {
+            const uint32_t *data = list.data();
+            for (uint32_t i = 0; i < count; ++i) {
+                raw_sum += data[i];
+            }
+        }
+        ns = t.elapsed_ns();
+        bench::report("array_list sum (per value)", ns, static_cast<size_t>(count) * rounds);
+        printf("%-40s %14.2f\n", "array_list read GB/s", static_cast<double>(count) * rounds * 4 / ns);
+        if (sum != raw_sum) {
+            printf("mismatch\n");
+        }
+
+        const uint32_t probes = 1 << 16;
+        t.reset();
+        uint32_t acc = 0;
+        for (uint32_t i = 0; i < probes; ++i) {
+            acc += seq[static_cast<size_t>(r.next(count))];
+        }
+        bench::report("packed random at", t.elapsed_ns(), probes);
+        bench::do_not_optimize(acc);
+
+        if (sorted) {
+            const uint32_t lo = list[0];
+            const uint32_t span = list[count - 1] - lo;
+            t.reset();
+            size_t found = 0;
+            for (uint32_t i = 0; i < probes; ++i) {
+                found += seq.lower_bound(lo + static_cast<uint32_t>(r.next(span)));
+            }
+            bench::report("packed lower_bound", t.elapsed_ns(), probes);
+            t.reset();
+            for (uint32_t i = 0; i < probes; ++i) {
+                const uint32_t v = lo + static_cast<uint32_t>(r.next(span));
+                size_t first = 0;
+                size_t n = count;
+                while (n > 0) {
+                    const size_t step = n / 2;
+                    if (list[first + step] < v) {
+                        first += step + 1;
+                        n -= step + 1;
+                    } else {
+                        n = step;
+                    }
+                }
+                found += first;
+            }
+            bench::report("array_list binary search", t.elapsed_ns(), probes);
+            bench::do_not_optimize(found);
+        }
+        destroy<uint32_t[]>(out);
+    }
+
+}
+
+int main() {
+    run("timestamps, 4M values", timestamps, true);
+    run("slow counter, 4M values", counter, false);
+    run("random, 4M values", random_values, false);
+    return 0;
+}
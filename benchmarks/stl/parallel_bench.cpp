@@ -0,0 +1,131 @@
+/**
+ * @file parallel_bench.cpp
+ * @brief Scaling of the parallel algorithms with the team size.
+ *
+ * Reduce, inclusive scan, compaction, and histogram run over an array
+ * list of sixteen million samples with a sequential loop and then with
+ * teams of one thread up to twice the hardware threads. A team of one
+ * runs the blocked algorithm inline, which shows its cost over the
+ * plain loop.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <string.h>
+#include <thread>
+
+#include <wlib/stl/ArrayList.h>
+#include <wlib/stl/Parallel.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const uint32_t count = 1 << 24;
+    const uint32_t rounds = 8;
+    const size_t num_bins = 256;
+
+    struct data {
+        array_list<int32_t> in;
+        array_list<int32_t> out;
+        uint32_t bins[num_bins];
+
+        data()
+                : in(count),
+                  out(count) {
+            bench::rng r;
+            for (uint32_t i = 0; i < count; ++i) {
+                in.push_back(static_cast<int32_t>(r.next(2000)) - 1000);
+                out.push_back(0);
+            }
+            memset(bins, 0, sizeof(bins));
+        }
+    };
+
+    // functors rather than function pointers, so that calls inline
+    auto add = [](int32_t a, int32_t b) { return a + b; };
+    auto is_positive = [](int32_t v) { return v > 0; };
+    auto bin_of = [](int32_t v) { return static_cast<size_t>(v + 1000) >> 3; };
+
+    template<typename Kernel>
+    void run(const char *name, data &d, Kernel k) {
+        bench::timer t;
+        for (uint32_t p = 0; p < rounds; ++p) {
+            k(d);
+        }
+        bench::report(name, t.elapsed_ns(), static_cast<size_t>(rounds) * count);
+    }
+
+    void run_sequential(data &d) {
+        bench::header("sequential loops (per element)");
+        run("reduce", d, [](data &d) {
+            int32_t sum = 0;
+            for (size_t i = 0; i < count; ++i) {
+                sum += d.in[i];
+            }
+            bench::do_not_optimize(sum);
+        });
+        run("inclusive scan", d, [](data &d) {
+            int32_t sum = 0;
+            for (size_t i = 0; i < count; ++i) {
+                sum += d.in[i];
+                d.out[i] = sum;
+            }
+            bench::do_not_optimize(d.out[count - 1]);
+        });
+        run("compact", d, [](data &d) {
+            size_t n = 0;
+            for (size_t i = 0; i < count; ++i) {
+                if (is_positive(d.in[i])) {
+                    d.out[n++] = d.in[i];
+                }
+            }
+            bench::do_not_optimize(n);
+        });
+        run("histogram", d, [](data &d) {
+            for (size_t i = 0; i < count; ++i) {
+                ++d.bins[bin_of(d.in[i])];
+            }
+            bench::do_not_optimize(d.bins[0]);
+        });
+    }
+
+    void run_team(data &d, size_t threads) {
+        char title[64];
+        snprintf(title, sizeof(title), "team of %zu (per element)", threads);
+        bench::header(title);
+        thread_team team(threads);
+        run("parallel_reduce", d, [&team](data &d) {
+            bench::do_not_optimize(parallel_reduce(team, d.in.as_span(), 0, add));
+        });
+        run("parallel_inclusive_scan", d, [&team](data &d) {
+            parallel_inclusive_scan(team, d.in.as_span(), d.out.as_span(), 0, add);
+            bench::do_not_optimize(d.out[count - 1]);
+        });
+        run("parallel_compact", d, [&team](data &d) {
+            bench::do_not_optimize(parallel_compact(team, d.in.as_span(), d.out.as_span(), is_positive));
+        });
+        run("parallel_histogram", d, [&team](data &d) {
+            parallel_histogram(team, d.in.as_span(), make_span(d.bins), bin_of);
+            bench::do_not_optimize(d.bins[0]);
+        });
+    }
+
+}
+
+int main() {
+    data d;
+    run_sequential(d);
+    size_t hardware = std::thread::hardware_concurrency();
+    if (hardware == 0) {
+        hardware = 1;
+    }
+    for (size_t threads = 1; threads <= 2 * hardware; threads *= 2) {
+        run_team(d, threads);
+    }
+    return 0;
+}
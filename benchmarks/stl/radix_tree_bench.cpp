@@ -0,0 +1,196 @@
+/**
+ * @file radix_tree_bench.cpp
+ * @brief Compare radix_tree against hash_map and tree_map for topic routing.
+ *
+ * Topics have the form "site/<s>/dev/<d>/<channel>". Exact lookups
+ * resolve a full topic, longest-prefix lookups find the most specific
+ * route for a topic among routes registered at every level, and prefix
+ * enumeration visits every topic of one device. The maps have no
+ * prefix queries, so they probe each truncation of the topic at a
+ * separator and scan all entries for an enumeration.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <wlib/stl/HashMap.h>
+#include <wlib/stl/RadixTree.h>
+#include <wlib/stl/TreeMap.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const uint32_t sites = 16;
+    const uint32_t devices = 32;
+    const uint32_t lookups = 1 << 18;
+
+    const char *const channels[] = {
+            "temperature", "humidity", "pressure", "battery",
+            "status", "firmware", "rssi", "uptime"
+    };
+    const uint32_t channel_count = sizeof(channels) / sizeof(channels[0]);
+    const uint32_t topic_count = sites * devices * channel_count;
+
+    char topics[topic_count][64];
+    uint32_t queries[lookups];
+
+    void make_topics() {
+        uint32_t n = 0;
+        for (uint32_t s = 0; s < sites; ++s) {
+            for (uint32_t d = 0; d < devices; ++d) {
+                for (uint32_t c = 0; c < channel_count; ++c) {
+                    snprintf(topics[n++], sizeof(topics[0]), "site/%u/dev/%u/%s", s, d, channels[c]);
+                }
+            }
+        }
+        bench::rng r;
+        for (uint32_t i = 0; i < lookups; ++i) {
+            queries[i] = r.next(topic_count);
+        }
+    }
+
+    template<typename Map>
+    void fill_map(Map &map) {
+        for (uint32_t i = 0; i < topic_count; ++i) {
+            map[dynamic_string(topics[i])] = i;
+        }
+    }
+
+    /**
+     * Register routes for every site, for every fourth device, and for
+     * the status channel of every device.
+     */
+    template<typename Insert>
+    void add_routes(Insert &&insert) {
+        char route[64];
+        for (uint32_t s = 0; s < sites; ++s) {
+            snprintf(route, sizeof(route), "site/%u", s);
+            insert(route, s);
+            for (uint32_t d = 0; d < devices; d += 4) {
+                snprintf(route, sizeof(route), "site/%u/dev/%u", s, d);
+                insert(route, d);
+            }
+            for (uint32_t d = 0; d < devices; ++d) {
+                snprintf(route, sizeof(route), "site/%u/dev/%u/status", s, d);
+                insert(route, d + 1000);
+            }
+        }
+    }
+
+    template<typename Map>
+    uint32_t map_longest_prefix(Map &map, const char *topic) {
+        for (size_t len = strlen(topic); len > 0; --len) {
+            if (topic[len] == '/' || topic[len] == '\0') {
+                typename Map::iterator it = map.find(dynamic_string(topic, len));
+                if (it != map.end()) {
+                    return *it;
+                }
+            }
+        }
+        return 0;
+    }
+
+    template<typename Map>
+    uint32_t map_enumerate(Map &map, const char *prefix) {
+        const size_t len = strlen(prefix);
+        uint32_t acc = 0;
+        for (typename Map::iterator it = map.begin(); it != map.end(); ++it) {
+            if (strncmp(it.key().c_str(), prefix, len) == 0) {
+                acc += *it;
+            }
+        }
+        return acc;
+    }
+
+    template<typename Map>
+    void run_map(const char *name) {
+        char label[64];
+        const size_t base = bench::live_bytes();
+        Map map;
+        fill_map(map);
+        snprintf(label, sizeof(label), "%s memory", name);
+        bench::report_bytes(label, bench::live_bytes() - base);
+
+        bench::timer t;
+        uint32_t acc = 0;
+        for (uint32_t i = 0; i < lookups; ++i) {
+            acc += *map.find(dynamic_string(topics[queries[i]]));
+        }
+        snprintf(label, sizeof(label), "%s find", name);
+        bench::report(label, t.elapsed_ns(), lookups);
+
+        Map routes;
+        add_routes([&routes](const char *route, uint32_t v) {
+            routes[dynamic_string(route)] = v;
+        });
+        t.reset();
+        for (uint32_t i = 0; i < lookups; ++i) {
+            acc += map_longest_prefix(routes, topics[queries[i]]);
+        }
+        snprintf(label, sizeof(label), "%s longest prefix", name);
+        bench::report(label, t.elapsed_ns(), lookups);
+
+        char prefix[32];
+        const uint32_t scans = 256;
+        t.reset();
+        for (uint32_t i = 0; i < scans; ++i) {
+            snprintf(prefix, sizeof(prefix), "site/%u/dev/%u/", i % sites, i % devices);
+            acc += map_enumerate(map, prefix);
+        }
+        snprintf(label, sizeof(label), "%s enumerate device", name);
+        bench::report(label, t.elapsed_ns(), scans);
+        bench::do_not_optimize(acc);
+    }
+
+    void run_tree() {
+        const size_t base = bench::live_bytes();
+        radix_tree<uint32_t> tree;
+        for (uint32_t i = 0; i < topic_count; ++i) {
+            tree.insert(topics[i], i);
+        }
+        bench::report_bytes("radix_tree memory", bench::live_bytes() - base);
+
+        bench::timer t;
+        uint32_t acc = 0;
+        for (uint32_t i = 0; i < lookups; ++i) {
+            acc += *tree.find(topics[queries[i]]);
+        }
+        bench::report("radix_tree find", t.elapsed_ns(), lookups);
+
+        radix_tree<uint32_t> routes;
+        add_routes([&routes](const char *route, uint32_t v) {
+            routes.insert(route, v);
+        });
+        t.reset();
+        for (uint32_t i = 0; i < lookups; ++i) {
+            acc += *routes.longest_prefix(topics[queries[i]]);
+        }
+        bench::report("radix_tree longest prefix", t.elapsed_ns(), lookups);
+
+        char prefix[32];
+        const uint32_t scans = 256;
+        t.reset();
+        for (uint32_t i = 0; i < scans; ++i) {
+            snprintf(prefix, sizeof(prefix), "site/%u/dev/%u/", i % sites, i % devices);
+            tree.for_each_prefix(prefix, [&acc](const char *, size_t, uint32_t &v) {
+                acc += v;
+            });
+        }
+        bench::report("radix_tree enumerate device", t.elapsed_ns(), scans);
+        bench::do_not_optimize(acc);
+    }
+
+}
+
+int main() {
+    make_topics();
+    bench::header("topic routing, 4096 topics");
+    run_tree();
+    run_map<hash_map<dynamic_string, uint32_t>>("hash_map");
+    run_map<tree_map<dynamic_string, uint32_t>>("tree_map");
+    return 0;
+}
@@ -0,0 +1,153 @@
+/**
+ * @file range_bench.cpp
+ * @brief Compare range adaptor pipelines with loops and intermediates.
+ *
+ * The sum of the squares of the even samples is computed with a hand
+ * written loop, with a filter and transform pipeline, and by filling
+ * an array list of the even samples and another of their squares, as
+ * callers do today. Block sums over chunks are compared the same way.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <wlib/stl/ArrayList.h>
+#include <wlib/stl/LinkedList.h>
+#include <wlib/stl/Range.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const uint32_t count = 1 << 14;
+    const uint32_t rounds = 256;
+    const size_t block = 16;
+
+    bool is_even(int32_t v) {
+        return (v & 1) == 0;
+    }
+
+    int32_t square(int32_t v) {
+        return v * v;
+    }
+
+    template<typename Container>
+    int32_t sum_loop(const Container &c) {
+        int32_t sum = 0;
+        for (auto it = c.begin(); it != c.end(); ++it) {
+            if (is_even(*it)) {
+                sum += square(*it);
+            }
+        }
+        return sum;
+    }
+
+    template<typename Container>
+    int32_t sum_pipeline(const Container &c) {
+        int32_t sum = 0;
+        auto evens = filtered([](int32_t v) { return is_even(v); });
+        auto squares = transformed([](int32_t v) { return square(v); });
+        for (int32_t v : make_range(c) | evens | squares) {
+            sum += v;
+        }
+        return sum;
+    }
+
+    template<typename Container>
+    int32_t sum_materialized(const Container &c) {
+        array_list<int32_t> evens;
+        for (auto it = c.begin(); it != c.end(); ++it) {
+            if (is_even(*it)) {
+                evens.push_back(*it);
+            }
+        }
+        array_list<int32_t> squares(evens.size());
+        for (size_t i = 0; i < evens.size(); ++i) {
+            squares.push_back(square(evens[i]));
+        }
+        int32_t sum = 0;
+        for (size_t i = 0; i < squares.size(); ++i) {
+            sum += squares[i];
+        }
+        return sum;
+    }
+
+    int32_t blocks_loop(const array_list<int32_t> &list) {
+        int32_t best = 0;
+        for (size_t i = 0; i < list.size(); i += block) {
+            int32_t sum = 0;
+            for (size_t j = i; j < i + block && j < list.size(); ++j) {
+                sum += list[j];
+            }
+            best = sum > best ? sum : best;
+        }
+        return best;
+    }
+
+    int32_t blocks_iterators(const array_list<int32_t> &list) {
+        int32_t best = 0;
+        auto it = list.begin();
+        while (it != list.end()) {
+            int32_t sum = 0;
+            for (size_t j = 0; j < block && it != list.end(); ++j, ++it) {
+                sum += *it;
+            }
+            best = sum > best ? sum : best;
+        }
+        return best;
+    }
+
+    int32_t blocks_chunked(const array_list<int32_t> &list) {
+        int32_t best = 0;
+        for (auto chunk : make_range(list) | chunked(block)) {
+            int32_t sum = 0;
+            for (int32_t v : chunk) {
+                sum += v;
+            }
+            best = sum > best ? sum : best;
+        }
+        return best;
+    }
+
+    template<typename Container, typename Sum>
+    void run(const char *name, const Container &c, Sum sum) {
+        int32_t acc = 0;
+        bench::timer t;
+        for (uint32_t p = 0; p < rounds; ++p) {
+            acc += sum(c);
+            bench::do_not_optimize(acc);
+        }
+        bench::report(name, t.elapsed_ns(), static_cast<size_t>(rounds) * count);
+    }
+
+}
+
+int main() {
+    array_list<int32_t> list(count);
+    linked_list<int32_t> linked;
+    bench::rng r;
+    for (uint32_t i = 0; i < count; ++i) {
+        int32_t v = static_cast<int32_t>(r.next(1000));
+        list.push_back(v);
+        linked.push_back(v);
+    }
+
+    bench::header("sum of squares of evens, array_list (per element)");
+    run("hand written loop", list, sum_loop<array_list<int32_t>>);
+    run("filtered | transformed", list, sum_pipeline<array_list<int32_t>>);
+    run("materialized intermediates", list, sum_materialized<array_list<int32_t>>);
+
+    bench::header("sum of squares of evens, linked_list (per element)");
+    run("hand written loop", linked, sum_loop<linked_list<int32_t>>);
+    run("filtered | transformed", linked, sum_pipeline<linked_list<int32_t>>);
+    run("materialized intermediates", linked, sum_materialized<linked_list<int32_t>>);
+
+    bench::header("largest block sum, array_list (per element)");
+    run("nested index loops", list, blocks_loop);
+    run("nested iterator loops", list, blocks_iterators);
+    run("chunked", list, blocks_chunked);
+    return 0;
+}
@@ -0,0 +1,135 @@
+/**
+ * @file range_query_bench.cpp
+ * @brief Compare Fenwick and segment trees with scans of array lists.
+ *
+ * Event counts per time bucket take point increments and range sums,
+ * answered by scanning an array list slice and by a Fenwick tree.
+ * Sensor temperatures take range offsets and range maximums, answered
+ * by updating and scanning a slice and by a lazy segment tree. Ranges
+ * are random, so a scan reads a third of the array on average.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <wlib/stl/ArrayList.h>
+#include <wlib/stl/FenwickTree.h>
+#include <wlib/stl/SegmentTree.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const size_t ops = 1 << 16;
+    const size_t sizes[] = {256, 4096, 65536};
+
+    struct query {
+        uint32_t begin;
+        uint32_t end;
+        int32_t value;
+    };
+
+    void make_queries(array_list<query> &queries, size_t n) {
+        bench::rng r;
+        queries.clear();
+        for (size_t i = 0; i < ops; ++i) {
+            uint32_t a = r.next(static_cast<uint32_t>(n));
+            uint32_t b = r.next(static_cast<uint32_t>(n));
+            if (b < a) {
+                uint32_t t = a;
+                a = b;
+                b = t;
+            }
+            queries.push_back(query{a, b + 1, static_cast<int32_t>(r.next(21)) - 10});
+        }
+    }
+
+    void bench_counts(size_t n, const array_list<query> &queries) {
+        array_list<uint32_t> counts(n);
+        for (size_t i = 0; i < n; ++i) {
+            counts.push_back(0);
+        }
+        fenwick_tree<uint32_t> tree(n);
+
+        // one increment of the bucket at the range start, then one sum
+        bench::timer t;
+        uint32_t acc = 0;
+        for (size_t i = 0; i < ops; ++i) {
+            const query &q = queries[i];
+            ++counts[q.begin];
+            uint32_t sum = 0;
+            for (uint32_t k = q.begin; k < q.end; ++k) {
+                sum += counts[k];
+            }
+            acc += sum;
+        }
+        bench::do_not_optimize(acc);
+        bench::report("array_list scan", t.elapsed_ns(), ops);
+
+        t.reset();
+        acc = 0;
+        for (size_t i = 0; i < ops; ++i) {
+            const query &q = queries[i];
+            tree.add(q.begin, 1);
+            acc += tree.range(q.begin, q.end);
+        }
+        bench::do_not_optimize(acc);
+        bench::report("fenwick_tree", t.elapsed_ns(), ops);
+    }
+
+    void bench_temperatures(size_t n, const array_list<query> &queries) {
+        array_list<int32_t> temps(n);
+        for (size_t i = 0; i < n; ++i) {
+            temps.push_back(static_cast<int32_t>(i % 50));
+        }
+        segment_tree<int32_t, max_monoid<int32_t>> tree(temps.as_span());
+
+        // one offset of a range, then one maximum of the next range
+        bench::timer t;
+        int32_t acc = 0;
+        for (size_t i = 0; i + 1 < ops; ++i) {
+            const query &u = queries[i];
+            for (uint32_t k = u.begin; k < u.end; ++k) {
+                temps[k] += u.value;
+            }
+            const query &q = queries[i + 1];
+            int32_t best = temps[q.begin];
+            for (uint32_t k = q.begin + 1; k < q.end; ++k) {
+                best = temps[k] > best ? temps[k] : best;
+            }
+            acc += best;
+        }
+        bench::do_not_optimize(acc);
+        bench::report("array_list scan", t.elapsed_ns(), ops);
+
+        t.reset();
+        acc = 0;
+        for (size_t i = 0; i + 1 < ops; ++i) {
+            const query &u = queries[i];
+            tree.apply(u.begin, u.end, u.value);
+            const query &q = queries[i + 1];
+            acc += tree.query(q.begin, q.end);
+        }
+        bench::do_not_optimize(acc);
+        bench::report("segment_tree", t.elapsed_ns(), ops);
+    }
+
+}
+
+int main() {
+    array_list<query> queries(ops);
+    char title[96];
+    for (size_t n : sizes) {
+        make_queries(queries, n);
+        snprintf(title, sizeof(title), "%zu buckets, increment and range sum (per pair)", n);
+        bench::header(title);
+        bench_counts(n, queries);
+        snprintf(title, sizeof(title), "%zu sensors, range add and range max (per pair)", n);
+        bench::header(title);
+        bench_temperatures(n, queries);
+    }
+    return 0;
+}
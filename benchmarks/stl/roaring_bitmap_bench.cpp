@@ -0,0 +1,213 @@
+/**
+ * @file roaring_bitmap_bench.cpp
+ * @brief Compare roaring_bitmap against hash_set and flat bitmaps.
+ *
+ * Sets of different densities are drawn from a 2^22 value domain,
+ * plus a clustered set made of long intervals. The flat bitmap is a
+ * plain word array over the whole domain, which is what a bit_set
+ * would be if it could hold that many bits. bit_set is indexed by 16
+ * bits and is only compared on a small domain.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <string.h>
+
+#include <wlib/stl/Bitset.h>
+#include <wlib/stl/HashSet.h>
+#include <wlib/stl/RoaringBitmap.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const uint32_t domain = 1 << 22;
+    const uint32_t flat_words = domain / 64;
+    const uint32_t probes = 1 << 20;
+
+    typedef hash_set<uint32_t, hash<uint32_t, uint32_t>> int_set;
+
+    /**
+     * Fill a roaring bitmap and a flat bitmap with the same values.
+     * Clustered sets are built from runs of 1000 to 5000 values.
+     */
+    void generate(roaring_bitmap &set, uint64_t *flat, uint32_t per_million, bool clustered, bench::rng &r) {
+        memset(flat, 0, flat_words * sizeof(uint64_t));
+        if (clustered) {
+            uint32_t v = r.next(5000);
+            while (v < domain) {
+                uint32_t last = v + 1000 + r.next(4000);
+                last = last < domain ? last : domain - 1;
+                set.add_range(v, last);
+                for (uint32_t x = v; x <= last; ++x) {
+                    flat[x >> 6] |= static_cast<uint64_t>(1) << (x & 63);
+                }
+                v = last + 2 + r.next(20000);
+            }
+            return;
+        }
+        for (uint32_t v = 0; v < domain; ++v) {
+            if (r.next(1000000) < per_million) {
+                set.add(v);
+                flat[v >> 6] |= static_cast<uint64_t>(1) << (v & 63);
+            }
+        }
+    }
+
+    void run(const char *name, uint32_t per_million, bool clustered) {
+        bench::header(name);
+        bench::rng r;
+        uint64_t *flat_a = create<uint64_t[]>(flat_words);
+        uint64_t *flat_b = create<uint64_t[]>(flat_words);
+        uint64_t *flat_out = create<uint64_t[]>(flat_words);
+
+        size_t before = bench::live_bytes();
+        roaring_bitmap a;
+        bench::timer t;
+        generate(a, flat_a, per_million, clustered, r);
+        const double build_ns = t.elapsed_ns();
+        roaring_bitmap b;
+        generate(b, flat_b, per_million, clustered, r);
+        const size_t card = a.cardinality();
+        printf("%-40s %14zu\n", "cardinality", card);
+        bench::report("roaring build + flat build (per value)", build_ns, card);
+        bench::report_bytes("roaring memory", a.memory_usage());
+        a.run_optimize();
+        b.run_optimize();
+        bench::report_bytes("roaring memory, run optimized", a.memory_usage());
+        bench::report_bytes("flat bitmap memory", flat_words * sizeof(uint64_t));
+        bench::do_not_optimize(before);
+
+        int_set hs(card * 2);
+        before = bench::live_bytes();
+        t.reset();
+        for (roaring_bitmap::iterator it = a.begin(); it != a.end(); ++it) {
+            hs.insert(*it);
+        }
+        bench::report("hash_set insert", t.elapsed_ns(), card);
+        bench::report_bytes("hash_set memory", bench::live_bytes() - before);
+
+        uint32_t *keys = create<uint32_t[]>(probes);
+        for (uint32_t i = 0; i < probes; ++i) {
+            keys[i] = r.next(domain);
+        }
+        size_t hits = 0;
+        t.reset();
+        for (uint32_t i = 0; i < probes; ++i) {
+            hits += a.contains(keys[i]);
+        }
+        bench::report("roaring contains", t.elapsed_ns(), probes);
+        t.reset();
+        for (uint32_t i = 0; i < probes; ++i) {
+            hits += hs.contains(keys[i]);
+        }
+        bench::report("hash_set contains", t.elapsed_ns(), probes);
+        t.reset();
+        for (uint32_t i = 0; i < probes; ++i) {
+            hits += (flat_a[keys[i] >> 6] >> (keys[i] & 63)) & 1;
+        }
+        bench::report("flat bitmap contains", t.elapsed_ns(), probes);
+        bench::do_not_optimize(hits);
+
+        t.reset();
+        roaring_bitmap u = a | b;
+        bench::report("roaring union", t.elapsed_ns(), 1);
+        t.reset();
+        roaring_bitmap n = a & b;
+        bench::report("roaring intersection", t.elapsed_ns(), 1);
+        t.reset();
+        roaring_bitmap d = a - b;
+        bench::report("roaring difference", t.elapsed_ns(), 1);
+        t.reset();
+        size_t flat_card = 0;
+        for (uint32_t w = 0; w < flat_words; ++w) {
+            flat_out[w] = flat_a[w] & flat_b[w];
+            flat_card += static_cast<size_t>(__builtin_popcountll(flat_out[w]));
+        }
+        bench::report("flat bitmap intersection", t.elapsed_ns(), 1);
+        t.reset();
+        size_t hs_card = 0;
+        for (roaring_bitmap::iterator it = b.begin(); it != b.end(); ++it) {
+            hs_card += hs.contains(*it);
+        }
+        bench::report("hash_set intersection by probing", t.elapsed_ns(), 1);
+        if (flat_card != n.cardinality() || hs_card != n.cardinality()) {
+            printf("mismatch\n");
+        }
+        bench::do_not_optimize(u.cardinality() + d.cardinality());
+
+        t.reset();
+        uint64_t sum = 0;
+        for (roaring_bitmap::iterator it = a.begin(); it != a.end(); ++it) {
+            sum += *it;
+        }
+        bench::report("roaring iterate (per value)", t.elapsed_ns(), card);
+        t.reset();
+        for (uint32_t w = 0; w < flat_words; ++w) {
+            uint64_t bits = flat_a[w];
+            while (bits != 0) {
+                sum += w * 64 + static_cast<uint32_t>(__builtin_ctzll(bits));
+                bits &= bits - 1;
+            }
+        }
+        bench::report("flat bitmap iterate (per value)", t.elapsed_ns(), card);
+        bench::do_not_optimize(sum);
+
+        const size_t bytes = a.serialized_size();
+        uint8_t *buf = create<uint8_t[]>(bytes);
+        t.reset();
+        a.serialize(buf);
+        roaring_bitmap copy;
+        copy.deserialize(buf, bytes);
+        bench::report("serialize + deserialize", t.elapsed_ns(), 1);
+        bench::report_bytes("serialized size", bytes);
+
+        destroy<uint8_t[]>(buf);
+        destroy<uint32_t[]>(keys);
+        destroy<uint64_t[]>(flat_a);
+        destroy<uint64_t[]>(flat_b);
+        destroy<uint64_t[]>(flat_out);
+    }
+
+    void run_tiny() {
+        bench::header("255 value domain, half full");
+        bench::rng r;
+        bit_set<255> bits;
+        roaring_bitmap set;
+        for (uint16_t v = 0; v < 255; ++v) {
+            if (r.next(2) == 0) {
+                bits.set(v);
+                set.add(v);
+            }
+        }
+        bench::report_bytes("bit_set memory", sizeof(bits));
+        bench::report_bytes("roaring memory", set.memory_usage());
+        size_t hits = 0;
+        bench::timer t;
+        for (uint32_t i = 0; i < probes; ++i) {
+            hits += bits.test(static_cast<uint16_t>(i % 255));
+        }
+        bench::report("bit_set test", t.elapsed_ns(), probes);
+        t.reset();
+        for (uint32_t i = 0; i < probes; ++i) {
+            hits += set.contains(i % 255);
+        }
+        bench::report("roaring contains", t.elapsed_ns(), probes);
+        bench::do_not_optimize(hits);
+    }
+
+}
+
+int main() {
+    run("0.1% density", 1000, false);
+    run("1% density", 10000, false);
+    run("10% density", 100000, false);
+    run("50% density", 500000, false);
+    run("clustered intervals", 0, true);
+    run_tiny();
+    return 0;
+}
@@ -0,0 +1,127 @@
+/**
+ * @file simd_bench.cpp
+ * @brief Compare the sample kernels at each instruction set level.
+ *
+ * Each kernel runs over an array list of float and of int16_t sensor
+ * samples, small enough to stay in cache, with the scalar loops and
+ * then with every vector level the processor supports.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <wlib/stl/Array2D.h>
+#include <wlib/stl/ArrayList.h>
+#include <wlib/stl/Simd.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const uint32_t count = 1 << 13;
+    const uint32_t rounds = 4096;
+    const size_t num_bins = 64;
+
+    const char *level_names[] = {"scalar", "sse2", "avx2"};
+
+    struct samples {
+        array_list<float> f;
+        array_list<int16_t> s;
+        array_list<float> y;
+        array_list<int32_t> counts;
+        array2d<uint32_t> bins;
+
+        samples()
+                : f(count),
+                  s(count),
+                  y(count),
+                  counts(count),
+                  bins(1, num_bins) {
+            bench::rng r;
+            for (uint32_t i = 0; i < count; ++i) {
+                f.push_back(static_cast<float>(r.next(20000)) / 100.0f - 100.0f);
+                s.push_back(static_cast<int16_t>(static_cast<int32_t>(r.next(8192)) - 4096));
+                y.push_back(0.0f);
+                counts.push_back(static_cast<int32_t>(r.next(16)));
+            }
+        }
+    };
+
+    template<typename Kernel>
+    void run(const char *kernel, simd_level level, samples &data, Kernel k) {
+        char name[64];
+        snprintf(name, sizeof(name), "%s, %s", kernel, level_names[static_cast<int>(level)]);
+        bench::timer t;
+        for (uint32_t p = 0; p < rounds; ++p) {
+            k(data, p);
+        }
+        bench::report(name, t.elapsed_ns(), static_cast<size_t>(rounds) * count);
+    }
+
+    void run_level(simd_level level, samples &data) {
+        run("sum float", level, data, [](samples &d, uint32_t) {
+            bench::do_not_optimize(simd_sum(d.f.as_span()));
+        });
+        run("sum int16", level, data, [](samples &d, uint32_t) {
+            bench::do_not_optimize(simd_sum(d.s.as_span()));
+        });
+        run("minmax float", level, data, [](samples &d, uint32_t) {
+            bench::do_not_optimize(simd_minmax(d.f.as_span()).max);
+        });
+        run("minmax int16", level, data, [](samples &d, uint32_t) {
+            bench::do_not_optimize(simd_minmax(d.s.as_span()).max);
+        });
+        run("find float (absent)", level, data, [](samples &d, uint32_t) {
+            bench::do_not_optimize(simd_find(d.f.as_span(), 1000.0f));
+        });
+        run("find int16 (absent)", level, data, [](samples &d, uint32_t) {
+            bench::do_not_optimize(simd_find(d.s.as_span(), static_cast<int16_t>(5000)));
+        });
+        run("count float > threshold", level, data, [](samples &d, uint32_t) {
+            bench::do_not_optimize(simd_count_greater(d.f.as_span(), 25.0f));
+        });
+        run("count int16 > threshold", level, data, [](samples &d, uint32_t) {
+            bench::do_not_optimize(simd_count_greater(d.s.as_span(), static_cast<int16_t>(1000)));
+        });
+        run("clamp float", level, data, [](samples &d, uint32_t) {
+            simd_clamp(d.f.as_span(), -90.0f, 90.0f);
+            bench::do_not_optimize(d.f[0]);
+        });
+        run("clamp int16", level, data, [](samples &d, uint32_t) {
+            simd_clamp(d.s.as_span(), static_cast<int16_t>(-4000), static_cast<int16_t>(4000));
+            bench::do_not_optimize(d.s[0]);
+        });
+        run("saxpy", level, data, [](samples &d, uint32_t p) {
+            simd_saxpy((p & 1) ? 0.5f : -0.5f, d.f.as_span(), d.y.as_span());
+            bench::do_not_optimize(d.y[0]);
+        });
+        run("prefix sum int32", level, data, [](samples &d, uint32_t) {
+            simd_prefix_sum(d.counts.as_span());
+            bench::do_not_optimize(d.counts[count - 1]);
+        });
+        run("prefix sum float", level, data, [](samples &d, uint32_t) {
+            simd_prefix_sum(d.y.as_span());
+            bench::do_not_optimize(d.y[count - 1]);
+        });
+        run("histogram int16", level, data, [](samples &d, uint32_t) {
+            simd_histogram(d.s.as_span(), -4096, 7, d.bins.row(0));
+            bench::do_not_optimize(d.bins[0][0]);
+        });
+    }
+
+}
+
+int main() {
+    samples data;
+    const simd_level best = simd_supported();
+    for (int level = 0; level <= static_cast<int>(best); ++level) {
+        char title[64];
+        snprintf(title, sizeof(title), "%s kernels (per element)", level_names[level]);
+        bench::header(title);
+        run_level(simd_select(static_cast<simd_level>(level)), data);
+    }
+    return 0;
+}
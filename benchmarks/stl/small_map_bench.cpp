@@ -0,0 +1,95 @@
+/**
+ * @file small_map_bench.cpp
+ * @brief Compare small_map against hash_map for short-lived small maps.
+ *
+ * Each cycle builds a map of message attributes, queries every key
+ * once plus as many absent keys, and destroys the map, as is done when
+ * decoding one message. Entry counts past the inline capacity show
+ * the cost of promotion.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <wlib/stl/HashMap.h>
+#include <wlib/stl/SmallMap.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const uint32_t cycles = 1 << 18;
+    const uint32_t key_sets = 256;
+    const uint32_t max_entries = 32;
+
+    uint16_t keys[key_sets][2 * max_entries];
+
+    /**
+     * Draw distinct attribute IDs for each cycle; the second half of
+     * each row holds keys that are never inserted.
+     */
+    void make_keys() {
+        bench::rng r;
+        for (uint32_t s = 0; s < key_sets; ++s) {
+            for (uint32_t i = 0; i < 2 * max_entries; ++i) {
+                uint16_t k;
+                bool fresh;
+                do {
+                    k = static_cast<uint16_t>(r.next(1024));
+                    fresh = true;
+                    for (uint32_t j = 0; j < i; ++j) {
+                        fresh = fresh && keys[s][j] != k;
+                    }
+                } while (!fresh);
+                keys[s][i] = k;
+            }
+        }
+    }
+
+    template<typename Map>
+    uint32_t cycle(const uint16_t *row, uint32_t entries) {
+        Map map;
+        for (uint32_t i = 0; i < entries; ++i) {
+            map.insert(row[i], static_cast<uint32_t>(i));
+        }
+        uint32_t found = 0;
+        for (uint32_t i = 0; i < 2 * entries; ++i) {
+            typename Map::iterator it = map.find(row[i]);
+            if (it != map.end()) {
+                found += *it + 1;
+            }
+        }
+        return found;
+    }
+
+    template<typename Map>
+    void run(const char *name, uint32_t entries) {
+        char label[64];
+        bench::reset_counters();
+        bench::timer t;
+        uint32_t acc = 0;
+        for (uint32_t c = 0; c < cycles; ++c) {
+            acc += cycle<Map>(keys[c % key_sets], entries);
+        }
+        const double ns = t.elapsed_ns();
+        bench::do_not_optimize(acc);
+        snprintf(label, sizeof(label), "%s, %u entries", name, entries);
+        bench::report(label, ns, cycles);
+        printf("%-40s %14.2f\n", "  allocations per cycle", static_cast<double>(bench::alloc_count()) / cycles);
+    }
+
+}
+
+int main() {
+    make_keys();
+    bench::header("create, fill, query, destroy (per cycle)");
+    const uint32_t sizes[] = {1, 4, 8, 16, 32};
+    for (uint32_t entries : sizes) {
+        run<small_map<uint16_t, uint32_t>>("small_map<8>", entries);
+        run<hash_map<uint16_t, uint32_t>>("hash_map", entries);
+    }
+    return 0;
+}
@@ -0,0 +1,140 @@
+/**
+ * @file sort_strings_bench.cpp
+ * @brief Measure sorting and growing an array_list of dynamic_string.
+ *
+ * Station names are heap sorted, shuffled with swap, and pushed into
+ * a list that grows from a small capacity. The baseline wraps the
+ * string in a type without move operations, so every element that is
+ * moved around is copied instead, which is what the heap functions
+ * and the list growth did before. Allocations are reported per
+ * element.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <stdio.h>
+
+#include <wlib/stl/ArrayHeap.h>
+#include <wlib/strings/String.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const uint32_t count = 1 << 14;
+    const uint32_t rounds = 8;
+
+    char names[count][32];
+
+    /**
+     * A string that can only be copied.
+     */
+    struct copied_string {
+        dynamic_string str;
+
+        copied_string() = default;
+
+        copied_string(const copied_string &other)
+                : str(other.str) {
+        }
+
+        explicit copied_string(const char *s)
+                : str(s) {
+        }
+
+        copied_string &operator=(const copied_string &other) {
+            str = other.str;
+            return *this;
+        }
+
+        bool operator<(const copied_string &other) const {
+            return str < other.str;
+        }
+    };
+
+    void make_names() {
+        bench::rng r;
+        const char *const sites[] = {"kiruna", "svalbard", "inuvik", "mcmurdo", "santiago", "hartebeesthoek"};
+        for (uint32_t i = 0; i < count; ++i) {
+            snprintf(names[i], sizeof(names[i]), "%s-%05u", sites[r.next(6)], r.next(100000));
+        }
+    }
+
+    template<typename Str>
+    void fill(array_list<Str> &list) {
+        list.clear();
+        for (uint32_t i = 0; i < count; ++i) {
+            list.push_back(Str(names[i]));
+        }
+    }
+
+    void report_allocs(size_t allocs, size_t ops) {
+        printf("%-40s %14.2f\n", "  allocations per element",
+               static_cast<double>(allocs) / static_cast<double>(ops));
+    }
+
+    template<typename Str>
+    void run_sort(const char *name) {
+        array_list<Str> list(count);
+        double ns = 0;
+        size_t allocs = 0;
+        for (uint32_t p = 0; p < rounds; ++p) {
+            fill(list);
+            bench::reset_counters();
+            bench::timer t;
+            heap_sort(list);
+            ns += t.elapsed_ns();
+            allocs += bench::alloc_count();
+        }
+        bench::report(name, ns, rounds * count);
+        report_allocs(allocs, rounds * count);
+    }
+
+    template<typename Str>
+    void run_shuffle(const char *name) {
+        array_list<Str> list(count);
+        fill(list);
+        bench::rng r;
+        bench::reset_counters();
+        bench::timer t;
+        for (uint32_t p = 0; p < rounds; ++p) {
+            for (uint32_t i = count - 1; i > 0; --i) {
+                swap(list[i], list[r.next(i + 1)]);
+            }
+        }
+        bench::report(name, t.elapsed_ns(), rounds * count);
+        report_allocs(bench::alloc_count(), rounds * count);
+    }
+
+    template<typename Str>
+    void run_growth(const char *name) {
+        bench::reset_counters();
+        bench::timer t;
+        for (uint32_t p = 0; p < rounds; ++p) {
+            array_list<Str> list(4);
+            fill(list);
+            bench::do_not_optimize(list.size());
+        }
+        bench::report(name, t.elapsed_ns(), rounds * count);
+        report_allocs(bench::alloc_count(), rounds * count);
+    }
+
+}
+
+int main() {
+    make_names();
+    bench::header("heap sort array_list of strings (per element)");
+    run_sort<copied_string>("copied strings");
+    run_sort<dynamic_string>("dynamic_string");
+    bench::header("shuffle with swap (per swap)");
+    run_shuffle<copied_string>("copied strings");
+    run_shuffle<dynamic_string>("dynamic_string");
+    bench::header("push_back from capacity 4 (per element)");
+    run_growth<copied_string>("copied strings");
+    run_growth<dynamic_string>("dynamic_string");
+    return 0;
+}
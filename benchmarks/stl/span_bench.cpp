@@ -0,0 +1,127 @@
+/**
+ * @file span_bench.cpp
+ * @brief Compare array_list loops through iterators, at(), and spans.
+ *
+ * A list of samples is summed and scaled into a second list. The
+ * iterator and at() loops are what callers write today; the span
+ * loops walk the backing array directly, which the compiler can
+ * vectorize.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <wlib/stl/Algorithm.h>
+#include <wlib/stl/ArrayList.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const uint32_t count = 1 << 16;
+    const uint32_t rounds = 512;
+
+    template<typename T>
+    void fill_list(array_list<T> &list) {
+        bench::rng r;
+        list.clear();
+        for (uint32_t i = 0; i < count; ++i) {
+            list.push_back(static_cast<T>(r.next(1000)));
+        }
+    }
+
+    template<typename T>
+    T sum_iterators(const array_list<T> &list) {
+        T sum = 0;
+        for (auto it = list.begin(); it != list.end(); ++it) {
+            sum += *it;
+        }
+        return sum;
+    }
+
+    template<typename T>
+    T sum_at(const array_list<T> &list) {
+        T sum = 0;
+        for (size_t i = 0; i < list.size(); ++i) {
+            sum += list.at(i);
+        }
+        return sum;
+    }
+
+    template<typename T>
+    T sum_span(const array_list<T> &list) {
+        T sum = 0;
+        for (T v : list.as_span()) {
+            sum += v;
+        }
+        return sum;
+    }
+
+    template<typename T>
+    T sum_accumulate(const array_list<T> &list) {
+        return accumulate(list.as_span(), static_cast<T>(0));
+    }
+
+    template<typename T>
+    void scale_iterators(const array_list<T> &in, array_list<T> &out) {
+        auto dst = out.begin();
+        for (auto it = in.begin(); it != in.end(); ++it, ++dst) {
+            *dst = *it * 3 + 1;
+        }
+    }
+
+    template<typename T>
+    void scale_transform(const array_list<T> &in, array_list<T> &out) {
+        transform(in.as_span(), out.as_span(), [](T v) { return v * 3 + 1; });
+    }
+
+    template<typename T, typename Sum>
+    void run_sum(const char *name, const array_list<T> &list, Sum sum) {
+        T acc = 0;
+        bench::timer t;
+        for (uint32_t p = 0; p < rounds; ++p) {
+            acc += sum(list);
+            bench::do_not_optimize(acc);
+        }
+        bench::report(name, t.elapsed_ns(), rounds * count);
+    }
+
+    template<typename T, typename Scale>
+    void run_scale(const char *name, const array_list<T> &in, array_list<T> &out, Scale scale) {
+        bench::timer t;
+        for (uint32_t p = 0; p < rounds; ++p) {
+            scale(in, out);
+            bench::do_not_optimize(out[p]);
+        }
+        bench::report(name, t.elapsed_ns(), rounds * count);
+    }
+
+    template<typename T>
+    void run_all(const char *type) {
+        array_list<T> in(count);
+        array_list<T> out(count);
+        fill_list(in);
+        fill_list(out);
+        char title[64];
+        snprintf(title, sizeof(title), "sum array_list<%s> (per element)", type);
+        bench::header(title);
+        run_sum("iterators", in, sum_iterators<T>);
+        run_sum("at()", in, sum_at<T>);
+        run_sum("span range-for", in, sum_span<T>);
+        run_sum("accumulate(span)", in, sum_accumulate<T>);
+        snprintf(title, sizeof(title), "scale array_list<%s> (per element)", type);
+        bench::header(title);
+        run_scale("iterators", in, out, scale_iterators<T>);
+        run_scale("transform(span)", in, out, scale_transform<T>);
+    }
+
+}
+
+int main() {
+    run_all<int32_t>("int32_t");
+    run_all<float>("float");
+    return 0;
+}
@@ -0,0 +1,176 @@
+/**
+ * @file sparse_grid_bench.cpp
+ * @brief Compare sparse_grid against a dense array2d.
+ *
+ * The workload is a vehicle driving a winding path through the map
+ * and casting range-sensor rays around it, which touches a thin band
+ * of cells and leaves the rest of the map unknown.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <math.h>
+
+#include <wlib/stl/Array2D.h>
+#include <wlib/stl/SparseGrid.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const uint32_t ray_count = 32;
+    const uint32_t ray_length = 120;
+    const int8_t free_cell = 0;
+    const int8_t hit_cell = 100;
+
+    struct ray {
+        uint32_t x0, y0, x1, y1;
+    };
+
+    /**
+     * Generate sensor rays along a sinusoidal path across the map.
+     */
+    uint32_t make_rays(ray *rays, uint32_t poses, uint32_t side) {
+        uint32_t n = 0;
+        const double margin = ray_length + 2.0;
+        const double span = side - 2 * margin;
+        for (uint32_t p = 0; p < poses; ++p) {
+            const double t = static_cast<double>(p) / poses;
+            const double px = margin + span * t;
+            const double py = margin + span * (0.5 + 0.4 * sin(t * 12.0));
+            for (uint32_t r = 0; r < ray_count; ++r) {
+                const double a = 6.283185307 * r / ray_count;
+                rays[n].x0 = static_cast<uint32_t>(px);
+                rays[n].y0 = static_cast<uint32_t>(py);
+                rays[n].x1 = static_cast<uint32_t>(px + ray_length * cos(a));
+                rays[n].y1 = static_cast<uint32_t>(py + ray_length * sin(a));
+                ++n;
+            }
+        }
+        return n;
+    }
+
+    /**
+     * Bresenham raycast into a dense array2d.
+     */
+    void dense_raycast(array2d<int8_t, uint32_t> &grid, const ray &r) {
+        int32_t x = static_cast<int32_t>(r.x0);
+        int32_t y = static_cast<int32_t>(r.y0);
+        const int32_t ex = static_cast<int32_t>(r.x1);
+        const int32_t ey = static_cast<int32_t>(r.y1);
+        const int32_t dx = ex > x ? ex - x : x - ex;
+        const int32_t dy = ey > y ? ey - y : y - ey;
+        const int32_t sx = x < ex ? 1 : -1;
+        const int32_t sy = y < ey ? 1 : -1;
+        int32_t err = dx - dy;
+        int8_t **cells = grid.get();
+        for (;;) {
+            if (x == ex && y == ey) {
+                cells[x][y] = hit_cell;
+                return;
+            }
+            cells[x][y] = free_cell;
+            const int32_t e2 = 2 * err;
+            if (e2 > -dy) {
+                err -= dy;
+                x += sx;
+            }
+            if (e2 < dx) {
+                err += dx;
+                y += sy;
+            }
+        }
+    }
+
+    void run(uint32_t side, uint32_t poses) {
+        ray *rays = new ray[poses * ray_count];
+        const uint32_t n = make_rays(rays, poses, side);
+        size_t cells = 0;
+        for (uint32_t i = 0; i < n; ++i) {
+            const uint32_t dx = rays[i].x1 > rays[i].x0 ? rays[i].x1 - rays[i].x0 : rays[i].x0 - rays[i].x1;
+            const uint32_t dy = rays[i].y1 > rays[i].y0 ? rays[i].y1 - rays[i].y0 : rays[i].y0 - rays[i].y1;
+            cells += (dx > dy ? dx : dy) + 1;
+        }
+
+        char title[96];
+        snprintf(title, sizeof(title), "%u x %u map, %u rays, %zu cell updates", side, side, n, cells);
+        bench::header(title);
+
+        {
+            bench::timer t;
+            array2d<int8_t, uint32_t> dense(side, side);
+            const double alloc_ns = t.elapsed_ns();
+            t.reset();
+            for (uint32_t i = 0; i < n; ++i) {
+                dense_raycast(dense, rays[i]);
+            }
+            bench::report("array2d raycast (per cell)", t.elapsed_ns(), cells);
+            bench::report("array2d allocate + zero (per cell)", alloc_ns, static_cast<size_t>(side) * side);
+            bench::report_bytes("array2d memory",
+                                static_cast<size_t>(side) * side * sizeof(int8_t) + side * sizeof(int8_t *));
+            bench::do_not_optimize(dense.get()[side / 2][side / 2]);
+        }
+
+        {
+            size_t before = bench::live_bytes();
+            bench::timer t;
+            sparse_grid<int8_t> sparse(side, side, -1);
+            for (uint32_t i = 0; i < n; ++i) {
+                sparse.raycast(rays[i].x0, rays[i].y0, rays[i].x1, rays[i].y1, free_cell, hit_cell);
+            }
+            bench::report("sparse_grid raycast, cold (per cell)", t.elapsed_ns(), cells);
+            t.reset();
+            for (uint32_t i = 0; i < n; ++i) {
+                sparse.raycast(rays[i].x0, rays[i].y0, rays[i].x1, rays[i].y1, free_cell, hit_cell);
+            }
+            bench::report("sparse_grid raycast, warm (per cell)", t.elapsed_ns(), cells);
+            bench::report_bytes("sparse_grid memory (estimate)", sparse.memory_usage());
+            bench::report_bytes("sparse_grid memory (measured)", bench::live_bytes() - before);
+            printf("%-40s %14u\n", "sparse_grid tiles", sparse.tile_count());
+
+            t.reset();
+            size_t known = 0;
+            for (sparse_grid<int8_t>::iterator it = sparse.begin(); it != sparse.end(); ++it) {
+                for (uint32_t c = 0; c < sparse_grid<int8_t>::tile_area; ++c) {
+                    known += it.data()[c] >= 0;
+                }
+            }
+            bench::report("sparse_grid scan allocated (per cell)", t.elapsed_ns(),
+                          sparse.tile_count() * sparse_grid<int8_t>::tile_area);
+            bench::do_not_optimize(known);
+        }
+
+        delete[] rays;
+    }
+
+    void run_sparse_only(uint32_t side, uint32_t poses) {
+        ray *rays = new ray[poses * ray_count];
+        const uint32_t n = make_rays(rays, poses, side);
+        char title[96];
+        snprintf(title, sizeof(title), "%u x %u map, %u rays (dense impossible)", side, side, n);
+        bench::header(title);
+        size_t before = bench::live_bytes();
+        bench::timer t;
+        sparse_grid<int8_t> sparse(side, side, -1);
+        for (uint32_t i = 0; i < n; ++i) {
+            sparse.raycast(rays[i].x0, rays[i].y0, rays[i].x1, rays[i].y1, free_cell, hit_cell);
+        }
+        bench::report("sparse_grid raycast (per ray)", t.elapsed_ns(), n);
+        bench::report_bytes("sparse_grid memory (measured)", bench::live_bytes() - before);
+        bench::report_bytes("array2d memory (would need)",
+                            static_cast<size_t>(side) * side * sizeof(int8_t) + side * sizeof(int8_t *));
+        delete[] rays;
+    }
+
+}
+
+int main() {
+    run(4096, 2000);
+    run(16384, 8000);
+    run_sparse_only(100000, 40000);
+    return 0;
+}
@@ -0,0 +1,211 @@
+/**
+ * @file variant_bench.cpp
+ * @brief Compare message dispatch through variants and virtual calls.
+ *
+ * A million telemetry messages of four kinds are queued in random
+ * order and then handled once each, updating a vehicle state. One
+ * queue is an array list of variants handled with visit; the other is
+ * an array list of unique pointers to a message base class handled
+ * with a virtual call, where every message is a separate allocation.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <wlib/stl/ArrayList.h>
+#include <wlib/stl/UniquePtr.h>
+#include <wlib/stl/Variant.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const uint32_t messages = 1000000;
+    const uint32_t rounds = 8;
+
+    struct vehicle {
+        float speed;
+        int32_t x;
+        int32_t y;
+        uint32_t faults;
+        uint32_t beats;
+    };
+
+    struct speed_report {
+        float value;
+    };
+
+    struct position_report {
+        int32_t x;
+        int32_t y;
+    };
+
+    struct fault_report {
+        uint16_t code;
+    };
+
+    struct heartbeat {
+        uint32_t sequence;
+    };
+
+    typedef variant<speed_report, position_report, fault_report, heartbeat> message;
+
+    struct handler {
+        vehicle &state;
+
+        void operator()(const speed_report &m) const {
+            state.speed = m.value;
+        }
+
+        void operator()(const position_report &m) const {
+            state.x += m.x;
+            state.y += m.y;
+        }
+
+        void operator()(const fault_report &m) const {
+            state.faults += m.code;
+        }
+
+        void operator()(const heartbeat &m) const {
+            state.beats = m.sequence;
+        }
+    };
+
+    struct message_base {
+        virtual ~message_base() {
+        }
+
+        virtual void handle(vehicle &state) const = 0;
+    };
+
+    struct speed_message : message_base {
+        speed_report m;
+
+        explicit speed_message(speed_report m)
+                : m(m) {
+        }
+
+        void handle(vehicle &state) const override {
+            state.speed = m.value;
+        }
+    };
+
+    struct position_message : message_base {
+        position_report m;
+
+        explicit position_message(position_report m)
+                : m(m) {
+        }
+
+        void handle(vehicle &state) const override {
+            state.x += m.x;
+            state.y += m.y;
+        }
+    };
+
+    struct fault_message : message_base {
+        fault_report m;
+
+        explicit fault_message(fault_report m)
+                : m(m) {
+        }
+
+        void handle(vehicle &state) const override {
+            state.faults += m.code;
+        }
+    };
+
+    struct heartbeat_message : message_base {
+        heartbeat m;
+
+        explicit heartbeat_message(heartbeat m)
+                : m(m) {
+        }
+
+        void handle(vehicle &state) const override {
+            state.beats = m.sequence;
+        }
+    };
+
+    void fill_variants(array_list<message> &queue) {
+        bench::rng r;
+        for (uint32_t i = 0; i < messages; ++i) {
+            switch (r.next(4)) {
+                case 0:
+                    queue.push_back(message(speed_report{static_cast<float>(r.next(100))}));
+                    break;
+                case 1:
+                    queue.push_back(message(position_report{static_cast<int32_t>(r.next(9)) - 4, 1}));
+                    break;
+                case 2:
+                    queue.push_back(message(fault_report{static_cast<uint16_t>(r.next(8))}));
+                    break;
+                default:
+                    queue.push_back(message(heartbeat{i}));
+                    break;
+            }
+        }
+    }
+
+    void fill_pointers(array_list<unique_ptr<message_base>> &queue) {
+        bench::rng r;
+        for (uint32_t i = 0; i < messages; ++i) {
+            switch (r.next(4)) {
+                case 0:
+                    queue.push_back(make_unique<speed_message>(speed_report{static_cast<float>(r.next(100))}));
+                    break;
+                case 1:
+                    queue.push_back(make_unique<position_message>(
+                            position_report{static_cast<int32_t>(r.next(9)) - 4, 1}));
+                    break;
+                case 2:
+                    queue.push_back(make_unique<fault_message>(fault_report{static_cast<uint16_t>(r.next(8))}));
+                    break;
+                default:
+                    queue.push_back(make_unique<heartbeat_message>(heartbeat{i}));
+                    break;
+            }
+        }
+    }
+
+    template<typename Handle>
+    void run(const char *name, Handle handle) {
+        vehicle state = {0, 0, 0, 0, 0};
+        bench::timer t;
+        for (uint32_t r = 0; r < rounds; ++r) {
+            handle(state);
+        }
+        bench::do_not_optimize(state);
+        bench::report(name, t.elapsed_ns(), static_cast<size_t>(rounds) * messages);
+    }
+
+}
+
+int main() {
+    bench::header("queue a million messages (per message)");
+    bench::timer t;
+    array_list<message> variants(messages);
+    fill_variants(variants);
+    bench::report("array_list<variant>", t.elapsed_ns(), messages);
+    t.reset();
+    array_list<unique_ptr<message_base>> pointers(messages);
+    fill_pointers(pointers);
+    bench::report("array_list<unique_ptr> + virtual", t.elapsed_ns(), messages);
+
+    bench::header("handle every message (per message)");
+    run("array_list<variant>", [&](vehicle &state) {
+        handler h{state};
+        for (size_t i = 0; i < variants.size(); ++i) {
+            visit(h, variants[i]);
+        }
+    });
+    run("array_list<unique_ptr> + virtual", [&](vehicle &state) {
+        for (size_t i = 0; i < pointers.size(); ++i) {
+            pointers[i]->handle(state);
+        }
+    });
+    return 0;
+}
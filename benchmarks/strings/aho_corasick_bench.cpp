@@ -0,0 +1,161 @@
+/**
+ * @file aho_corasick_bench.cpp
+ * @brief Compare aho_corasick against per-pattern search for log filtering.
+ *
+ * Every log line is checked against a few hundred keywords, counting
+ * all matches and, separately, only whether any keyword occurs. The
+ * baseline runs one strstr per keyword per line. The automaton is run
+ * with the full table, with the default compact table budget, and with
+ * a full row for the root only.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <string.h>
+
+#include <wlib/strings/AhoCorasick.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const uint32_t keyword_count = 300;
+    const uint32_t line_count = 2048;
+    const uint32_t line_length = 120;
+    const uint32_t passes = 8;
+
+    char keywords[keyword_count][16];
+    char lines[line_count][line_length + 1];
+
+    void make_word(bench::rng &r, char *out, uint32_t len) {
+        for (uint32_t i = 0; i < len; ++i) {
+            out[i] = static_cast<char>('a' + r.next(26));
+        }
+        out[len] = '\0';
+    }
+
+    /**
+     * Lines of random words, about one in six holding a keyword.
+     */
+    void make_input() {
+        bench::rng r;
+        for (uint32_t k = 0; k < keyword_count; ++k) {
+            make_word(r, keywords[k], 5 + r.next(8));
+        }
+        for (uint32_t l = 0; l < line_count; ++l) {
+            uint32_t pos = 0;
+            while (pos < line_length) {
+                char word[16];
+                if (r.next(96) == 0) {
+                    strcpy(word, keywords[r.next(keyword_count)]);
+                } else {
+                    make_word(r, word, 2 + r.next(8));
+                }
+                for (uint32_t i = 0; word[i] && pos < line_length; ++i) {
+                    lines[l][pos++] = word[i];
+                }
+                if (pos < line_length) {
+                    lines[l][pos++] = ' ';
+                }
+            }
+            lines[l][line_length] = '\0';
+        }
+    }
+
+    size_t naive_count(const char *line) {
+        size_t count = 0;
+        for (uint32_t k = 0; k < keyword_count; ++k) {
+            for (const char *p = strstr(line, keywords[k]); p; p = strstr(p + 1, keywords[k])) {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    bool naive_any(const char *line) {
+        for (uint32_t k = 0; k < keyword_count; ++k) {
+            if (strstr(line, keywords[k])) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void report(const char *name, double ns) {
+        const double bytes = static_cast<double>(passes) * line_count * line_length;
+        bench::report(name, ns, static_cast<size_t>(passes) * line_count);
+        printf("%-40s %14.1f MB/s\n", "", bytes * 1e3 / ns);
+    }
+
+    void run_naive() {
+        bench::timer t;
+        size_t acc = 0;
+        for (uint32_t p = 0; p < passes; ++p) {
+            for (uint32_t l = 0; l < line_count; ++l) {
+                acc += naive_count(lines[l]);
+            }
+        }
+        report("strstr per keyword, all matches", t.elapsed_ns());
+        printf("%-40s %14zu\n", "  matches", acc / passes);
+        t.reset();
+        acc = 0;
+        for (uint32_t p = 0; p < passes; ++p) {
+            for (uint32_t l = 0; l < line_count; ++l) {
+                acc += naive_any(lines[l]) ? 1 : 0;
+            }
+        }
+        report("strstr per keyword, any match", t.elapsed_ns());
+        printf("%-40s %14zu\n", "  matching lines", acc / passes);
+    }
+
+    void run_automaton(const char *name, aho_corasick::mode_type mode,
+                       size_t budget = aho_corasick::default_table_budget) {
+        char label[64];
+        aho_corasick ac;
+        for (uint32_t k = 0; k < keyword_count; ++k) {
+            ac.add(keywords[k]);
+        }
+        bench::timer t;
+        ac.compile(mode, budget);
+        snprintf(label, sizeof(label), "%s compile", name);
+        bench::report(label, t.elapsed_ns(), 1);
+        snprintf(label, sizeof(label), "%s tables", name);
+        bench::report_bytes(label, ac.memory_usage());
+
+        t.reset();
+        size_t acc = 0;
+        for (uint32_t p = 0; p < passes; ++p) {
+            for (uint32_t l = 0; l < line_count; ++l) {
+                acc += ac.scan(lines[l], line_length, [](size_t, size_t) {});
+            }
+        }
+        snprintf(label, sizeof(label), "%s, all matches", name);
+        report(label, t.elapsed_ns());
+        printf("%-40s %14zu\n", "  matches", acc / passes);
+        t.reset();
+        acc = 0;
+        for (uint32_t p = 0; p < passes; ++p) {
+            for (uint32_t l = 0; l < line_count; ++l) {
+                acc += ac.find_first(lines[l], line_length) >= 0 ? 1 : 0;
+            }
+        }
+        snprintf(label, sizeof(label), "%s, any match", name);
+        report(label, t.elapsed_ns());
+        printf("%-40s %14zu\n", "  matching lines", acc / passes);
+    }
+
+}
+
+int main() {
+    make_input();
+    bench::header("300 keywords, 120 byte lines (per line)");
+    run_naive();
+    run_automaton("aho_corasick dfa", aho_corasick::dfa);
+    run_automaton("aho_corasick compact", aho_corasick::compact);
+    run_automaton("aho_corasick root row", aho_corasick::compact, 0);
+    return 0;
+}
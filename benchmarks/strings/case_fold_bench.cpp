@@ -0,0 +1,191 @@
+/**
+ * @file case_fold_bench.cpp
+ * @brief Compare the ASCII case kernels against byte loops.
+ *
+ * A buffer of mixed case text is lowered in place, and a set of
+ * station keys is hashed, compared, and looked up in a map without
+ * regard to case. Each baseline folds one byte at a time, and the map
+ * baseline stores lower case keys and lowers a copy of every key it
+ * looks up, which is what the callers did before.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <string.h>
+
+#include <wlib/stl/HashMap.h>
+#include <wlib/strings/Ascii.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const size_t text_size = 4 << 20;
+    const uint32_t key_count = 4096;
+    const uint32_t passes = 16;
+
+    char text[text_size];
+    char keys[key_count][48];
+    char flipped[key_count][48];
+    size_t key_lengths[key_count];
+
+    const char *const sites[] = {"Kiruna", "Svalbard", "Inuvik", "McMurdo", "Hartebeesthoek", "Santiago"};
+    const char *const channels[] = {"Downlink", "Uplink", "Telemetry", "Ranging", "BatteryVoltage"};
+
+    void make_input() {
+        bench::rng r;
+        const char alphabet[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 ,.=_-/";
+        for (size_t i = 0; i < text_size; ++i) {
+            text[i] = alphabet[r.next(sizeof(alphabet) - 1)];
+        }
+        for (uint32_t k = 0; k < key_count; ++k) {
+            const int n = snprintf(keys[k], sizeof(keys[k]), "%s-%02u/%s/%s-%u",
+                                   sites[r.next(6)], r.next(100), channels[r.next(5)],
+                                   r.next(2) ? "Primary" : "Backup", k);
+            key_lengths[k] = static_cast<size_t>(n);
+            for (int i = 0; i <= n; ++i) {
+                const char c = keys[k][i];
+                flipped[k][i] = c >= 'a' && c <= 'z' ? ascii_upper(c) : ascii_lower(c);
+            }
+        }
+    }
+
+    void lower_bytes(char *str, size_t len) {
+        for (size_t i = 0; i < len; ++i) {
+            str[i] = ascii_lower(str[i]);
+        }
+    }
+
+    bool equals_bytes(const char *a, size_t alen, const char *b, size_t blen) {
+        if (alen != blen) {
+            return false;
+        }
+        for (size_t i = 0; i < alen; ++i) {
+            if (ascii_lower(a[i]) != ascii_lower(b[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    uint32_t hash_bytes(const char *str, size_t len) {
+        char lowered[48];
+        memcpy(lowered, str, len + 1);
+        lower_bytes(lowered, len);
+        return hash_string<uint32_t>(lowered);
+    }
+
+    void run_lower() {
+        bench::header("lower case in place (per byte)");
+        bench::timer t;
+        for (uint32_t p = 0; p < passes; ++p) {
+            lower_bytes(text, text_size);
+            bench::do_not_optimize(text[p]);
+            text[p] = 'Q';
+        }
+        bench::report("byte loop", t.elapsed_ns(), text_size * passes);
+        t.reset();
+        for (uint32_t p = 0; p < passes; ++p) {
+            ascii_to_lower(text, text_size);
+            bench::do_not_optimize(text[p]);
+            text[p] = 'Q';
+        }
+        bench::report("ascii_to_lower", t.elapsed_ns(), text_size * passes);
+    }
+
+    void run_keys() {
+        const uint32_t rounds = passes * 16;
+        bench::header("case-insensitive key operations (per key)");
+        uint32_t acc = 0;
+        bench::timer t;
+        for (uint32_t p = 0; p < rounds; ++p) {
+            for (uint32_t k = 0; k < key_count; ++k) {
+                acc += hash_bytes(flipped[k], key_lengths[k]);
+            }
+        }
+        bench::report("hash, lower copy then hash", t.elapsed_ns(), rounds * key_count);
+        case_insensitive_hash<const char *, uint32_t> hasher;
+        t.reset();
+        for (uint32_t p = 0; p < rounds; ++p) {
+            for (uint32_t k = 0; k < key_count; ++k) {
+                acc += hasher(flipped[k]);
+            }
+        }
+        bench::report("hash, case_insensitive_hash", t.elapsed_ns(), rounds * key_count);
+        t.reset();
+        for (uint32_t p = 0; p < rounds; ++p) {
+            for (uint32_t k = 0; k < key_count; ++k) {
+                acc += equals_bytes(keys[k], key_lengths[k], flipped[k], key_lengths[k]);
+            }
+        }
+        bench::report("equals, byte loop", t.elapsed_ns(), rounds * key_count);
+        t.reset();
+        for (uint32_t p = 0; p < rounds; ++p) {
+            for (uint32_t k = 0; k < key_count; ++k) {
+                acc += equals_ignore_case(string_view(keys[k], key_lengths[k]),
+                                          string_view(flipped[k], key_lengths[k]));
+            }
+        }
+        bench::report("equals, equals_ignore_case", t.elapsed_ns(), rounds * key_count);
+        bench::do_not_optimize(acc);
+    }
+
+    void run_map() {
+        const uint32_t rounds = passes;
+        bench::header("hash_map lookup by mixed case key (per lookup)");
+        size_t found = 0;
+        {
+            hash_map<dynamic_string, uint32_t> lowered(key_count * 2);
+            for (uint32_t k = 0; k < key_count; ++k) {
+                dynamic_string key(keys[k]);
+                ascii_to_lower(key);
+                lowered[move(key)] = k;
+            }
+            bench::reset_counters();
+            bench::timer t;
+            for (uint32_t p = 0; p < rounds; ++p) {
+                for (uint32_t k = 0; k < key_count; ++k) {
+                    dynamic_string key(flipped[k], key_lengths[k]);
+                    lower_bytes(key.c_str(), key.length());
+                    found += lowered.find(key) != lowered.end();
+                }
+            }
+            bench::report("lower a copy, exact map", t.elapsed_ns(), rounds * key_count);
+            printf("%-40s %14.2f\n", "  allocations per lookup",
+                   static_cast<double>(bench::alloc_count()) / (rounds * key_count));
+        }
+        {
+            typedef hash_map<string_view, uint32_t,
+                    case_insensitive_hash<string_view, uint16_t>,
+                    case_insensitive_equals<string_view>> map_type;
+            map_type folded(key_count * 2);
+            for (uint32_t k = 0; k < key_count; ++k) {
+                folded[string_view(keys[k], key_lengths[k])] = k;
+            }
+            bench::reset_counters();
+            bench::timer t;
+            for (uint32_t p = 0; p < rounds; ++p) {
+                for (uint32_t k = 0; k < key_count; ++k) {
+                    found += folded.find(string_view(flipped[k], key_lengths[k])) != folded.end();
+                }
+            }
+            bench::report("case-insensitive map", t.elapsed_ns(), rounds * key_count);
+            printf("%-40s %14.2f\n", "  allocations per lookup",
+                   static_cast<double>(bench::alloc_count()) / (rounds * key_count));
+        }
+        bench::do_not_optimize(found);
+    }
+
+}
+
+int main() {
+    make_input();
+    run_lower();
+    run_keys();
+    run_map();
+    return 0;
+}
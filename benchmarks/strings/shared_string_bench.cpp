@@ -0,0 +1,113 @@
+/**
+ * @file shared_string_bench.cpp
+ * @brief Compare copy-heavy use of shared_string and dynamic_string.
+ *
+ * A set of configuration names is copied into lists and into a hash
+ * map and a tree map, the way a parsed configuration is fanned out to
+ * the modules that keep their own copies, and the maps are then
+ * probed. Allocations are reported per copied string.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <stdio.h>
+
+#include <wlib/stl/ArrayList.h>
+#include <wlib/stl/HashMap.h>
+#include <wlib/stl/TreeMap.h>
+#include <wlib/strings/SharedString.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const uint32_t key_count = 1024;
+    const uint32_t copies = 16;
+    const uint32_t rounds = 32;
+
+    char names[key_count][48];
+
+    void make_names() {
+        bench::rng r;
+        const char *const modules[] = {"payload.camera", "comms.uhf.radio", "eps.battery.heater", "adcs.sun_sensor"};
+        for (uint32_t k = 0; k < key_count; ++k) {
+            snprintf(names[k], sizeof(names[k]), "%s.%04u.threshold", modules[r.next(4)], k);
+        }
+    }
+
+    void report_allocs(size_t allocs, size_t ops) {
+        printf("%-40s %14.2f\n", "  allocations per copy",
+               static_cast<double>(allocs) / static_cast<double>(ops));
+    }
+
+    template<typename Str>
+    void run_list_copies(const char *name, const array_list<Str> &keys) {
+        bench::reset_counters();
+        bench::timer t;
+        size_t total = 0;
+        for (uint32_t p = 0; p < rounds; ++p) {
+            array_list<Str> list(key_count * copies);
+            for (uint32_t c = 0; c < copies; ++c) {
+                for (uint32_t k = 0; k < key_count; ++k) {
+                    list.push_back(keys[k]);
+                }
+            }
+            total += list.size();
+        }
+        const size_t ops = rounds * copies * key_count;
+        bench::report(name, t.elapsed_ns(), ops);
+        report_allocs(bench::alloc_count(), ops);
+        bench::do_not_optimize(total);
+    }
+
+    template<typename Map, typename Str>
+    void run_map(const char *name, const array_list<Str> &keys) {
+        bench::reset_counters();
+        bench::timer t;
+        size_t acc = 0;
+        for (uint32_t p = 0; p < rounds; ++p) {
+            Map map;
+            for (uint32_t k = 0; k < key_count; ++k) {
+                map[keys[k]] = k;
+            }
+            for (uint32_t k = 0; k < key_count; ++k) {
+                acc += *map.find(keys[key_count - 1 - k]);
+            }
+        }
+        const size_t ops = rounds * key_count;
+        bench::report(name, t.elapsed_ns(), ops);
+        report_allocs(bench::alloc_count(), ops);
+        bench::do_not_optimize(acc);
+    }
+
+    template<typename Str>
+    void make_keys(array_list<Str> &keys) {
+        for (uint32_t k = 0; k < key_count; ++k) {
+            keys.push_back(Str(names[k]));
+        }
+    }
+
+}
+
+int main() {
+    make_names();
+    array_list<dynamic_string> dynamic_keys(key_count);
+    array_list<shared_string> shared_keys(key_count);
+    make_keys(dynamic_keys);
+    make_keys(shared_keys);
+
+    bench::header("copy names into a list (per copy)");
+    run_list_copies("dynamic_string", dynamic_keys);
+    run_list_copies("shared_string", shared_keys);
+    bench::header("fill and probe hash_map (per key)");
+    run_map<hash_map<dynamic_string, uint32_t>>("dynamic_string", dynamic_keys);
+    run_map<hash_map<shared_string, uint32_t>>("shared_string", shared_keys);
+    bench::header("fill and probe tree_map (per key)");
+    run_map<tree_map<dynamic_string, uint32_t>>("dynamic_string", dynamic_keys);
+    run_map<tree_map<shared_string, uint32_t>>("shared_string", shared_keys);
+    return 0;
+}
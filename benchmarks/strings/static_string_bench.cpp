@@ -0,0 +1,139 @@
+/**
+ * @file static_string_bench.cpp
+ * @brief Measure map lookups keyed by static_string<16>.
+ *
+ * Sensor names are looked up in a hash map and a tree map, once with
+ * functors that work the way the string functors used to, through the
+ * null-terminated characters with strcmp and a bounds-checked hash
+ * loop, and once with the default functors, which use the stored
+ * lengths.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <string.h>
+
+#include <wlib/stl/HashMap.h>
+#include <wlib/stl/TreeMap.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const uint32_t key_count = 2048;
+    const uint32_t rounds = 256;
+
+    String16 keys[key_count];
+    String16 probes[key_count];
+
+    struct legacy_hash {
+        uint16_t operator()(const String16 &s) const {
+            uint16_t h = 0;
+            for (size_t pos = 0; pos < s.length(); ++pos) {
+                h = static_cast<uint16_t>(MUL_127(h) + s[pos]);
+            }
+            return h;
+        }
+    };
+
+    struct legacy_equals {
+        bool operator()(const String16 &a, const String16 &b) const {
+            return strcmp(a.c_str(), b.c_str()) == 0;
+        }
+    };
+
+    struct legacy_comparator {
+        bool __lt__(const String16 &a, const String16 &b) const {
+            return strcmp(a.c_str(), b.c_str()) < 0;
+        }
+
+        bool __eq__(const String16 &a, const String16 &b) const {
+            return strcmp(a.c_str(), b.c_str()) == 0;
+        }
+
+        bool __le__(const String16 &a, const String16 &b) const {
+            return strcmp(a.c_str(), b.c_str()) <= 0;
+        }
+
+        bool __ne__(const String16 &a, const String16 &b) const {
+            return strcmp(a.c_str(), b.c_str()) != 0;
+        }
+
+        bool __gt__(const String16 &a, const String16 &b) const {
+            return strcmp(a.c_str(), b.c_str()) > 0;
+        }
+
+        bool __ge__(const String16 &a, const String16 &b) const {
+            return strcmp(a.c_str(), b.c_str()) >= 0;
+        }
+    };
+
+    /**
+     * Names share long prefixes, like "imu.gyro.x.0042", so that
+     * comparisons look past the first few characters.
+     */
+    void make_keys() {
+        bench::rng r;
+        const char *const groups[] = {"imu.gyro", "imu.accel", "eps.batt", "eps.panel", "adcs.wheel"};
+        const char axes[] = "xyz";
+        for (uint32_t k = 0; k < key_count; ++k) {
+            char name[32];
+            snprintf(name, sizeof(name), "%s.%c.%04u", groups[k % 5], axes[k / 5 % 3], k);
+            keys[k] = name;
+        }
+        // probe the keys in a shuffled order
+        for (uint32_t k = 0; k < key_count; ++k) {
+            probes[k] = keys[k];
+        }
+        for (uint32_t k = key_count - 1; k > 0; --k) {
+            const uint32_t j = r.next(k + 1);
+            const String16 tmp = probes[k];
+            probes[k] = probes[j];
+            probes[j] = tmp;
+        }
+    }
+
+    template<typename Map>
+    void run_lookups(const char *name, Map &map) {
+        for (uint32_t k = 0; k < key_count; ++k) {
+            String16 key = keys[k];
+            map[move(key)] = k;
+        }
+        size_t acc = 0;
+        bench::timer t;
+        for (uint32_t p = 0; p < rounds; ++p) {
+            for (uint32_t k = 0; k < key_count; ++k) {
+                acc += *map.find(probes[k]);
+            }
+        }
+        bench::report(name, t.elapsed_ns(), rounds * key_count);
+        bench::do_not_optimize(acc);
+    }
+
+}
+
+int main() {
+    make_keys();
+    bench::header("static_string<16> map lookups (per lookup)");
+    {
+        hash_map<String16, uint32_t, legacy_hash, legacy_equals> map(key_count * 2);
+        run_lookups("hash_map, strcmp functors", map);
+    }
+    {
+        hash_map<String16, uint32_t> map(key_count * 2);
+        run_lookups("hash_map, length-aware functors", map);
+    }
+    {
+        tree_map<String16, uint32_t, legacy_comparator> map;
+        run_lookups("tree_map, strcmp comparator", map);
+    }
+    {
+        tree_map<String16, uint32_t> map;
+        run_lookups("tree_map, length-aware comparator", map);
+    }
+    return 0;
+}
@@ -0,0 +1,103 @@
+/**
+ * @file string_pool_bench.cpp
+ * @brief Measure a string churn workload on the heap and on a string pool.
+ *
+ * A table of dynamic strings is updated at random: slots are assigned
+ * names of random length, appended to, copied from other slots, and
+ * emptied, which is how a command parser and its log buffers churn
+ * through strings. The same sequence runs with buffers from the heap
+ * and from a string_pool with 1 KB chunks, and the heap requests, peak
+ * heap bytes, and the pool's own counts are reported.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <stdio.h>
+
+#include <wlib/strings/StringPool.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const uint32_t slots = 512;
+    const uint32_t ops = 1 << 21;
+
+    char text[128];
+
+    const char *const suffixes[] = {".", "=1", ".ok", "/tmp", ":4242", ".backup", ",retry=3", ";timeout=250"};
+
+    void make_text() {
+        bench::rng r;
+        for (size_t i = 0; i + 1 < sizeof(text); ++i) {
+            text[i] = static_cast<char>('a' + r.next(26));
+        }
+    }
+
+    void churn(dynamic_string *table) {
+        bench::rng r;
+        for (uint32_t i = 0; i < ops; ++i) {
+            dynamic_string &s = table[r.next(slots)];
+            switch (r.next(8)) {
+                case 0:
+                case 1:
+                case 2:
+                    s.set_value(text + r.next(32), 4 + r.next(60));
+                    break;
+                case 3:
+                case 4:
+                    s.append(suffixes[r.next(8)]);
+                    break;
+                case 5:
+                case 6:
+                    s = table[r.next(slots)];
+                    break;
+                default:
+                    s = dynamic_string();
+                    break;
+            }
+        }
+    }
+
+    void run(const char *name) {
+        double ns;
+        size_t allocs;
+        size_t peak;
+        {
+            dynamic_string table[slots];
+            bench::reset_counters();
+            const size_t base = bench::live_bytes();
+            bench::timer t;
+            churn(table);
+            ns = t.elapsed_ns();
+            allocs = bench::alloc_count();
+            peak = bench::peak_bytes() - base;
+        }
+        bench::report(name, ns, ops);
+        printf("%-40s %14.3f\n", "  heap requests per op", static_cast<double>(allocs) / ops);
+        bench::report_bytes("  peak heap bytes", peak);
+    }
+
+}
+
+int main() {
+    make_text();
+    bench::header("string churn (per operation)");
+    run("heap buffers");
+    {
+        string_pool pool(1024);
+        const string_allocator *prev = dynamic_string::set_allocator(pool.allocator());
+        run("string_pool buffers");
+        dynamic_string::set_allocator(prev);
+        const string_pool_stats &stats = pool.stats();
+        bench::report_bytes("  pool reserved", stats.reserved_bytes);
+        bench::report_bytes("  pool idle after churn", stats.free_bytes);
+        printf("%-40s %14.3f\n", "  rounding loss (1 - requested/granted)",
+               1.0 - static_cast<double>(stats.requested_bytes) / static_cast<double>(stats.granted_bytes));
+    }
+    return 0;
+}
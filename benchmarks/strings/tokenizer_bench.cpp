@@ -0,0 +1,130 @@
+/**
+ * @file tokenizer_bench.cpp
+ * @brief Measure field splitting throughput on a synthetic telemetry log.
+ *
+ * The log is split into lines and each line into comma separated
+ * fields. The baseline copies each line and each field into a dynamic
+ * string with substr. The tokenizer fills a reserved list of views,
+ * once with a delimiter set searched a word at a time and once with a
+ * set too large for that, which looks up every byte.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <string.h>
+
+#include <wlib/strings/Tokenizer.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const size_t log_size = 16 << 20;
+    const uint32_t passes = 4;
+
+    char log_text[log_size];
+    size_t log_length = 0;
+
+    const char *const channels[] = {"temperature", "humidity", "pressure", "battery_voltage", "rssi"};
+    const char *const states[] = {"OK", "WARN", "FAULT_SENSOR_TIMEOUT"};
+
+    void make_log() {
+        bench::rng r;
+        char line[128];
+        uint64_t stamp = 1718000000000ULL;
+        for (;;) {
+            stamp += r.next(50);
+            const int n = snprintf(line, sizeof(line), "%llu,site%02u,dev%04u,%s,%d.%02u,%s\n",
+                                   static_cast<unsigned long long>(stamp), r.next(32), r.next(4096),
+                                   channels[r.next(5)], static_cast<int>(r.next(200)) - 50, r.next(100),
+                                   states[r.next(16) == 0 ? 1 + r.next(2) : 0]);
+            if (log_length + static_cast<size_t>(n) > log_size) {
+                break;
+            }
+            memcpy(log_text + log_length, line, static_cast<size_t>(n));
+            log_length += static_cast<size_t>(n);
+        }
+    }
+
+    void report(const char *name, double ns, size_t lines, size_t fields) {
+        bench::report(name, ns, lines);
+        printf("%-40s %14.3f GB/s\n", "", static_cast<double>(log_length) * passes / ns);
+        printf("%-40s %14zu\n", "  fields per pass", fields / passes);
+        printf("%-40s %14.2f\n", "  allocations per line",
+               static_cast<double>(bench::alloc_count()) / static_cast<double>(lines));
+    }
+
+    void run_substr() {
+        bench::reset_counters();
+        bench::timer t;
+        size_t lines = 0;
+        size_t fields = 0;
+        size_t acc = 0;
+        for (uint32_t p = 0; p < passes; ++p) {
+            const char *pos = log_text;
+            const char *end = log_text + log_length;
+            while (pos < end) {
+                const char *eol = static_cast<const char *>(memchr(pos, '\n', static_cast<size_t>(end - pos)));
+                dynamic_string line(pos, static_cast<size_t>(eol - pos));
+                size_t start = 0;
+                for (;;) {
+                    const char *comma = strchr(line.c_str() + start, ',');
+                    const size_t stop = comma ? static_cast<size_t>(comma - line.c_str()) : line.length();
+                    dynamic_string field = line.substr(start, stop - start);
+                    acc += field.length();
+                    ++fields;
+                    if (!comma) {
+                        break;
+                    }
+                    start = stop + 1;
+                }
+                ++lines;
+                pos = eol + 1;
+            }
+        }
+        const double ns = t.elapsed_ns();
+        bench::do_not_optimize(acc);
+        report("substr into dynamic_string", ns, lines, fields);
+    }
+
+    void run_tokenizer(const char *name, const delimiter_set &commas) {
+        const delimiter_set newlines("\n");
+        array_list<string_view> fields(16);
+        bench::reset_counters();
+        bench::timer t;
+        size_t lines = 0;
+        size_t count = 0;
+        size_t acc = 0;
+        for (uint32_t p = 0; p < passes; ++p) {
+            tokenizer by_line(string_view(log_text, log_length), newlines);
+            string_view line;
+            while (by_line.next(line)) {
+                if (line.empty()) {
+                    continue;
+                }
+                fields.clear();
+                count += tokenizer(line, commas).split(fields);
+                acc += fields[fields.size() - 1].length();
+                ++lines;
+            }
+        }
+        const double ns = t.elapsed_ns();
+        bench::do_not_optimize(acc);
+        report(name, ns, lines, count);
+    }
+
+}
+
+int main() {
+    make_log();
+    printf("log of %zu bytes\n", log_length);
+    bench::header("split lines into fields (per line)");
+    run_substr();
+    run_tokenizer("tokenizer, word search", delimiter_set(","));
+    run_tokenizer("tokenizer, byte table", delimiter_set(",;|\x01\x02"));
+    return 0;
+}
@@ -0,0 +1,121 @@
+/**
+ * @file utf8_bench.cpp
+ * @brief Compare UTF-8 validation against a byte at a time decoder.
+ *
+ * Two inputs are validated: plain ASCII telemetry, the common case,
+ * and text where about one character in eight is a multi-byte
+ * sequence. The baseline decodes every byte in turn with the same
+ * rules.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <string.h>
+
+#include <wlib/strings/Utf8.h>
+
+#include "bench_helper.h"
+
+using namespace wlp;
+
+namespace {
+
+    const size_t text_size = 8 << 20;
+    const uint32_t passes = 8;
+
+    char ascii_text[text_size];
+    char mixed_text[text_size];
+
+    void make_input() {
+        bench::rng r;
+        const char alphabet[] = "abcdefghijklmnopqrstuvwxyz0123456789 ,.=_-/";
+        for (size_t i = 0; i < text_size; ++i) {
+            ascii_text[i] = alphabet[r.next(sizeof(alphabet) - 1)];
+        }
+        const char *const wide[] = {"\xc3\xa9", "\xce\xb1", "\xe2\x82\xac", "\xe2\x84\x83", "\xf0\x9f\x9b\xb0"};
+        size_t n = 0;
+        while (n < text_size) {
+            if (r.next(8) == 0) {
+                const char *seq = wide[r.next(5)];
+                const size_t len = strlen(seq);
+                if (n + len > text_size) {
+                    break;
+                }
+                memcpy(mixed_text + n, seq, len);
+                n += len;
+            } else {
+                mixed_text[n++] = alphabet[r.next(sizeof(alphabet) - 1)];
+            }
+        }
+        memset(mixed_text + n, ' ', text_size - n);
+    }
+
+    /**
+     * Validate one byte at a time, the way the callers did before.
+     */
+    bool valid_bytes(const char *str, size_t len) {
+        const uint8_t *p = reinterpret_cast<const uint8_t *>(str);
+        const uint8_t *end = p + len;
+        while (p != end) {
+            const uint8_t c = *p++;
+            uint32_t cp;
+            size_t more;
+            if (c < 0x80) {
+                continue;
+            } else if ((c & 0xe0) == 0xc0) {
+                cp = c & 0x1fu;
+                more = 1;
+            } else if ((c & 0xf0) == 0xe0) {
+                cp = c & 0x0fu;
+                more = 2;
+            } else if ((c & 0xf8) == 0xf0) {
+                cp = c & 0x07u;
+                more = 3;
+            } else {
+                return false;
+            }
+            if (static_cast<size_t>(end - p) < more) {
+                return false;
+            }
+            for (size_t i = 0; i < more; ++i, ++p) {
+                if ((*p & 0xc0) != 0x80) {
+                    return false;
+                }
+                cp = (cp << 6) | (*p & 0x3fu);
+            }
+            const uint32_t min[] = {0, 0x80, 0x800, 0x10000};
+            if (cp < min[more] || cp > 0x10ffff || (cp >= 0xd800 && cp <= 0xdfff)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void run(const char *title, const char *text) {
+        bench::header(title);
+        size_t valid = 0;
+        bench::timer t;
+        for (uint32_t p = 0; p < passes; ++p) {
+            valid += valid_bytes(text, text_size);
+        }
+        bench::report("byte at a time", t.elapsed_ns(), text_size * passes);
+        t.reset();
+        for (uint32_t p = 0; p < passes; ++p) {
+            valid += utf8_valid(text, text_size);
+        }
+        bench::report("utf8_valid", t.elapsed_ns(), text_size * passes);
+        if (valid != 2 * passes) {
+            printf("validation mismatch\n");
+        }
+    }
+
+}
+
+int main() {
+    make_input();
+    run("validate ASCII text (per byte)", ascii_text);
+    run("validate mixed text (per byte)", mixed_text);
+    return 0;
+}
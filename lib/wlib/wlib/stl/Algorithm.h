@@ -0,0 +1,202 @@
+/**
+ * @file Algorithm.h
+ * @brief Loops over spans.
+ *
+ * The algorithms take spans so that they index plain arrays, which
+ * compilers can unroll and vectorize; take a span of a container with
+ * its @code as_span @endcode. Positions are returned as indices, with
+ * the span size standing for not found, as in @code index_of @endcode
+ * of the array list.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_ALGORITHM_H
+#define EMBEDDEDCPLUSPLUS_ALGORITHM_H
+
+#include <stddef.h>
+
+#include <wlib/stl/Span.h>
+
+namespace wlp {
+
+    /**
+     * Add up the elements in four interleaved partial sums, which
+     * keeps the additions independent. Floating point sums may round
+     * differently than a sum taken in order.
+     *
+     * @return the initial value with every element added to it
+     */
+    template<typename T, typename V>
+    V accumulate(span<T> s, V init) {
+        const T *const p = s.data();
+        const size_t n = s.size();
+        V part[4] = {V(), V(), V(), V()};
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            part[0] = part[0] + p[i];
+            part[1] = part[1] + p[i + 1];
+            part[2] = part[2] + p[i + 2];
+            part[3] = part[3] + p[i + 3];
+        }
+        for (; i < n; ++i) {
+            part[0] = part[0] + p[i];
+        }
+        return init + ((part[0] + part[1]) + (part[2] + part[3]));
+    }
+
+    /**
+     * Call a function on every element.
+     */
+    template<typename T, typename F>
+    void for_each(span<T> s, F f) {
+        T *const p = s.data();
+        const size_t n = s.size();
+        for (size_t i = 0; i < n; ++i) {
+            f(p[i]);
+        }
+    }
+
+    /**
+     * Store a function of each element of one span in the other,
+     * up to the shorter of the two.
+     *
+     * @return the number of elements stored
+     */
+    template<typename T, typename U, typename F>
+    size_t transform(span<T> in, span<U> out, F f) {
+        const T *const src = in.data();
+        U *const dst = out.data();
+        const size_t n = in.size() < out.size() ? in.size() : out.size();
+        for (size_t i = 0; i < n; ++i) {
+            dst[i] = f(src[i]);
+        }
+        return n;
+    }
+
+    /**
+     * Copy the elements of one span into the other, up to the
+     * shorter of the two. The spans must not overlap.
+     *
+     * @return the number of elements copied
+     */
+    template<typename T, typename U>
+    size_t copy(span<T> in, span<U> out) {
+        const T *const src = in.data();
+        U *const dst = out.data();
+        const size_t n = in.size() < out.size() ? in.size() : out.size();
+        for (size_t i = 0; i < n; ++i) {
+            dst[i] = src[i];
+        }
+        return n;
+    }
+
+    template<typename T, typename V>
+    void fill(span<T> s, const V &val) {
+        T *const p = s.data();
+        const size_t n = s.size();
+        for (size_t i = 0; i < n; ++i) {
+            p[i] = val;
+        }
+    }
+
+    template<typename T, typename V>
+    size_t count(span<T> s, const V &val) {
+        const T *const p = s.data();
+        const size_t n = s.size();
+        size_t c = 0;
+        for (size_t i = 0; i < n; ++i) {
+            c += p[i] == val;
+        }
+        return c;
+    }
+
+    template<typename T, typename P>
+    size_t count_if(span<T> s, P pred) {
+        const T *const p = s.data();
+        const size_t n = s.size();
+        size_t c = 0;
+        for (size_t i = 0; i < n; ++i) {
+            c += pred(p[i]) ? 1 : 0;
+        }
+        return c;
+    }
+
+    /**
+     * @return the index of the first element equal to the value,
+     * or the size of the span
+     */
+    template<typename T, typename V>
+    size_t find(span<T> s, const V &val) {
+        const T *const p = s.data();
+        const size_t n = s.size();
+        size_t i = 0;
+        while (i < n && !(p[i] == val)) {
+            ++i;
+        }
+        return i;
+    }
+
+    /**
+     * @return the index of the first smallest element, or the size
+     * of an empty span
+     */
+    template<typename T>
+    size_t min_element(span<T> s) {
+        const T *const p = s.data();
+        const size_t n = s.size();
+        if (n == 0) {
+            return 0;
+        }
+        size_t m = 0;
+        for (size_t i = 1; i < n; ++i) {
+            if (p[i] < p[m]) {
+                m = i;
+            }
+        }
+        return m;
+    }
+
+    /**
+     * @return the index of the first largest element, or the size
+     * of an empty span
+     */
+    template<typename T>
+    size_t max_element(span<T> s) {
+        const T *const p = s.data();
+        const size_t n = s.size();
+        if (n == 0) {
+            return 0;
+        }
+        size_t m = 0;
+        for (size_t i = 1; i < n; ++i) {
+            if (p[m] < p[i]) {
+                m = i;
+            }
+        }
+        return m;
+    }
+
+    /**
+     * @return whether two spans have the same size and equal elements
+     */
+    template<typename T, typename U>
+    bool equal(span<T> a, span<U> b) {
+        if (a.size() != b.size()) {
+            return false;
+        }
+        const T *const p = a.data();
+        const U *const q = b.data();
+        for (size_t i = 0; i < a.size(); ++i) {
+            if (!(p[i] == q[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_ALGORITHM_H
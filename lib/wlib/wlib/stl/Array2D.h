@@ -1,7 +1,9 @@
 #ifndef EMBEDDEDCPLUSPLUS_ARRAY2D_H
 #define EMBEDDEDCPLUSPLUS_ARRAY2D_H
 
+#include <wlib/stl/Helper.h>
 #include <wlib/stl/InitializerList.h>
+#include <wlib/stl/Span.h>
 #include <wlib/utility>
 #include <string.h>
 
@@ -88,6 +90,12 @@ namespace wlp {
         }
 
         array2d<val_t, size_t> &operator=(array2d<val_t, size_t> &&arr) noexcept {
+            if (this == &arr) {
+                return *this;
+            }
+            if (m_arr) {
+                delete_array();
+            }
             m_x = arr.m_x;
             m_y = arr.m_y;
             m_arr = arr.m_arr;
@@ -97,6 +105,12 @@ namespace wlp {
             return *this;
         };
 
+        void swap(array2d<val_t, size_t> &arr) noexcept {
+            wlp::swap(m_arr, arr.m_arr);
+            wlp::swap(m_x, arr.m_x);
+            wlp::swap(m_y, arr.m_y);
+        }
+
         val_t **get() {
             return m_arr;
         }
@@ -105,18 +119,25 @@ namespace wlp {
             return __array2d_access<val_t, size_t>(m_arr[x], m_y);
         };
 
+        /**
+         * @return a span over the row at @code x @endcode
+         */
+        span<val_t> row(size_t x) {
+            return span<val_t>(m_arr[x], m_y);
+        }
+
         // Disable copy constructor and assignment
         array2d(const array2d<val_t, size_t> &) = delete;
 
         array2d<val_t, size_t> &operator=(const array2d<val_t, size_t> &) = delete;
 
     private:
-        void make_array(int x, int y) {
+        void make_array(size_t x, size_t y) {
             if (m_arr) {
                 delete_array();
             }
             m_arr = new val_t *[x];
-            for (int tx = 0; tx < x; ++tx) {
+            for (size_t tx = 0; tx < x; ++tx) {
                 m_arr[tx] = new val_t[y];
                 memset(m_arr[tx], 0, y * sizeof(val_t));
             }
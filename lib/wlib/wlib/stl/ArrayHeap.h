@@ -53,11 +53,11 @@ namespace wlp {
     ) {
         SizeType parent = static_cast<SizeType>((hole_index - 1) / 2);
         while (hole_index > top_index && cmp.__lt__(*(first + parent), value)) {
-            *(first + hole_index) = *(first + parent);
+            *(first + hole_index) = move(*(first + parent));
             hole_index = parent;
             parent = static_cast<SizeType>((hole_index - 1) / 2);
         }
-        *(first + hole_index) = value;
+        *(first + hole_index) = move(value);
     };
 
     /**
@@ -86,11 +86,11 @@ namespace wlp {
     ) {
         SizeType parent = static_cast<SizeType>((hole_index - 1) / 2);
         while (hole_index > top_index && *(first + parent) < value) {
-            *(first + hole_index) = *(first + parent);
+            *(first + hole_index) = move(*(first + parent));
             hole_index = parent;
             parent = static_cast<SizeType>((hole_index - 1) / 2);
         }
-        *(first + hole_index) = value;
+        *(first + hole_index) = move(value);
     };
 
     /**
@@ -121,7 +121,7 @@ namespace wlp {
             RandomAccessIterator last,
             Cmp cmp
     ) {
-        __push_heap(first, static_cast<SizeType>(last - first - 1), (SizeType) 0, ValType(*(last - 1)), cmp);
+        __push_heap(first, static_cast<SizeType>(last - first - 1), (SizeType) 0, ValType(move(*(last - 1))), cmp);
     }
 
     /**
@@ -147,7 +147,7 @@ namespace wlp {
             RandomAccessIterator first,
             RandomAccessIterator last
     ) {
-        __push_heap(first, static_cast<SizeType>(last - first - 1), (SizeType) 0, ValType(*(last - 1)));
+        __push_heap(first, static_cast<SizeType>(last - first - 1), (SizeType) 0, ValType(move(*(last - 1))));
     }
 
     /**
@@ -182,15 +182,15 @@ namespace wlp {
             if (cmp.__lt__(*(first + second_child), *(first + second_child - 1))) {
                 --second_child;
             }
-            *(first + hole_index) = *(first + second_child);
+            *(first + hole_index) = move(*(first + second_child));
             hole_index = second_child;
             second_child = static_cast<SizeType>(2 * (second_child + 1));
         }
         if (second_child == length) {
-            *(first + hole_index) = *(first + second_child - 1);
+            *(first + hole_index) = move(*(first + second_child - 1));
             hole_index = static_cast<SizeType>(second_child - 1);
         }
-        __push_heap(first, hole_index, top_index, value, cmp);
+        __push_heap(first, hole_index, top_index, move(value), cmp);
     };
 
     /**
@@ -221,15 +221,15 @@ namespace wlp {
             if (*(first + second_child) < *(first + second_child - 1)) {
                 --second_child;
             }
-            *(first + hole_index) = *(first + second_child);
+            *(first + hole_index) = move(*(first + second_child));
             hole_index = second_child;
             second_child = static_cast<SizeType>(2 * (second_child + 1));
         }
         if (second_child == length) {
-            *(first + hole_index) = *(first + second_child - 1);
+            *(first + hole_index) = move(*(first + second_child - 1));
             hole_index = static_cast<SizeType>(second_child - 1);
         }
-        __push_heap(first, hole_index, top_index, value);
+        __push_heap(first, hole_index, top_index, move(value));
     };
 
     /**
@@ -258,8 +258,8 @@ namespace wlp {
             ValType value,
             Cmp cmp
     ) {
-        *result = *first;
-        __adjust_heap(first, (SizeType) 0, (SizeType) (last - first), value, cmp);
+        *result = move(*first);
+        __adjust_heap(first, (SizeType) 0, (SizeType) (last - first), move(value), cmp);
     };
 
     /**
@@ -284,8 +284,8 @@ namespace wlp {
             RandomAccessIterator result,
             ValType value
     ) {
-        *result = *first;
-        __adjust_heap(first, (SizeType) 0, (SizeType) (last - first), value);
+        *result = move(*first);
+        __adjust_heap(first, (SizeType) 0, (SizeType) (last - first), move(value));
     };
 
     /**
@@ -314,7 +314,7 @@ namespace wlp {
             RandomAccessIterator last,
             Cmp cmp
     ) {
-        __pop_heap(first, last - 1, last - 1, (ValType) *(last - 1), cmp);
+        __pop_heap(first, last - 1, last - 1, ValType(move(*(last - 1))), cmp);
     };
 
     /**
@@ -338,7 +338,7 @@ namespace wlp {
             RandomAccessIterator first,
             RandomAccessIterator last
     ) {
-        __pop_heap(first, last - 1, last - 1, (ValType) *(last - 1));
+        __pop_heap(first, last - 1, last - 1, ValType(move(*(last - 1))));
     };
 
     /**
@@ -375,7 +375,7 @@ namespace wlp {
         }
         SizeType parent = static_cast<SizeType>((length - 2) / 2);
         for (;;) {
-            __adjust_heap(first, parent, length, (ValType) *(first + parent), cmp);
+            __adjust_heap(first, parent, length, ValType(move(*(first + parent))), cmp);
             if (parent == 0) {
                 return;
             }
@@ -412,7 +412,7 @@ namespace wlp {
         }
         SizeType parent = static_cast<SizeType>((length - 2) / 2);
         for (;;) {
-            __adjust_heap(first, parent, length, (ValType) *(first + parent));
+            __adjust_heap(first, parent, length, ValType(move(*(first + parent))));
             if (parent == 0) {
                 return;
             }
@@ -610,6 +610,16 @@ namespace wlp {
             m_list = move(heap.m_list);
             return *this;
         }
+
+        /**
+         * Exchange the backing lists of two heaps.
+         *
+         * @param heap array heap to swap with
+         */
+        void swap(heap_t &heap) noexcept {
+            m_list.swap(heap.m_list);
+            wlp::swap(m_cmp, heap.m_cmp);
+        }
     };
 
     /**
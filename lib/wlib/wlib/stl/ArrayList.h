@@ -13,6 +13,8 @@
 #ifndef EMBEDDEDCPLUSPLUS_ARRAYLIST_H
 #define EMBEDDEDCPLUSPLUS_ARRAYLIST_H
 
+#include <wlib/stl/Helper.h>
+#include <wlib/stl/Span.h>
 #include <wlib/utility>
 #include <wlib/memory>
 #include <stddef.h>
@@ -314,7 +316,9 @@ namespace wlp {
         array_list(const list_type &) = delete;
 
         /**
-         * Move constructor.
+         * Move constructor. The moved-from list is left
+         * empty with no backing array and allocates one
+         * on the next insertion.
          *
          * @param list array list whose resources to transfer
          */
@@ -401,7 +405,7 @@ namespace wlp {
         /**
          * Called before any insertion operation,
          * this function will extend the size of the
-         * array to twice its capacity and copy
+         * array to twice its capacity and move
          * the elements of the previous array.
          */
         void ensure_capacity();
@@ -471,7 +475,9 @@ namespace wlp {
          * @return reference to the element
          */
         val_type &at(size_type i) {
-            normalize(i);
+            if (i >= m_size) {
+                normalize(i);
+            }
             return m_data[i];
         }
 
@@ -482,7 +488,9 @@ namespace wlp {
          * @return reference to the element
          */
         val_type const &at(size_type i) const {
-            normalize(i);
+            if (i >= m_size) {
+                normalize(i);
+            }
             return m_data[i];
         }
 
@@ -558,6 +566,22 @@ namespace wlp {
             return m_data;
         }
 
+        /**
+         * @return a span over the elements in the list, which is
+         * invalidated by any insertion or removal
+         */
+        span<val_type> as_span() {
+            return span<val_type>(m_data, m_size);
+        }
+
+        /**
+         * @return a span over the elements in the list, which is
+         * invalidated by any insertion or removal
+         */
+        span<const val_type> as_span() const {
+            return span<const val_type>(m_data, m_size);
+        }
+
         /**
          * Clear the contents of the array list
          * such that it is empty.
@@ -751,7 +775,12 @@ namespace wlp {
          * @return reference to this list
          */
         list_type &operator=(list_type &&list) {
-            destroy<val_type[]>(m_data);
+            if (this == &list) {
+                return *this;
+            }
+            if (m_data) {
+                destroy<val_type[]>(m_data);
+            }
             m_data = move(list.m_data);
             m_size = move(list.m_size);
             m_capacity = move(list.m_capacity);
@@ -761,6 +790,17 @@ namespace wlp {
             return *this;
         }
 
+        /**
+         * Exchange the backing arrays of two lists.
+         *
+         * @param list array list to swap with
+         */
+        void swap(list_type &list) noexcept {
+            wlp::swap(m_data, list.m_data);
+            wlp::swap(m_size, list.m_size);
+            wlp::swap(m_capacity, list.m_capacity);
+        }
+
     };
 
     template<typename T>
@@ -768,12 +808,14 @@ namespace wlp {
         if (m_size < m_capacity) {
             return;
         }
-        size_type new_capacity = static_cast<size_type>(2 * m_capacity);
+        size_type new_capacity = m_capacity == 0 ? 1 : static_cast<size_type>(2 * m_capacity);
         val_type *new_data = create<val_type[]>(new_capacity);
         for (size_type i = 0; i < m_size; i++) {
-            new_data[i] = m_data[i];
+            new_data[i] = move(m_data[i]);
+        }
+        if (m_data) {
+            destroy<val_type[]>(m_data);
         }
-        destroy<val_type[]>(m_data);
         m_data = new_data;
         m_capacity = new_capacity;
     }
@@ -785,9 +827,11 @@ namespace wlp {
         }
         val_type *new_data = create<val_type[]>(new_capacity);
         for (size_type i = 0; i < m_size; i++) {
-            new_data[i] = m_data[i];
+            new_data[i] = move(m_data[i]);
+        }
+        if (m_data) {
+            destroy<val_type[]>(m_data);
         }
-        destroy<val_type[]>(m_data);
         m_data = new_data;
         m_capacity = new_capacity;
     }
@@ -799,7 +843,7 @@ namespace wlp {
         }
         val_type *new_data = create<val_type[]>(m_size);
         for (size_type i = 0; i < m_size; i++) {
-            new_data[i] = m_data[i];
+            new_data[i] = move(m_data[i]);
         }
         destroy<val_type[]>(m_data);
         m_data = new_data;
@@ -809,14 +853,14 @@ namespace wlp {
     template<typename T>
     inline void array_list<T>::shift_right(size_type i) {
         for (size_type j = m_size; j > i; j--) {
-            m_data[j] = m_data[j - 1];
+            m_data[j] = move(m_data[j - 1]);
         }
     }
 
     template<typename T>
     inline void array_list<T>::shift_left(size_type i) {
         for (size_type j = i; j < m_size - 1; j++) {
-            m_data[j] = m_data[j + 1];
+            m_data[j] = move(m_data[j + 1]);
         }
     }
 
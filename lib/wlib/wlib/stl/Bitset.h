@@ -54,17 +54,17 @@ namespace wlp {
      * needed to store a certain number of bits.
      * @tparam nBits the bits to store
      */
-    template<uint8_t nBits>
+    template<uint16_t nBits>
     struct ceil_bits {
         static const uint32_t value = static_cast<uint32_t>((nBits + INT32_SIZE - 1) / INT32_SIZE);
     };
 
-    template<uint8_t nBits>
+    template<uint16_t nBits>
     struct next_byte {
         static constexpr uint16_t value = static_cast<const uint16_t>((nBits + BYTE_SIZE - 1) / BYTE_SIZE);
     };
 
-    template<uint8_t nBits>
+    template<uint16_t nBits>
     class bit_set {
     public:
         /**
@@ -151,6 +151,30 @@ namespace wlp {
             return (m_array[index / INT32_SIZE] & (1U << (index % INT32_SIZE))) != 0;
         }
 
+        /**
+         * Find the first set bit at or after @code index @endcode,
+         * scanning a whole word at a time.
+         *
+         * @param index the position to start from
+         * @return the position of the bit, or @code nBits @endcode if
+         * no later bit is set
+         */
+        uint16_t find_next(uint16_t index) const {
+            if (index >= nBits) {
+                return nBits;
+            }
+            uint32_t i = index / INT32_SIZE;
+            uint32_t word = m_array[i] & (~0U << (index % INT32_SIZE));
+            while (word == 0) {
+                if (++i == ceil_bits<nBits>::value) {
+                    return nBits;
+                }
+                word = m_array[i];
+            }
+            const uint32_t found = static_cast<uint32_t>(i * INT32_SIZE) + static_cast<uint32_t>(__builtin_ctz(word));
+            return static_cast<uint16_t>(found < nBits ? found : nBits);
+        }
+
         /**
          * Converts the bits into 64 bit unsigned integer
          *
@@ -13,6 +13,8 @@
 #include <string.h> // strcmp
 
 #include <wlib/stl/Equal.h>
+#include <wlib/strings/Ascii.h>
+#include <wlib/strings/SharedString.h>
 #include <wlib/strings/String.h>
 
 namespace wlp {
@@ -118,30 +120,94 @@ namespace wlp {
      *
      * @tparam tSize static string size
      */
-    template<uint16_t tSize>
+    template<size_t tSize>
     struct comparator<static_string <tSize>> {
         bool __lt__(const static_string <tSize> &s1, const static_string <tSize> &s2) const {
-            return strcmp(s1.c_str(), s2.c_str()) < 0;
+            return s1.compare(s2) < 0;
         }
 
         bool __le__(const static_string <tSize> &s1, const static_string <tSize> &s2) const {
-            return strcmp(s1.c_str(), s2.c_str()) <= 0;
+            return s1.compare(s2) <= 0;
         }
 
         bool __eq__(const static_string <tSize> &s1, const static_string <tSize> &s2) const {
-            return strcmp(s1.c_str(), s2.c_str()) == 0;
+            return s1.equals(s2);
         }
 
         bool __ne__(const static_string <tSize> &s1, const static_string <tSize> &s2) const {
-            return strcmp(s1.c_str(), s2.c_str()) != 0;
+            return !s1.equals(s2);
         }
 
         bool __gt__(const static_string <tSize> &s1, const static_string <tSize> &s2) const {
-            return strcmp(s1.c_str(), s2.c_str()) > 0;
+            return s1.compare(s2) > 0;
         }
 
         bool __ge__(const static_string <tSize> &s1, const static_string <tSize> &s2) const {
-            return strcmp(s1.c_str(), s2.c_str()) >= 0;
+            return s1.compare(s2) >= 0;
+        }
+    };
+
+    /**
+     * Template specialization for shared strings.
+     */
+    template<>
+    struct comparator<shared_string> {
+        bool __lt__(const shared_string &s1, const shared_string &s2) const {
+            return s1.compare(s2) < 0;
+        }
+
+        bool __le__(const shared_string &s1, const shared_string &s2) const {
+            return s1.compare(s2) <= 0;
+        }
+
+        bool __eq__(const shared_string &s1, const shared_string &s2) const {
+            return s1.equals(s2);
+        }
+
+        bool __ne__(const shared_string &s1, const shared_string &s2) const {
+            return !s1.equals(s2);
+        }
+
+        bool __gt__(const shared_string &s1, const shared_string &s2) const {
+            return s1.compare(s2) > 0;
+        }
+
+        bool __ge__(const shared_string &s1, const shared_string &s2) const {
+            return s1.compare(s2) >= 0;
+        }
+    };
+
+    /**
+     * Comparator for strings that orders them with the ASCII letters
+     * in lower case. Works for static strings, dynamic strings, C
+     * strings, and string views.
+     *
+     * @tparam T compared string type
+     */
+    template<typename T>
+    struct case_insensitive_comparator {
+        bool __lt__(const T &t1, const T &t2) const {
+            return compare_ignore_case(string_view(t1), string_view(t2)) < 0;
+        }
+
+        bool __le__(const T &t1, const T &t2) const {
+            return compare_ignore_case(string_view(t1), string_view(t2)) <= 0;
+        }
+
+        bool __eq__(const T &t1, const T &t2) const {
+            return equals_ignore_case(string_view(t1), string_view(t2));
+        }
+
+        bool __ne__(const T &t1, const T &t2) const {
+            return !equals_ignore_case(string_view(t1), string_view(t2));
+        }
+
+        bool __gt__(const T &t1, const T &t2) const {
+            return compare_ignore_case(string_view(t1), string_view(t2)) > 0;
+        }
+
+        bool __ge__(const T &t1, const T &t2) const {
+            return compare_ignore_case(string_view(t1), string_view(t2)) >= 0;
         }
     };
 
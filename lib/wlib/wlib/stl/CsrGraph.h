@@ -0,0 +1,352 @@
+/**
+ * @file CsrGraph.h
+ * @brief Compressed sparse row graph with breadth-first search and
+ * Dijkstra's shortest paths.
+ *
+ * The graph keeps the targets and weights of all edges in two arrays,
+ * grouped by source vertex, and an array of the offset of each
+ * vertex's group. The neighbours of a vertex are one contiguous run,
+ * so a traversal reads the edges in order without following pointers.
+ * The graph is built once from an edge list with a counting sort by
+ * source and is not modified afterwards.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_CSRGRAPH_H
+#define EMBEDDEDCPLUSPLUS_CSRGRAPH_H
+
+#include <stdint.h>
+
+#include <wlib/stl/ArrayHeap.h>
+#include <wlib/stl/ArrayList.h>
+#include <wlib/stl/Monoid.h>
+#include <wlib/stl/Span.h>
+
+namespace wlp {
+
+    /**
+     * Marks a vertex that a search did not reach, in depth and parent
+     * outputs.
+     */
+    enum : uint32_t {
+        graph_unreached = 0xffffffffu
+    };
+
+    /**
+     * A directed edge for building a graph.
+     *
+     * @tparam W weight type
+     */
+    template<typename W>
+    struct graph_edge {
+        uint32_t source;
+        uint32_t target;
+        W weight;
+    };
+
+    /**
+     * Immutable directed graph in compressed sparse row form, with
+     * vertices numbered from zero.
+     *
+     * @tparam W edge weight type
+     */
+    template<typename W = uint32_t>
+    class csr_graph {
+    public:
+        typedef uint32_t size_type;
+        typedef W weight_type;
+        typedef csr_graph<W> graph_type;
+
+    private:
+        /**
+         * Offset of the first edge of each vertex, and the edge count
+         * at the end.
+         */
+        array_list<uint32_t> m_offsets;
+        array_list<uint32_t> m_targets;
+        array_list<W> m_weights;
+
+        void place(uint32_t *next, uint32_t source, uint32_t target, const W &weight) {
+            const uint32_t e = next[source]++;
+            m_targets[e] = target;
+            m_weights[e] = weight;
+        }
+
+    public:
+        /**
+         * Build a graph from a list of edges. Edges keep their list
+         * order among the edges of the same source.
+         *
+         * @param vertices number of vertices; edge endpoints must be
+         *                 smaller
+         * @param edges    the edges, each with a @code source @endcode,
+         *                 @code target @endcode, and @code weight @endcode
+         * @param both_ways whether to also add each edge reversed, for
+         *                 undirected graphs such as track networks
+         */
+        template<typename Edge>
+        csr_graph(size_type vertices, span<Edge> edges, bool both_ways = false)
+                : m_offsets(static_cast<size_t>(vertices) + 1),
+                  m_targets(edges.size() * (both_ways ? 2 : 1)),
+                  m_weights(edges.size() * (both_ways ? 2 : 1)) {
+            for (size_type v = 0; v <= vertices; ++v) {
+                m_offsets.push_back(0);
+            }
+            uint32_t *const offsets = m_offsets.data();
+            // count the edges of each source one place over, so that
+            // the running sum leaves each offset at its group's start
+            for (size_t e = 0; e < edges.size(); ++e) {
+                ++offsets[edges[e].source + 1];
+                if (both_ways) {
+                    ++offsets[edges[e].target + 1];
+                }
+            }
+            for (size_type v = 0; v < vertices; ++v) {
+                offsets[v + 1] += offsets[v];
+            }
+            const uint32_t total = offsets[vertices];
+            for (uint32_t e = 0; e < total; ++e) {
+                m_targets.push_back(0);
+                m_weights.push_back(W());
+            }
+            // place each edge at the next free slot of its source,
+            // which is the next vertex's offset once the group is full
+            array_list<uint32_t> next(static_cast<size_t>(vertices) + 1);
+            for (size_type v = 0; v <= vertices; ++v) {
+                next.push_back(offsets[v]);
+            }
+            for (size_t e = 0; e < edges.size(); ++e) {
+                place(next.data(), edges[e].source, edges[e].target, edges[e].weight);
+                if (both_ways) {
+                    place(next.data(), edges[e].target, edges[e].source, edges[e].weight);
+                }
+            }
+        }
+
+        csr_graph(const graph_type &) = delete;
+
+        csr_graph(graph_type &&graph)
+                : m_offsets(move(graph.m_offsets)),
+                  m_targets(move(graph.m_targets)),
+                  m_weights(move(graph.m_weights)) {
+        }
+
+        /**
+         * @return the number of vertices
+         */
+        size_type vertices() const {
+            return m_offsets.empty() ? 0 : static_cast<size_type>(m_offsets.size() - 1);
+        }
+
+        /**
+         * @return the number of edges
+         */
+        size_type edges() const {
+            return static_cast<size_type>(m_targets.size());
+        }
+
+        /**
+         * @return the number of edges out of a vertex
+         */
+        size_type degree(size_type v) const {
+            return m_offsets[v + 1] - m_offsets[v];
+        }
+
+        /**
+         * @return the targets of the edges out of a vertex
+         */
+        span<const uint32_t> neighbors(size_type v) const {
+            return span<const uint32_t>(m_targets.data() + m_offsets[v], degree(v));
+        }
+
+        /**
+         * @return the weights of the edges out of a vertex, in the same
+         *         order as the neighbours
+         */
+        span<const W> weights(size_type v) const {
+            return span<const W>(m_weights.data() + m_offsets[v], degree(v));
+        }
+
+        graph_type &operator=(const graph_type &) = delete;
+
+        graph_type &operator=(graph_type &&graph) {
+            m_offsets = move(graph.m_offsets);
+            m_targets = move(graph.m_targets);
+            m_weights = move(graph.m_weights);
+            return *this;
+        }
+
+        void swap(graph_type &graph) {
+            m_offsets.swap(graph.m_offsets);
+            m_targets.swap(graph.m_targets);
+            m_weights.swap(graph.m_weights);
+        }
+    };
+
+    /**
+     * Find the number of edges from the nearest source to each vertex,
+     * ignoring weights.
+     *
+     * @param graph   the graph
+     * @param sources vertices at depth zero
+     * @param depth   output depth of each vertex, or
+     *                @code graph_unreached @endcode; at least one per
+     *                vertex
+     * @return the number of vertices reached
+     */
+    template<typename W, typename S>
+    uint32_t breadth_first(const csr_graph<W> &graph, span<S> sources, span<uint32_t> depth) {
+        const uint32_t n = graph.vertices();
+        for (uint32_t v = 0; v < n; ++v) {
+            depth[v] = graph_unreached;
+        }
+        // every vertex is queued at most once, so the queue is an array
+        // read from the front
+        array_list<uint32_t> queue(n);
+        for (size_t i = 0; i < sources.size(); ++i) {
+            const uint32_t s = sources[i];
+            if (depth[s] == graph_unreached) {
+                depth[s] = 0;
+                queue.push_back(s);
+            }
+        }
+        for (size_t head = 0; head < queue.size(); ++head) {
+            const uint32_t v = queue[head];
+            const uint32_t next = depth[v] + 1;
+            span<const uint32_t> out = graph.neighbors(v);
+            for (size_t e = 0; e < out.size(); ++e) {
+                const uint32_t t = out[e];
+                if (depth[t] == graph_unreached) {
+                    depth[t] = next;
+                    queue.push_back(t);
+                }
+            }
+        }
+        return static_cast<uint32_t>(queue.size());
+    }
+
+    template<typename W>
+    uint32_t breadth_first(const csr_graph<W> &graph, uint32_t source, span<uint32_t> depth) {
+        return breadth_first(graph, span<uint32_t>(&source, 1), depth);
+    }
+
+    /**
+     * Tentative distance of a vertex in the Dijkstra queue.
+     */
+    template<typename W>
+    struct __dijkstra_entry {
+        W distance;
+        uint32_t vertex;
+    };
+
+    /**
+     * Orders the Dijkstra queue by reverse distance so the nearest
+     * vertex is on top of the max heap.
+     */
+    template<typename W>
+    struct __dijkstra_order {
+        typedef __dijkstra_entry<W> entry;
+
+        bool __lt__(const entry &a, const entry &b) const {
+            return b.distance < a.distance;
+        }
+
+        bool __le__(const entry &a, const entry &b) const {
+            return !(a.distance < b.distance);
+        }
+
+        bool __eq__(const entry &a, const entry &b) const {
+            return a.distance == b.distance;
+        }
+
+        bool __ne__(const entry &a, const entry &b) const {
+            return !(a.distance == b.distance);
+        }
+
+        bool __gt__(const entry &a, const entry &b) const {
+            return a.distance < b.distance;
+        }
+
+        bool __ge__(const entry &a, const entry &b) const {
+            return !(b.distance < a.distance);
+        }
+    };
+
+    /**
+     * Find the shortest distance from the nearest source to each
+     * vertex, with weights that are not negative. Rather than lowering
+     * the key of a queued vertex, a shorter distance queues the vertex
+     * again, and entries whose distance is no longer the vertex's are
+     * skipped when they reach the top.
+     *
+     * @param graph    the graph
+     * @param sources  vertices at distance zero
+     * @param distance output distance of each vertex, or the greatest
+     *                 weight value if it is not reached; at least one
+     *                 per vertex
+     * @param parent   output previous vertex on each shortest path,
+     *                 which is the vertex itself for sources and
+     *                 @code graph_unreached @endcode for vertices not
+     *                 reached; may be empty to skip
+     * @return the number of vertices reached
+     */
+    template<typename W, typename S>
+    uint32_t dijkstra(const csr_graph<W> &graph, span<S> sources, span<W> distance,
+                      span<uint32_t> parent = span<uint32_t>()) {
+        const uint32_t n = graph.vertices();
+        const W far = monoid_bounds<W>::highest();
+        const bool parents = !parent.empty();
+        for (uint32_t v = 0; v < n; ++v) {
+            distance[v] = far;
+            if (parents) {
+                parent[v] = graph_unreached;
+            }
+        }
+        array_heap<__dijkstra_entry<W>, __dijkstra_order<W>> queue(n);
+        for (size_t i = 0; i < sources.size(); ++i) {
+            const uint32_t s = sources[i];
+            if (distance[s] != W()) {
+                distance[s] = W();
+                if (parents) {
+                    parent[s] = s;
+                }
+                queue.push(__dijkstra_entry<W>{W(), s});
+            }
+        }
+        uint32_t reached = 0;
+        while (!queue.empty()) {
+            const __dijkstra_entry<W> top = queue.top();
+            queue.pop();
+            if (distance[top.vertex] < top.distance) {
+                continue;
+            }
+            ++reached;
+            span<const uint32_t> out = graph.neighbors(top.vertex);
+            span<const W> weight = graph.weights(top.vertex);
+            for (size_t e = 0; e < out.size(); ++e) {
+                const uint32_t t = out[e];
+                const W d = top.distance + weight[e];
+                if (d < distance[t]) {
+                    distance[t] = d;
+                    if (parents) {
+                        parent[t] = top.vertex;
+                    }
+                    queue.push(__dijkstra_entry<W>{d, t});
+                }
+            }
+        }
+        return reached;
+    }
+
+    template<typename W>
+    uint32_t dijkstra(const csr_graph<W> &graph, uint32_t source, span<W> distance,
+                      span<uint32_t> parent = span<uint32_t>()) {
+        return dijkstra(graph, span<uint32_t>(&source, 1), distance, parent);
+    }
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_CSRGRAPH_H
@@ -0,0 +1,406 @@
+/**
+ * @file DirectMap.h
+ * @brief Map over a small, dense range of integer keys.
+ *
+ * The key is the index into a contiguous array of values, and a bit set
+ * records which slots are occupied. There is no hashing, probing, or
+ * per-element allocation, which suits register maps, message IDs, and
+ * other tables whose keys are known to lie in a small range.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_DIRECTMAP_H
+#define EMBEDDEDCPLUSPLUS_DIRECTMAP_H
+
+#include <wlib/stl/Bitset.h>
+#include <wlib/stl/Helper.h>
+#include <wlib/stl/Pair.h>
+#include <wlib/memory>
+#include <wlib/utility>
+
+namespace wlp {
+
+    // Forward declaration of direct map
+    template<typename Val, uint16_t MaxKey>
+    class direct_map;
+
+    /**
+     * Iterator over the occupied slots of a direct map in increasing
+     * key order. Empty slots are skipped by scanning the occupancy
+     * bits a word at a time.
+     *
+     * @tparam Val    value type
+     * @tparam MaxKey largest key of the map
+     * @tparam Ref    reference type to value
+     * @tparam Ptr    pointer type to value
+     */
+    template<typename Val, uint16_t MaxKey, typename Ref, typename Ptr>
+    struct DirectMapIterator {
+        typedef DirectMapIterator<Val, MaxKey, Ref, Ptr> self_type;
+        typedef bit_set<MaxKey + 1> bits_type;
+
+        typedef uint16_t key_type;
+        typedef Val val_type;
+        typedef Ref reference;
+        typedef Ptr pointer;
+
+        typedef size_t size_type;
+
+        /**
+         * Values array of the map.
+         */
+        pointer m_values;
+        /**
+         * Occupancy bits of the map.
+         */
+        const bits_type *m_bits;
+        /**
+         * Key of the current slot, or one past the largest
+         * key if past-the-end.
+         */
+        key_type m_key;
+        /**
+         * Occupancy bits of the current word above the current key,
+         * so that most increments avoid reloading the word.
+         */
+        uint32_t m_rest;
+
+        DirectMapIterator()
+                : m_values(nullptr),
+                  m_bits(nullptr),
+                  m_key(MaxKey + 1),
+                  m_rest(0) {
+        }
+
+        DirectMapIterator(pointer values, const bits_type *bits, key_type key)
+                : m_values(values),
+                  m_bits(bits),
+                  m_key(key),
+                  m_rest(rest_of_word(bits, key)) {
+        }
+
+        DirectMapIterator(const self_type &it)
+                : m_values(it.m_values),
+                  m_bits(it.m_bits),
+                  m_key(it.m_key),
+                  m_rest(it.m_rest) {
+        }
+
+        /**
+         * @return the set bits in the word of the key that lie above it
+         */
+        static uint32_t rest_of_word(const bits_type *bits, key_type key) {
+            if (key > MaxKey) {
+                return 0;
+            }
+            return bits->data()[key / 32] & ~((2U << (key % 32)) - 1);
+        }
+
+        /**
+         * @return reference to the value in the current slot
+         */
+        reference operator*() const {
+            return m_values[m_key];
+        }
+
+        /**
+         * @return pointer to the value in the current slot
+         */
+        pointer operator->() const {
+            return &(operator*());
+        }
+
+        const key_type &key() const {
+            return m_key;
+        }
+
+        /**
+         * Advance to the next occupied slot.
+         *
+         * @return this iterator
+         */
+        self_type &operator++() {
+            if (m_rest != 0) {
+                m_key = static_cast<key_type>((m_key & ~31U) + static_cast<uint32_t>(__builtin_ctz(m_rest)));
+                m_rest &= m_rest - 1;
+                return *this;
+            }
+            const uint32_t next = (m_key | 31U) + 1;
+            m_key = next > MaxKey ? static_cast<key_type>(MaxKey + 1)
+                                  : m_bits->find_next(static_cast<key_type>(next));
+            m_rest = rest_of_word(m_bits, m_key);
+            return *this;
+        }
+
+        self_type operator++(int) {
+            self_type tmp(*this);
+            ++*this;
+            return tmp;
+        }
+
+        bool operator==(const self_type &it) const {
+            return m_key == it.m_key;
+        }
+
+        bool operator!=(const self_type &it) const {
+            return m_key != it.m_key;
+        }
+
+        self_type &operator=(const self_type &it) {
+            m_values = it.m_values;
+            m_bits = it.m_bits;
+            m_key = it.m_key;
+            m_rest = it.m_rest;
+            return *this;
+        }
+    };
+
+    /**
+     * Map whose keys are the integers from zero to @code MaxKey @endcode,
+     * stored as a flat array of values indexed by key. Lookup, insertion,
+     * and removal are a bit test and an array access. Memory is fixed at
+     * one value and one bit per possible key, so the map is only suitable
+     * when the key range is small and reasonably well populated.
+     *
+     * Keys beyond @code MaxKey @endcode are never present: @code insert @endcode
+     * fails and @code find @endcode returns past-the-end. Accessing such a
+     * key through @code at @endcode or the subscript operator is undefined.
+     *
+     * @tparam Val    value type, which must be default constructible
+     * @tparam MaxKey largest key the map can hold
+     */
+    template<typename Val, uint16_t MaxKey>
+    class direct_map {
+        static_assert(MaxKey < 0xffff, "Direct map keys must fit in 16 bits");
+
+    public:
+        typedef direct_map<Val, MaxKey> map_type;
+        typedef DirectMapIterator<Val, MaxKey, Val &, Val *> iterator;
+        typedef DirectMapIterator<Val, MaxKey, const Val &, const Val *> const_iterator;
+        typedef bit_set<MaxKey + 1> bits_type;
+        typedef size_t size_type;
+
+        typedef uint16_t key_type;
+        typedef Val val_type;
+
+    private:
+        static constexpr key_type s_end = MaxKey + 1;
+
+        bits_type m_bits;
+        val_type *m_values;
+        size_type m_size;
+
+        /**
+         * @return the value array, allocated if the map was moved from
+         */
+        val_type *values() {
+            if (!m_values) {
+                m_values = create<val_type[]>(static_cast<size_type>(MaxKey) + 1);
+            }
+            return m_values;
+        }
+
+    public:
+        direct_map()
+                : m_bits(),
+                  m_values(create<val_type[]>(static_cast<size_type>(MaxKey) + 1)),
+                  m_size(0) {
+        }
+
+        direct_map(const map_type &) = delete;
+
+        direct_map(map_type &&map)
+                : m_bits(map.m_bits),
+                  m_values(map.m_values),
+                  m_size(map.m_size) {
+            map.m_bits = bits_type();
+            map.m_values = nullptr;
+            map.m_size = 0;
+        }
+
+        ~direct_map() {
+            if (!m_values) {
+                return;
+            }
+            destroy<val_type[]>(m_values);
+            m_values = nullptr;
+        }
+
+        size_type size() const {
+            return m_size;
+        }
+
+        /**
+         * @return the number of keys the map can hold
+         */
+        size_type capacity() const {
+            return s_end;
+        }
+
+        bool empty() const {
+            return m_size == 0;
+        }
+
+        /**
+         * @return the occupancy bits, one per key
+         */
+        const bits_type &occupancy() const {
+            return m_bits;
+        }
+
+        iterator begin() {
+            return iterator(m_values, &m_bits, m_bits.find_next(0));
+        }
+
+        const_iterator begin() const {
+            return const_iterator(m_values, &m_bits, m_bits.find_next(0));
+        }
+
+        iterator end() {
+            return iterator(m_values, &m_bits, s_end);
+        }
+
+        const_iterator end() const {
+            return const_iterator(m_values, &m_bits, s_end);
+        }
+
+        /**
+         * Remove all entries, resetting each occupied slot to a
+         * default value so that resources held by values are freed.
+         */
+        void clear() noexcept {
+            for (key_type key = m_bits.find_next(0); key < s_end; key = m_bits.find_next(static_cast<key_type>(key + 1))) {
+                m_values[key] = val_type();
+            }
+            m_bits = bits_type();
+            m_size = 0;
+        }
+
+        /**
+         * Insert a value if the key is not already present.
+         *
+         * @param key the key to insert
+         * @param val the value to insert
+         * @return an iterator to the entry for the key, and whether the
+         * insertion took place; past-the-end if the key is out of range
+         */
+        template<typename V>
+        pair<iterator, bool> insert(key_type key, V &&val) {
+            if (key >= s_end) {
+                return pair<iterator, bool>(end(), false);
+            }
+            if (m_bits.test(key)) {
+                return pair<iterator, bool>(iterator(m_values, &m_bits, key), false);
+            }
+            values()[key] = forward<V>(val);
+            m_bits.set(key);
+            ++m_size;
+            return pair<iterator, bool>(iterator(m_values, &m_bits, key), true);
+        };
+
+        template<typename V>
+        pair<iterator, bool> insert_or_assign(key_type key, V &&val) {
+            if (key >= s_end) {
+                return pair<iterator, bool>(end(), false);
+            }
+            values()[key] = forward<V>(val);
+            const bool inserted = !m_bits.test(key);
+            if (inserted) {
+                m_bits.set(key);
+                ++m_size;
+            }
+            return pair<iterator, bool>(iterator(m_values, &m_bits, key), inserted);
+        };
+
+        /**
+         * Remove the entry at the iterator.
+         *
+         * @param pos iterator to an entry in this map
+         * @return iterator to the next entry
+         */
+        iterator erase(const iterator &pos) {
+            iterator tmp = pos;
+            ++tmp;
+            erase(pos.m_key);
+            return tmp;
+        }
+
+        bool erase(const key_type &key) {
+            if (key >= s_end || !m_bits.test(key)) {
+                return false;
+            }
+            m_values[key] = val_type();
+            m_bits.reset(key);
+            --m_size;
+            return true;
+        }
+
+        val_type &at(const key_type &key) {
+            return values()[key];
+        }
+
+        /**
+         * @pre the key is in the map
+         */
+        const val_type &at(const key_type &key) const {
+            return m_values[key];
+        }
+
+        bool contains(const key_type &key) const {
+            return key < s_end && m_bits.test(key);
+        }
+
+        iterator find(const key_type &key) {
+            return contains(key) ? iterator(m_values, &m_bits, key) : end();
+        }
+
+        const_iterator find(const key_type &key) const {
+            return contains(key) ? const_iterator(m_values, &m_bits, key) : end();
+        }
+
+        /**
+         * Access the value for a key, inserting a default value if
+         * the key is not present.
+         *
+         * @param key key in the range of the map
+         * @return reference to the value
+         */
+        val_type &operator[](const key_type &key) {
+            if (!m_bits.test(key)) {
+                m_bits.set(key);
+                ++m_size;
+            }
+            return values()[key];
+        }
+
+        map_type &operator=(const map_type &) = delete;
+
+        map_type &operator=(map_type &&map) {
+            if (this == &map) {
+                return *this;
+            }
+            if (m_values) {
+                destroy<val_type[]>(m_values);
+            }
+            m_bits = map.m_bits;
+            m_values = map.m_values;
+            m_size = map.m_size;
+            map.m_bits = bits_type();
+            map.m_values = nullptr;
+            map.m_size = 0;
+            return *this;
+        }
+
+        void swap(map_type &map) noexcept {
+            wlp::swap(m_bits, map.m_bits);
+            wlp::swap(m_values, map.m_values);
+            wlp::swap(m_size, map.m_size);
+        }
+    };
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_DIRECTMAP_H
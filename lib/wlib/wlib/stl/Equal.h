@@ -12,7 +12,10 @@
 
 #include <string.h> // strcmp
 
+#include <wlib/strings/Ascii.h>
+#include <wlib/strings/SharedString.h>
 #include <wlib/strings/String.h>
+#include <wlib/stl/Tuple.h>
 
 namespace wlp {
 
@@ -33,10 +36,10 @@ namespace wlp {
      *
      * @tparam tSize static string size
      */
-    template<uint16_t tSize>
+    template<size_t tSize>
     struct equals<static_string<tSize>> {
         bool operator()(const static_string<tSize> &key1, const static_string<tSize> &key2) const {
-            return strcmp(key1.c_str(), key2.c_str()) == 0;
+            return key1.equals(key2);
         }
     };
 
@@ -45,10 +48,10 @@ namespace wlp {
      *
      * @tparam tSize static string size
      */
-    template<uint16_t tSize>
+    template<size_t tSize>
     struct equals<const static_string<tSize>> {
         bool operator()(const static_string<tSize> &key1, const static_string<tSize> &key2) const {
-            return strcmp(key1.c_str(), key2.c_str()) == 0;
+            return key1.equals(key2);
         }
     };
 
@@ -66,6 +69,26 @@ namespace wlp {
         }
     };
 
+    /**
+     * Template specialization for shared strings.
+     */
+    template<>
+    struct equals<shared_string> {
+        bool operator()(const shared_string &str1, const shared_string &str2) const {
+            return str1.equals(str2);
+        }
+    };
+
+    /**
+     * Template specialization for const shared strings.
+     */
+    template<>
+    struct equals<const shared_string> {
+        bool operator()(const shared_string &str1, const shared_string &str2) const {
+            return str1.equals(str2);
+        }
+    };
+
     /**
      * Template specialization for character arrays.
      */
@@ -86,6 +109,68 @@ namespace wlp {
         }
     };
 
+    /**
+     * Equality for string keys that ignores ASCII case. Works for
+     * static strings, dynamic strings, C strings, and string views.
+     *
+     * @tparam Key string key type
+     */
+    template<class Key>
+    struct case_insensitive_equals {
+        bool operator()(const Key &key1, const Key &key2) const {
+            return equals_ignore_case(string_view(key1), string_view(key2));
+        }
+    };
+
+    /**
+     * Template specialization for pairs, which are equal if both their
+     * values are equal under their own equality functions.
+     *
+     * @tparam First  first value type
+     * @tparam Second second value type
+     */
+    template<class First, class Second>
+    struct equals<pair<First, Second>> {
+        bool operator()(const pair<First, Second> &key1, const pair<First, Second> &key2) const {
+            return equals<First>()(key1.first(), key2.first()) &&
+                   equals<Second>()(key1.second(), key2.second());
+        }
+    };
+
+    /**
+     * Compares the values of two tuples from the I-th onwards, stopping
+     * at the first unequal value.
+     */
+    template<int I, int N>
+    struct __tuple_equals {
+        template<class... Types>
+        static bool apply(const tuple<Types...> &key1, const tuple<Types...> &key2) {
+            return equals<TypeAtIndexType<I, Types...>>()(get<I>(key1), get<I>(key2)) &&
+                   __tuple_equals<I + 1, N>::apply(key1, key2);
+        }
+    };
+
+    template<int N>
+    struct __tuple_equals<N, N> {
+        template<class... Types>
+        static bool apply(const tuple<Types...> &, const tuple<Types...> &) {
+            return true;
+        }
+    };
+
+    /**
+     * Template specialization for tuples, which are equal if all their
+     * values are equal under their own equality functions.
+     *
+     * @tparam Types tuple types
+     */
+    template<class... Types>
+    struct equals<tuple<Types...>> {
+        bool operator()(const tuple<Types...> &key1, const tuple<Types...> &key2) const {
+            return __tuple_equals<0, sizeof...(Types)>::apply(key1, key2);
+        }
+    };
+
 }
 
 #endif //CORE_STL_EQUAL_H
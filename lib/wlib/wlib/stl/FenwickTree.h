@@ -0,0 +1,210 @@
+/**
+ * @file FenwickTree.h
+ * @brief Binary indexed tree of prefix combinations.
+ *
+ * A Fenwick tree answers prefix sums and adds to single elements in
+ * logarithmic time, in an array of the same length as the elements.
+ * Element @p k, counting from one, stores the combination of the
+ * @code k & -k @endcode elements that end at it.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_FENWICKTREE_H
+#define EMBEDDEDCPLUSPLUS_FENWICKTREE_H
+
+#include <stddef.h>
+
+#include <wlib/memory>
+#include <wlib/stl/Helper.h>
+#include <wlib/stl/Monoid.h>
+#include <wlib/stl/Span.h>
+
+namespace wlp {
+
+    /**
+     * Fenwick tree over a commutative monoid. Ranges that do not start
+     * at the first element, and setting elements, also need the
+     * monoid's @code subtract @endcode, as with sums.
+     *
+     * With the max monoid, which has no subtract, elements may only
+     * grow and only prefixes can be queried.
+     *
+     * @tparam T      element type
+     * @tparam Monoid the combining operation
+     */
+    template<typename T, typename Monoid = sum_monoid<T>>
+    class fenwick_tree {
+    public:
+        typedef size_t size_type;
+        typedef T val_type;
+        typedef fenwick_tree<T, Monoid> tree_type;
+
+    private:
+        /**
+         * Partial combinations, where index @code k - 1 @endcode holds
+         * node @p k.
+         */
+        T *m_tree;
+        size_type m_size;
+
+        static size_type low_bit(size_type k) {
+            return k & (~k + 1);
+        }
+
+    public:
+        /**
+         * Create a tree of identity elements.
+         *
+         * @param n number of elements
+         */
+        explicit fenwick_tree(size_type n = 0)
+                : m_tree(n > 0 ? create<T[]>(n) : nullptr),
+                  m_size(n) {
+            for (size_type k = 0; k < n; ++k) {
+                m_tree[k] = Monoid::identity();
+            }
+        }
+
+        /**
+         * Create a tree of the given elements in linear time, by adding
+         * each node into its parent in order.
+         *
+         * @param values the elements
+         */
+        template<typename U>
+        explicit fenwick_tree(span<U> values)
+                : m_tree(values.size() > 0 ? create<T[]>(values.size()) : nullptr),
+                  m_size(values.size()) {
+            for (size_type k = 0; k < m_size; ++k) {
+                m_tree[k] = values[k];
+            }
+            for (size_type k = 1; k <= m_size; ++k) {
+                const size_type parent = k + low_bit(k);
+                if (parent <= m_size) {
+                    m_tree[parent - 1] = Monoid::combine(m_tree[parent - 1], m_tree[k - 1]);
+                }
+            }
+        }
+
+        fenwick_tree(const tree_type &) = delete;
+
+        fenwick_tree(tree_type &&tree)
+                : m_tree(tree.m_tree),
+                  m_size(tree.m_size) {
+            tree.m_tree = nullptr;
+            tree.m_size = 0;
+        }
+
+        ~fenwick_tree() {
+            if (m_tree) {
+                destroy<T[]>(m_tree);
+            }
+        }
+
+        size_type size() const {
+            return m_size;
+        }
+
+        /**
+         * Combine a value into an element.
+         *
+         * @param i     element index
+         * @param value the value to combine
+         */
+        void add(size_type i, const T &value) {
+            for (size_type k = i + 1; k <= m_size; k += low_bit(k)) {
+                m_tree[k - 1] = Monoid::combine(m_tree[k - 1], value);
+            }
+        }
+
+        /**
+         * @param n number of leading elements, at most the size
+         * @return the combination of the first @p n elements
+         */
+        T prefix(size_type n) const {
+            T acc = Monoid::identity();
+            for (size_type k = n; k > 0; k -= low_bit(k)) {
+                acc = Monoid::combine(m_tree[k - 1], acc);
+            }
+            return acc;
+        }
+
+        /**
+         * @return the combination of the elements in [begin, end)
+         */
+        T range(size_type begin, size_type end) const {
+            return Monoid::subtract(prefix(end), prefix(begin));
+        }
+
+        /**
+         * @return the element at an index
+         */
+        T get(size_type i) const {
+            return range(i, i + 1);
+        }
+
+        /**
+         * Replace an element.
+         */
+        void set(size_type i, const T &value) {
+            add(i, Monoid::subtract(value, get(i)));
+        }
+
+        /**
+         * Find the first prefix that reaches a target, such as the
+         * bucket that holds the k-th event, by descending the implicit
+         * tree. Prefixes must not decrease, as with sums of elements
+         * that are not negative.
+         *
+         * @param target the value to reach
+         * @return the smallest index @p i such that the first
+         *         @code i + 1 @endcode elements combine to at least
+         *         @p target, or the size if there is none
+         */
+        size_type lower_bound(const T &target) const {
+            size_type step = 1;
+            while (step <= m_size / 2) {
+                step <<= 1;
+            }
+            size_type pos = 0;
+            T acc = Monoid::identity();
+            for (; step > 0 && m_size > 0; step >>= 1) {
+                if (pos + step <= m_size) {
+                    T next = Monoid::combine(acc, m_tree[pos + step - 1]);
+                    if (next < target) {
+                        pos += step;
+                        acc = next;
+                    }
+                }
+            }
+            return pos;
+        }
+
+        tree_type &operator=(const tree_type &) = delete;
+
+        tree_type &operator=(tree_type &&tree) {
+            if (this == &tree) {
+                return *this;
+            }
+            if (m_tree) {
+                destroy<T[]>(m_tree);
+            }
+            m_tree = tree.m_tree;
+            m_size = tree.m_size;
+            tree.m_tree = nullptr;
+            tree.m_size = 0;
+            return *this;
+        }
+
+        void swap(tree_type &tree) {
+            wlp::swap(m_tree, tree.m_tree);
+            wlp::swap(m_size, tree.m_size);
+        }
+    };
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_FENWICKTREE_H
@@ -0,0 +1,539 @@
+/**
+ * @file Fixed.h
+ * @brief Fixed-point number types for boards without an FPU.
+ *
+ * A @code fixed<IntBits, FracBits> @endcode stores a signed value in
+ * an 8, 16, or 32 bit integer with @code FracBits @endcode fractional
+ * bits. Arithmetic is done in the next wider integer type and the
+ * result is narrowed by an overflow policy, which either wraps like
+ * plain integers or saturates at the representable range.
+ *
+ * The math functions @code sqrt @endcode, @code sin @endcode,
+ * @code cos @endcode, @code atan2 @endcode, @code abs @endcode, and
+ * @code reciprocal @endcode are found by argument-dependent lookup,
+ * so templated code calling them unqualified compiles for both
+ * @code float @endcode and @code fixed @endcode value types, as does
+ * @code vector2d @endcode.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_FIXED_H
+#define EMBEDDEDCPLUSPLUS_FIXED_H
+
+#include <stdint.h>
+
+#include <wlib/type_traits>
+
+namespace wlp {
+
+    /**
+     * Overflow policy that truncates results to the storage width,
+     * so that values wrap around like plain integers.
+     */
+    struct fixed_wrap {
+        template<typename raw_t, typename wide_t>
+        static constexpr raw_t narrow(wide_t v, wide_t, wide_t) {
+            return static_cast<raw_t>(v);
+        }
+    };
+
+    /**
+     * Overflow policy that clamps results to the representable range.
+     */
+    struct fixed_saturate {
+        template<typename raw_t, typename wide_t>
+        static constexpr raw_t narrow(wide_t v, wide_t lo, wide_t hi) {
+            return static_cast<raw_t>(v < lo ? lo : (v > hi ? hi : v));
+        }
+    };
+
+    /**
+     * Storage and intermediate integer types for a fixed-point
+     * type of the given total width.
+     *
+     * @tparam Bits total number of bits, including the sign bit
+     */
+    template<uint8_t Bits>
+    struct __fixed_storage;
+
+    template<>
+    struct __fixed_storage<8> {
+        typedef int8_t raw_type;
+        typedef int16_t wide_type;
+        typedef uint16_t uwide_type;
+    };
+
+    template<>
+    struct __fixed_storage<16> {
+        typedef int16_t raw_type;
+        typedef int32_t wide_type;
+        typedef uint32_t uwide_type;
+    };
+
+    template<>
+    struct __fixed_storage<32> {
+        typedef int32_t raw_type;
+        typedef int64_t wide_type;
+        typedef uint64_t uwide_type;
+    };
+
+    /**
+     * Integer kernels shared by all fixed-point types. Angles and
+     * polynomial terms are computed in Q28, which leaves enough
+     * headroom for products in 64 bits while keeping the error of
+     * the approximations below the resolution of a Q16 result.
+     */
+    struct __fixed_math {
+        static constexpr int64_t q28_one = static_cast<int64_t>(1) << 28;
+        static constexpr int64_t q28_pi = 843314857;
+        static constexpr int64_t q28_half_pi = 421657428;
+        static constexpr int64_t q28_two_pi = 1686629713;
+
+        /**
+         * Convert a raw value with the given fractional bits to Q28.
+         */
+        static int64_t to_q28(int64_t raw, uint8_t frac) {
+            return frac <= 28
+                   ? raw * (static_cast<int64_t>(1) << (28 - frac))
+                   : raw >> (frac - 28);
+        }
+
+        /**
+         * Convert a Q28 value to a raw value with the given fractional
+         * bits, rounding to nearest.
+         */
+        static int64_t from_q28(int64_t q, uint8_t frac) {
+            if (frac >= 28) {
+                return q * (static_cast<int64_t>(1) << (frac - 28));
+            }
+            return (q + (static_cast<int64_t>(1) << (27 - frac))) >> (28 - frac);
+        }
+
+        /**
+         * Sine of a Q28 angle. The angle is reduced to the range
+         * [-pi/2, pi/2] and evaluated with an odd polynomial,
+         * Abramowitz and Stegun 4.3.97, whose error is about 2e-9.
+         */
+        static int64_t sin_q28(int64_t a) {
+            if (a > q28_pi || a < -q28_pi) {
+                a %= q28_two_pi;
+                if (a > q28_pi) {
+                    a -= q28_two_pi;
+                } else if (a < -q28_pi) {
+                    a += q28_two_pi;
+                }
+            }
+            if (a > q28_half_pi) {
+                a = q28_pi - a;
+            } else if (a < -q28_half_pi) {
+                a = -q28_pi - a;
+            }
+            const int64_t a2 = (a * a) >> 28;
+            int64_t p = -6;
+            p = ((p * a2) >> 28) + 739;
+            p = ((p * a2) >> 28) - 53260;
+            p = ((p * a2) >> 28) + 2236962;
+            p = ((p * a2) >> 28) - 44739243;
+            p = ((p * a2) >> 28) + q28_one;
+            return (p * a) >> 28;
+        }
+
+        /**
+         * Arctangent of y / x in Q28 radians, for raw values of any
+         * common scale. The ratio of the smaller to the larger
+         * magnitude is evaluated with Abramowitz and Stegun 4.4.49,
+         * whose error is about 2e-8, and mapped to the right octant.
+         */
+        static int64_t atan2_q28(int64_t y, int64_t x) {
+            const int64_t ax = x < 0 ? -x : x;
+            const int64_t ay = y < 0 ? -y : y;
+            if (ax == 0 && ay == 0) {
+                return 0;
+            }
+            const bool steep = ay > ax;
+            const int64_t z = ((steep ? ax : ay) << 28) / (steep ? ay : ax);
+            const int64_t z2 = (z * z) >> 28;
+            int64_t p = 769397;
+            p = ((p * z2) >> 28) - 4339457;
+            p = ((p * z2) >> 28) + 11518462;
+            p = ((p * z2) >> 28) - 20210409;
+            p = ((p * z2) >> 28) + 28605191;
+            p = ((p * z2) >> 28) - 38141724;
+            p = ((p * z2) >> 28) + 53669779;
+            p = ((p * z2) >> 28) - 89477981;
+            p = ((p * z2) >> 28) + q28_one;
+            int64_t r = (p * z) >> 28;
+            if (steep) {
+                r = q28_half_pi - r;
+            }
+            if (x < 0) {
+                r = q28_pi - r;
+            }
+            return y < 0 ? -r : r;
+        }
+
+        /**
+         * Approximate the reciprocal of a non-zero raw value without
+         * division. The magnitude is normalized to [0.5, 1) and three
+         * Newton-Raphson steps are taken from a linear first guess,
+         * which gives about 30 correct bits.
+         *
+         * @param raw  non-zero raw value, at most 32 bits
+         * @param frac number of fractional bits of the value
+         * @return the raw reciprocal with the same fractional bits
+         */
+        static int64_t reciprocal(int64_t raw, uint8_t frac) {
+            const uint32_t u = static_cast<uint32_t>(raw < 0 ? -raw : raw);
+            const int n = __builtin_clz(u);
+            const int64_t d = static_cast<int64_t>((static_cast<uint64_t>(u) << n) >> 2);
+            int64_t x = 3031741621LL - ((2021161080LL * d) >> 30);
+            for (int i = 0; i < 3; ++i) {
+                x += (x * ((static_cast<int64_t>(1) << 30) - ((d * x) >> 30))) >> 30;
+            }
+            const int s = 62 - 2 * frac - n;
+            const int64_t r = s > 0
+                              ? (x + (static_cast<int64_t>(1) << (s - 1))) >> s
+                              : x * (static_cast<int64_t>(1) << -s);
+            return raw < 0 ? -r : r;
+        }
+
+        /**
+         * Integer square root, rounded to nearest, computed one bit
+         * at a time with shifts and subtractions only. The loop starts
+         * at the highest set bit and does not branch on the data, which
+         * keeps it fast on pipelined cores.
+         */
+        template<typename uint_t>
+        static uint_t isqrt(uint_t n) {
+            if (n == 0) {
+                return 0;
+            }
+            uint_t res = 0;
+            uint_t bit = static_cast<uint_t>(static_cast<uint_t>(1) << ((63 - __builtin_clzll(n)) & ~1));
+            while (bit != 0) {
+                const uint_t trial = static_cast<uint_t>(res + bit);
+                const uint_t take = static_cast<uint_t>(-static_cast<uint_t>(n >= trial));
+                n = static_cast<uint_t>(n - (trial & take));
+                res = static_cast<uint_t>((res >> 1) + (bit & take));
+                bit >>= 2;
+            }
+            return n > res ? static_cast<uint_t>(res + 1) : res;
+        }
+    };
+
+    /**
+     * Signed fixed-point number with @code IntBits @endcode integer
+     * bits and @code FracBits @endcode fractional bits, plus a sign
+     * bit. The total must be 8, 16, or 32 bits.
+     *
+     * The type is trivially copyable and a raw value of zero is the
+     * number zero, so it can be cleared with @code memset @endcode and
+     * stored in an @code array2d @endcode. Like @code float @endcode,
+     * a default constructed value is uninitialized.
+     *
+     * Conversion from floating point clamps to the representable range
+     * under either policy. Results of the math functions always clamp.
+     *
+     * @tparam IntBits  number of integer bits, excluding the sign
+     * @tparam FracBits number of fractional bits
+     * @tparam Overflow overflow policy, @code fixed_wrap @endcode or
+     *                  @code fixed_saturate @endcode
+     */
+    template<uint8_t IntBits, uint8_t FracBits, typename Overflow = fixed_wrap>
+    class fixed {
+        static_assert(IntBits + FracBits + 1 == 8 || IntBits + FracBits + 1 == 16 ||
+                      IntBits + FracBits + 1 == 32, "Fixed-point width must be 8, 16, or 32 bits");
+
+    public:
+        typedef fixed<IntBits, FracBits, Overflow> fixed_type;
+        typedef __fixed_storage<IntBits + FracBits + 1> storage_type;
+        typedef typename storage_type::raw_type raw_type;
+        typedef typename storage_type::wide_type wide_type;
+        typedef typename storage_type::uwide_type uwide_type;
+        typedef Overflow overflow_policy;
+
+        static constexpr uint8_t int_bits = IntBits;
+        static constexpr uint8_t frac_bits = FracBits;
+        static constexpr wide_type one = static_cast<wide_type>(static_cast<wide_type>(1) << FracBits);
+        static constexpr wide_type raw_max =
+                static_cast<wide_type>((static_cast<wide_type>(1) << (IntBits + FracBits)) - 1);
+        static constexpr wide_type raw_min = static_cast<wide_type>(-raw_max - 1);
+
+    private:
+        struct raw_tag {
+        };
+
+        raw_type m_raw;
+
+        constexpr fixed(raw_type raw, raw_tag)
+                : m_raw(raw) {}
+
+        static constexpr raw_type narrow(wide_type v) {
+            return Overflow::template narrow<raw_type, wide_type>(v, raw_min, raw_max);
+        }
+
+        static constexpr raw_type clamp(int64_t v) {
+            return static_cast<raw_type>(v < raw_min ? raw_min : (v > raw_max ? raw_max : v));
+        }
+
+        static constexpr wide_type round_half() {
+            return FracBits > 0 ? static_cast<wide_type>(static_cast<wide_type>(1) << (FracBits - 1)) : 0;
+        }
+
+    public:
+        fixed() = default;
+
+        /**
+         * Convert from an integer. Out of range values are handled by
+         * the overflow policy.
+         */
+        template<typename int_t, typename enable_if<is_integral<int_t>::value, int>::type = 0>
+        constexpr fixed(int_t v)
+                : m_raw(narrow(static_cast<wide_type>(static_cast<wide_type>(v) * one))) {}
+
+        /**
+         * Convert from floating point, rounding to nearest. Out of
+         * range values clamp.
+         */
+        template<typename real_t, typename enable_if<is_floating_point<real_t>::value, int>::type = 0>
+        constexpr fixed(real_t v)
+                : m_raw(static_cast<raw_type>(
+                                static_cast<double>(v) * one >= raw_max ? raw_max :
+                                static_cast<double>(v) * one <= raw_min ? raw_min :
+                                static_cast<double>(v) * one + (v < 0 ? -0.5 : 0.5))) {}
+
+        /**
+         * @param raw the underlying integer representation
+         * @return the fixed-point number with that representation
+         */
+        static constexpr fixed_type from_raw(raw_type raw) {
+            return fixed_type(raw, raw_tag());
+        }
+
+        static constexpr fixed_type max_value() {
+            return from_raw(static_cast<raw_type>(raw_max));
+        }
+
+        static constexpr fixed_type min_value() {
+            return from_raw(static_cast<raw_type>(raw_min));
+        }
+
+        /**
+         * @return the smallest positive representable value
+         */
+        static constexpr fixed_type epsilon() {
+            return from_raw(1);
+        }
+
+        constexpr raw_type raw() const {
+            return m_raw;
+        }
+
+        constexpr float to_float() const {
+            return static_cast<float>(m_raw) / static_cast<float>(one);
+        }
+
+        constexpr double to_double() const {
+            return static_cast<double>(m_raw) / static_cast<double>(one);
+        }
+
+        /**
+         * @return the integer part, truncated toward zero
+         */
+        constexpr int32_t to_int() const {
+            return static_cast<int32_t>(m_raw < 0 ? -(-static_cast<wide_type>(m_raw) >> FracBits)
+                                                  : m_raw >> FracBits);
+        }
+
+        explicit constexpr operator float() const {
+            return to_float();
+        }
+
+        explicit constexpr operator double() const {
+            return to_double();
+        }
+
+        constexpr fixed_type operator+() const {
+            return *this;
+        }
+
+        constexpr fixed_type operator-() const {
+            return from_raw(narrow(static_cast<wide_type>(-static_cast<wide_type>(m_raw))));
+        }
+
+        friend constexpr fixed_type operator+(fixed_type a, fixed_type b) {
+            return from_raw(narrow(static_cast<wide_type>(static_cast<wide_type>(a.m_raw) + b.m_raw)));
+        }
+
+        friend constexpr fixed_type operator-(fixed_type a, fixed_type b) {
+            return from_raw(narrow(static_cast<wide_type>(static_cast<wide_type>(a.m_raw) - b.m_raw)));
+        }
+
+        /**
+         * Multiply, rounding the result to nearest.
+         */
+        friend constexpr fixed_type operator*(fixed_type a, fixed_type b) {
+            return from_raw(narrow(static_cast<wide_type>(
+                    (static_cast<wide_type>(static_cast<wide_type>(a.m_raw) * b.m_raw) + round_half()) >> FracBits)));
+        }
+
+        /**
+         * Divide, truncating toward zero. Division by zero gives the
+         * largest magnitude value with the sign of the dividend.
+         */
+        friend constexpr fixed_type operator/(fixed_type a, fixed_type b) {
+            return b.m_raw == 0
+                   ? (a.m_raw < 0 ? min_value() : max_value())
+                   : from_raw(narrow(static_cast<wide_type>(
+                           static_cast<wide_type>(static_cast<wide_type>(a.m_raw) * one) / b.m_raw)));
+        }
+
+        template<typename int_t, typename enable_if<is_integral<int_t>::value, int>::type = 0>
+        friend constexpr fixed_type operator*(fixed_type a, int_t b) {
+            return from_raw(narrow(static_cast<wide_type>(
+                    static_cast<wide_type>(a.m_raw) * static_cast<wide_type>(b))));
+        }
+
+        template<typename int_t, typename enable_if<is_integral<int_t>::value, int>::type = 0>
+        friend constexpr fixed_type operator*(int_t a, fixed_type b) {
+            return b * a;
+        }
+
+        template<typename int_t, typename enable_if<is_integral<int_t>::value, int>::type = 0>
+        friend constexpr fixed_type operator/(fixed_type a, int_t b) {
+            return b == 0
+                   ? (a.m_raw < 0 ? min_value() : max_value())
+                   : from_raw(narrow(static_cast<wide_type>(
+                           static_cast<wide_type>(a.m_raw) / static_cast<wide_type>(b))));
+        }
+
+        template<typename scalar_t>
+        fixed_type &operator+=(const scalar_t &b) {
+            return *this = *this + b;
+        }
+
+        template<typename scalar_t>
+        fixed_type &operator-=(const scalar_t &b) {
+            return *this = *this - b;
+        }
+
+        template<typename scalar_t>
+        fixed_type &operator*=(const scalar_t &b) {
+            return *this = *this * b;
+        }
+
+        template<typename scalar_t>
+        fixed_type &operator/=(const scalar_t &b) {
+            return *this = *this / b;
+        }
+
+        friend constexpr bool operator==(fixed_type a, fixed_type b) {
+            return a.m_raw == b.m_raw;
+        }
+
+        friend constexpr bool operator!=(fixed_type a, fixed_type b) {
+            return a.m_raw != b.m_raw;
+        }
+
+        friend constexpr bool operator<(fixed_type a, fixed_type b) {
+            return a.m_raw < b.m_raw;
+        }
+
+        friend constexpr bool operator<=(fixed_type a, fixed_type b) {
+            return a.m_raw <= b.m_raw;
+        }
+
+        friend constexpr bool operator>(fixed_type a, fixed_type b) {
+            return a.m_raw > b.m_raw;
+        }
+
+        friend constexpr bool operator>=(fixed_type a, fixed_type b) {
+            return a.m_raw >= b.m_raw;
+        }
+
+        friend constexpr fixed_type abs(fixed_type a) {
+            return a.m_raw < 0 ? -a : a;
+        }
+
+        /**
+         * Square root, rounded to nearest. Negative values give zero.
+         */
+        friend fixed_type sqrt(fixed_type a) {
+            if (a.m_raw <= 0) {
+                return from_raw(0);
+            }
+            const uwide_type r = __fixed_math::isqrt<uwide_type>(
+                    static_cast<uwide_type>(static_cast<uwide_type>(a.m_raw) << FracBits));
+            return from_raw(clamp(static_cast<int64_t>(r)));
+        }
+
+        /**
+         * Approximate reciprocal computed without division. The
+         * reciprocal of zero is the largest representable value.
+         */
+        friend fixed_type reciprocal(fixed_type a) {
+            if (a.m_raw == 0) {
+                return max_value();
+            }
+            return from_raw(clamp(__fixed_math::reciprocal(a.m_raw, FracBits)));
+        }
+
+        friend fixed_type sin(fixed_type a) {
+            return from_raw(clamp(__fixed_math::from_q28(
+                    __fixed_math::sin_q28(__fixed_math::to_q28(a.m_raw, FracBits)), FracBits)));
+        }
+
+        friend fixed_type cos(fixed_type a) {
+            return from_raw(clamp(__fixed_math::from_q28(
+                    __fixed_math::sin_q28(__fixed_math::to_q28(a.m_raw, FracBits) + __fixed_math::q28_half_pi),
+                    FracBits)));
+        }
+
+        /**
+         * @return the angle of the point (x, y) in radians, in [-pi, pi]
+         */
+        friend fixed_type atan2(fixed_type y, fixed_type x) {
+            return from_raw(clamp(__fixed_math::from_q28(
+                    __fixed_math::atan2_q28(y.m_raw, x.m_raw), FracBits)));
+        }
+    };
+
+    template<uint8_t IntBits, uint8_t FracBits, typename Overflow>
+    constexpr uint8_t fixed<IntBits, FracBits, Overflow>::int_bits;
+
+    template<uint8_t IntBits, uint8_t FracBits, typename Overflow>
+    constexpr uint8_t fixed<IntBits, FracBits, Overflow>::frac_bits;
+
+    template<uint8_t IntBits, uint8_t FracBits, typename Overflow>
+    constexpr typename fixed<IntBits, FracBits, Overflow>::wide_type fixed<IntBits, FracBits, Overflow>::one;
+
+    template<uint8_t IntBits, uint8_t FracBits, typename Overflow>
+    constexpr typename fixed<IntBits, FracBits, Overflow>::wide_type fixed<IntBits, FracBits, Overflow>::raw_max;
+
+    template<uint8_t IntBits, uint8_t FracBits, typename Overflow>
+    constexpr typename fixed<IntBits, FracBits, Overflow>::wide_type fixed<IntBits, FracBits, Overflow>::raw_min;
+
+    typedef fixed<7, 8> q7_8;
+    typedef fixed<15, 16> q15_16;
+    typedef fixed<1, 30> q1_30;
+    typedef fixed<7, 8, fixed_saturate> sat_q7_8;
+    typedef fixed<15, 16, fixed_saturate> sat_q15_16;
+
+    /**
+     * Floating point counterparts of the fixed-point reciprocal, so
+     * that generic code can call @code reciprocal @endcode on either.
+     */
+    inline float reciprocal(float v) {
+        return 1.0f / v;
+    }
+
+    inline double reciprocal(double v) {
+        return 1.0 / v;
+    }
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_FIXED_H
@@ -14,7 +14,12 @@
 #ifndef CORE_STL_HASH_H
 #define CORE_STL_HASH_H
 
+#include <stdint.h>
+
+#include <wlib/strings/Ascii.h>
+#include <wlib/strings/SharedString.h>
 #include <wlib/strings/String.h>
+#include <wlib/stl/Tuple.h>
 
 #define MUL_127(x) (((x) << 7) - (x))
 
@@ -40,18 +45,21 @@ namespace wlp {
 
     /**
      * Hash a static string by multiplying the character value
-     * by 127 and adding consecutively.
+     * by 127 and adding consecutively. The stored length bounds
+     * the loop, so the string is not scanned for its terminator.
      *
      * @tparam IntType the integer return type
      * @tparam tSize the static string size
-     * @param static_string the string to hash
+     * @param str the string to hash
      * @return a hash code of the string
      */
-    template<class IntType, uint16_t tSize>
-    inline IntType hash_static_string(const static_string<tSize> &static_string) {
+    template<class IntType, size_t tSize>
+    inline IntType hash_static_string(const static_string<tSize> &str) {
+        const char *s = str.c_str();
+        const char *const end = s + str.length();
         IntType h = 0;
-        for (size_t pos = 0; pos < static_string.length(); ++pos) {
-            h = static_cast<IntType>(MUL_127(h) + static_string[pos]);
+        for (; s != end; ++s) {
+            h = static_cast<IntType>(MUL_127(h) + *s);
         }
         return h;
     };
@@ -93,6 +101,19 @@ namespace wlp {
         }
     };
 
+    /**
+     * Template specialization for shared strings, which returns the
+     * hash code stored with the characters.
+     *
+     * @tparam IntType hash code integer type
+     */
+    template<class IntType>
+    struct hash<shared_string, IntType> {
+        IntType operator()(const shared_string &str) const {
+            return static_cast<IntType>(str.hash());
+        }
+    };
+
     /**
      * Template specialization for C strings.
      *
@@ -117,6 +138,148 @@ namespace wlp {
         }
     };
 
+    /**
+     * Hash function for string keys that ignores ASCII case, to
+     * be used with @code case_insensitive_equals @endcode. Works for
+     * static strings, dynamic strings, C strings, and string views.
+     *
+     * @tparam Key     string key type
+     * @tparam IntType hash code integer type
+     */
+    template<class Key, class IntType>
+    struct case_insensitive_hash {
+        IntType operator()(const Key &key) const {
+            return hash_ignore_case<IntType>(string_view(key));
+        }
+    };
+
+    /**
+     * Mixing steps for hash codes of several values, on a word of 32
+     * bits for hash codes up to that size and of 64 bits otherwise.
+     * Each value's hash code is folded into the running hash code by
+     * rotating, exclusive or, and a multiply by the golden ratio, and
+     * the result is finished with the avalanche of MurmurHash3 so that
+     * every input bit reaches the low bits a table index is taken from.
+     *
+     * @tparam Wide whether the hash code is wider than 32 bits
+     */
+    template<bool Wide>
+    struct __hash_mix {
+        typedef uint32_t word;
+
+        static word combine(word seed, word h) {
+            return (((seed << 5) | (seed >> 27)) ^ h) * 0x9e3779b1u;
+        }
+
+        static word finish(word x) {
+            x ^= x >> 16;
+            x *= 0x85ebca6bu;
+            x ^= x >> 13;
+            x *= 0xc2b2ae35u;
+            x ^= x >> 16;
+            return x;
+        }
+    };
+
+    template<>
+    struct __hash_mix<true> {
+        typedef uint64_t word;
+
+        static word combine(word seed, word h) {
+            return (((seed << 5) | (seed >> 59)) ^ h) * 0x9e3779b97f4a7c15ull;
+        }
+
+        static word finish(word x) {
+            x ^= x >> 33;
+            x *= 0xff51afd7ed558ccdull;
+            x ^= x >> 33;
+            x *= 0xc4ceb9fe1a85ec53ull;
+            x ^= x >> 33;
+            return x;
+        }
+    };
+
+    /**
+     * Running hash code of a key made of several fields. It is a full
+     * mixing word, wider than narrow hash codes, so that no field loses
+     * bits before the hash code is finished.
+     *
+     * @tparam IntType hash code integer type
+     */
+    template<class IntType>
+    struct hash_seed {
+        typedef typename __hash_mix<(sizeof(IntType) > 4)>::word type;
+    };
+
+    /**
+     * Fold the hash code of one more value into a running hash code,
+     * for keys made of several fields. The running hash code starts
+     * at zero and is passed through @code hash_finish @endcode once
+     * every field is folded in.
+     *
+     * @tparam IntType hash code integer type
+     * @param seed the running hash code
+     * @param h    the hash code of the next field
+     * @return the new running hash code
+     */
+    template<class IntType>
+    inline typename hash_seed<IntType>::type hash_combine(typename hash_seed<IntType>::type seed, IntType h) {
+        return __hash_mix<(sizeof(IntType) > 4)>::combine(seed, h);
+    }
+
+    /**
+     * Finish a running hash code of several fields.
+     *
+     * @tparam IntType hash code integer type
+     * @param seed the running hash code
+     * @return the hash code
+     */
+    template<class IntType>
+    inline IntType hash_finish(typename hash_seed<IntType>::type seed) {
+        return static_cast<IntType>(__hash_mix<(sizeof(IntType) > 4)>::finish(seed));
+    }
+
+    /**
+     * Template specialization for pairs, which combines the hash codes
+     * of both values.
+     *
+     * @tparam First   first value type
+     * @tparam Second  second value type
+     * @tparam IntType hash code integer type
+     */
+    template<class First, class Second, class IntType>
+    struct hash<pair<First, Second>, IntType> {
+        IntType operator()(const pair<First, Second> &key) const {
+            typename hash_seed<IntType>::type h = hash_combine<IntType>(0, hash<First, IntType>()(key.first()));
+            return hash_finish<IntType>(hash_combine<IntType>(h, hash<Second, IntType>()(key.second())));
+        }
+    };
+
+    /**
+     * Template specialization for tuples, which combines the hash codes
+     * of the values in order.
+     *
+     * @tparam Types   tuple types
+     * @tparam IntType hash code integer type
+     */
+    template<class... Types, class IntType>
+    struct hash<tuple<Types...>, IntType> {
+        IntType operator()(const tuple<Types...> &key) const {
+            return apply(key, typename MakeIndexSequence<sizeof...(Types)>::type());
+        }
+
+    private:
+        template<int... Indices>
+        static IntType apply(const tuple<Types...> &key, IndexSequence<Indices...>) {
+            typename hash_seed<IntType>::type h = 0;
+            // a braced list folds the fields in order
+            int order[] = {0, (h = hash_combine<IntType>(
+                    h, hash<TypeAtIndexType<Indices, Types...>, IntType>()(get<Indices>(key))), 0)...};
+            (void) order;
+            return hash_finish<IntType>(h);
+        }
+    };
+
 }
 
 #endif //CORE_STL_HASH_H
@@ -159,6 +159,10 @@ namespace wlp {
             m_table = move(map.m_table);
             return *this;
         }
+
+        void swap(map_type &map) noexcept {
+            m_table.swap(map.m_table);
+        }
     };
 
 }
@@ -0,0 +1,455 @@
+/**
+ * @file HashMultimap.h
+ * @brief Hash map from each key to a group of values.
+ *
+ * Chaining every value of a key as its own node, as
+ * @code hash_table::insert_equal @endcode does, costs an allocation
+ * and a node header per value and a walk along the chain to reach the
+ * values of a key. The multimap instead keeps one node per distinct
+ * key, holding all the key's values in a contiguous group, so the
+ * values of a key are found with one lookup and read as a span.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_HASHMULTIMAP_H
+#define EMBEDDEDCPLUSPLUS_HASHMULTIMAP_H
+
+#include <stddef.h>
+
+#include <wlib/stl/Equal.h>
+#include <wlib/stl/Hash.h>
+#include <wlib/stl/HashTable.h>
+#include <wlib/stl/Span.h>
+#include <wlib/stl/Table.h>
+#include <wlib/stl/Tuple.h>
+#include <wlib/memory>
+
+namespace wlp {
+
+    /**
+     * Small vector of values that keeps the first few values inline
+     * and moves all of them to a heap array, grown by doubling, once
+     * there are more. Most keys of a multimap have only a few values,
+     * which then need no allocation of their own.
+     *
+     * @tparam T value type, which must be default constructible
+     * @tparam N number of values kept inline
+     */
+    template<typename T, size_t N>
+    class value_group {
+    public:
+        typedef T val_type;
+        typedef size_t size_type;
+        typedef value_group<T, N> group_type;
+
+    private:
+        /**
+         * Heap array of the values, or null while they are inline.
+         */
+        T *m_heap;
+        size_type m_size;
+        size_type m_capacity;
+        T m_inline[N];
+
+        void grow() {
+            const size_type new_capacity = static_cast<size_type>(2 * m_capacity);
+            T *new_heap = create<T[]>(new_capacity);
+            T *values = data();
+            for (size_type i = 0; i < m_size; ++i) {
+                new_heap[i] = move(values[i]);
+            }
+            if (m_heap) {
+                destroy<T[]>(m_heap);
+            }
+            m_heap = new_heap;
+            m_capacity = new_capacity;
+        }
+
+        void take(group_type &group) {
+            if (group.m_heap) {
+                m_heap = group.m_heap;
+                m_capacity = group.m_capacity;
+                group.m_heap = nullptr;
+                group.m_capacity = N;
+            } else {
+                for (size_type i = 0; i < group.m_size; ++i) {
+                    m_inline[i] = move(group.m_inline[i]);
+                }
+            }
+            m_size = group.m_size;
+            group.m_size = 0;
+        }
+
+    public:
+        value_group()
+                : m_heap(nullptr),
+                  m_size(0),
+                  m_capacity(N) {
+        }
+
+        value_group(const group_type &) = delete;
+
+        value_group(group_type &&group)
+                : m_heap(nullptr),
+                  m_size(0),
+                  m_capacity(N) {
+            take(group);
+        }
+
+        ~value_group() {
+            if (m_heap) {
+                destroy<T[]>(m_heap);
+            }
+        }
+
+        size_type size() const {
+            return m_size;
+        }
+
+        size_type capacity() const {
+            return m_capacity;
+        }
+
+        bool empty() const {
+            return m_size == 0;
+        }
+
+        T *data() {
+            return m_heap ? m_heap : m_inline;
+        }
+
+        const T *data() const {
+            return m_heap ? m_heap : m_inline;
+        }
+
+        T &operator[](size_type i) {
+            return data()[i];
+        }
+
+        const T &operator[](size_type i) const {
+            return data()[i];
+        }
+
+        span<T> as_span() {
+            return span<T>(data(), m_size);
+        }
+
+        span<const T> as_span() const {
+            return span<const T>(data(), m_size);
+        }
+
+        /**
+         * Append a value to the group.
+         *
+         * @return the appended value
+         */
+        template<typename U>
+        T &push_back(U &&value) {
+            if (m_size == m_capacity) {
+                grow();
+            }
+            T &slot = data()[m_size++];
+            slot = forward<U>(value);
+            return slot;
+        }
+
+        /**
+         * Remove the value at an index by moving the last value into
+         * its place, so the order of the values is not kept.
+         *
+         * @param i index of the value to remove
+         */
+        void swap_remove(size_type i) {
+            T *values = data();
+            --m_size;
+            if (i != m_size) {
+                values[i] = move(values[m_size]);
+            }
+            values[m_size] = T();
+        }
+
+        /**
+         * Remove every value, keeping the storage.
+         */
+        void clear() {
+            T *values = data();
+            for (size_type i = 0; i < m_size; ++i) {
+                values[i] = T();
+            }
+            m_size = 0;
+        }
+
+        group_type &operator=(const group_type &) = delete;
+
+        group_type &operator=(group_type &&group) {
+            if (this != &group) {
+                if (m_heap) {
+                    destroy<T[]>(m_heap);
+                    m_heap = nullptr;
+                    m_capacity = N;
+                }
+                take(group);
+            }
+            return *this;
+        }
+
+        void swap(group_type &group) {
+            group_type tmp(move(group));
+            group = move(*this);
+            *this = move(tmp);
+        }
+    };
+
+    /**
+     * Number of values of a type kept inline in a multimap's group,
+     * as many as fit in 16 bytes and at least one.
+     */
+    template<typename T>
+    struct __group_inline : integral_constant<size_t, (sizeof(T) >= 16 ? 1 : 16 / sizeof(T))> {
+    };
+
+    /**
+     * Hash map that associates each key with any number of values,
+     * kept together in one group per key.
+     *
+     * @tparam Key    key type
+     * @tparam Val    value type, which must be default constructible
+     * @tparam Hasher hash function
+     * @tparam Equals key equality function
+     */
+    template<typename Key,
+            typename Val,
+            typename Hasher = hash<Key, uint16_t>,
+            typename Equals = equals<Key>>
+    class hash_multimap {
+    public:
+        typedef hash_multimap<Key, Val, Hasher, Equals> map_type;
+        typedef value_group<Val, __group_inline<Val>::value> group_type;
+        typedef tuple<Key, group_type> element_type;
+        typedef hash_table<element_type,
+                Key, group_type,
+                MapGetKey<Key, group_type>, MapGetVal<Key, group_type>,
+                Hasher, Equals
+        > table_type;
+        typedef typename table_type::iterator iterator;
+        typedef typename table_type::const_iterator const_iterator;
+        typedef typename table_type::size_type size_type;
+        typedef typename table_type::percent_type percent_type;
+
+        typedef Key key_type;
+        typedef Val val_type;
+
+    private:
+        table_type m_table;
+        /**
+         * Number of values in all groups.
+         */
+        size_type m_size;
+
+    public:
+        /**
+         * @param n        initial number of buckets
+         * @param max_load load factor, in percent of distinct keys to
+         *                 buckets, past which the buckets are doubled
+         */
+        explicit hash_multimap(size_type n = 12, percent_type max_load = 75)
+                : m_table(n, max_load),
+                  m_size(0) {
+        }
+
+        hash_multimap(const map_type &) = delete;
+
+        hash_multimap(map_type &&map)
+                : m_table(move(map.m_table)),
+                  m_size(map.m_size) {
+            map.m_size = 0;
+        }
+
+        /**
+         * @return the number of values
+         */
+        size_type size() const {
+            return m_size;
+        }
+
+        /**
+         * @return the number of distinct keys
+         */
+        size_type keys() const {
+            return m_table.size();
+        }
+
+        size_type capacity() const {
+            return m_table.capacity();
+        }
+
+        percent_type max_load() const {
+            return m_table.max_load();
+        }
+
+        bool empty() const {
+            return m_size == 0;
+        }
+
+        /**
+         * Iterators visit each distinct key once; the iterator's
+         * @code key() @endcode is the key and it dereferences to the
+         * key's group of values.
+         */
+        iterator begin() {
+            return m_table.begin();
+        }
+
+        const_iterator begin() const {
+            return m_table.begin();
+        }
+
+        iterator end() {
+            return m_table.end();
+        }
+
+        const_iterator end() const {
+            return m_table.end();
+        }
+
+        void clear() noexcept {
+            m_table.clear();
+            m_size = 0;
+        }
+
+        /**
+         * Add a value to a key's group, creating the group if the key
+         * is new.
+         *
+         * @return iterator to the key's group
+         */
+        template<typename K, typename V>
+        iterator insert(K &&key, V &&val) {
+            iterator it = m_table.find(key);
+            if (it == m_table.end()) {
+                it = m_table.insert_unique(element_type(forward<K>(key), group_type())).first();
+            }
+            it->push_back(forward<V>(val));
+            ++m_size;
+            return it;
+        }
+
+        /**
+         * @return iterator to the key's group, or the end iterator if
+         *         the key has no values
+         */
+        iterator find(const key_type &key) {
+            return m_table.find(key);
+        }
+
+        const_iterator find(const key_type &key) const {
+            return m_table.find(key);
+        }
+
+        bool contains(const key_type &key) const {
+            return m_table.find(key) != m_table.end();
+        }
+
+        /**
+         * @return the number of values of the key
+         */
+        size_type count(const key_type &key) const {
+            const_iterator it = m_table.find(key);
+            return it == m_table.end() ? 0 : it->size();
+        }
+
+        /**
+         * The values of a key, contiguous and in insertion order unless
+         * values were removed with @code erase_value @endcode. Adding
+         * values to the key may move them.
+         *
+         * @return span of the key's values, empty if it has none
+         */
+        span<val_type> equal_range(const key_type &key) {
+            iterator it = m_table.find(key);
+            return it == m_table.end() ? span<val_type>() : it->as_span();
+        }
+
+        span<const val_type> equal_range(const key_type &key) const {
+            const_iterator it = m_table.find(key);
+            return it == m_table.end() ? span<const val_type>() : it->as_span();
+        }
+
+        /**
+         * Remove a key and all its values.
+         *
+         * @return the number of values removed
+         */
+        size_type erase(const key_type &key) {
+            iterator it = m_table.find(key);
+            if (it == m_table.end()) {
+                return 0;
+            }
+            const size_type erased = it->size();
+            m_table.erase(it);
+            m_size -= erased;
+            return erased;
+        }
+
+        /**
+         * Remove a key's group and all its values.
+         *
+         * @return iterator to the next group
+         */
+        iterator erase(const iterator &pos) {
+            iterator tmp = pos;
+            ++tmp;
+            m_size -= pos->size();
+            m_table.erase(pos);
+            return tmp;
+        }
+
+        /**
+         * Remove one value of a key that matches a value. The last
+         * value of the key takes its place, and the key is removed
+         * with its last value.
+         *
+         * @return true if a value was removed
+         */
+        bool erase_value(const key_type &key, const val_type &val) {
+            iterator it = m_table.find(key);
+            if (it == m_table.end()) {
+                return false;
+            }
+            group_type &group = *it;
+            for (size_type i = 0; i < group.size(); ++i) {
+                if (group[i] == val) {
+                    group.swap_remove(i);
+                    --m_size;
+                    if (group.empty()) {
+                        m_table.erase(it);
+                    }
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        map_type &operator=(const map_type &) = delete;
+
+        map_type &operator=(map_type &&map) {
+            if (this != &map) {
+                m_table = move(map.m_table);
+                m_size = map.m_size;
+                map.m_size = 0;
+            }
+            return *this;
+        }
+
+        void swap(map_type &map) noexcept {
+            m_table.swap(map.m_table);
+            wlp::swap(m_size, map.m_size);
+        }
+    };
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_HASHMULTIMAP_H
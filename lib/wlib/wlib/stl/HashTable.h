@@ -3,6 +3,7 @@
 
 #include <wlib/stl/Equal.h>
 #include <wlib/stl/Hash.h>
+#include <wlib/stl/Helper.h>
 #include <wlib/stl/Pair.h>
 #include <wlib/memory>
 #include <string.h>
@@ -82,6 +83,13 @@ namespace wlp {
                 : m_node(node),
                   m_table(table) {}
 
+        /**
+         * Copy constructor copies node and table.
+         *
+         * @param it iterator to copy
+         */
+        HashTableIterator(const self_type &it) = default;
+
         reference operator*() const {
             return m_get_value(m_node->m_element);
         }
@@ -320,6 +328,9 @@ namespace wlp {
         element_type &find_or_insert(E &&element);
 
         iterator find(const key_type &key) {
+            if (m_size == 0) {
+                return end();
+            }
             size_type n = hash(key);
             node_type *first;
             for (first = m_buckets[n];
@@ -329,6 +340,9 @@ namespace wlp {
         }
 
         const_iterator find(const key_type &key) const {
+            if (m_size == 0) {
+                return end();
+            }
             size_type n = hash(key);
             node_type *first;
             for (first = m_buckets[n];
@@ -338,6 +352,9 @@ namespace wlp {
         }
 
         size_type count(const key_type &key) const {
+            if (m_size == 0) {
+                return 0;
+            }
             size_type n = hash(key);
             size_type result = 0;
             for (const node_type *cur = m_buckets[n]; cur; cur = cur->m_next) {
@@ -361,6 +378,9 @@ namespace wlp {
         table_type &operator=(const table_type &) = delete;
 
         table_type &operator=(table_type &&table) {
+            if (this == &table) {
+                return *this;
+            }
             if (m_buckets) {
                 clear();
                 destroy<node_type *[]>(m_buckets);
@@ -373,6 +393,22 @@ namespace wlp {
             table.m_capacity = 0;
             return *this;
         }
+
+        /**
+         * Exchange the buckets of two tables. No nodes
+         * are moved or copied.
+         *
+         * @param table the table to swap with
+         */
+        void swap(table_type &table) noexcept {
+            wlp::swap(m_buckets, table.m_buckets);
+            wlp::swap(m_size, table.m_size);
+            wlp::swap(m_capacity, table.m_capacity);
+            wlp::swap(m_max_load, table.m_max_load);
+            wlp::swap(m_hash_function, table.m_hash_function);
+            wlp::swap(m_key_equals, table.m_key_equals);
+            wlp::swap(m_get_key, table.m_get_key);
+        }
     };
 
     template<typename Element, typename Key, typename Val,
@@ -490,6 +526,9 @@ namespace wlp {
     hash_table<Element, Key, Val, GetKey, GetVal, Hasher, Equals>
     ::equal_range(const key_type &key) {
         typedef pair<iterator, iterator> ret_type;
+        if (m_size == 0) {
+            return ret_type(end(), end());
+        }
         const size_type n = hash(key);
         for (node_type *first = m_buckets[n]; first; first = first->m_next) {
             if (m_key_equals(m_get_key(first->m_element), key)) {
@@ -498,7 +537,7 @@ namespace wlp {
                         return ret_type(iterator(first, this), iterator(cur, this));
                     }
                 }
-                for (size_type m = static_cast<unsigned short>(n + 1); m < m_size; ++m) {
+                for (size_type m = n + 1; m < m_capacity; ++m) {
                     if (m_buckets[m]) {
                         return ret_type(iterator(first, this), iterator(m_buckets[m], this));
                     }
@@ -517,6 +556,9 @@ namespace wlp {
     hash_table<Element, Key, Val, GetKey, GetVal, Hasher, Equals>
     ::equal_range(const key_type &key) const {
         typedef pair<const_iterator, const_iterator> ret_type;
+        if (m_size == 0) {
+            return ret_type(end(), end());
+        }
         const size_type n = hash(key);
         for (node_type *first = m_buckets[n]; first; first = first->m_next) {
             if (m_key_equals(m_get_key(first->m_element), key)) {
@@ -525,7 +567,7 @@ namespace wlp {
                         return ret_type(const_iterator(first, this), const_iterator(cur, this));
                     }
                 }
-                for (size_type m = static_cast<unsigned short>(n + 1); m < m_size; ++m) {
+                for (size_type m = n + 1; m < m_capacity; ++m) {
                     if (m_buckets[m]) {
                         return ret_type(const_iterator(first, this), const_iterator(m_buckets[m], this));
                     }
@@ -571,6 +613,9 @@ namespace wlp {
     typename hash_table<Element, Key, Val, GetKey, GetVal, Hasher, Equals>::size_type
     hash_table<Element, Key, Val, GetKey, GetVal, Hasher, Equals>
     ::erase(const key_type &key) {
+        if (m_size == 0) {
+            return 0;
+        }
         const size_type n = hash(key);
         node_type *first = m_buckets[n];
         size_type erased = 0;
@@ -634,7 +679,7 @@ namespace wlp {
         if (m_size * 100 < m_max_load * m_capacity) {
             return;
         }
-        size_type new_capacity = static_cast<size_type>(m_capacity * 2);
+        size_type new_capacity = m_capacity == 0 ? 1 : static_cast<size_type>(m_capacity * 2);
         node_type **new_buckets = create<node_type *[]>(new_capacity);
         memset(new_buckets, 0, new_capacity * sizeof(node_type *));
         for (size_type i = 0; i < m_capacity; ++i) {
@@ -651,7 +696,9 @@ namespace wlp {
                 cur = next;
             }
         }
-        destroy<node_type *[]>(m_buckets);
+        if (m_buckets) {
+            destroy<node_type *[]>(m_buckets);
+        }
         m_buckets = new_buckets;
         m_capacity = new_capacity;
     }
@@ -17,22 +17,131 @@
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
 
+#include <stddef.h>
+
+#include <wlib/tmp/Declval.h>
+#include <wlib/type_traits>
 #include <wlib/utility>
 
 namespace wlp {
     /**
-     * Swap two elements.
+     * Type trait checks whether a type has a member
+     * function @code swap(T &) @endcode.
+     *
+     * @tparam T the type to check
+     */
+    template<typename T>
+    struct has_member_swap {
+    private:
+        template<typename U>
+        static constexpr auto check(U *) -> typename is_same<
+                decltype(declval<U &>().swap(declval<U &>())),
+                void
+        >::type;
+
+        template<typename>
+        static constexpr false_type check(...);
+
+        typedef decltype(check<T>(nullptr)) type;
+
+    public:
+        static constexpr bool value = type::value;
+    };
+
+    /**
+     * Swap two elements by moving them through
+     * a temporary.
      *
      * @tparam T element type
      * @param v1 first element
      * @param v2 second element
      */
     template<typename T>
-    void swap(T &v1, T &v2) {
+    typename enable_if<!has_member_swap<T>::value>::type
+    swap(T &v1, T &v2) {
         T tmp(move(v1));
         v1 = move(v2);
         v2 = move(tmp);
     }
+
+    /**
+     * Swap two elements whose type provides a member
+     * swap, which exchanges their internals without
+     * moving through a temporary.
+     *
+     * @tparam T element type
+     * @param v1 first element
+     * @param v2 second element
+     */
+    template<typename T>
+    typename enable_if<has_member_swap<T>::value>::type
+    swap(T &v1, T &v2) {
+        v1.swap(v2);
+    }
+
+    /**
+     * An index sequence is a container object for
+     * an index pack and is needed to expand the index
+     * pack to instantiate tuples.
+     * @tparam Indices the index pack to expand
+     */
+    template<int... Indices>
+    struct IndexSequence {
+        using type = IndexSequence<Indices...>;
+    };
+
+    /**
+     * This type joins two index sequences, offsetting
+     * the second by the length of the first.
+     * This is the undefined base type.
+     * @tparam First the first index sequence
+     * @tparam Second the second index sequence
+     */
+    template<typename First, typename Second>
+    struct ConcatIndexSequence;
+
+    /**
+     * Join two index sequence packs. The sequence
+     * 0, ..., N - 1 joined with 0, ..., M - 1 is
+     * the sequence 0, ..., N + M - 1.
+     * @tparam First the first index pack
+     * @tparam Second the second index pack
+     */
+    template<int... First, int... Second>
+    struct ConcatIndexSequence<IndexSequence<First...>, IndexSequence<Second...>>
+            : IndexSequence<First..., static_cast<int>(sizeof...(First)) + Second...> {
+    };
+
+    /**
+     * Recursive type instantiates an index sequence
+     * with value up to N. Each half is made separately
+     * so that the recursion depth is logarithmic in N.
+     * @tparam N the sequence length
+     */
+    template<int N>
+    struct MakeIndexSequence
+            : ConcatIndexSequence<
+                    typename MakeIndexSequence<N / 2>::type,
+                    typename MakeIndexSequence<N - N / 2>::type
+            >::type {
+    };
+
+    /**
+     * Base case type creates an empty index sequence.
+     */
+    template<>
+    struct MakeIndexSequence<0>
+            : IndexSequence<> {
+    };
+
+    /**
+     * Base case type creates an index sequence
+     * with one value.
+     */
+    template<>
+    struct MakeIndexSequence<1>
+            : IndexSequence<0> {
+    };
 }
 
 #endif //EMBEDDEDCPLUSPLUS_MACROS_H
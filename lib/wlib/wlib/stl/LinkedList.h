@@ -15,6 +15,7 @@
 #define CORE_STL_LIST_H
 
 #include <wlib/memory>
+#include <wlib/stl/Helper.h>
 
 namespace wlp {
 
@@ -611,6 +612,9 @@ namespace wlp {
          * @return a reference to this list
          */
         list_type &operator=(list_type &&list) {
+            if (this == &list) {
+                return *this;
+            }
             clear();
             m_size = list.m_size;
             m_head = list.m_head;
@@ -620,6 +624,17 @@ namespace wlp {
             list.m_tail = nullptr;
             return *this;
         }
+
+        /**
+         * Exchange the nodes of two lists.
+         *
+         * @param list the list to swap with
+         */
+        void swap(list_type &list) noexcept {
+            wlp::swap(m_head, list.m_head);
+            wlp::swap(m_tail, list.m_tail);
+            wlp::swap(m_size, list.m_size);
+        }
     };
 
     template<typename T>
@@ -0,0 +1,122 @@
+/**
+ * @file Monoid.h
+ * @brief Monoids for range query containers.
+ *
+ * A monoid is a struct of static functions over a value type:
+ * @code identity() @endcode, an associative @code combine(a, b) @endcode
+ * for which the identity is neutral, and @code repeat(v, count) @endcode,
+ * which is @p v combined with itself @p count times and is used to
+ * apply a range update to a node that covers many elements. Monoids
+ * that can be undone also have @code subtract(a, b) @endcode, the value
+ * that combined with @p b gives @p a.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_MONOID_H
+#define EMBEDDEDCPLUSPLUS_MONOID_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace wlp {
+
+    /**
+     * The least and greatest values of a type, which are the identities
+     * of the max and min monoids. Defined for the fixed width integers
+     * and floating point types; floating point bounds are infinite.
+     *
+     * @tparam T value type
+     */
+    template<typename T>
+    struct monoid_bounds;
+
+#define WLIB_MONOID_BOUNDS(T, LOW, HIGH) \
+    template<> \
+    struct monoid_bounds<T> { \
+        static T lowest() { return LOW; } \
+        static T highest() { return HIGH; } \
+    }
+
+    WLIB_MONOID_BOUNDS(int8_t, INT8_MIN, INT8_MAX);
+    WLIB_MONOID_BOUNDS(int16_t, INT16_MIN, INT16_MAX);
+    WLIB_MONOID_BOUNDS(int32_t, INT32_MIN, INT32_MAX);
+    WLIB_MONOID_BOUNDS(int64_t, INT64_MIN, INT64_MAX);
+    WLIB_MONOID_BOUNDS(uint8_t, 0, UINT8_MAX);
+    WLIB_MONOID_BOUNDS(uint16_t, 0, UINT16_MAX);
+    WLIB_MONOID_BOUNDS(uint32_t, 0, UINT32_MAX);
+    WLIB_MONOID_BOUNDS(uint64_t, 0, UINT64_MAX);
+    WLIB_MONOID_BOUNDS(float, -__builtin_huge_valf(), __builtin_huge_valf());
+    WLIB_MONOID_BOUNDS(double, -__builtin_huge_val(), __builtin_huge_val());
+
+#undef WLIB_MONOID_BOUNDS
+
+    /**
+     * Addition, with zero as the identity.
+     */
+    template<typename T>
+    struct sum_monoid {
+        typedef T value_type;
+
+        static T identity() {
+            return T();
+        }
+
+        static T combine(const T &a, const T &b) {
+            return a + b;
+        }
+
+        static T repeat(const T &v, size_t count) {
+            return static_cast<T>(v * static_cast<T>(count));
+        }
+
+        static T subtract(const T &a, const T &b) {
+            return a - b;
+        }
+    };
+
+    /**
+     * Minimum, with the greatest value as the identity.
+     */
+    template<typename T>
+    struct min_monoid {
+        typedef T value_type;
+
+        static T identity() {
+            return monoid_bounds<T>::highest();
+        }
+
+        static T combine(const T &a, const T &b) {
+            return b < a ? b : a;
+        }
+
+        static T repeat(const T &v, size_t) {
+            return v;
+        }
+    };
+
+    /**
+     * Maximum, with the least value as the identity.
+     */
+    template<typename T>
+    struct max_monoid {
+        typedef T value_type;
+
+        static T identity() {
+            return monoid_bounds<T>::lowest();
+        }
+
+        static T combine(const T &a, const T &b) {
+            return a < b ? b : a;
+        }
+
+        static T repeat(const T &v, size_t) {
+            return v;
+        }
+    };
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_MONOID_H
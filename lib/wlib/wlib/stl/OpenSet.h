@@ -138,6 +138,10 @@ namespace wlp {
             m_table = move(set.m_table);
             return *this;
         }
+
+        void swap(set_type &set) noexcept {
+            m_table.swap(set.m_table);
+        }
     };
 
 }
@@ -17,6 +17,7 @@
 
 #include <wlib/stl/Equal.h>
 #include <wlib/stl/Hash.h>
+#include <wlib/stl/Helper.h>
 #include <wlib/stl/Pair.h>
 #include <wlib/memory>
 
@@ -524,6 +525,22 @@ namespace wlp {
          * @return reference to this map
          */
         table_type &operator=(table_type &&map);
+
+        /**
+         * Exchange the bucket arrays of two tables. No
+         * elements are moved or copied.
+         *
+         * @param map the table to swap with
+         */
+        void swap(table_type &map) noexcept {
+            wlp::swap(m_buckets, map.m_buckets);
+            wlp::swap(m_num_elements, map.m_num_elements);
+            wlp::swap(m_capacity, map.m_capacity);
+            wlp::swap(m_max_load, map.m_max_load);
+            wlp::swap(m_hash_function, map.m_hash_function);
+            wlp::swap(m_key_equals, map.m_key_equals);
+            wlp::swap(m_get_key, map.m_get_key);
+        }
     };
 
     template<typename Element, typename Key, typename Val,
@@ -545,7 +562,7 @@ namespace wlp {
         if (m_num_elements * 100 < m_max_load * m_capacity) {
             return;
         }
-        size_type new_capacity = static_cast<size_type>(m_capacity * 2);
+        size_type new_capacity = m_capacity == 0 ? 1 : static_cast<size_type>(m_capacity * 2);
         element_type **new_buckets = create<element_type *[]>(new_capacity);
         for (size_type i = 0; i < new_capacity; ++i) {
             new_buckets[i] = nullptr;
@@ -563,7 +580,9 @@ namespace wlp {
             }
             new_buckets[k] = node;
         }
-        destroy<element_type *[]>(m_buckets);
+        if (m_buckets) {
+            destroy<element_type *[]>(m_buckets);
+        }
         m_buckets = new_buckets;
         m_capacity = new_capacity;
     }
@@ -655,6 +674,9 @@ namespace wlp {
     typename open_table<Element, Key, Val, GetKey, GetVal, Hasher, Equals>::size_type
     open_table<Element, Key, Val, GetKey, GetVal, Hasher, Equals>
     ::erase(const key_type &key) {
+        if (m_num_elements == 0) {
+            return 0;
+        }
         size_type i = hash(key);
         while (m_buckets[i] && !m_key_equals(key, m_get_key(*m_buckets[i]))) {
             if (++i >= m_capacity) {
@@ -695,6 +717,9 @@ namespace wlp {
     inline typename open_table<Element, Key, Val, GetKey, GetVal, Hasher, Equals>::iterator
     open_table<Element, Key, Val, GetKey, GetVal, Hasher, Equals>
     ::find(const key_type &key) {
+        if (m_num_elements == 0) {
+            return end();
+        }
         size_type i = hash(key);
         while (m_buckets[i] && !m_key_equals(key, m_get_key(*m_buckets[i]))) {
             if (++i >= m_capacity) {
@@ -714,6 +739,9 @@ namespace wlp {
     inline typename open_table<Element, Key, Val, GetKey, GetVal, Hasher, Equals>::const_iterator
     open_table<Element, Key, Val, GetKey, GetVal, Hasher, Equals>
     ::find(const key_type &key) const {
+        if (m_num_elements == 0) {
+            return end();
+        }
         size_type i = hash(key);
         while (m_buckets[i] && !m_key_equals(key, m_get_key(*m_buckets[i]))) {
             if (++i >= m_capacity) {
@@ -751,8 +779,13 @@ namespace wlp {
     open_table<Element, Key, Val, GetKey, GetVal, Hasher, Equals> &
     open_table<Element, Key, Val, GetKey, GetVal, Hasher, Equals>
     ::operator=(open_table<Element, Key, Val, GetKey, GetVal, Hasher, Equals> &&map) {
-        clear();
-        destroy<element_type *[]>(m_buckets);
+        if (this == &map) {
+            return *this;
+        }
+        if (m_buckets) {
+            clear();
+            destroy<element_type *[]>(m_buckets);
+        }
         m_capacity = move(map.m_capacity);
         m_max_load = move(map.m_max_load);
         m_num_elements = move(map.m_num_elements);
@@ -0,0 +1,515 @@
+/**
+ * @file PackedSequence.h
+ * @brief Append-only compressed sequence of 32-bit integers.
+ *
+ * Values are grouped into blocks of a fixed size. Each full block
+ * is stored as its first value followed by the zigzag encoded
+ * differences between consecutive values, bit-packed at the width
+ * of the largest difference in the block. Timestamps and slowly
+ * varying counters pack into a few bits per value.
+ *
+ * Decoding dispatches once per block to a routine specialized for
+ * the bit width. Each group of 32 values fills exactly that many
+ * words, so every load and shift within a group is a compile-time
+ * constant and the unrolled loop has no data-dependent branches.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_PACKEDSEQUENCE_H
+#define EMBEDDEDCPLUSPLUS_PACKEDSEQUENCE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <wlib/stl/ArrayList.h>
+#include <wlib/stl/Tuple.h>
+#include <wlib/utility>
+
+namespace wlp {
+
+    /**
+     * Decode value @code J @endcode of a group of 32 zigzag encoded
+     * differences packed at a fixed bit width, then the rest of the
+     * group. The recursion unrolls the group so that every word index
+     * and shift is a compile-time constant.
+     *
+     * @tparam Width bits per value
+     * @tparam J     index of the value within its group
+     */
+    template<int Width, int J>
+    struct __packed_lane {
+        static void apply(const uint32_t *in, uint32_t *out, uint32_t v) {
+            const uint64_t mask = (static_cast<uint64_t>(1) << Width) - 1;
+            const int word = J * Width / 32;
+            const int shift = J * Width % 32;
+            const uint64_t pair = shift + Width > 32
+                                  ? in[word] | (static_cast<uint64_t>(in[word + 1]) << 32)
+                                  : in[word];
+            const uint32_t z = static_cast<uint32_t>((pair >> shift) & mask);
+            out[J] = v + ((z >> 1) ^ (0u - (z & 1u)));
+            __packed_lane<Width, J + 1>::apply(in, out, out[J]);
+        }
+    };
+
+    template<int Width>
+    struct __packed_lane<Width, 32> {
+        static void apply(const uint32_t *, uint32_t *, uint32_t) {}
+    };
+
+    /**
+     * Decode one block of differences packed at a fixed bit width,
+     * starting from the first value of the block. Each group of 32
+     * values occupies exactly @code Width @endcode words.
+     *
+     * @tparam BlockSize number of values per block
+     * @tparam Width     bits per value
+     */
+    template<uint16_t BlockSize, int Width>
+    struct __packed_unpack {
+        static void apply(const uint32_t *in, uint32_t *out, uint32_t first) {
+            for (size_t g = 0; g < BlockSize / 32; ++g) {
+                __packed_lane<Width, 0>::apply(in, out, first);
+                first = out[31];
+                in += Width;
+                out += 32;
+            }
+        }
+    };
+
+    template<uint16_t BlockSize>
+    struct __packed_unpack<BlockSize, 0> {
+        static void apply(const uint32_t *, uint32_t *out, uint32_t first) {
+            for (size_t i = 0; i < BlockSize; ++i) {
+                out[i] = first;
+            }
+        }
+    };
+
+    /**
+     * Table of the unpack routines for every width from 0 to 32.
+     */
+    template<uint16_t BlockSize>
+    struct __packed_unpack_table {
+        typedef void (*unpack_fn)(const uint32_t *, uint32_t *, uint32_t);
+
+        template<int... Widths>
+        static const unpack_fn *make(IndexSequence<Widths...>) {
+            static const unpack_fn fns[] = {&__packed_unpack<BlockSize, Widths>::apply...};
+            return fns;
+        }
+
+        static unpack_fn get(uint8_t width) {
+            return make(typename MakeIndexSequence<33>::type())[width];
+        }
+    };
+
+    // PackedSequence forward declaration
+    template<uint16_t BlockSize>
+    class packed_sequence;
+
+    /**
+     * Forward iterator over a packed sequence. The iterator decodes a
+     * whole block at a time into its own buffer, so it is larger than
+     * most iterators and should be passed by reference.
+     *
+     * @tparam BlockSize number of values per block
+     */
+    template<uint16_t BlockSize>
+    class PackedSequenceIterator {
+    public:
+        typedef size_t size_type;
+        typedef uint32_t val_type;
+        typedef const uint32_t &reference;
+        typedef const uint32_t *pointer;
+        typedef packed_sequence<BlockSize> sequence_type;
+        typedef PackedSequenceIterator<BlockSize> self_type;
+
+    private:
+        const sequence_type *m_seq;
+        size_type m_i;
+        size_type m_block;
+        uint32_t m_buf[BlockSize];
+
+        friend class packed_sequence<BlockSize>;
+
+        void load() {
+            if (m_i < m_seq->size()) {
+                m_block = m_i / BlockSize;
+                m_seq->decode_block(m_block, m_buf);
+            }
+        }
+
+    public:
+        PackedSequenceIterator()
+                : m_seq(nullptr),
+                  m_i(0),
+                  m_block(static_cast<size_type>(-1)) {}
+
+        PackedSequenceIterator(size_type i, const sequence_type *seq)
+                : m_seq(seq),
+                  m_i(i),
+                  m_block(static_cast<size_type>(-1)) {
+            load();
+        }
+
+        reference operator*() const {
+            return m_buf[m_i % BlockSize];
+        }
+
+        pointer operator->() const {
+            return &(operator*());
+        }
+
+        /**
+         * @return the index of the element pointed to
+         */
+        size_type index() const {
+            return m_i;
+        }
+
+        self_type &operator++() {
+            ++m_i;
+            if (m_i % BlockSize == 0) {
+                load();
+            }
+            return *this;
+        }
+
+        self_type operator++(int) {
+            self_type tmp(*this);
+            ++*this;
+            return tmp;
+        }
+
+        bool operator==(const self_type &it) const {
+            return m_i == it.m_i;
+        }
+
+        bool operator!=(const self_type &it) const {
+            return m_i != it.m_i;
+        }
+    };
+
+    /**
+     * Append-only compressed sequence of unsigned 32-bit integers.
+     * Differences between consecutive values are taken modulo
+     * 2^32 and interpreted as signed, so both increasing and
+     * decreasing runs compress well.
+     *
+     * The most recent partial block is kept uncompressed and is
+     * packed once it fills.
+     *
+     * @tparam BlockSize number of values per block, a multiple of 32
+     */
+    template<uint16_t BlockSize = 128>
+    class packed_sequence {
+        static_assert(BlockSize >= 32 && BlockSize % 32 == 0, "Block size must be a multiple of 32");
+
+    public:
+        typedef size_t size_type;
+        typedef uint32_t val_type;
+        typedef packed_sequence<BlockSize> sequence_type;
+        typedef PackedSequenceIterator<BlockSize> const_iterator;
+        typedef const_iterator iterator;
+
+        static constexpr size_type block_size = BlockSize;
+
+    private:
+        /**
+         * Header of a packed block. The packed differences start at
+         * word @code offset @endcode and occupy
+         * @code BlockSize * width / 32 @endcode words.
+         */
+        struct block {
+            uint32_t first;
+            uint32_t offset;
+            uint8_t width;
+        };
+
+        /**
+         * Packed words of all full blocks, followed by one zero word
+         * so that unpacking may always read a word past a value. The
+         * zero word is pushed by the first packed block if missing.
+         */
+        array_list<uint32_t> m_words;
+        array_list<block> m_blocks;
+        uint32_t m_tail[BlockSize];
+        uint16_t m_tail_size;
+
+        static uint32_t zigzag(uint32_t cur, uint32_t prev) {
+            const int32_t d = static_cast<int32_t>(cur - prev);
+            return (static_cast<uint32_t>(d) << 1) ^ static_cast<uint32_t>(d >> 31);
+        }
+
+        /**
+         * Pack the full tail buffer into a new block.
+         */
+        void pack_tail() {
+            uint32_t zs[BlockSize];
+            uint32_t bits = 0;
+            zs[0] = 0;
+            for (size_type i = 1; i < BlockSize; ++i) {
+                zs[i] = zigzag(m_tail[i], m_tail[i - 1]);
+                bits |= zs[i];
+            }
+            const uint8_t width = static_cast<uint8_t>(bits == 0 ? 0 : 8 * sizeof(unsigned long) - __builtin_clzl(bits));
+            const size_type words = static_cast<size_type>(BlockSize / 32 * width);
+
+            if (m_words.empty()) {
+                m_words.push_back(0u);
+            }
+            block b;
+            b.first = m_tail[0];
+            b.offset = static_cast<uint32_t>(m_words.size() - 1);
+            b.width = width;
+            m_blocks.push_back(b);
+
+            for (size_type i = 0; i < words; ++i) {
+                m_words.push_back(0u);
+            }
+            uint32_t *out = m_words.data() + b.offset;
+            for (size_type i = 0; i < BlockSize && width != 0; ++i) {
+                const size_type pos = i * width;
+                const size_type k = pos >> 5;
+                const uint32_t shift = static_cast<uint32_t>(pos & 31);
+                out[k] |= zs[i] << shift;
+                if (shift + width > 32) {
+                    out[k + 1] |= zs[i] >> (32 - shift);
+                }
+            }
+            m_tail_size = 0;
+        }
+
+        /**
+         * Decode a packed block into values.
+         */
+        void unpack(const block &b, uint32_t *out) const {
+            __packed_unpack_table<BlockSize>::get(b.width)(m_words.data() + b.offset, out, b.first);
+        }
+
+        /**
+         * @return the first value of a block, including the tail
+         */
+        uint32_t block_first(size_type bi) const {
+            return bi < m_blocks.size() ? m_blocks[bi].first : m_tail[0];
+        }
+
+    public:
+        /**
+         * Create an empty sequence.
+         *
+         * @param initial_blocks number of blocks to reserve space for
+         */
+        explicit packed_sequence(size_type initial_blocks = 4)
+                : m_words(initial_blocks * BlockSize / 4 + 1),
+                  m_blocks(initial_blocks > 0 ? initial_blocks : 1),
+                  m_tail_size(0) {
+            m_words.push_back(0u);
+        }
+
+        packed_sequence(const sequence_type &) = delete;
+
+        packed_sequence(sequence_type &&seq)
+                : m_words(move(seq.m_words)),
+                  m_blocks(move(seq.m_blocks)),
+                  m_tail_size(seq.m_tail_size) {
+            for (size_type i = 0; i < m_tail_size; ++i) {
+                m_tail[i] = seq.m_tail[i];
+            }
+            seq.m_tail_size = 0;
+        }
+
+        /**
+         * @return the number of values in the sequence
+         */
+        size_type size() const {
+            return m_blocks.size() * BlockSize + m_tail_size;
+        }
+
+        bool empty() const {
+            return m_blocks.empty() && m_tail_size == 0;
+        }
+
+        /**
+         * @return the number of blocks, including a partial tail block
+         */
+        size_type block_count() const {
+            return m_blocks.size() + (m_tail_size > 0 ? 1 : 0);
+        }
+
+        /**
+         * @return the bytes held by the sequence, including its own
+         * size and unused reserved space
+         */
+        size_t memory_usage() const {
+            return sizeof(sequence_type) +
+                   m_words.capacity() * sizeof(uint32_t) +
+                   m_blocks.capacity() * sizeof(block);
+        }
+
+        /**
+         * Append a value to the end of the sequence.
+         *
+         * @param value value to append
+         */
+        void push_back(uint32_t value) {
+            m_tail[m_tail_size++] = value;
+            if (m_tail_size == BlockSize) {
+                pack_tail();
+            }
+        }
+
+        /**
+         * Decode one block.
+         *
+         * @param bi  block index, less than @code block_count() @endcode
+         * @param out buffer with room for @code BlockSize @endcode values
+         * @return the number of values in the block
+         */
+        size_type decode_block(size_type bi, uint32_t *out) const {
+            if (bi < m_blocks.size()) {
+                unpack(m_blocks[bi], out);
+                return BlockSize;
+            }
+            for (size_type i = 0; i < m_tail_size; ++i) {
+                out[i] = m_tail[i];
+            }
+            return m_tail_size;
+        }
+
+        /**
+         * Decode the whole sequence.
+         *
+         * @param out buffer with room for @code size() @endcode values
+         */
+        void decode(uint32_t *out) const {
+            for (size_type bi = 0; bi < m_blocks.size(); ++bi) {
+                unpack(m_blocks[bi], out + bi * BlockSize);
+            }
+            decode_block(m_blocks.size(), out + m_blocks.size() * BlockSize);
+        }
+
+        /**
+         * Read a value by decoding its block. Out of range indices
+         * read zero.
+         *
+         * @param i value index
+         * @return the value
+         */
+        uint32_t at(size_type i) const {
+            const size_type bi = i / BlockSize;
+            const size_type j = i % BlockSize;
+            if (bi >= m_blocks.size()) {
+                return j < m_tail_size && bi == m_blocks.size() ? m_tail[j] : 0;
+            }
+            uint32_t buf[BlockSize];
+            unpack(m_blocks[bi], buf);
+            return buf[j];
+        }
+
+        uint32_t operator[](size_type i) const {
+            return at(i);
+        }
+
+        /**
+         * Find the first value not less than the given value in a
+         * sequence sorted in non-decreasing order. Block first values
+         * are binary searched and only one block is decoded.
+         *
+         * @param value value to search for
+         * @return the index of the first value not less than
+         * @code value @endcode, or @code size() @endcode
+         */
+        size_type lower_bound(uint32_t value) const {
+            size_type lo = 0;
+            size_type hi = block_count();
+            while (lo < hi) {
+                const size_type mid = lo + (hi - lo) / 2;
+                if (block_first(mid) < value) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+            if (lo == 0) {
+                return 0;
+            }
+            const size_type bi = lo - 1;
+            uint32_t buf[BlockSize];
+            const size_type n = decode_block(bi, buf);
+            size_type first = 0;
+            size_type count = n;
+            while (count > 0) {
+                const size_type step = count / 2;
+                if (buf[first + step] < value) {
+                    first += step + 1;
+                    count -= step + 1;
+                } else {
+                    count = step;
+                }
+            }
+            return bi * BlockSize + first;
+        }
+
+        /**
+         * Release reserved memory beyond what the packed blocks use,
+         * for sequences that are done growing.
+         */
+        void shrink() {
+            m_words.shrink();
+            m_blocks.shrink();
+        }
+
+        /**
+         * Remove all values. Reserved memory is kept.
+         */
+        void clear() {
+            m_words.clear();
+            m_blocks.clear();
+            m_tail_size = 0;
+        }
+
+        const_iterator begin() const {
+            return const_iterator(0, this);
+        }
+
+        const_iterator end() const {
+            return const_iterator(size(), this);
+        }
+
+        sequence_type &operator=(const sequence_type &) = delete;
+
+        sequence_type &operator=(sequence_type &&seq) {
+            if (this == &seq) {
+                return *this;
+            }
+            m_words = move(seq.m_words);
+            m_blocks = move(seq.m_blocks);
+            m_tail_size = seq.m_tail_size;
+            for (size_type i = 0; i < m_tail_size; ++i) {
+                m_tail[i] = seq.m_tail[i];
+            }
+            seq.m_tail_size = 0;
+            return *this;
+        }
+
+        void swap(sequence_type &seq) noexcept {
+            m_words.swap(seq.m_words);
+            m_blocks.swap(seq.m_blocks);
+            const uint16_t n = MAX(m_tail_size, seq.m_tail_size);
+            for (uint16_t i = 0; i < n; ++i) {
+                wlp::swap(m_tail[i], seq.m_tail[i]);
+            }
+            wlp::swap(m_tail_size, seq.m_tail_size);
+        }
+    };
+
+    template<uint16_t BlockSize>
+    constexpr typename packed_sequence<BlockSize>::size_type packed_sequence<BlockSize>::block_size;
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_PACKEDSEQUENCE_H
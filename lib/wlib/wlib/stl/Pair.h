@@ -52,8 +52,8 @@ namespace wlp {
          * @param pair temporary pair to copy
          */
         pair(pair &&pair)
-                : m_first(move(pair.m_first)),
-                  m_second(move(pair.m_second)) {
+                : m_first(forward<first_type>(pair.m_first)),
+                  m_second(forward<second_type>(pair.m_second)) {
         }
 
         /**
@@ -0,0 +1,152 @@
+/**
+ * @file Parallel.cpp
+ * @brief Implementation of the thread team.
+ *
+ * A job is published under the team lock with a new generation number,
+ * which wakes the workers. Threads claim tasks by incrementing a shared
+ * counter, and each worker checks in once it finds no tasks left, so
+ * the job, which lives on the stack of the thread running it, is not
+ * released while a worker may still read it.
+ *
+ * Compiled in when wlib is built with WLIB_THREADS, since the team
+ * runs on std::thread, which embedded targets do not have.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifdef WLIB_THREADS
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <wlib/stl/Parallel.h>
+
+namespace wlp {
+
+    struct team_state {
+        std::mutex mutex;
+        std::condition_variable start;
+        std::condition_variable done;
+        std::thread *workers;
+        size_t num_workers;
+
+        uint64_t generation;
+        bool stop;
+
+        void (*fn)(void *, size_t);
+        void *ctx;
+        size_t tasks;
+        size_t next;
+        // workers yet to check in for the current job
+        size_t active;
+
+        team_state()
+                : workers(nullptr),
+                  num_workers(0),
+                  generation(0),
+                  stop(false),
+                  fn(nullptr),
+                  ctx(nullptr),
+                  tasks(0),
+                  next(0),
+                  active(0) {
+        }
+    };
+
+    namespace {
+
+        void run_claimed(team_state *s) {
+            for (;;) {
+                size_t task = __atomic_fetch_add(&s->next, 1, __ATOMIC_RELAXED);
+                if (task >= s->tasks) {
+                    return;
+                }
+                s->fn(s->ctx, task);
+            }
+        }
+
+        void work(team_state *s) {
+            uint64_t seen = 0;
+            for (;;) {
+                {
+                    std::unique_lock<std::mutex> lock(s->mutex);
+                    while (!s->stop && s->generation == seen) {
+                        s->start.wait(lock);
+                    }
+                    if (s->stop) {
+                        return;
+                    }
+                    seen = s->generation;
+                }
+                run_claimed(s);
+                std::lock_guard<std::mutex> lock(s->mutex);
+                if (--s->active == 0) {
+                    s->done.notify_one();
+                }
+            }
+        }
+
+    }
+
+    thread_team::thread_team(size_t threads)
+            : m_state(create<team_state>()),
+              m_size(threads) {
+        if (m_size == 0) {
+            m_size = std::thread::hardware_concurrency();
+        }
+        if (m_size == 0) {
+            m_size = 1;
+        }
+        m_state->num_workers = m_size - 1;
+        if (m_state->num_workers) {
+            m_state->workers = create<std::thread[]>(m_state->num_workers);
+            for (size_t i = 0; i < m_state->num_workers; ++i) {
+                m_state->workers[i] = std::thread(work, m_state);
+            }
+        }
+    }
+
+    thread_team::~thread_team() {
+        {
+            std::lock_guard<std::mutex> lock(m_state->mutex);
+            m_state->stop = true;
+        }
+        m_state->start.notify_all();
+        for (size_t i = 0; i < m_state->num_workers; ++i) {
+            m_state->workers[i].join();
+        }
+        destroy<std::thread[]>(m_state->workers);
+        destroy<team_state>(m_state);
+    }
+
+    void thread_team::run_tasks(size_t tasks, void (*fn)(void *, size_t), void *ctx) {
+        team_state *s = m_state;
+        if (s->num_workers == 0 || tasks <= 1) {
+            for (size_t task = 0; task < tasks; ++task) {
+                fn(ctx, task);
+            }
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(s->mutex);
+            s->fn = fn;
+            s->ctx = ctx;
+            s->tasks = tasks;
+            s->next = 0;
+            s->active = s->num_workers;
+            ++s->generation;
+        }
+        s->start.notify_all();
+        run_claimed(s);
+        std::unique_lock<std::mutex> lock(s->mutex);
+        while (s->active != 0) {
+            s->done.wait(lock);
+        }
+    }
+
+}
+
+#endif
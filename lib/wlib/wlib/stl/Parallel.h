@@ -0,0 +1,330 @@
+/**
+ * @file Parallel.h
+ * @brief Multithreaded reduce, scan, partition, and histogram.
+ *
+ * The algorithms split a span into blocks of a fixed number of elements
+ * and run the blocks as tasks on a thread team. Blocks do not depend on
+ * the number of threads, and partial results are combined in block
+ * order, so the results are the same for any team size, including
+ * floating point results. They may differ from a sequential loop,
+ * which associates the operation differently.
+ *
+ * Arrays of tens of millions of elements are the intended use; spans
+ * of at most one block run on the calling thread. The thread team is
+ * only built into wlib with the WLIB_THREADS option.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_PARALLEL_H
+#define EMBEDDEDCPLUSPLUS_PARALLEL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <wlib/memory>
+#include <wlib/stl/Helper.h>
+#include <wlib/stl/Span.h>
+
+namespace wlp {
+
+    /**
+     * Elements in each block of a parallel algorithm.
+     */
+    enum : size_t {
+        parallel_block = 1 << 14
+    };
+
+    struct team_state;
+
+    /**
+     * A fixed set of worker threads that run the tasks of one job at a
+     * time. The thread that runs a job works on it too, so a team of
+     * one thread has no workers and runs jobs inline. A team runs jobs
+     * from one thread at a time, and tasks may not start jobs.
+     */
+    class thread_team {
+    private:
+        team_state *m_state;
+        size_t m_size;
+
+        template<typename F>
+        static void call(void *f, size_t task) {
+            (*static_cast<F *>(f))(task);
+        }
+
+        void run_tasks(size_t tasks, void (*fn)(void *, size_t), void *ctx);
+
+    public:
+        /**
+         * Start a team.
+         *
+         * @param threads the number of threads including the caller, or
+         *                zero for one per hardware thread
+         */
+        explicit thread_team(size_t threads = 0);
+
+        thread_team(const thread_team &) = delete;
+
+        /**
+         * Stop and join the workers.
+         */
+        ~thread_team();
+
+        thread_team &operator=(const thread_team &) = delete;
+
+        /**
+         * @return the number of threads including the caller
+         */
+        size_t size() const {
+            return m_size;
+        }
+
+        /**
+         * Call a function with every task index in [0, tasks) and wait
+         * for all of the calls to return. Tasks are claimed by threads
+         * in index order.
+         */
+        template<typename F>
+        void run(size_t tasks, F f) {
+            run_tasks(tasks, &call<F>, &f);
+        }
+    };
+
+    /**
+     * @return the number of blocks of a span size
+     */
+    inline size_t parallel_blocks(size_t n) {
+        return (n + parallel_block - 1) / parallel_block;
+    }
+
+    /**
+     * Combine the elements with an associative operation.
+     *
+     * @param team     threads to run on
+     * @param in       the elements
+     * @param identity the identity of the operation, which starts the
+     *                 sum of each block
+     * @param op       the operation
+     * @return the identity combined with every element
+     */
+    template<typename T, typename V, typename Op>
+    V parallel_reduce(thread_team &team, span<T> in, V identity, Op op) {
+        const T *const src = in.data();
+        const size_t n = in.size();
+        const size_t blocks = parallel_blocks(n);
+        V *partial = create<V[]>(blocks);
+        team.run(blocks, [&](size_t b) {
+            const size_t end = MIN(n, (b + 1) * parallel_block);
+            V acc = identity;
+            for (size_t i = b * parallel_block; i < end; ++i) {
+                acc = op(acc, src[i]);
+            }
+            partial[b] = acc;
+        });
+        V acc = identity;
+        for (size_t b = 0; b < blocks; ++b) {
+            acc = op(acc, partial[b]);
+        }
+        destroy<V[]>(partial);
+        return acc;
+    }
+
+    /**
+     * Store the combination of each element and all before it, or,
+     * for an exclusive scan, of all the elements before it. The output
+     * may be the input span.
+     *
+     * @param team      threads to run on
+     * @param in        the elements
+     * @param out       the sums, up to the shorter of the two spans
+     * @param identity  the identity of the operation
+     * @param op        an associative operation
+     * @param inclusive whether each sum includes its element
+     * @return the number of sums stored
+     */
+    template<typename T, typename V, typename Op>
+    size_t parallel_scan(thread_team &team, span<T> in, span<V> out, V identity, Op op, bool inclusive) {
+        const T *const src = in.data();
+        V *const dst = out.data();
+        const size_t n = MIN(in.size(), out.size());
+        const size_t blocks = parallel_blocks(n);
+        // the sum of each block, then the sum of the blocks before it
+        V *carry = create<V[]>(blocks);
+        if (blocks > 1) {
+            team.run(blocks, [&](size_t b) {
+                const size_t end = MIN(n, (b + 1) * parallel_block);
+                V acc = identity;
+                for (size_t i = b * parallel_block; i < end; ++i) {
+                    acc = op(acc, src[i]);
+                }
+                carry[b] = acc;
+            });
+            V acc = identity;
+            for (size_t b = 0; b < blocks; ++b) {
+                V sum = carry[b];
+                carry[b] = acc;
+                acc = op(acc, sum);
+            }
+        } else if (blocks == 1) {
+            carry[0] = identity;
+        }
+        team.run(blocks, [&](size_t b) {
+            const size_t end = MIN(n, (b + 1) * parallel_block);
+            V sum = carry[b];
+            for (size_t i = b * parallel_block; i < end; ++i) {
+                V v = src[i];
+                if (!inclusive) {
+                    dst[i] = sum;
+                }
+                sum = op(sum, v);
+                if (inclusive) {
+                    dst[i] = sum;
+                }
+            }
+        });
+        destroy<V[]>(carry);
+        return n;
+    }
+
+    template<typename T, typename V, typename Op>
+    size_t parallel_inclusive_scan(thread_team &team, span<T> in, span<V> out, V identity, Op op) {
+        return parallel_scan(team, in, out, identity, op, true);
+    }
+
+    template<typename T, typename V, typename Op>
+    size_t parallel_exclusive_scan(thread_team &team, span<T> in, span<V> out, V identity, Op op) {
+        return parallel_scan(team, in, out, identity, op, false);
+    }
+
+    /**
+     * Copy the elements that satisfy a predicate, in order, followed by
+     * the rest in order if @p keep_rest is set. The predicate is called
+     * twice on each element, once to count and once to copy.
+     *
+     * @param team      threads to run on
+     * @param in        the elements
+     * @param out       the destination, which must not overlap the input;
+     *                  elements past its end are not copied
+     * @param pred      the predicate
+     * @param keep_rest whether to copy the elements that fail
+     * @return the number of elements that satisfy the predicate
+     */
+    template<typename T, typename U, typename Pred>
+    size_t parallel_split(thread_team &team, span<T> in, span<U> out, Pred pred, bool keep_rest) {
+        const T *const src = in.data();
+        U *const dst = out.data();
+        const size_t n = in.size();
+        const size_t room = out.size();
+        const size_t blocks = parallel_blocks(n);
+        // the passing elements of each block, then of the blocks before it
+        size_t *before = create<size_t[]>(blocks);
+        team.run(blocks, [&](size_t b) {
+            const size_t end = MIN(n, (b + 1) * parallel_block);
+            size_t c = 0;
+            for (size_t i = b * parallel_block; i < end; ++i) {
+                c += pred(src[i]) ? 1 : 0;
+            }
+            before[b] = c;
+        });
+        size_t total = 0;
+        for (size_t b = 0; b < blocks; ++b) {
+            size_t c = before[b];
+            before[b] = total;
+            total += c;
+        }
+        team.run(blocks, [&](size_t b) {
+            const size_t begin = b * parallel_block;
+            const size_t end = MIN(n, begin + parallel_block);
+            size_t pass = before[b];
+            // the failing elements before this block follow all that pass
+            size_t fail = total + begin - before[b];
+            for (size_t i = begin; i < end; ++i) {
+                if (pred(src[i])) {
+                    if (pass < room) {
+                        dst[pass] = src[i];
+                    }
+                    ++pass;
+                } else if (keep_rest) {
+                    if (fail < room) {
+                        dst[fail] = src[i];
+                    }
+                    ++fail;
+                }
+            }
+        });
+        destroy<size_t[]>(before);
+        return total;
+    }
+
+    /**
+     * Stable partition: copy the elements that satisfy a predicate and
+     * then the rest, each in their original order.
+     *
+     * @return the number of elements that satisfy the predicate
+     */
+    template<typename T, typename U, typename Pred>
+    size_t parallel_partition(thread_team &team, span<T> in, span<U> out, Pred pred) {
+        return parallel_split(team, in, out, pred, true);
+    }
+
+    /**
+     * Stream compaction: copy the elements that satisfy a predicate, in
+     * order.
+     *
+     * @return the number of elements that satisfy the predicate
+     */
+    template<typename T, typename U, typename Pred>
+    size_t parallel_compact(thread_team &team, span<T> in, span<U> out, Pred pred) {
+        return parallel_split(team, in, out, pred, false);
+    }
+
+    /**
+     * Count elements into bins. Each thread counts a slice of the
+     * elements into its own bins, which are added up at the end. Counts
+     * are added to the bins, which are not cleared first.
+     *
+     * @param team threads to run on
+     * @param in   the elements
+     * @param bins the bin counts
+     * @param bin  function from an element to its bin index; elements
+     *             with an index past the last bin are not counted
+     */
+    template<typename T, typename Bin>
+    void parallel_histogram(thread_team &team, span<T> in, span<uint32_t> bins, Bin bin) {
+        const T *const src = in.data();
+        const size_t n = in.size();
+        const size_t num_bins = bins.size();
+        const size_t blocks = parallel_blocks(n);
+        const size_t slices = MIN(blocks, team.size());
+        if (slices == 0 || num_bins == 0) {
+            return;
+        }
+        uint32_t *counts = create<uint32_t[]>(slices * num_bins);
+        memset(counts, 0, slices * num_bins * sizeof(uint32_t));
+        team.run(slices, [&](size_t s) {
+            // whole blocks per slice
+            const size_t begin = blocks * s / slices * parallel_block;
+            const size_t end = MIN(n, blocks * (s + 1) / slices * parallel_block);
+            uint32_t *const local = counts + s * num_bins;
+            for (size_t i = begin; i < end; ++i) {
+                const size_t k = static_cast<size_t>(bin(src[i]));
+                if (k < num_bins) {
+                    ++local[k];
+                }
+            }
+        });
+        for (size_t s = 0; s < slices; ++s) {
+            for (size_t k = 0; k < num_bins; ++k) {
+                bins[k] += counts[s * num_bins + k];
+            }
+        }
+        destroy<uint32_t[]>(counts);
+    }
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_PARALLEL_H
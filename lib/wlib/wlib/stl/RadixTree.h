@@ -0,0 +1,875 @@
+/**
+ * @file RadixTree.h
+ * @brief Adaptive radix tree over byte string keys.
+ *
+ * Keys are consumed one byte per level, and runs of single-child
+ * levels are collapsed into a prefix stored in the node. Inner nodes
+ * come in four sizes holding up to 4, 16, 48, or 256 children and are
+ * grown or shrunk as children are added and removed, so sparse levels
+ * stay small and dense levels are indexed directly. Any node may hold
+ * a value, which lets one key be a prefix of another, and enables
+ * longest-prefix matching and ordered enumeration of a key prefix.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_RADIXTREE_H
+#define EMBEDDEDCPLUSPLUS_RADIXTREE_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include <wlib/stl/ArrayList.h>
+#include <wlib/stl/Pair.h>
+#include <wlib/strings/String.h>
+#include <wlib/memory>
+#include <wlib/utility>
+
+namespace wlp {
+
+    /**
+     * View of the bytes of a radix tree key. Constructible implicitly
+     * from C strings and the string classes, so that every radix tree
+     * function accepts any of them.
+     */
+    struct radix_key {
+        const uint8_t *data;
+        size_t length;
+
+        radix_key(const char *str)
+                : data(reinterpret_cast<const uint8_t *>(str)),
+                  length(strlen(str)) {
+        }
+
+        radix_key(const char *str, size_t len)
+                : data(reinterpret_cast<const uint8_t *>(str)),
+                  length(len) {
+        }
+
+        template<size_t tSize>
+        radix_key(const static_string<tSize> &str)
+                : data(reinterpret_cast<const uint8_t *>(str.c_str())),
+                  length(str.length()) {
+        }
+
+        radix_key(const dynamic_string &str)
+                : data(reinterpret_cast<const uint8_t *>(str.c_str())),
+                  length(str.length()) {
+        }
+    };
+
+    /**
+     * Common header of the radix tree nodes.
+     *
+     * @tparam Val value type
+     */
+    template<typename Val>
+    struct __radix_node {
+        enum : uint8_t {
+            node4 = 0,
+            node16 = 1,
+            node48 = 2,
+            node256 = 3
+        };
+
+        enum : uint32_t {
+            inline_prefix = 16
+        };
+
+        uint8_t type;
+        uint16_t count;
+        uint32_t prefix_len;
+        /**
+         * Value of the key ending at this node, or null.
+         */
+        Val *value;
+        /**
+         * Compressed path, stored inline when short.
+         */
+        union {
+            uint8_t small[inline_prefix];
+            uint8_t *heap;
+        } prefix;
+
+        const uint8_t *prefix_data() const {
+            return prefix_len <= inline_prefix ? prefix.small : prefix.heap;
+        }
+    };
+
+    template<typename Val>
+    struct __radix_node4 : public __radix_node<Val> {
+        uint8_t keys[4];
+        __radix_node<Val> *children[4];
+    };
+
+    template<typename Val>
+    struct __radix_node16 : public __radix_node<Val> {
+        uint8_t keys[16];
+        __radix_node<Val> *children[16];
+    };
+
+    /**
+     * Node with an index from key byte to child slot. Index entries
+     * hold the slot plus one, so zero marks a missing child.
+     */
+    template<typename Val>
+    struct __radix_node48 : public __radix_node<Val> {
+        uint8_t index[256];
+        __radix_node<Val> *children[48];
+    };
+
+    template<typename Val>
+    struct __radix_node256 : public __radix_node<Val> {
+        __radix_node<Val> *children[256];
+    };
+
+    /**
+     * Node operations of the radix tree.
+     *
+     * @tparam Val value type
+     */
+    template<typename Val>
+    struct __radix {
+        typedef __radix_node<Val> node;
+        typedef __radix_node4<Val> node4;
+        typedef __radix_node16<Val> node16;
+        typedef __radix_node48<Val> node48;
+        typedef __radix_node256<Val> node256;
+
+        /**
+         * Find a byte among the sorted keys of a node16 by comparing
+         * eight keys per word. Lanes past the child count may hold
+         * stale keys, but they follow every valid lane in the same
+         * word, so the first match is valid if there is one.
+         *
+         * @return the slot of the key, or -1
+         */
+        static int32_t find16(const uint8_t *keys, uint32_t count, uint8_t c) {
+            const uint64_t ones = 0x0101010101010101ULL;
+            const uint64_t low = 0x7f7f7f7f7f7f7f7fULL;
+            const uint64_t probe = ones * c;
+            for (uint32_t w = 0; w * 8 < count; ++w) {
+                uint64_t x;
+                memcpy(&x, keys + w * 8, sizeof(x));
+                x ^= probe;
+                const uint64_t zero = ~(((x & low) + low) | x | low);
+                if (zero != 0) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+                    const uint32_t i = w * 8 + static_cast<uint32_t>(__builtin_clzll(zero)) / 8;
+#else
+                    const uint32_t i = w * 8 + static_cast<uint32_t>(__builtin_ctzll(zero)) / 8;
+#endif
+                    return i < count ? static_cast<int32_t>(i) : -1;
+                }
+            }
+            return -1;
+        }
+
+        static node *make(uint8_t type) {
+            node *n;
+            switch (type) {
+                case node::node4:
+                    n = create<node4>();
+                    break;
+                case node::node16:
+                    n = create<node16>();
+                    break;
+                case node::node48:
+                    n = create<node48>();
+                    break;
+                default:
+                    n = create<node256>();
+                    break;
+            }
+            n->type = type;
+            return n;
+        }
+
+        /**
+         * Free a node without touching its prefix, value, or children.
+         */
+        static void free_node(node *n) {
+            switch (n->type) {
+                case node::node4:
+                    destroy<node4>(static_cast<node4 *>(n));
+                    break;
+                case node::node16:
+                    destroy<node16>(static_cast<node16 *>(n));
+                    break;
+                case node::node48:
+                    destroy<node48>(static_cast<node48 *>(n));
+                    break;
+                default:
+                    destroy<node256>(static_cast<node256 *>(n));
+                    break;
+            }
+        }
+
+        static void free_prefix(node *n) {
+            if (n->prefix_len > node::inline_prefix) {
+                destroy<uint8_t[]>(n->prefix.heap);
+            }
+            n->prefix_len = 0;
+        }
+
+        /**
+         * Replace the prefix of a node. The new prefix may point into
+         * the current one.
+         */
+        static void set_prefix(node *n, const uint8_t *data, uint32_t len) {
+            uint8_t *old = n->prefix_len > node::inline_prefix ? n->prefix.heap : nullptr;
+            if (len > node::inline_prefix) {
+                uint8_t *dst = create<uint8_t[]>(len);
+                memcpy(dst, data, len);
+                n->prefix.heap = dst;
+            } else {
+                memmove(n->prefix.small, data, len);
+            }
+            n->prefix_len = len;
+            if (old) {
+                destroy<uint8_t[]>(old);
+            }
+        }
+
+        /**
+         * Free a subtree, including prefixes and values.
+         */
+        static void destroy_tree(node *n) {
+            if (!n) {
+                return;
+            }
+            for_each_child(n, [](uint8_t, node *c) {
+                destroy_tree(c);
+            });
+            if (n->value) {
+                destroy<Val>(n->value);
+            }
+            free_prefix(n);
+            free_node(n);
+        }
+
+        /**
+         * Call a function with each child of a node in key order.
+         */
+        template<typename F>
+        static void for_each_child(node *n, F &&f) {
+            switch (n->type) {
+                case node::node4: {
+                    node4 *p = static_cast<node4 *>(n);
+                    for (uint32_t i = 0; i < n->count; ++i) {
+                        f(p->keys[i], p->children[i]);
+                    }
+                    break;
+                }
+                case node::node16: {
+                    node16 *p = static_cast<node16 *>(n);
+                    for (uint32_t i = 0; i < n->count; ++i) {
+                        f(p->keys[i], p->children[i]);
+                    }
+                    break;
+                }
+                case node::node48: {
+                    node48 *p = static_cast<node48 *>(n);
+                    for (uint32_t c = 0; c < 256; ++c) {
+                        if (p->index[c]) {
+                            f(static_cast<uint8_t>(c), p->children[p->index[c] - 1]);
+                        }
+                    }
+                    break;
+                }
+                default: {
+                    node256 *p = static_cast<node256 *>(n);
+                    for (uint32_t c = 0; c < 256; ++c) {
+                        if (p->children[c]) {
+                            f(static_cast<uint8_t>(c), p->children[c]);
+                        }
+                    }
+                    break;
+                }
+            }
+        }
+
+        /**
+         * @return the slot holding the child for a byte, or null
+         */
+        static node **find_child(node *n, uint8_t c) {
+            switch (n->type) {
+                case node::node4: {
+                    node4 *p = static_cast<node4 *>(n);
+                    for (uint32_t i = 0; i < n->count; ++i) {
+                        if (p->keys[i] == c) {
+                            return &p->children[i];
+                        }
+                    }
+                    return nullptr;
+                }
+                case node::node16: {
+                    node16 *p = static_cast<node16 *>(n);
+                    const int32_t i = find16(p->keys, n->count, c);
+                    return i < 0 ? nullptr : &p->children[i];
+                }
+                case node::node48: {
+                    node48 *p = static_cast<node48 *>(n);
+                    return p->index[c] ? &p->children[p->index[c] - 1] : nullptr;
+                }
+                default: {
+                    node256 *p = static_cast<node256 *>(n);
+                    return p->children[c] ? &p->children[c] : nullptr;
+                }
+            }
+        }
+
+        /**
+         * Replace a node with a node of another size holding the
+         * same header and children.
+         */
+        static node *resize(node *n, uint8_t type) {
+            node *r = make(type);
+            r->value = n->value;
+            r->prefix_len = n->prefix_len;
+            r->prefix = n->prefix;
+            for_each_child(n, [r](uint8_t c, node *child) {
+                insert_child(r, c, child);
+            });
+            free_node(n);
+            return r;
+        }
+
+        /**
+         * Add a child to a node that has room for it.
+         */
+        static void insert_child(node *n, uint8_t c, node *child) {
+            switch (n->type) {
+                case node::node4:
+                case node::node16: {
+                    uint8_t *keys = n->type == node::node4 ? static_cast<node4 *>(n)->keys
+                                                           : static_cast<node16 *>(n)->keys;
+                    node **children = n->type == node::node4 ? static_cast<node4 *>(n)->children
+                                                             : static_cast<node16 *>(n)->children;
+                    uint32_t i = n->count;
+                    while (i > 0 && keys[i - 1] > c) {
+                        keys[i] = keys[i - 1];
+                        children[i] = children[i - 1];
+                        --i;
+                    }
+                    keys[i] = c;
+                    children[i] = child;
+                    break;
+                }
+                case node::node48: {
+                    node48 *p = static_cast<node48 *>(n);
+                    uint32_t slot = 0;
+                    while (p->children[slot]) {
+                        ++slot;
+                    }
+                    p->children[slot] = child;
+                    p->index[c] = static_cast<uint8_t>(slot + 1);
+                    break;
+                }
+                default:
+                    static_cast<node256 *>(n)->children[c] = child;
+                    break;
+            }
+            ++n->count;
+        }
+
+        /**
+         * Add a child, growing the node if it is full.
+         */
+        static void add_child(node *&ref, uint8_t c, node *child) {
+            node *n = ref;
+            if (n->type == node::node4 && n->count == 4) {
+                ref = n = resize(n, node::node16);
+            } else if (n->type == node::node16 && n->count == 16) {
+                ref = n = resize(n, node::node48);
+            } else if (n->type == node::node48 && n->count == 48) {
+                ref = n = resize(n, node::node256);
+            }
+            insert_child(n, c, child);
+        }
+
+        /**
+         * Remove a child, shrinking the node once it is sparse enough.
+         */
+        static void remove_child(node *&ref, uint8_t c) {
+            node *n = ref;
+            switch (n->type) {
+                case node::node4:
+                case node::node16: {
+                    uint8_t *keys = n->type == node::node4 ? static_cast<node4 *>(n)->keys
+                                                           : static_cast<node16 *>(n)->keys;
+                    node **children = n->type == node::node4 ? static_cast<node4 *>(n)->children
+                                                             : static_cast<node16 *>(n)->children;
+                    uint32_t i = 0;
+                    while (keys[i] != c) {
+                        ++i;
+                    }
+                    for (; i + 1 < n->count; ++i) {
+                        keys[i] = keys[i + 1];
+                        children[i] = children[i + 1];
+                    }
+                    break;
+                }
+                case node::node48: {
+                    node48 *p = static_cast<node48 *>(n);
+                    p->children[p->index[c] - 1] = nullptr;
+                    p->index[c] = 0;
+                    break;
+                }
+                default:
+                    static_cast<node256 *>(n)->children[c] = nullptr;
+                    break;
+            }
+            --n->count;
+            if (n->type == node::node256 && n->count <= 36) {
+                ref = resize(n, node::node48);
+            } else if (n->type == node::node48 && n->count <= 12) {
+                ref = resize(n, node::node16);
+            } else if (n->type == node::node16 && n->count <= 3) {
+                ref = resize(n, node::node4);
+            }
+        }
+
+        /**
+         * Make a node holding the remainder of a key and its value.
+         */
+        static node *make_leaf(const uint8_t *data, uint32_t len, Val *value) {
+            node *n = make(node::node4);
+            set_prefix(n, data, len);
+            n->value = value;
+            return n;
+        }
+
+        /**
+         * Remove a node that has no value and at most one child,
+         * merging the child's prefix into the parent edge.
+         */
+        static void compact(node *&ref) {
+            node *n = ref;
+            if (n->value || n->count > 1) {
+                return;
+            }
+            if (n->count == 0) {
+                free_prefix(n);
+                free_node(n);
+                ref = nullptr;
+                return;
+            }
+            uint8_t edge = 0;
+            node *child = nullptr;
+            for_each_child(n, [&edge, &child](uint8_t c, node *ch) {
+                edge = c;
+                child = ch;
+            });
+            const uint32_t len = n->prefix_len + 1 + child->prefix_len;
+            uint8_t *buf = create<uint8_t[]>(len);
+            memcpy(buf, n->prefix_data(), n->prefix_len);
+            buf[n->prefix_len] = edge;
+            memcpy(buf + n->prefix_len + 1, child->prefix_data(), child->prefix_len);
+            set_prefix(child, buf, len);
+            destroy<uint8_t[]>(buf);
+            free_prefix(n);
+            free_node(n);
+            ref = child;
+        }
+
+        static size_t node_size(const node *n) {
+            switch (n->type) {
+                case node::node4:
+                    return sizeof(node4);
+                case node::node16:
+                    return sizeof(node16);
+                case node::node48:
+                    return sizeof(node48);
+                default:
+                    return sizeof(node256);
+            }
+        }
+
+        static size_t memory_usage(node *n) {
+            if (!n) {
+                return 0;
+            }
+            size_t bytes = node_size(n);
+            if (n->prefix_len > node::inline_prefix) {
+                bytes += n->prefix_len;
+            }
+            if (n->value) {
+                bytes += sizeof(Val);
+            }
+            for_each_child(n, [&bytes](uint8_t, node *c) {
+                bytes += memory_usage(c);
+            });
+            return bytes;
+        }
+    };
+
+    /**
+     * Ordered map from byte strings to values, built as an adaptive
+     * radix tree. Lookups cost one step per key byte outside of the
+     * compressed paths, independent of the number of keys, and keys
+     * sharing a prefix share its storage.
+     *
+     * Besides exact lookups, the tree finds the longest stored key
+     * that is a prefix of a query and visits, in lexicographic order,
+     * every stored key that starts with a given prefix. Keys may be
+     * given as C strings, static or dynamic strings, or a radix key
+     * with an explicit length, and may contain any bytes.
+     *
+     * @tparam Val value type
+     */
+    template<typename Val>
+    class radix_tree {
+    public:
+        typedef radix_tree<Val> tree_type;
+        typedef size_t size_type;
+        typedef Val val_type;
+
+    private:
+        typedef __radix<Val> ops;
+        typedef typename ops::node node;
+
+        node *m_root;
+        size_type m_size;
+
+        /**
+         * @return the number of leading bytes the key and the node
+         * prefix have in common
+         */
+        static uint32_t common_prefix(const node *n, const radix_key &key, size_t depth) {
+            const uint8_t *p = n->prefix_data();
+            const size_t rest = key.length - depth;
+            const uint32_t max = n->prefix_len < rest ? n->prefix_len : static_cast<uint32_t>(rest);
+            uint32_t i = 0;
+            while (i < max && p[i] == key.data[depth + i]) {
+                ++i;
+            }
+            return i;
+        }
+
+        template<typename V>
+        pair<val_type *, bool> insert_impl(const radix_key &key, V &&val, bool assign) {
+            node **ref = &m_root;
+            size_t depth = 0;
+            for (;;) {
+                node *n = *ref;
+                if (!n) {
+                    val_type *v = create<val_type>(forward<V>(val));
+                    *ref = ops::make_leaf(key.data + depth, static_cast<uint32_t>(key.length - depth), v);
+                    ++m_size;
+                    return pair<val_type *, bool>(v, true);
+                }
+                const uint32_t p = common_prefix(n, key, depth);
+                if (p < n->prefix_len) {
+                    node *split = ops::make(node::node4);
+                    ops::set_prefix(split, n->prefix_data(), p);
+                    const uint8_t edge = n->prefix_data()[p];
+                    ops::set_prefix(n, n->prefix_data() + p + 1, n->prefix_len - p - 1);
+                    ops::insert_child(split, edge, n);
+                    *ref = split;
+                    val_type *v = create<val_type>(forward<V>(val));
+                    depth += p;
+                    if (depth == key.length) {
+                        split->value = v;
+                    } else {
+                        node *leaf = ops::make_leaf(key.data + depth + 1,
+                                                    static_cast<uint32_t>(key.length - depth - 1), v);
+                        ops::insert_child(split, key.data[depth], leaf);
+                    }
+                    ++m_size;
+                    return pair<val_type *, bool>(v, true);
+                }
+                depth += p;
+                if (depth == key.length) {
+                    if (n->value) {
+                        if (assign) {
+                            *n->value = forward<V>(val);
+                        }
+                        return pair<val_type *, bool>(n->value, false);
+                    }
+                    n->value = create<val_type>(forward<V>(val));
+                    ++m_size;
+                    return pair<val_type *, bool>(n->value, true);
+                }
+                node **child = ops::find_child(n, key.data[depth]);
+                if (!child) {
+                    val_type *v = create<val_type>(forward<V>(val));
+                    node *leaf = ops::make_leaf(key.data + depth + 1,
+                                                static_cast<uint32_t>(key.length - depth - 1), v);
+                    ops::add_child(*ref, key.data[depth], leaf);
+                    ++m_size;
+                    return pair<val_type *, bool>(v, true);
+                }
+                ref = child;
+                ++depth;
+            }
+        }
+
+        bool erase_impl(node *&ref, const radix_key &key, size_t depth) {
+            node *n = ref;
+            if (!n || common_prefix(n, key, depth) < n->prefix_len) {
+                return false;
+            }
+            depth += n->prefix_len;
+            if (depth == key.length) {
+                if (!n->value) {
+                    return false;
+                }
+                destroy<val_type>(n->value);
+                n->value = nullptr;
+                ops::compact(ref);
+                return true;
+            }
+            const uint8_t c = key.data[depth];
+            node **child = ops::find_child(n, c);
+            if (!child || !erase_impl(*child, key, depth + 1)) {
+                return false;
+            }
+            if (!*child) {
+                ops::remove_child(ref, c);
+            }
+            ops::compact(ref);
+            return true;
+        }
+
+        /**
+         * Visit a subtree in key order, with the key bytes leading to
+         * the node already in the buffer.
+         */
+        template<typename F>
+        static void visit(node *n, array_list<char> &buf, F &f, size_type &count) {
+            const uint8_t *p = n->prefix_data();
+            for (uint32_t i = 0; i < n->prefix_len; ++i) {
+                buf.push_back(static_cast<char>(p[i]));
+            }
+            if (n->value) {
+                f(static_cast<const char *>(buf.data()), buf.size(), *n->value);
+                ++count;
+            }
+            ops::for_each_child(n, [&buf, &f, &count](uint8_t c, node *child) {
+                buf.push_back(static_cast<char>(c));
+                visit(child, buf, f, count);
+                buf.pop_back();
+            });
+            for (uint32_t i = 0; i < n->prefix_len; ++i) {
+                buf.pop_back();
+            }
+        }
+
+    public:
+        radix_tree()
+                : m_root(nullptr),
+                  m_size(0) {
+        }
+
+        radix_tree(const tree_type &) = delete;
+
+        radix_tree(tree_type &&tree)
+                : m_root(tree.m_root),
+                  m_size(tree.m_size) {
+            tree.m_root = nullptr;
+            tree.m_size = 0;
+        }
+
+        ~radix_tree() {
+            ops::destroy_tree(m_root);
+        }
+
+        size_type size() const {
+            return m_size;
+        }
+
+        bool empty() const {
+            return m_size == 0;
+        }
+
+        void clear() {
+            ops::destroy_tree(m_root);
+            m_root = nullptr;
+            m_size = 0;
+        }
+
+        /**
+         * @return bytes used by the nodes, long prefixes, and values
+         */
+        size_t memory_usage() const {
+            return sizeof(tree_type) + ops::memory_usage(m_root);
+        }
+
+        /**
+         * Insert a value if the key is not present.
+         *
+         * @param key the key
+         * @param val the value
+         * @return pointer to the value stored for the key, and whether
+         * the insertion took place
+         */
+        template<typename V>
+        pair<val_type *, bool> insert(const radix_key &key, V &&val) {
+            return insert_impl(key, forward<V>(val), false);
+        }
+
+        template<typename V>
+        pair<val_type *, bool> insert_or_assign(const radix_key &key, V &&val) {
+            return insert_impl(key, forward<V>(val), true);
+        }
+
+        /**
+         * @return pointer to the value for the key, or null
+         */
+        val_type *find(const radix_key &key) {
+            node *n = m_root;
+            size_t depth = 0;
+            while (n) {
+                if (common_prefix(n, key, depth) < n->prefix_len) {
+                    return nullptr;
+                }
+                depth += n->prefix_len;
+                if (depth == key.length) {
+                    return n->value;
+                }
+                node **child = ops::find_child(n, key.data[depth]);
+                n = child ? *child : nullptr;
+                ++depth;
+            }
+            return nullptr;
+        }
+
+        const val_type *find(const radix_key &key) const {
+            return const_cast<tree_type *>(this)->find(key);
+        }
+
+        bool contains(const radix_key &key) const {
+            return find(key) != nullptr;
+        }
+
+        /**
+         * Access the value for a key, inserting a default value if
+         * the key is not present.
+         */
+        val_type &operator[](const radix_key &key) {
+            return *insert_impl(key, val_type(), false).first();
+        }
+
+        /**
+         * Remove a key and its value.
+         *
+         * @return true if the key was present
+         */
+        bool erase(const radix_key &key) {
+            if (erase_impl(m_root, key, 0)) {
+                --m_size;
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * Find the longest stored key that is a prefix of the query,
+         * such as the most specific route for a topic name.
+         *
+         * @param key     the query
+         * @param matched if not null, receives the length of the
+         *                matching stored key
+         * @return pointer to the value of the matching key, or null
+         */
+        val_type *longest_prefix(const radix_key &key, size_type *matched = nullptr) {
+            val_type *best = nullptr;
+            size_type best_len = 0;
+            node *n = m_root;
+            size_t depth = 0;
+            while (n) {
+                if (common_prefix(n, key, depth) < n->prefix_len) {
+                    break;
+                }
+                depth += n->prefix_len;
+                if (n->value) {
+                    best = n->value;
+                    best_len = depth;
+                }
+                if (depth == key.length) {
+                    break;
+                }
+                node **child = ops::find_child(n, key.data[depth]);
+                n = child ? *child : nullptr;
+                ++depth;
+            }
+            if (matched) {
+                *matched = best_len;
+            }
+            return best;
+        }
+
+        const val_type *longest_prefix(const radix_key &key, size_type *matched = nullptr) const {
+            return const_cast<tree_type *>(this)->longest_prefix(key, matched);
+        }
+
+        /**
+         * Visit every key starting with a prefix, in lexicographic
+         * byte order. The function is called with the key bytes, which
+         * are not null terminated and are only valid during the call,
+         * the key length, and a reference to the value.
+         *
+         * @param prefix the key prefix, which may be empty
+         * @param f      function of (const char *, size_type, val_type &)
+         * @return the number of keys visited
+         */
+        template<typename F>
+        size_type for_each_prefix(const radix_key &prefix, F &&f) {
+            node *n = m_root;
+            size_t depth = 0;
+            size_type count = 0;
+            while (n) {
+                const uint32_t p = common_prefix(n, prefix, depth);
+                if (depth + p == prefix.length) {
+                    array_list<char> buf(prefix.length + 32);
+                    for (size_t i = 0; i < depth; ++i) {
+                        buf.push_back(static_cast<char>(prefix.data[i]));
+                    }
+                    visit(n, buf, f, count);
+                    return count;
+                }
+                if (p < n->prefix_len) {
+                    return 0;
+                }
+                depth += p;
+                node **child = ops::find_child(n, prefix.data[depth]);
+                n = child ? *child : nullptr;
+                ++depth;
+            }
+            return 0;
+        }
+
+        /**
+         * Visit every key in lexicographic byte order.
+         */
+        template<typename F>
+        size_type for_each(F &&f) {
+            return for_each_prefix(radix_key("", 0), forward<F>(f));
+        }
+
+        tree_type &operator=(const tree_type &) = delete;
+
+        tree_type &operator=(tree_type &&tree) {
+            if (this == &tree) {
+                return *this;
+            }
+            ops::destroy_tree(m_root);
+            m_root = tree.m_root;
+            m_size = tree.m_size;
+            tree.m_root = nullptr;
+            tree.m_size = 0;
+            return *this;
+        }
+
+        void swap(tree_type &tree) noexcept {
+            wlp::swap(m_root, tree.m_root);
+            wlp::swap(m_size, tree.m_size);
+        }
+    };
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_RADIXTREE_H
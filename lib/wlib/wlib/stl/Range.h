@@ -0,0 +1,479 @@
+/**
+ * @file Range.h
+ * @brief Lazy range adaptors over container iterators.
+ *
+ * A range is a pair of iterators, taken from any container with
+ * @code begin @endcode and @code end @endcode, such as an array list,
+ * linked list, hash map, open map, or tree map, or from a span. Ranges
+ * are adapted with the pipe operator,
+ * @code make_range(list) | filtered(pred) | transformed(f) @endcode,
+ * which wraps the iterators in adaptor iterators and copies nothing.
+ * Elements are computed as the adapted range is iterated, so a range
+ * for loop over a pipeline is a single loop over the container.
+ *
+ * Adapted ranges refer to the container and the functors they were
+ * made from, and are invalidated with the container's iterators.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_RANGE_H
+#define EMBEDDEDCPLUSPLUS_RANGE_H
+
+#include <stddef.h>
+
+#include <wlib/stl/Pair.h>
+#include <wlib/tmp/Declval.h>
+#include <wlib/type_traits>
+
+namespace wlp {
+
+    /**
+     * @tparam It an iterator type
+     */
+    template<typename It>
+    struct iterator_reference {
+        typedef decltype(*declval<It &>()) type;
+    };
+
+    /**
+     * A pair of iterators.
+     *
+     * @tparam It iterator type
+     */
+    template<typename It>
+    class range {
+    public:
+        typedef It iterator;
+        typedef typename iterator_reference<It>::type reference;
+
+    private:
+        It m_begin;
+        It m_end;
+
+    public:
+        range(const It &begin, const It &end)
+                : m_begin(begin),
+                  m_end(end) {
+        }
+
+        It begin() const {
+            return m_begin;
+        }
+
+        It end() const {
+            return m_end;
+        }
+
+        bool empty() const {
+            return m_begin == m_end;
+        }
+
+        /**
+         * Count the elements by walking the range.
+         */
+        size_t size() const {
+            size_t n = 0;
+            for (It it = m_begin; !(it == m_end); ++it) {
+                ++n;
+            }
+            return n;
+        }
+    };
+
+    template<typename It>
+    range<It> make_range(const It &begin, const It &end) {
+        return range<It>(begin, end);
+    }
+
+    /**
+     * @return a range over the elements of a container, const if the
+     * container is const
+     */
+    template<typename Container>
+    auto make_range(Container &c) -> range<decltype(c.begin())> {
+        return range<decltype(c.begin())>(c.begin(), c.end());
+    }
+
+    /**
+     * Iterator that skips elements that fail a predicate.
+     */
+    template<typename It, typename Pred>
+    class filter_iterator {
+    public:
+        typedef typename iterator_reference<It>::type reference;
+        typedef filter_iterator<It, Pred> self_type;
+
+    private:
+        It m_it;
+        It m_end;
+        Pred m_pred;
+
+        void skip() {
+            while (!(m_it == m_end) && !m_pred(*m_it)) {
+                ++m_it;
+            }
+        }
+
+    public:
+        filter_iterator(const It &it, const It &end, const Pred &pred)
+                : m_it(it),
+                  m_end(end),
+                  m_pred(pred) {
+            skip();
+        }
+
+        reference operator*() const {
+            return *m_it;
+        }
+
+        self_type &operator++() {
+            ++m_it;
+            skip();
+            return *this;
+        }
+
+        bool operator==(const self_type &it) const {
+            return m_it == it.m_it;
+        }
+
+        bool operator!=(const self_type &it) const {
+            return !(m_it == it.m_it);
+        }
+    };
+
+    /**
+     * Iterator whose elements are a function of the underlying
+     * elements, called each time an element is read.
+     */
+    template<typename It, typename F>
+    class transform_iterator {
+    public:
+        typedef decltype(declval<const F &>()(*declval<It &>())) reference;
+        typedef transform_iterator<It, F> self_type;
+
+    private:
+        It m_it;
+        F m_f;
+
+    public:
+        transform_iterator(const It &it, const F &f)
+                : m_it(it),
+                  m_f(f) {
+        }
+
+        reference operator*() const {
+            return m_f(*m_it);
+        }
+
+        self_type &operator++() {
+            ++m_it;
+            return *this;
+        }
+
+        bool operator==(const self_type &it) const {
+            return m_it == it.m_it;
+        }
+
+        bool operator!=(const self_type &it) const {
+            return !(m_it == it.m_it);
+        }
+    };
+
+    /**
+     * Iterator that ends after a number of elements or at the end of
+     * the underlying range, whichever is first. The end iterator has
+     * no elements left.
+     */
+    template<typename It>
+    class take_iterator {
+    public:
+        typedef typename iterator_reference<It>::type reference;
+        typedef take_iterator<It> self_type;
+
+    private:
+        It m_it;
+        size_t m_left;
+
+    public:
+        take_iterator(const It &it, size_t left)
+                : m_it(it),
+                  m_left(left) {
+        }
+
+        reference operator*() const {
+            return *m_it;
+        }
+
+        self_type &operator++() {
+            ++m_it;
+            --m_left;
+            return *this;
+        }
+
+        bool operator==(const self_type &it) const {
+            return m_it == it.m_it || (m_left == 0 && it.m_left == 0);
+        }
+
+        bool operator!=(const self_type &it) const {
+            return !(*this == it);
+        }
+    };
+
+    /**
+     * Iterator over two ranges in step, whose elements are pairs of
+     * references to the elements of each. It ends with the shorter
+     * range.
+     */
+    template<typename A, typename B>
+    class zip_iterator {
+    public:
+        typedef pair<typename iterator_reference<A>::type, typename iterator_reference<B>::type> reference;
+        typedef zip_iterator<A, B> self_type;
+
+    private:
+        A m_a;
+        B m_b;
+
+    public:
+        zip_iterator(const A &a, const B &b)
+                : m_a(a),
+                  m_b(b) {
+        }
+
+        reference operator*() const {
+            return reference(*m_a, *m_b);
+        }
+
+        self_type &operator++() {
+            ++m_a;
+            ++m_b;
+            return *this;
+        }
+
+        bool operator==(const self_type &it) const {
+            return m_a == it.m_a || m_b == it.m_b;
+        }
+
+        bool operator!=(const self_type &it) const {
+            return !(*this == it);
+        }
+    };
+
+    /**
+     * Iterator whose elements are pairs of the element index and a
+     * reference to the element.
+     */
+    template<typename It>
+    class enumerate_iterator {
+    public:
+        typedef pair<size_t, typename iterator_reference<It>::type> reference;
+        typedef enumerate_iterator<It> self_type;
+
+    private:
+        It m_it;
+        size_t m_i;
+
+    public:
+        enumerate_iterator(const It &it, size_t i)
+                : m_it(it),
+                  m_i(i) {
+        }
+
+        reference operator*() const {
+            return reference(m_i, *m_it);
+        }
+
+        self_type &operator++() {
+            ++m_it;
+            ++m_i;
+            return *this;
+        }
+
+        bool operator==(const self_type &it) const {
+            return m_it == it.m_it;
+        }
+
+        bool operator!=(const self_type &it) const {
+            return !(m_it == it.m_it);
+        }
+    };
+
+    /**
+     * Iterator whose elements are ranges of consecutive elements, all
+     * of the chunk size except possibly the last. The end of the next
+     * chunk is found when the iterator moves, so the chunks are plain
+     * ranges of the underlying iterator.
+     */
+    template<typename It>
+    class chunk_iterator {
+    public:
+        typedef range<It> reference;
+        typedef chunk_iterator<It> self_type;
+
+    private:
+        It m_it;
+        It m_next;
+        It m_end;
+        size_t m_size;
+
+        void find_next() {
+            for (size_t i = 0; i < m_size && !(m_next == m_end); ++i) {
+                ++m_next;
+            }
+        }
+
+    public:
+        chunk_iterator(const It &it, const It &end, size_t size)
+                : m_it(it),
+                  m_next(it),
+                  m_end(end),
+                  m_size(size) {
+            find_next();
+        }
+
+        reference operator*() const {
+            return reference(m_it, m_next);
+        }
+
+        self_type &operator++() {
+            m_it = m_next;
+            find_next();
+            return *this;
+        }
+
+        bool operator==(const self_type &it) const {
+            return m_it == it.m_it;
+        }
+
+        bool operator!=(const self_type &it) const {
+            return !(m_it == it.m_it);
+        }
+    };
+
+    template<typename Pred>
+    struct filter_adaptor {
+        Pred pred;
+    };
+
+    template<typename F>
+    struct transform_adaptor {
+        F f;
+    };
+
+    struct take_adaptor {
+        size_t count;
+    };
+
+    struct drop_adaptor {
+        size_t count;
+    };
+
+    struct enumerate_adaptor {
+    };
+
+    struct chunk_adaptor {
+        size_t size;
+    };
+
+    /**
+     * Keep the elements for which a predicate is true.
+     */
+    template<typename Pred>
+    filter_adaptor<Pred> filtered(Pred pred) {
+        return filter_adaptor<Pred>{pred};
+    }
+
+    /**
+     * Replace each element with a function of it. A transformed range
+     * that is then filtered calls the function twice on the elements
+     * that pass, once for the predicate and once when read.
+     */
+    template<typename F>
+    transform_adaptor<F> transformed(F f) {
+        return transform_adaptor<F>{f};
+    }
+
+    /**
+     * Keep at most the first elements.
+     */
+    inline take_adaptor taken(size_t count) {
+        return take_adaptor{count};
+    }
+
+    /**
+     * Skip the first elements, or all of them if there are fewer. The
+     * elements are skipped when the range is adapted.
+     */
+    inline drop_adaptor dropped(size_t count) {
+        return drop_adaptor{count};
+    }
+
+    /**
+     * Pair each element with its index.
+     */
+    inline enumerate_adaptor enumerated() {
+        return enumerate_adaptor();
+    }
+
+    /**
+     * Split the elements into ranges of a size, which must not be zero.
+     */
+    inline chunk_adaptor chunked(size_t size) {
+        return chunk_adaptor{size};
+    }
+
+    template<typename It, typename Pred>
+    range<filter_iterator<It, Pred>> operator|(const range<It> &r, const filter_adaptor<Pred> &a) {
+        typedef filter_iterator<It, Pred> iterator;
+        return range<iterator>(iterator(r.begin(), r.end(), a.pred), iterator(r.end(), r.end(), a.pred));
+    }
+
+    template<typename It, typename F>
+    range<transform_iterator<It, F>> operator|(const range<It> &r, const transform_adaptor<F> &a) {
+        typedef transform_iterator<It, F> iterator;
+        return range<iterator>(iterator(r.begin(), a.f), iterator(r.end(), a.f));
+    }
+
+    template<typename It>
+    range<take_iterator<It>> operator|(const range<It> &r, take_adaptor a) {
+        typedef take_iterator<It> iterator;
+        return range<iterator>(iterator(r.begin(), a.count), iterator(r.end(), 0));
+    }
+
+    template<typename It>
+    range<It> operator|(const range<It> &r, drop_adaptor a) {
+        It it = r.begin();
+        const It end = r.end();
+        for (size_t i = 0; i < a.count && !(it == end); ++i) {
+            ++it;
+        }
+        return range<It>(it, end);
+    }
+
+    template<typename It>
+    range<enumerate_iterator<It>> operator|(const range<It> &r, enumerate_adaptor) {
+        typedef enumerate_iterator<It> iterator;
+        return range<iterator>(iterator(r.begin(), 0), iterator(r.end(), 0));
+    }
+
+    template<typename It>
+    range<chunk_iterator<It>> operator|(const range<It> &r, chunk_adaptor a) {
+        typedef chunk_iterator<It> iterator;
+        return range<iterator>(iterator(r.begin(), r.end(), a.size), iterator(r.end(), r.end(), a.size));
+    }
+
+    /**
+     * Iterate two ranges in step, up to the end of the shorter.
+     */
+    template<typename A, typename B>
+    range<zip_iterator<A, B>> zip(const range<A> &a, const range<B> &b) {
+        typedef zip_iterator<A, B> iterator;
+        return range<iterator>(iterator(a.begin(), b.begin()), iterator(a.end(), b.end()));
+    }
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_RANGE_H
@@ -14,6 +14,7 @@
 #define EMBEDDEDCPLUSPLUS_REDBLACKTREE_H
 
 #include <wlib/stl/Comparator.h>
+#include <wlib/stl/Helper.h>
 #include <wlib/stl/Pair.h>
 #include <wlib/memory>
 
@@ -513,7 +514,8 @@ namespace wlp {
         tree(const tree_type &) = delete;
 
         /**
-         * Move constructor.
+         * Move constructor. The moved-from tree is left without
+         * a header node, which is created on its next insertion.
          *
          * @param tree tree to move
          */
@@ -538,14 +540,14 @@ namespace wlp {
          * @return an iterator to the leftmost node in the tree
          */
         iterator begin() {
-            return iterator(m_header->m_left);
+            return iterator(m_header ? m_header->m_left : nullptr);
         }
 
         /**
          * @return a const iterator to the leftmost node in the tree
          */
         const_iterator begin() const {
-            return const_iterator(m_header->m_left);
+            return const_iterator(m_header ? m_header->m_left : nullptr);
         }
 
         /**
@@ -772,15 +774,34 @@ namespace wlp {
          * @return reference to this tree
          */
         tree_type &operator=(tree_type &&tree) {
+            if (this == &tree) {
+                return *this;
+            }
             clear();
-            destroy_node(m_header);
+            if (m_header) {
+                destroy_node(m_header);
+            }
             m_size = move(tree.m_size);
             m_header = move(tree.m_header);
             tree.m_size = 0;
-            tree.m_header = 0;
+            tree.m_header = nullptr;
             return *this;
         }
 
+        /**
+         * Exchange the nodes of two trees. Since each header
+         * node is allocated separately, swapping the headers
+         * swaps the trees.
+         *
+         * @param tree the tree to swap with
+         */
+        void swap(tree_type &tree) noexcept {
+            wlp::swap(m_header, tree.m_header);
+            wlp::swap(m_size, tree.m_size);
+            wlp::swap(m_cmp, tree.m_cmp);
+            wlp::swap(m_get_key, tree.m_get_key);
+        }
+
     };
 
     template<typename Element, typename Key, typename Val,
@@ -922,7 +943,7 @@ namespace wlp {
                 node->m_parent->m_right = carry;
             }
             carry->m_parent = node->m_parent;
-            swap(carry->m_color, node->m_color);
+            wlp::swap(carry->m_color, node->m_color);
             // carry now points to node that is deleted
             carry = node;
         } else {
@@ -1036,9 +1057,10 @@ namespace wlp {
     typename tree<Element, Key, Val, GetKey, GetVal, Cmp>::iterator
     tree<Element, Key, Val, GetKey, GetVal, Cmp>
     ::insert(node_type *cur, node_type *carry, E &&element) {
+        bool left = carry == m_header || cur || m_cmp.__lt__(m_get_key(element), m_get_key(carry->m_element));
         node_type *node = create_node();
         node->m_element = forward<E>(element);
-        if (carry == m_header || cur || m_cmp.__lt__(m_get_key(element), m_get_key(carry->m_element))) {
+        if (left) {
             carry->m_left = node;
             if (carry == m_header) {
                 m_header->m_parent = node;
@@ -1066,6 +1088,10 @@ namespace wlp {
     pair<typename tree<Element, Key, Val, GetKey, GetVal, Cmp>::iterator, bool>
     tree<Element, Key, Val, GetKey, GetVal, Cmp>
     ::insert_unique(E &&element) {
+        if (!m_header) {
+            m_header = create_node();
+            empty_initialize();
+        }
         node_type *carry = m_header;
         node_type *cur = m_header->m_parent;
         bool compare = true;
@@ -1094,6 +1120,10 @@ namespace wlp {
     typename tree<Element, Key, Val, GetKey, GetVal, Cmp>::iterator
     tree<Element, Key, Val, GetKey, GetVal, Cmp>
     ::insert_equal(E &&element) {
+        if (!m_header) {
+            m_header = create_node();
+            empty_initialize();
+        }
         node_type *carry = m_header;
         node_type *cur = m_header->m_parent;
         while (cur) {
@@ -1182,6 +1212,9 @@ namespace wlp {
     typename tree<Element, Key, Val, GetKey, GetVal, Cmp>::iterator
     tree<Element, Key, Val, GetKey, GetVal, Cmp>
     ::find(const key_type &key) {
+        if (!m_header) {
+            return end();
+        }
         node_type *carry = m_header;
         node_type *cur = m_header->m_parent;
         while (cur) {
@@ -1201,6 +1234,9 @@ namespace wlp {
     typename tree<Element, Key, Val, GetKey, GetVal, Cmp>::const_iterator
     tree<Element, Key, Val, GetKey, GetVal, Cmp>
     ::find(const key_type &key) const {
+        if (!m_header) {
+            return end();
+        }
         node_type *carry = m_header;
         node_type *cur = m_header->m_parent;
         while (cur) {
@@ -1234,6 +1270,9 @@ namespace wlp {
     typename tree<Element, Key, Val, GetKey, GetVal, Cmp>::iterator
     tree<Element, Key, Val, GetKey, GetVal, Cmp>
     ::lower_bound(const key_type &key) {
+        if (!m_header) {
+            return end();
+        }
         node_type *carry = m_header;
         node_type *cur = m_header->m_parent;
         while (cur) {
@@ -1252,6 +1291,9 @@ namespace wlp {
     typename tree<Element, Key, Val, GetKey, GetVal, Cmp>::iterator
     tree<Element, Key, Val, GetKey, GetVal, Cmp>
     ::upper_bound(const key_type &key) {
+        if (!m_header) {
+            return end();
+        }
         node_type *carry = m_header;
         node_type *cur = m_header->m_parent;
         while (cur) {
@@ -1271,6 +1313,9 @@ namespace wlp {
     typename tree<Element, Key, Val, GetKey, GetVal, Cmp>::const_iterator
     tree<Element, Key, Val, GetKey, GetVal, Cmp>
     ::lower_bound(const key_type &key) const {
+        if (!m_header) {
+            return end();
+        }
         node_type *carry = m_header;
         node_type *cur = m_header->m_parent;
         while (cur) {
@@ -1289,6 +1334,9 @@ namespace wlp {
     typename tree<Element, Key, Val, GetKey, GetVal, Cmp>::const_iterator
     tree<Element, Key, Val, GetKey, GetVal, Cmp>
     ::upper_bound(const key_type &key) const {
+        if (!m_header) {
+            return end();
+        }
         node_type *carry = m_header;
         node_type *cur = m_header->m_parent;
         while (cur) {
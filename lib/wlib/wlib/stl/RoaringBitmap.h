@@ -0,0 +1,1271 @@
+/**
+ * @file RoaringBitmap.h
+ * @brief Compressed bitmap over the 32-bit integers.
+ *
+ * The domain is split into chunks of 2^16 values keyed by the upper
+ * 16 bits. Each non-empty chunk keeps its lower 16 bits in whichever
+ * container is smallest for its contents: a sorted array for sparse
+ * chunks, a 2^16 bit bitmap for dense chunks, or a sorted list of
+ * runs for chunks made of long intervals. Set operations work chunk
+ * by chunk with a specialized routine for each pair of containers.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_ROARINGBITMAP_H
+#define EMBEDDEDCPLUSPLUS_ROARINGBITMAP_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <wlib/stl/ArrayList.h>
+#include <wlib/stl/Helper.h>
+#include <wlib/memory>
+#include <wlib/utility>
+
+namespace wlp {
+
+    /**
+     * Container for the lower 16 bits of the values in one chunk.
+     * Arrays store sorted values. Runs store sorted, disjoint,
+     * non-adjacent pairs of first and last value, both inclusive.
+     * Bitmaps store one bit per value.
+     */
+    struct __roaring_container {
+        uint8_t kind;
+        uint32_t card;
+        uint32_t size;
+        uint32_t cap;
+        uint16_t *values;
+        uint64_t *words;
+    };
+
+    /**
+     * Operations on roaring containers. Containers are plain values
+     * whose memory is managed explicitly through these functions.
+     */
+    struct __roaring {
+        enum : uint8_t {
+            array_kind = 0,
+            bitmap_kind = 1,
+            run_kind = 2
+        };
+
+        enum : uint8_t {
+            op_or = 0,
+            op_and = 1,
+            op_andnot = 2
+        };
+
+        /**
+         * Arrays holding more values than this are converted to
+         * bitmaps, which take 8 KiB regardless of their contents.
+         */
+        enum : uint32_t {
+            array_max = 4096,
+            bitmap_words = 1024,
+            bitmap_bytes = bitmap_words * sizeof(uint64_t)
+        };
+
+        static __roaring_container make(uint8_t kind, uint32_t cap) {
+            __roaring_container c;
+            c.kind = kind;
+            c.card = 0;
+            c.size = 0;
+            c.cap = 0;
+            c.values = nullptr;
+            c.words = nullptr;
+            if (kind == bitmap_kind) {
+                c.words = create<uint64_t[]>(bitmap_words);
+                memset(c.words, 0, bitmap_bytes);
+            } else {
+                c.cap = cap < 4 ? 4 : cap;
+                c.values = create<uint16_t[]>(kind == run_kind ? 2 * c.cap : c.cap);
+            }
+            return c;
+        }
+
+        static void release(__roaring_container &c) {
+            if (c.values) {
+                destroy<uint16_t[]>(c.values);
+                c.values = nullptr;
+            }
+            if (c.words) {
+                destroy<uint64_t[]>(c.words);
+                c.words = nullptr;
+            }
+        }
+
+        static __roaring_container clone(const __roaring_container &c) {
+            __roaring_container r = make(c.kind, c.size);
+            r.card = c.card;
+            r.size = c.size;
+            if (c.kind == bitmap_kind) {
+                memcpy(r.words, c.words, bitmap_bytes);
+            } else {
+                memcpy(r.values, c.values, (c.kind == run_kind ? 2 : 1) * c.size * sizeof(uint16_t));
+            }
+            return r;
+        }
+
+        static size_t memory_usage(const __roaring_container &c) {
+            if (c.kind == bitmap_kind) {
+                return bitmap_bytes;
+            }
+            return (c.kind == run_kind ? 2 : 1) * c.cap * sizeof(uint16_t);
+        }
+
+        /**
+         * Ensure an array or run container has room for the given
+         * number of entries.
+         */
+        static void reserve(__roaring_container &c, uint32_t n) {
+            if (n <= c.cap) {
+                return;
+            }
+            uint32_t cap = c.cap * 2;
+            if (cap < n) {
+                cap = n;
+            }
+            const uint32_t width = c.kind == run_kind ? 2 : 1;
+            uint16_t *values = create<uint16_t[]>(width * cap);
+            memcpy(values, c.values, width * c.size * sizeof(uint16_t));
+            destroy<uint16_t[]>(c.values);
+            c.values = values;
+            c.cap = cap;
+        }
+
+        /**
+         * @return the index of the first value not less than v
+         */
+        static uint32_t lower(const uint16_t *values, uint32_t n, uint16_t v) {
+            if (n == 0) {
+                return 0;
+            }
+            // the halving step compiles to a conditional move, since
+            // random lookups would mispredict a branch on every step
+            uint32_t lo = 0;
+            while (n > 1) {
+                const uint32_t half = n / 2;
+                lo = values[lo + half] < v ? lo + half : lo;
+                n -= half;
+            }
+            return lo + (values[lo] < v);
+        }
+
+        /**
+         * @return the index of the last run starting at or before v,
+         * or -1 if there is none
+         */
+        static int32_t run_index(const __roaring_container &c, uint16_t v) {
+            if (c.size == 0) {
+                return -1;
+            }
+            uint32_t lo = 0;
+            uint32_t n = c.size;
+            while (n > 1) {
+                const uint32_t half = n / 2;
+                lo = c.values[2 * (lo + half)] <= v ? lo + half : lo;
+                n -= half;
+            }
+            return c.values[2 * lo] <= v ? static_cast<int32_t>(lo) : -1;
+        }
+
+        static void set_bit(uint64_t *words, uint32_t v) {
+            words[v >> 6] |= static_cast<uint64_t>(1) << (v & 63);
+        }
+
+        /**
+         * Set the bits from first to last, inclusive.
+         */
+        static void set_range(uint64_t *words, uint32_t first, uint32_t last) {
+            const uint32_t fw = first >> 6;
+            const uint32_t lw = last >> 6;
+            const uint64_t fmask = ~static_cast<uint64_t>(0) << (first & 63);
+            const uint64_t lmask = ~static_cast<uint64_t>(0) >> (63 - (last & 63));
+            if (fw == lw) {
+                words[fw] |= fmask & lmask;
+                return;
+            }
+            words[fw] |= fmask;
+            for (uint32_t w = fw + 1; w < lw; ++w) {
+                words[w] = ~static_cast<uint64_t>(0);
+            }
+            words[lw] |= lmask;
+        }
+
+        static uint32_t popcount(const uint64_t *words) {
+            uint32_t n = 0;
+            for (uint32_t i = 0; i < bitmap_words; ++i) {
+                n += static_cast<uint32_t>(__builtin_popcountll(words[i]));
+            }
+            return n;
+        }
+
+        static bool contains(const __roaring_container &c, uint16_t v) {
+            if (c.kind == bitmap_kind) {
+                return (c.words[v >> 6] >> (v & 63)) & 1;
+            }
+            if (c.kind == array_kind) {
+                const uint32_t i = lower(c.values, c.size, v);
+                return i < c.size && c.values[i] == v;
+            }
+            const int32_t i = run_index(c, v);
+            return i >= 0 && v <= c.values[2 * i + 1];
+        }
+
+        /**
+         * Convert an array or run container to a bitmap.
+         */
+        static void to_bitmap(__roaring_container &c) {
+            __roaring_container r = make(bitmap_kind, 0);
+            if (c.kind == array_kind) {
+                for (uint32_t i = 0; i < c.size; ++i) {
+                    set_bit(r.words, c.values[i]);
+                }
+            } else {
+                for (uint32_t i = 0; i < c.size; ++i) {
+                    set_range(r.words, c.values[2 * i], c.values[2 * i + 1]);
+                }
+            }
+            r.card = c.card;
+            release(c);
+            c = r;
+        }
+
+        /**
+         * Convert a bitmap or run container with at most
+         * @code array_max @endcode values to an array.
+         */
+        static void to_array(__roaring_container &c) {
+            __roaring_container r = make(array_kind, c.card);
+            if (c.kind == bitmap_kind) {
+                for (uint32_t w = 0; w < bitmap_words; ++w) {
+                    uint64_t bits = c.words[w];
+                    while (bits != 0) {
+                        r.values[r.size++] = static_cast<uint16_t>(w * 64 + __builtin_ctzll(bits));
+                        bits &= bits - 1;
+                    }
+                }
+            } else {
+                for (uint32_t i = 0; i < c.size; ++i) {
+                    for (uint32_t v = c.values[2 * i]; v <= c.values[2 * i + 1]; ++v) {
+                        r.values[r.size++] = static_cast<uint16_t>(v);
+                    }
+                }
+            }
+            r.card = c.card;
+            release(c);
+            c = r;
+        }
+
+        /**
+         * @return the number of runs needed to store the container
+         */
+        static uint32_t count_runs(const __roaring_container &c) {
+            if (c.kind == run_kind) {
+                return c.size;
+            }
+            uint32_t runs = 0;
+            if (c.kind == array_kind) {
+                for (uint32_t i = 0; i < c.size; ++i) {
+                    runs += i == 0 || c.values[i] != c.values[i - 1] + 1;
+                }
+                return runs;
+            }
+            uint64_t carry = 0;
+            for (uint32_t w = 0; w < bitmap_words; ++w) {
+                const uint64_t bits = c.words[w];
+                runs += static_cast<uint32_t>(__builtin_popcountll(bits & ~((bits << 1) | carry)));
+                carry = bits >> 63;
+            }
+            return runs;
+        }
+
+        /**
+         * Convert an array or bitmap container to runs.
+         */
+        static void to_runs(__roaring_container &c) {
+            __roaring_container r = make(run_kind, count_runs(c));
+            if (c.kind == array_kind) {
+                for (uint32_t i = 0; i < c.size; ++i) {
+                    if (r.size > 0 && r.values[2 * r.size - 1] + 1 == c.values[i]) {
+                        r.values[2 * r.size - 1] = c.values[i];
+                    } else {
+                        r.values[2 * r.size] = c.values[i];
+                        r.values[2 * r.size + 1] = c.values[i];
+                        ++r.size;
+                    }
+                }
+            } else {
+                int32_t start = -1;
+                for (uint32_t v = 0; v <= 0xffff; ++v) {
+                    const bool set = (c.words[v >> 6] >> (v & 63)) & 1;
+                    if (set && start < 0) {
+                        start = static_cast<int32_t>(v);
+                    } else if (!set && start >= 0) {
+                        r.values[2 * r.size] = static_cast<uint16_t>(start);
+                        r.values[2 * r.size + 1] = static_cast<uint16_t>(v - 1);
+                        ++r.size;
+                        start = -1;
+                    }
+                }
+                if (start >= 0) {
+                    r.values[2 * r.size] = static_cast<uint16_t>(start);
+                    r.values[2 * r.size + 1] = 0xffff;
+                    ++r.size;
+                }
+            }
+            r.card = c.card;
+            release(c);
+            c = r;
+        }
+
+        /**
+         * Choose the representation of an array or bitmap container
+         * by cardinality alone, leaving runs in place unless they are
+         * larger than the alternative.
+         */
+        static void normalize(__roaring_container &c) {
+            if (c.kind == array_kind && c.card > array_max) {
+                to_bitmap(c);
+            } else if (c.kind == bitmap_kind && c.card <= array_max) {
+                to_array(c);
+            } else if (c.kind == run_kind) {
+                const uint32_t other = c.card <= array_max ? c.card * 2 : bitmap_bytes;
+                if (c.size * 4 > other) {
+                    if (c.card <= array_max) {
+                        to_array(c);
+                    } else {
+                        to_bitmap(c);
+                    }
+                }
+            }
+        }
+
+        /**
+         * Choose the smallest representation, including runs.
+         */
+        static void optimize(__roaring_container &c) {
+            normalize(c);
+            if (c.kind == run_kind) {
+                return;
+            }
+            const uint32_t current = c.kind == array_kind ? c.card * 2 : bitmap_bytes;
+            if (count_runs(c) * 4 < current) {
+                to_runs(c);
+            }
+        }
+
+        /**
+         * Add a value.
+         *
+         * @return true if the value was not already present
+         */
+        static bool add(__roaring_container &c, uint16_t v) {
+            if (c.kind == bitmap_kind) {
+                uint64_t &word = c.words[v >> 6];
+                const uint64_t bit = static_cast<uint64_t>(1) << (v & 63);
+                if (word & bit) {
+                    return false;
+                }
+                word |= bit;
+                ++c.card;
+                return true;
+            }
+            if (c.kind == array_kind) {
+                const uint32_t i = lower(c.values, c.size, v);
+                if (i < c.size && c.values[i] == v) {
+                    return false;
+                }
+                if (c.size == array_max) {
+                    to_bitmap(c);
+                    return add(c, v);
+                }
+                reserve(c, c.size + 1);
+                memmove(c.values + i + 1, c.values + i, (c.size - i) * sizeof(uint16_t));
+                c.values[i] = v;
+                ++c.size;
+                ++c.card;
+                return true;
+            }
+            const int32_t i = run_index(c, v);
+            if (i >= 0 && v <= c.values[2 * i + 1]) {
+                return false;
+            }
+            const uint32_t next = static_cast<uint32_t>(i + 1);
+            const bool joins_prev = i >= 0 && c.values[2 * i + 1] + 1 == v;
+            const bool joins_next = next < c.size && c.values[2 * next] == v + 1;
+            if (joins_prev && joins_next) {
+                c.values[2 * i + 1] = c.values[2 * next + 1];
+                remove_run(c, next);
+            } else if (joins_prev) {
+                c.values[2 * i + 1] = v;
+            } else if (joins_next) {
+                c.values[2 * next] = v;
+            } else {
+                insert_run(c, next, v, v);
+            }
+            ++c.card;
+            return true;
+        }
+
+        /**
+         * Remove a value.
+         *
+         * @return true if the value was present
+         */
+        static bool remove(__roaring_container &c, uint16_t v) {
+            if (c.kind == bitmap_kind) {
+                uint64_t &word = c.words[v >> 6];
+                const uint64_t bit = static_cast<uint64_t>(1) << (v & 63);
+                if (!(word & bit)) {
+                    return false;
+                }
+                word &= ~bit;
+                if (--c.card <= array_max) {
+                    to_array(c);
+                }
+                return true;
+            }
+            if (c.kind == array_kind) {
+                const uint32_t i = lower(c.values, c.size, v);
+                if (i == c.size || c.values[i] != v) {
+                    return false;
+                }
+                memmove(c.values + i, c.values + i + 1, (c.size - i - 1) * sizeof(uint16_t));
+                --c.size;
+                --c.card;
+                return true;
+            }
+            const int32_t i = run_index(c, v);
+            if (i < 0 || v > c.values[2 * i + 1]) {
+                return false;
+            }
+            const uint16_t first = c.values[2 * i];
+            const uint16_t last = c.values[2 * i + 1];
+            if (first == last) {
+                remove_run(c, static_cast<uint32_t>(i));
+            } else if (v == first) {
+                c.values[2 * i] = static_cast<uint16_t>(v + 1);
+            } else if (v == last) {
+                c.values[2 * i + 1] = static_cast<uint16_t>(v - 1);
+            } else {
+                c.values[2 * i + 1] = static_cast<uint16_t>(v - 1);
+                insert_run(c, static_cast<uint32_t>(i + 1), static_cast<uint16_t>(v + 1), last);
+            }
+            --c.card;
+            return true;
+        }
+
+        static void insert_run(__roaring_container &c, uint32_t i, uint16_t first, uint16_t last) {
+            reserve(c, c.size + 1);
+            memmove(c.values + 2 * i + 2, c.values + 2 * i, 2 * (c.size - i) * sizeof(uint16_t));
+            c.values[2 * i] = first;
+            c.values[2 * i + 1] = last;
+            ++c.size;
+        }
+
+        static void remove_run(__roaring_container &c, uint32_t i) {
+            memmove(c.values + 2 * i, c.values + 2 * i + 2, 2 * (c.size - i - 1) * sizeof(uint16_t));
+            --c.size;
+        }
+
+        /**
+         * Append a run to a run container being built in order,
+         * merging it with the previous run if they touch.
+         */
+        static void append_run(__roaring_container &r, uint32_t first, uint32_t last) {
+            if (r.size > 0 && r.values[2 * r.size - 1] + 1u >= first) {
+                if (last > r.values[2 * r.size - 1]) {
+                    r.card += last - r.values[2 * r.size - 1];
+                    r.values[2 * r.size - 1] = static_cast<uint16_t>(last);
+                }
+                return;
+            }
+            reserve(r, r.size + 1);
+            r.values[2 * r.size] = static_cast<uint16_t>(first);
+            r.values[2 * r.size + 1] = static_cast<uint16_t>(last);
+            ++r.size;
+            r.card += last - first + 1;
+        }
+
+        static __roaring_container runs_op(const __roaring_container &a, const __roaring_container &b, uint8_t op) {
+            __roaring_container r = make(run_kind, a.size + b.size);
+            uint32_t i = 0;
+            uint32_t j = 0;
+            if (op == op_or) {
+                while (i < a.size || j < b.size) {
+                    if (j == b.size || (i < a.size && a.values[2 * i] <= b.values[2 * j])) {
+                        append_run(r, a.values[2 * i], a.values[2 * i + 1]);
+                        ++i;
+                    } else {
+                        append_run(r, b.values[2 * j], b.values[2 * j + 1]);
+                        ++j;
+                    }
+                }
+            } else if (op == op_and) {
+                while (i < a.size && j < b.size) {
+                    const uint32_t first = MAX(a.values[2 * i], b.values[2 * j]);
+                    const uint32_t last = MIN(a.values[2 * i + 1], b.values[2 * j + 1]);
+                    if (first <= last) {
+                        append_run(r, first, last);
+                    }
+                    if (a.values[2 * i + 1] < b.values[2 * j + 1]) {
+                        ++i;
+                    } else {
+                        ++j;
+                    }
+                }
+            } else {
+                for (; i < a.size; ++i) {
+                    uint32_t first = a.values[2 * i];
+                    const uint32_t last = a.values[2 * i + 1];
+                    while (j < b.size && b.values[2 * j + 1] < first) {
+                        ++j;
+                    }
+                    uint32_t k = j;
+                    while (k < b.size && b.values[2 * k] <= last && first <= last) {
+                        if (b.values[2 * k] > first) {
+                            append_run(r, first, b.values[2 * k] - 1u);
+                        }
+                        first = b.values[2 * k + 1] + 1u;
+                        ++k;
+                    }
+                    if (first <= last) {
+                        append_run(r, first, last);
+                    }
+                }
+            }
+            return r;
+        }
+
+        static __roaring_container arrays_op(const __roaring_container &a, const __roaring_container &b, uint8_t op) {
+            __roaring_container r = make(array_kind, op == op_or ? a.size + b.size : a.size);
+            uint32_t i = 0;
+            uint32_t j = 0;
+            while (i < a.size && j < b.size) {
+                const uint16_t x = a.values[i];
+                const uint16_t y = b.values[j];
+                if (x < y) {
+                    if (op != op_and) {
+                        r.values[r.size++] = x;
+                    }
+                    ++i;
+                } else if (y < x) {
+                    if (op == op_or) {
+                        r.values[r.size++] = y;
+                    }
+                    ++j;
+                } else {
+                    if (op != op_andnot) {
+                        r.values[r.size++] = x;
+                    }
+                    ++i;
+                    ++j;
+                }
+            }
+            if (op != op_and) {
+                while (i < a.size) {
+                    r.values[r.size++] = a.values[i++];
+                }
+            }
+            if (op == op_or) {
+                while (j < b.size) {
+                    r.values[r.size++] = b.values[j++];
+                }
+            }
+            r.card = r.size;
+            return r;
+        }
+
+        static __roaring_container bitmaps_op(const __roaring_container &a, const __roaring_container &b, uint8_t op) {
+            __roaring_container r = make(bitmap_kind, 0);
+            uint32_t card = 0;
+            for (uint32_t w = 0; w < bitmap_words; ++w) {
+                const uint64_t bits = op == op_or ? a.words[w] | b.words[w]
+                                                  : op == op_and ? a.words[w] & b.words[w]
+                                                                 : a.words[w] & ~b.words[w];
+                r.words[w] = bits;
+                card += static_cast<uint32_t>(__builtin_popcountll(bits));
+            }
+            r.card = card;
+            return r;
+        }
+
+        /**
+         * Operation between an array and a bitmap, in that order.
+         */
+        static __roaring_container array_bitmap_op(const __roaring_container &a, const __roaring_container &b,
+                                                   uint8_t op) {
+            if (op == op_or) {
+                __roaring_container r = clone(b);
+                for (uint32_t i = 0; i < a.size; ++i) {
+                    add(r, a.values[i]);
+                }
+                return r;
+            }
+            __roaring_container r = make(array_kind, a.size);
+            const bool keep = op == op_and;
+            for (uint32_t i = 0; i < a.size; ++i) {
+                if (contains(b, a.values[i]) == keep) {
+                    r.values[r.size++] = a.values[i];
+                }
+            }
+            r.card = r.size;
+            return r;
+        }
+
+        /**
+         * Difference of a bitmap and an array.
+         */
+        static __roaring_container bitmap_andnot_array(const __roaring_container &a, const __roaring_container &b) {
+            __roaring_container r = clone(a);
+            for (uint32_t i = 0; i < b.size; ++i) {
+                const uint16_t v = b.values[i];
+                uint64_t &word = r.words[v >> 6];
+                const uint64_t bit = static_cast<uint64_t>(1) << (v & 63);
+                r.card -= (word & bit) != 0;
+                word &= ~bit;
+            }
+            return r;
+        }
+
+        /**
+         * Apply a set operation to two containers. Runs paired with
+         * other kinds are expanded first. The result is normalized
+         * and may be empty.
+         */
+        static __roaring_container apply(const __roaring_container &a, const __roaring_container &b, uint8_t op) {
+            __roaring_container r;
+            if (a.kind == run_kind && b.kind == run_kind) {
+                r = runs_op(a, b, op);
+            } else if (a.kind == run_kind || b.kind == run_kind) {
+                __roaring_container expanded = clone(a.kind == run_kind ? a : b);
+                normalize_expanded(expanded);
+                r = a.kind == run_kind ? apply(expanded, b, op) : apply(a, expanded, op);
+                release(expanded);
+                return r;
+            } else if (a.kind == array_kind && b.kind == array_kind) {
+                r = arrays_op(a, b, op);
+            } else if (a.kind == bitmap_kind && b.kind == bitmap_kind) {
+                r = bitmaps_op(a, b, op);
+            } else if (a.kind == array_kind) {
+                r = array_bitmap_op(a, b, op);
+            } else if (op == op_andnot) {
+                r = bitmap_andnot_array(a, b);
+            } else {
+                r = array_bitmap_op(b, a, op);
+            }
+            normalize(r);
+            return r;
+        }
+
+        /**
+         * Check that an array or run container read from untrusted
+         * data is sorted and matches its stated cardinality.
+         */
+        static bool valid(const __roaring_container &c) {
+            if (c.kind == array_kind) {
+                for (uint32_t i = 1; i < c.size; ++i) {
+                    if (c.values[i - 1] >= c.values[i]) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            uint32_t card = 0;
+            for (uint32_t i = 0; i < c.size; ++i) {
+                if (c.values[2 * i] > c.values[2 * i + 1] ||
+                    (i > 0 && c.values[2 * i - 1] + 1u >= c.values[2 * i])) {
+                    return false;
+                }
+                card += c.values[2 * i + 1] - c.values[2 * i] + 1u;
+            }
+            return card == c.card;
+        }
+
+        /**
+         * Expand a run container into an array or a bitmap.
+         */
+        static void normalize_expanded(__roaring_container &c) {
+            if (c.card <= array_max) {
+                to_array(c);
+            } else {
+                to_bitmap(c);
+            }
+        }
+    };
+
+    // RoaringBitmap forward declaration
+    class roaring_bitmap;
+
+    /**
+     * Forward iterator over the values of a roaring bitmap, in
+     * increasing order.
+     */
+    class RoaringBitmapIterator {
+    public:
+        typedef uint32_t val_type;
+        typedef RoaringBitmapIterator self_type;
+
+    private:
+        const roaring_bitmap *m_bitmap;
+        size_t m_chunk;
+        uint32_t m_pos;
+        uint64_t m_bits;
+        uint32_t m_value;
+
+        friend class roaring_bitmap;
+
+        inline void load();
+
+        inline void advance();
+
+    public:
+        RoaringBitmapIterator()
+                : m_bitmap(nullptr),
+                  m_chunk(0),
+                  m_pos(0),
+                  m_bits(0),
+                  m_value(0) {}
+
+        inline RoaringBitmapIterator(size_t chunk, const roaring_bitmap *bitmap);
+
+        const uint32_t &operator*() const {
+            return m_value;
+        }
+
+        self_type &operator++() {
+            advance();
+            return *this;
+        }
+
+        self_type operator++(int) {
+            self_type tmp(*this);
+            advance();
+            return tmp;
+        }
+
+        bool operator==(const self_type &it) const {
+            return m_chunk == it.m_chunk && m_pos == it.m_pos && m_value == it.m_value;
+        }
+
+        bool operator!=(const self_type &it) const {
+            return !(*this == it);
+        }
+    };
+
+    /**
+     * Compressed set of 32-bit unsigned integers. Sparse, dense, and
+     * interval-heavy regions of the domain are each stored compactly,
+     * and set operations only touch the chunks present in the inputs.
+     *
+     * Copying is disabled; use @code clone() @endcode for an explicit
+     * deep copy.
+     */
+    class roaring_bitmap {
+    public:
+        typedef size_t size_type;
+        typedef uint32_t val_type;
+        typedef RoaringBitmapIterator iterator;
+        typedef RoaringBitmapIterator const_iterator;
+
+    private:
+        struct chunk {
+            uint16_t key;
+            __roaring_container c;
+        };
+
+        array_list<chunk> m_chunks;
+
+        friend class RoaringBitmapIterator;
+
+        /**
+         * @return the index of the first chunk with a key not less
+         * than the given key
+         */
+        size_type lower_chunk(uint16_t key) const {
+            size_type n = m_chunks.size();
+            if (n == 0) {
+                return 0;
+            }
+            const chunk *chunks = m_chunks.data();
+            size_type lo = 0;
+            while (n > 1) {
+                const size_type half = n / 2;
+                lo = chunks[lo + half].key < key ? lo + half : lo;
+                n -= half;
+            }
+            return lo + (chunks[lo].key < key);
+        }
+
+        void insert_chunk(size_type i, uint16_t key, const __roaring_container &c) {
+            chunk ch;
+            ch.key = key;
+            ch.c = c;
+            if (i == m_chunks.size()) {
+                m_chunks.push_back(ch);
+            } else {
+                m_chunks.insert(i, ch);
+            }
+        }
+
+        void release_chunks() {
+            for (size_type i = 0; i < m_chunks.size(); ++i) {
+                __roaring::release(m_chunks[i].c);
+            }
+        }
+
+        static void put16(uint8_t *&out, uint16_t v) {
+            out[0] = static_cast<uint8_t>(v);
+            out[1] = static_cast<uint8_t>(v >> 8);
+            out += 2;
+        }
+
+        static void put32(uint8_t *&out, uint32_t v) {
+            put16(out, static_cast<uint16_t>(v));
+            put16(out, static_cast<uint16_t>(v >> 16));
+        }
+
+        static uint16_t get16(const uint8_t *&in) {
+            const uint16_t v = static_cast<uint16_t>(in[0] | (in[1] << 8));
+            in += 2;
+            return v;
+        }
+
+        static uint32_t get32(const uint8_t *&in) {
+            const uint32_t lo = get16(in);
+            return lo | (static_cast<uint32_t>(get16(in)) << 16);
+        }
+
+        /**
+         * Combine two bitmaps chunk by chunk.
+         */
+        static roaring_bitmap combine(const roaring_bitmap &a, const roaring_bitmap &b, uint8_t op) {
+            roaring_bitmap r;
+            size_type i = 0;
+            size_type j = 0;
+            const size_type na = a.m_chunks.size();
+            const size_type nb = b.m_chunks.size();
+            while (i < na || j < nb) {
+                if (j == nb || (i < na && a.m_chunks[i].key < b.m_chunks[j].key)) {
+                    if (op != __roaring::op_and) {
+                        r.m_chunks.push_back(chunk{a.m_chunks[i].key, __roaring::clone(a.m_chunks[i].c)});
+                    }
+                    ++i;
+                } else if (i == na || b.m_chunks[j].key < a.m_chunks[i].key) {
+                    if (op == __roaring::op_or) {
+                        r.m_chunks.push_back(chunk{b.m_chunks[j].key, __roaring::clone(b.m_chunks[j].c)});
+                    }
+                    ++j;
+                } else {
+                    __roaring_container c = __roaring::apply(a.m_chunks[i].c, b.m_chunks[j].c, op);
+                    if (c.card > 0) {
+                        r.m_chunks.push_back(chunk{a.m_chunks[i].key, c});
+                    } else {
+                        __roaring::release(c);
+                    }
+                    ++i;
+                    ++j;
+                }
+            }
+            return r;
+        }
+
+    public:
+        roaring_bitmap()
+                : m_chunks(4) {}
+
+        roaring_bitmap(const roaring_bitmap &) = delete;
+
+        roaring_bitmap(roaring_bitmap &&bitmap)
+                : m_chunks(move(bitmap.m_chunks)) {
+        }
+
+        ~roaring_bitmap() {
+            release_chunks();
+        }
+
+        /**
+         * @return a deep copy of this bitmap
+         */
+        roaring_bitmap clone() const {
+            roaring_bitmap r;
+            r.m_chunks.reserve(m_chunks.size());
+            for (size_type i = 0; i < m_chunks.size(); ++i) {
+                r.m_chunks.push_back(chunk{m_chunks[i].key, __roaring::clone(m_chunks[i].c)});
+            }
+            return r;
+        }
+
+        /**
+         * @return the number of values in the set
+         */
+        size_type cardinality() const {
+            size_type n = 0;
+            for (size_type i = 0; i < m_chunks.size(); ++i) {
+                n += m_chunks[i].c.card;
+            }
+            return n;
+        }
+
+        bool empty() const {
+            return m_chunks.empty();
+        }
+
+        /**
+         * @return the number of 2^16 value chunks with values
+         */
+        size_type chunk_count() const {
+            return m_chunks.size();
+        }
+
+        /**
+         * @return the heap bytes held by the bitmap and its size
+         */
+        size_t memory_usage() const {
+            size_t bytes = sizeof(roaring_bitmap) + m_chunks.capacity() * sizeof(chunk);
+            for (size_type i = 0; i < m_chunks.size(); ++i) {
+                bytes += __roaring::memory_usage(m_chunks[i].c);
+            }
+            return bytes;
+        }
+
+        bool contains(uint32_t v) const {
+            const uint16_t key = static_cast<uint16_t>(v >> 16);
+            const size_type i = lower_chunk(key);
+            return i < m_chunks.size() && m_chunks[i].key == key &&
+                   __roaring::contains(m_chunks[i].c, static_cast<uint16_t>(v));
+        }
+
+        /**
+         * Add a value to the set.
+         *
+         * @param v value to add
+         * @return true if the value was not already in the set
+         */
+        bool add(uint32_t v) {
+            const uint16_t key = static_cast<uint16_t>(v >> 16);
+            const size_type i = lower_chunk(key);
+            if (i == m_chunks.size() || m_chunks[i].key != key) {
+                insert_chunk(i, key, __roaring::make(__roaring::array_kind, 4));
+            }
+            return __roaring::add(m_chunks[i].c, static_cast<uint16_t>(v));
+        }
+
+        /**
+         * Add every value from first to last, inclusive.
+         */
+        void add_range(uint32_t first, uint32_t last) {
+            if (first > last) {
+                return;
+            }
+            for (uint32_t key = first >> 16; key <= (last >> 16); ++key) {
+                const uint32_t lo = key == (first >> 16) ? first & 0xffff : 0;
+                const uint32_t hi = key == (last >> 16) ? last & 0xffff : 0xffff;
+                __roaring_container range = __roaring::make(__roaring::run_kind, 1);
+                __roaring::append_run(range, lo, hi);
+                const size_type i = lower_chunk(static_cast<uint16_t>(key));
+                if (i == m_chunks.size() || m_chunks[i].key != key) {
+                    __roaring::normalize(range);
+                    insert_chunk(i, static_cast<uint16_t>(key), range);
+                } else {
+                    __roaring_container merged = __roaring::apply(m_chunks[i].c, range, __roaring::op_or);
+                    __roaring::release(range);
+                    __roaring::release(m_chunks[i].c);
+                    m_chunks[i].c = merged;
+                }
+                if (key == 0xffff) {
+                    break;
+                }
+            }
+        }
+
+        /**
+         * Remove a value from the set.
+         *
+         * @param v value to remove
+         * @return true if the value was in the set
+         */
+        bool remove(uint32_t v) {
+            const uint16_t key = static_cast<uint16_t>(v >> 16);
+            const size_type i = lower_chunk(key);
+            if (i == m_chunks.size() || m_chunks[i].key != key) {
+                return false;
+            }
+            if (!__roaring::remove(m_chunks[i].c, static_cast<uint16_t>(v))) {
+                return false;
+            }
+            if (m_chunks[i].c.card == 0) {
+                __roaring::release(m_chunks[i].c);
+                m_chunks.erase(i);
+            }
+            return true;
+        }
+
+        /**
+         * Convert each chunk to its smallest representation,
+         * including runs, which are otherwise only created by
+         * @code add_range @endcode.
+         */
+        void run_optimize() {
+            for (size_type i = 0; i < m_chunks.size(); ++i) {
+                __roaring::optimize(m_chunks[i].c);
+            }
+        }
+
+        void clear() {
+            release_chunks();
+            m_chunks.clear();
+        }
+
+        /**
+         * @return the number of bytes written by @code serialize @endcode
+         */
+        size_t serialized_size() const {
+            size_t bytes = 4;
+            for (size_type i = 0; i < m_chunks.size(); ++i) {
+                const __roaring_container &c = m_chunks[i].c;
+                bytes += 8;
+                if (c.kind == __roaring::bitmap_kind) {
+                    bytes += __roaring::bitmap_bytes;
+                } else {
+                    bytes += (c.kind == __roaring::run_kind ? 4 : 2) * c.size;
+                }
+            }
+            return bytes;
+        }
+
+        /**
+         * Write the bitmap in a portable little-endian format: the
+         * chunk count, then for each chunk its key, kind, cardinality,
+         * and entry count followed by the container contents.
+         *
+         * @param out buffer of at least @code serialized_size() @endcode bytes
+         * @return the number of bytes written
+         */
+        size_t serialize(uint8_t *out) const {
+            uint8_t *const start = out;
+            put32(out, static_cast<uint32_t>(m_chunks.size()));
+            for (size_type i = 0; i < m_chunks.size(); ++i) {
+                const __roaring_container &c = m_chunks[i].c;
+                put16(out, m_chunks[i].key);
+                *out++ = c.kind;
+                *out++ = 0;
+                put16(out, static_cast<uint16_t>(c.card - 1));
+                put16(out, static_cast<uint16_t>(c.size));
+                if (c.kind == __roaring::bitmap_kind) {
+                    for (uint32_t w = 0; w < __roaring::bitmap_words; ++w) {
+                        put32(out, static_cast<uint32_t>(c.words[w]));
+                        put32(out, static_cast<uint32_t>(c.words[w] >> 32));
+                    }
+                } else {
+                    const uint32_t n = (c.kind == __roaring::run_kind ? 2 : 1) * c.size;
+                    for (uint32_t k = 0; k < n; ++k) {
+                        put16(out, c.values[k]);
+                    }
+                }
+            }
+            return static_cast<size_t>(out - start);
+        }
+
+        /**
+         * Replace the contents of the bitmap with serialized data.
+         * The data is validated; on failure the bitmap is left empty.
+         *
+         * @param in  serialized data
+         * @param len length of the data in bytes
+         * @return true if the data was valid
+         */
+        bool deserialize(const uint8_t *in, size_t len) {
+            clear();
+            const uint8_t *const end = in + len;
+            if (len < 4) {
+                return false;
+            }
+            const uint32_t count = get32(in);
+            int32_t prev_key = -1;
+            for (uint32_t i = 0; i < count; ++i) {
+                if (end - in < 8) {
+                    clear();
+                    return false;
+                }
+                const uint16_t key = get16(in);
+                const uint8_t kind = *in++;
+                ++in;
+                const uint32_t card = get16(in) + 1u;
+                const uint32_t size = get16(in);
+                const size_t bytes = kind == __roaring::bitmap_kind ? __roaring::bitmap_bytes
+                                                                    : (kind == __roaring::run_kind ? 4 : 2) * size;
+                // arrays and bitmaps must have the kind their cardinality
+                // calls for, which the other operations rely on
+                if (kind > __roaring::run_kind || key <= prev_key || static_cast<size_t>(end - in) < bytes ||
+                    (kind == __roaring::array_kind && (size != card || card > __roaring::array_max)) ||
+                    (kind == __roaring::bitmap_kind && card <= __roaring::array_max)) {
+                    clear();
+                    return false;
+                }
+                prev_key = key;
+                __roaring_container c = __roaring::make(kind, size);
+                c.card = card;
+                c.size = kind == __roaring::bitmap_kind ? 0 : size;
+                if (kind == __roaring::bitmap_kind) {
+                    for (uint32_t w = 0; w < __roaring::bitmap_words; ++w) {
+                        const uint64_t lo = get32(in);
+                        c.words[w] = lo | (static_cast<uint64_t>(get32(in)) << 32);
+                    }
+                } else {
+                    const uint32_t n = (kind == __roaring::run_kind ? 2 : 1) * size;
+                    for (uint32_t k = 0; k < n; ++k) {
+                        c.values[k] = get16(in);
+                    }
+                }
+                const bool ok = kind == __roaring::bitmap_kind ? __roaring::popcount(c.words) == card
+                                                               : __roaring::valid(c);
+                if (!ok) {
+                    __roaring::release(c);
+                    clear();
+                    return false;
+                }
+                m_chunks.push_back(chunk{key, c});
+            }
+            return true;
+        }
+
+        iterator begin() const {
+            return iterator(0, this);
+        }
+
+        iterator end() const {
+            return iterator(m_chunks.size(), this);
+        }
+
+        friend roaring_bitmap operator|(const roaring_bitmap &a, const roaring_bitmap &b) {
+            return combine(a, b, __roaring::op_or);
+        }
+
+        friend roaring_bitmap operator&(const roaring_bitmap &a, const roaring_bitmap &b) {
+            return combine(a, b, __roaring::op_and);
+        }
+
+        /**
+         * @return the values in the first bitmap but not the second
+         */
+        friend roaring_bitmap operator-(const roaring_bitmap &a, const roaring_bitmap &b) {
+            return combine(a, b, __roaring::op_andnot);
+        }
+
+        roaring_bitmap &operator|=(const roaring_bitmap &b) {
+            return *this = combine(*this, b, __roaring::op_or);
+        }
+
+        roaring_bitmap &operator&=(const roaring_bitmap &b) {
+            return *this = combine(*this, b, __roaring::op_and);
+        }
+
+        roaring_bitmap &operator-=(const roaring_bitmap &b) {
+            return *this = combine(*this, b, __roaring::op_andnot);
+        }
+
+        bool operator==(const roaring_bitmap &b) const {
+            if (m_chunks.size() != b.m_chunks.size() || cardinality() != b.cardinality()) {
+                return false;
+            }
+            for (iterator x = begin(), y = b.begin(); x != end(); ++x, ++y) {
+                if (*x != *y) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool operator!=(const roaring_bitmap &b) const {
+            return !(*this == b);
+        }
+
+        roaring_bitmap &operator=(const roaring_bitmap &) = delete;
+
+        roaring_bitmap &operator=(roaring_bitmap &&bitmap) {
+            if (this == &bitmap) {
+                return *this;
+            }
+            release_chunks();
+            m_chunks = move(bitmap.m_chunks);
+            return *this;
+        }
+
+        void swap(roaring_bitmap &bitmap) noexcept {
+            m_chunks.swap(bitmap.m_chunks);
+        }
+    };
+
+    inline RoaringBitmapIterator::RoaringBitmapIterator(size_t chunk, const roaring_bitmap *bitmap)
+            : m_bitmap(bitmap),
+              m_chunk(chunk),
+              m_pos(0),
+              m_bits(0),
+              m_value(0) {
+        load();
+    }
+
+    /**
+     * Point to the first value of the current chunk.
+     */
+    inline void RoaringBitmapIterator::load() {
+        m_pos = 0;
+        m_value = 0;
+        m_bits = 0;
+        if (m_chunk >= m_bitmap->m_chunks.size()) {
+            return;
+        }
+        const uint32_t base = static_cast<uint32_t>(m_bitmap->m_chunks[m_chunk].key) << 16;
+        const __roaring_container &c = m_bitmap->m_chunks[m_chunk].c;
+        if (c.kind == __roaring::bitmap_kind) {
+            while (c.words[m_pos] == 0) {
+                ++m_pos;
+            }
+            m_bits = c.words[m_pos];
+            m_value = base | (m_pos * 64 + static_cast<uint32_t>(__builtin_ctzll(m_bits)));
+        } else {
+            m_value = base | c.values[0];
+        }
+    }
+
+    inline void RoaringBitmapIterator::advance() {
+        const __roaring_container &c = m_bitmap->m_chunks[m_chunk].c;
+        const uint32_t base = m_value & 0xffff0000u;
+        if (c.kind == __roaring::array_kind) {
+            if (++m_pos < c.size) {
+                m_value = base | c.values[m_pos];
+                return;
+            }
+        } else if (c.kind == __roaring::bitmap_kind) {
+            m_bits &= m_bits - 1;
+            while (m_bits == 0 && ++m_pos < __roaring::bitmap_words) {
+                m_bits = c.words[m_pos];
+            }
+            if (m_bits != 0) {
+                m_value = base | (m_pos * 64 + static_cast<uint32_t>(__builtin_ctzll(m_bits)));
+                return;
+            }
+        } else {
+            if ((m_value & 0xffff) < c.values[2 * m_pos + 1]) {
+                ++m_value;
+                return;
+            }
+            if (++m_pos < c.size) {
+                m_value = base | c.values[2 * m_pos];
+                return;
+            }
+        }
+        ++m_chunk;
+        load();
+    }
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_ROARINGBITMAP_H
@@ -0,0 +1,358 @@
+/**
+ * @file SegmentTree.h
+ * @brief Iterative segment tree with lazy range updates.
+ *
+ * The tree is a complete binary tree stored in one array, with the
+ * root at index one, the children of node @p k at @code 2k @endcode and
+ * @code 2k + 1 @endcode, and the elements as leaves at the end, padded
+ * to a power of two. Queries and updates walk up from the leaves of
+ * the range ends without recursion.
+ *
+ * A range update is applied to the nodes that cover the range and
+ * recorded on them as a pending update for their children. Before a
+ * query or update reads or writes under a node, the pending updates on
+ * the paths from the root to the range ends are pushed down a level
+ * at a time.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_SEGMENTTREE_H
+#define EMBEDDEDCPLUSPLUS_SEGMENTTREE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <wlib/memory>
+#include <wlib/stl/Helper.h>
+#include <wlib/stl/Monoid.h>
+#include <wlib/stl/Span.h>
+
+namespace wlp {
+
+    /**
+     * Update that adds a value to each element of a range. With the
+     * sum monoid a node of @p count elements grows by @p count times
+     * the value; with min and max it grows by the value.
+     *
+     * An action has an @code update_type @endcode, composes a newer
+     * update over an older one that is still pending, and applies an
+     * update to the combination of @p count elements.
+     */
+    template<typename Monoid>
+    struct range_add {
+        typedef typename Monoid::value_type value_type;
+        typedef value_type update_type;
+
+        static update_type compose(const update_type &newer, const update_type &older) {
+            return older + newer;
+        }
+
+        static value_type apply(const update_type &u, const value_type &v, size_t count) {
+            return v + Monoid::repeat(u, count);
+        }
+    };
+
+    /**
+     * Update that sets each element of a range to a value.
+     */
+    template<typename Monoid>
+    struct range_assign {
+        typedef typename Monoid::value_type value_type;
+        typedef value_type update_type;
+
+        static update_type compose(const update_type &newer, const update_type &) {
+            return newer;
+        }
+
+        static value_type apply(const update_type &u, const value_type &, size_t count) {
+            return Monoid::repeat(u, count);
+        }
+    };
+
+    /**
+     * Segment tree over a monoid, which answers the combination of any
+     * range of elements and applies an update to a range, both in
+     * logarithmic time.
+     *
+     * Queries are const, but push pending updates down the tree, so a
+     * tree may not be queried from several threads at once.
+     *
+     * @tparam T      element type
+     * @tparam Monoid the combining operation
+     * @tparam Action the range update
+     */
+    template<typename T, typename Monoid = sum_monoid<T>, typename Action = range_add<Monoid>>
+    class segment_tree {
+    public:
+        typedef size_t size_type;
+        typedef T val_type;
+        typedef typename Action::update_type update_type;
+        typedef segment_tree<T, Monoid, Action> tree_type;
+
+    private:
+        /**
+         * Nodes, where index zero is unused and the leaves start at
+         * @code m_leaves @endcode.
+         */
+        T *m_nodes;
+        /**
+         * Pending update of each inner node and whether it is set,
+         * kept together so a push reads one slot.
+         */
+        struct lazy_slot {
+            update_type update;
+            bool pending;
+        };
+
+        lazy_slot *m_lazy;
+        size_type m_size;
+        size_type m_leaves;
+        size_type m_log;
+
+        void allocate(size_type n) {
+            m_size = n;
+            m_leaves = 1;
+            m_log = 0;
+            while (m_leaves < n) {
+                m_leaves <<= 1;
+                ++m_log;
+            }
+            m_nodes = create<T[]>(2 * m_leaves);
+            m_lazy = create<lazy_slot[]>(m_leaves);
+            for (size_type k = 0; k < m_leaves; ++k) {
+                m_lazy[k].pending = false;
+            }
+            for (size_type k = 0; k < 2 * m_leaves; ++k) {
+                m_nodes[k] = Monoid::identity();
+            }
+        }
+
+        void release() {
+            if (m_nodes) {
+                destroy<T[]>(m_nodes);
+                destroy<lazy_slot[]>(m_lazy);
+            }
+        }
+
+        /**
+         * Leave the tree empty and without storage, as after a move.
+         */
+        void reset() {
+            m_nodes = nullptr;
+            m_lazy = nullptr;
+            m_size = 0;
+            m_leaves = 0;
+            m_log = 0;
+        }
+
+        void pull(size_type k) const {
+            m_nodes[k] = Monoid::combine(m_nodes[2 * k], m_nodes[2 * k + 1]);
+        }
+
+        /**
+         * Apply an update to a node of @p count elements and record it
+         * for the node's children.
+         */
+        void apply_node(size_type k, const update_type &u, size_type count) const {
+            m_nodes[k] = Action::apply(u, m_nodes[k], count);
+            if (k < m_leaves) {
+                lazy_slot &slot = m_lazy[k];
+                slot.update = slot.pending ? Action::compose(u, slot.update) : u;
+                slot.pending = true;
+            }
+        }
+
+        /**
+         * Push the pending update of a node at a height into its
+         * children, which cover @code 2^(height - 1) @endcode elements.
+         */
+        void push(size_type k, size_type height) const {
+            lazy_slot &slot = m_lazy[k];
+            if (slot.pending) {
+                const size_type count = static_cast<size_type>(1) << (height - 1);
+                apply_node(2 * k, slot.update, count);
+                apply_node(2 * k + 1, slot.update, count);
+                slot.pending = false;
+            }
+        }
+
+        /**
+         * Push the pending updates above the range ends, from the root
+         * down. Nodes whose whole subtree is inside the range are
+         * skipped because their pending updates are already included.
+         */
+        void push_ends(size_type l, size_type r) const {
+            for (size_type h = m_log; h > 0; --h) {
+                if (((l >> h) << h) != l) {
+                    push(l >> h, h);
+                }
+                if (((r >> h) << h) != r) {
+                    push((r - 1) >> h, h);
+                }
+            }
+        }
+
+    public:
+        /**
+         * Create a tree of identity elements.
+         *
+         * @param n number of elements
+         */
+        explicit segment_tree(size_type n = 0) {
+            allocate(n);
+        }
+
+        /**
+         * Create a tree of the given elements in linear time.
+         *
+         * @param values the elements
+         */
+        template<typename U>
+        explicit segment_tree(span<U> values) {
+            allocate(values.size());
+            for (size_type i = 0; i < m_size; ++i) {
+                m_nodes[m_leaves + i] = values[i];
+            }
+            for (size_type k = m_leaves - 1; k > 0; --k) {
+                pull(k);
+            }
+        }
+
+        segment_tree(const tree_type &) = delete;
+
+        segment_tree(tree_type &&tree)
+                : m_nodes(tree.m_nodes),
+                  m_lazy(tree.m_lazy),
+                  m_size(tree.m_size),
+                  m_leaves(tree.m_leaves),
+                  m_log(tree.m_log) {
+            tree.reset();
+        }
+
+        ~segment_tree() {
+            release();
+        }
+
+        size_type size() const {
+            return m_size;
+        }
+
+        /**
+         * @return the element at an index
+         */
+        T get(size_type i) const {
+            const size_type p = i + m_leaves;
+            for (size_type h = m_log; h > 0; --h) {
+                push(p >> h, h);
+            }
+            return m_nodes[p];
+        }
+
+        /**
+         * Replace an element.
+         */
+        void set(size_type i, const T &value) {
+            const size_type p = i + m_leaves;
+            for (size_type h = m_log; h > 0; --h) {
+                push(p >> h, h);
+            }
+            m_nodes[p] = value;
+            for (size_type h = 1; h <= m_log; ++h) {
+                pull(p >> h);
+            }
+        }
+
+        /**
+         * @return the combination of the elements in [begin, end), in
+         *         order, or the identity if the range is empty
+         */
+        T query(size_type begin, size_type end) const {
+            if (begin >= end) {
+                return Monoid::identity();
+            }
+            size_type l = begin + m_leaves;
+            size_type r = end + m_leaves;
+            push_ends(l, r);
+            T left = Monoid::identity();
+            T right = Monoid::identity();
+            while (l < r) {
+                if (l & 1) {
+                    left = Monoid::combine(left, m_nodes[l++]);
+                }
+                if (r & 1) {
+                    right = Monoid::combine(m_nodes[--r], right);
+                }
+                l >>= 1;
+                r >>= 1;
+            }
+            return Monoid::combine(left, right);
+        }
+
+        /**
+         * @return the combination of all elements, or the identity if
+         *         the tree holds no storage
+         */
+        T all() const {
+            return m_nodes ? m_nodes[1] : Monoid::identity();
+        }
+
+        /**
+         * Apply an update to each element in [begin, end).
+         */
+        void apply(size_type begin, size_type end, const update_type &u) {
+            if (begin >= end) {
+                return;
+            }
+            const size_type l0 = begin + m_leaves;
+            const size_type r0 = end + m_leaves;
+            push_ends(l0, r0);
+            size_type count = 1;
+            for (size_type l = l0, r = r0; l < r; l >>= 1, r >>= 1, count <<= 1) {
+                if (l & 1) {
+                    apply_node(l++, u, count);
+                }
+                if (r & 1) {
+                    apply_node(--r, u, count);
+                }
+            }
+            for (size_type h = 1; h <= m_log; ++h) {
+                if (((l0 >> h) << h) != l0) {
+                    pull(l0 >> h);
+                }
+                if (((r0 >> h) << h) != r0) {
+                    pull((r0 - 1) >> h);
+                }
+            }
+        }
+
+        tree_type &operator=(const tree_type &) = delete;
+
+        tree_type &operator=(tree_type &&tree) {
+            if (this == &tree) {
+                return *this;
+            }
+            release();
+            m_nodes = tree.m_nodes;
+            m_lazy = tree.m_lazy;
+            m_size = tree.m_size;
+            m_leaves = tree.m_leaves;
+            m_log = tree.m_log;
+            tree.reset();
+            return *this;
+        }
+
+        void swap(tree_type &tree) {
+            wlp::swap(m_nodes, tree.m_nodes);
+            wlp::swap(m_lazy, tree.m_lazy);
+            wlp::swap(m_size, tree.m_size);
+            wlp::swap(m_leaves, tree.m_leaves);
+            wlp::swap(m_log, tree.m_log);
+        }
+    };
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_SEGMENTTREE_H
@@ -0,0 +1,838 @@
+/**
+ * @file Simd.cpp
+ * @brief Implementation of the vectorized sample kernels.
+ *
+ * Each level fills a table of kernels. The vector kernels are compiled
+ * for their instruction set with target attributes, so the library
+ * itself needs no machine flags, and run a scalar tail over whatever
+ * is left after the last full vector.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <string.h>
+
+#include <wlib/stl/Simd.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define WLIB_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace wlp {
+
+    namespace {
+
+        struct simd_kernels {
+            simd_level level;
+            float (*sum_f32)(const float *, size_t);
+            int64_t (*sum_i16)(const int16_t *, size_t);
+            min_max<float> (*minmax_f32)(const float *, size_t);
+            min_max<int16_t> (*minmax_i16)(const int16_t *, size_t);
+            size_t (*find_f32)(const float *, size_t, float);
+            size_t (*find_i16)(const int16_t *, size_t, int16_t);
+            size_t (*count_f32)(const float *, size_t, float);
+            size_t (*count_i16)(const int16_t *, size_t, int16_t);
+            void (*clamp_f32)(float *, size_t, float, float);
+            void (*clamp_i16)(int16_t *, size_t, int16_t, int16_t);
+            void (*saxpy_f32)(float, const float *, float *, size_t);
+            void (*prefix_f32)(float *, size_t);
+            void (*prefix_i32)(int32_t *, size_t);
+            void (*histogram_i16)(const int16_t *, size_t, int16_t, uint8_t, uint32_t *, int32_t);
+        };
+
+        /**
+         * Vectors of 16-bit lanes added in 32-bit lanes between flushes to
+         * 64 bits. Each vector adds at most 2^16 to a lane.
+         */
+        enum : size_t {
+            i16_block = 1 << 14,
+            split_bins = 256
+        };
+
+        // Scalar kernels, the reference for the others, also run the tails.
+
+        float scalar_sum_f32(const float *p, size_t n) {
+            float sum = 0;
+            for (size_t i = 0; i < n; ++i) {
+                sum += p[i];
+            }
+            return sum;
+        }
+
+        int64_t scalar_sum_i16(const int16_t *p, size_t n) {
+            int64_t sum = 0;
+            for (size_t i = 0; i < n; ++i) {
+                sum += p[i];
+            }
+            return sum;
+        }
+
+        template<typename T>
+        min_max<T> scalar_minmax(const T *p, size_t n) {
+            min_max<T> r = {T(), T()};
+            if (n == 0) {
+                return r;
+            }
+            r.min = p[0];
+            r.max = p[0];
+            for (size_t i = 1; i < n; ++i) {
+                r.min = p[i] < r.min ? p[i] : r.min;
+                r.max = r.max < p[i] ? p[i] : r.max;
+            }
+            return r;
+        }
+
+        template<typename T>
+        size_t scalar_find(const T *p, size_t n, T val) {
+            size_t i = 0;
+            while (i < n && p[i] != val) {
+                ++i;
+            }
+            return i;
+        }
+
+        template<typename T>
+        size_t scalar_count(const T *p, size_t n, T threshold) {
+            size_t c = 0;
+            for (size_t i = 0; i < n; ++i) {
+                c += p[i] > threshold ? 1 : 0;
+            }
+            return c;
+        }
+
+        template<typename T>
+        void scalar_clamp(T *p, size_t n, T lo, T hi) {
+            for (size_t i = 0; i < n; ++i) {
+                T v = p[i] < lo ? lo : p[i];
+                p[i] = v > hi ? hi : v;
+            }
+        }
+
+        void scalar_saxpy_f32(float a, const float *x, float *y, size_t n) {
+            for (size_t i = 0; i < n; ++i) {
+                y[i] = a * x[i] + y[i];
+            }
+        }
+
+        void scalar_prefix_f32(float *p, size_t n) {
+            float sum = 0;
+            for (size_t i = 0; i < n; ++i) {
+                sum += p[i];
+                p[i] = sum;
+            }
+        }
+
+        void scalar_prefix_i32(int32_t *p, size_t n) {
+            // unsigned so that overflow wraps
+            uint32_t sum = 0;
+            for (size_t i = 0; i < n; ++i) {
+                sum += static_cast<uint32_t>(p[i]);
+                p[i] = static_cast<int32_t>(sum);
+            }
+        }
+
+        void scalar_histogram_i16(const int16_t *p, size_t n, int16_t lo, uint8_t shift,
+                                  uint32_t *bins, int32_t last) {
+            for (size_t i = 0; i < n; ++i) {
+                int32_t d = p[i] - lo;
+                d = d < 0 ? 0 : d >> shift;
+                ++bins[d > last ? last : d];
+            }
+        }
+
+        const simd_kernels scalar_kernels = {
+                simd_level::scalar,
+                scalar_sum_f32,
+                scalar_sum_i16,
+                scalar_minmax<float>,
+                scalar_minmax<int16_t>,
+                scalar_find<float>,
+                scalar_find<int16_t>,
+                scalar_count<float>,
+                scalar_count<int16_t>,
+                scalar_clamp<float>,
+                scalar_clamp<int16_t>,
+                scalar_saxpy_f32,
+                scalar_prefix_f32,
+                scalar_prefix_i32,
+                scalar_histogram_i16
+        };
+
+#ifdef WLIB_SIMD_X86
+
+#define WLIB_SSE2 __attribute__((target("sse2")))
+#define WLIB_AVX2 __attribute__((target("avx2")))
+
+        // SSE2 kernels, four floats or eight 16-bit samples at a time.
+
+        WLIB_SSE2 int64_t sse2_hsum_i32(__m128i v) {
+            int32_t lane[4];
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(lane), v);
+            return static_cast<int64_t>(lane[0]) + lane[1] + lane[2] + lane[3];
+        }
+
+        WLIB_SSE2 float sse2_sum_f32(const float *p, size_t n) {
+            __m128 a = _mm_setzero_ps();
+            __m128 b = _mm_setzero_ps();
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                a = _mm_add_ps(a, _mm_loadu_ps(p + i));
+                b = _mm_add_ps(b, _mm_loadu_ps(p + i + 4));
+            }
+            float lane[4];
+            _mm_storeu_ps(lane, _mm_add_ps(a, b));
+            return (lane[0] + lane[1]) + (lane[2] + lane[3]) + scalar_sum_f32(p + i, n - i);
+        }
+
+        WLIB_SSE2 int64_t sse2_sum_i16(const int16_t *p, size_t n) {
+            const __m128i ones = _mm_set1_epi16(1);
+            int64_t sum = 0;
+            size_t i = 0;
+            while (i + 8 <= n) {
+                __m128i acc = _mm_setzero_si128();
+                for (size_t k = 0; k < i16_block && i + 8 <= n; ++k, i += 8) {
+                    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+                    acc = _mm_add_epi32(acc, _mm_madd_epi16(v, ones));
+                }
+                sum += sse2_hsum_i32(acc);
+            }
+            return sum + scalar_sum_i16(p + i, n - i);
+        }
+
+        WLIB_SSE2 min_max<float> sse2_minmax_f32(const float *p, size_t n) {
+            if (n < 4) {
+                return scalar_minmax(p, n);
+            }
+            __m128 lo = _mm_loadu_ps(p);
+            __m128 hi = lo;
+            size_t i = 4;
+            for (; i + 4 <= n; i += 4) {
+                __m128 v = _mm_loadu_ps(p + i);
+                lo = _mm_min_ps(lo, v);
+                hi = _mm_max_ps(hi, v);
+            }
+            float lo_lane[4];
+            float hi_lane[4];
+            _mm_storeu_ps(lo_lane, lo);
+            _mm_storeu_ps(hi_lane, hi);
+            min_max<float> r = scalar_minmax(lo_lane, 4);
+            r.max = scalar_minmax(hi_lane, 4).max;
+            min_max<float> tail = scalar_minmax(p + i, n - i);
+            if (i < n) {
+                r.min = tail.min < r.min ? tail.min : r.min;
+                r.max = r.max < tail.max ? tail.max : r.max;
+            }
+            return r;
+        }
+
+        WLIB_SSE2 min_max<int16_t> sse2_minmax_i16(const int16_t *p, size_t n) {
+            if (n < 8) {
+                return scalar_minmax(p, n);
+            }
+            __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+            __m128i hi = lo;
+            size_t i = 8;
+            for (; i + 8 <= n; i += 8) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+                lo = _mm_min_epi16(lo, v);
+                hi = _mm_max_epi16(hi, v);
+            }
+            int16_t lo_lane[8];
+            int16_t hi_lane[8];
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(lo_lane), lo);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(hi_lane), hi);
+            min_max<int16_t> r = scalar_minmax(lo_lane, 8);
+            r.max = scalar_minmax(hi_lane, 8).max;
+            min_max<int16_t> tail = scalar_minmax(p + i, n - i);
+            if (i < n) {
+                r.min = tail.min < r.min ? tail.min : r.min;
+                r.max = r.max < tail.max ? tail.max : r.max;
+            }
+            return r;
+        }
+
+        WLIB_SSE2 size_t sse2_find_f32(const float *p, size_t n, float val) {
+            const __m128 v = _mm_set1_ps(val);
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(p + i), v));
+                if (mask) {
+                    return i + static_cast<size_t>(__builtin_ctz(static_cast<unsigned>(mask)));
+                }
+            }
+            return i + scalar_find(p + i, n - i, val);
+        }
+
+        WLIB_SSE2 size_t sse2_find_i16(const int16_t *p, size_t n, int16_t val) {
+            const __m128i v = _mm_set1_epi16(val);
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+                int mask = _mm_movemask_epi8(_mm_cmpeq_epi16(x, v));
+                if (mask) {
+                    // two mask bits per sample
+                    return i + static_cast<size_t>(__builtin_ctz(static_cast<unsigned>(mask)) / 2);
+                }
+            }
+            return i + scalar_find(p + i, n - i, val);
+        }
+
+        WLIB_SSE2 size_t sse2_count_f32(const float *p, size_t n, float threshold) {
+            const __m128 t = _mm_set1_ps(threshold);
+            __m128i acc = _mm_setzero_si128();
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                // true lanes are -1
+                __m128 gt = _mm_cmpgt_ps(_mm_loadu_ps(p + i), t);
+                acc = _mm_sub_epi32(acc, _mm_castps_si128(gt));
+            }
+            return static_cast<size_t>(sse2_hsum_i32(acc)) + scalar_count(p + i, n - i, threshold);
+        }
+
+        WLIB_SSE2 size_t sse2_count_i16(const int16_t *p, size_t n, int16_t threshold) {
+            const __m128i t = _mm_set1_epi16(threshold);
+            const __m128i ones = _mm_set1_epi16(1);
+            size_t c = 0;
+            size_t i = 0;
+            while (i + 8 <= n) {
+                __m128i acc = _mm_setzero_si128();
+                for (size_t k = 0; k < i16_block && i + 8 <= n; ++k, i += 8) {
+                    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+                    acc = _mm_sub_epi16(acc, _mm_cmpgt_epi16(x, t));
+                }
+                c += static_cast<size_t>(sse2_hsum_i32(_mm_madd_epi16(acc, ones)));
+            }
+            return c + scalar_count(p + i, n - i, threshold);
+        }
+
+        WLIB_SSE2 void sse2_clamp_f32(float *p, size_t n, float lo, float hi) {
+            const __m128 vlo = _mm_set1_ps(lo);
+            const __m128 vhi = _mm_set1_ps(hi);
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                _mm_storeu_ps(p + i, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(p + i), vlo), vhi));
+            }
+            scalar_clamp(p + i, n - i, lo, hi);
+        }
+
+        WLIB_SSE2 void sse2_clamp_i16(int16_t *p, size_t n, int16_t lo, int16_t hi) {
+            const __m128i vlo = _mm_set1_epi16(lo);
+            const __m128i vhi = _mm_set1_epi16(hi);
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __m128i *q = reinterpret_cast<__m128i *>(p + i);
+                _mm_storeu_si128(q, _mm_min_epi16(_mm_max_epi16(_mm_loadu_si128(q), vlo), vhi));
+            }
+            scalar_clamp(p + i, n - i, lo, hi);
+        }
+
+        WLIB_SSE2 void sse2_saxpy_f32(float a, const float *x, float *y, size_t n) {
+            const __m128 va = _mm_set1_ps(a);
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                __m128 v = _mm_add_ps(_mm_mul_ps(va, _mm_loadu_ps(x + i)), _mm_loadu_ps(y + i));
+                _mm_storeu_ps(y + i, v);
+            }
+            scalar_saxpy_f32(a, x + i, y + i, n - i);
+        }
+
+        /*
+         * The prefix sums scan each vector with two shifted adds, add the
+         * total carried from the vectors before, and carry the last lane on.
+         */
+
+        WLIB_SSE2 void sse2_prefix_f32(float *p, size_t n) {
+            __m128 carry = _mm_setzero_ps();
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                __m128 x = _mm_loadu_ps(p + i);
+                x = _mm_add_ps(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 4)));
+                x = _mm_add_ps(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 8)));
+                x = _mm_add_ps(x, carry);
+                _mm_storeu_ps(p + i, x);
+                carry = _mm_shuffle_ps(x, x, 0xff);
+            }
+            float sum = _mm_cvtss_f32(carry);
+            for (; i < n; ++i) {
+                sum += p[i];
+                p[i] = sum;
+            }
+        }
+
+        WLIB_SSE2 void sse2_prefix_i32(int32_t *p, size_t n) {
+            __m128i carry = _mm_setzero_si128();
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                __m128i *q = reinterpret_cast<__m128i *>(p + i);
+                __m128i x = _mm_loadu_si128(q);
+                x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+                x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+                x = _mm_add_epi32(x, carry);
+                _mm_storeu_si128(q, x);
+                carry = _mm_shuffle_epi32(x, 0xff);
+            }
+            uint32_t sum = static_cast<uint32_t>(_mm_cvtsi128_si32(carry));
+            for (; i < n; ++i) {
+                sum += static_cast<uint32_t>(p[i]);
+                p[i] = static_cast<int32_t>(sum);
+            }
+        }
+
+        /**
+         * Bin counts for the vector histograms, which compute bin indices
+         * a vector at a time but increment the bins one at a time. Runs
+         * of samples in one bin make each increment wait on the last, so
+         * up to 256 bins are counted in four interleaved copies, summed
+         * into the bins at the end.
+         */
+        struct bin_counts {
+            uint32_t *bins;
+            int32_t last;
+            size_t stride;
+            uint32_t copies[4 * split_bins];
+
+            bin_counts(uint32_t *b, int32_t l, size_t n)
+                    : bins(b),
+                      last(l),
+                      stride(static_cast<size_t>(l) < split_bins && n >= 4 * split_bins ? size_t(split_bins) : 0) {
+                if (stride) {
+                    memset(copies, 0, sizeof(copies));
+                }
+            }
+
+            void add(const int32_t *index, size_t n) {
+                uint32_t *base = stride ? copies : bins;
+                for (size_t k = 0; k < n; ++k) {
+                    ++base[(k & 3) * stride + static_cast<size_t>(index[k])];
+                }
+            }
+
+            void merge() {
+                if (!stride) {
+                    return;
+                }
+                for (size_t b = 0; b <= static_cast<size_t>(last); ++b) {
+                    bins[b] += copies[b] + copies[b + split_bins] + copies[b + 2 * split_bins] + copies[b + 3 * split_bins];
+                }
+            }
+        };
+
+        WLIB_SSE2 __m128i sse2_bin_i32(__m128i x, __m128i lo, __m128i shift, __m128i last) {
+            __m128i d = _mm_sub_epi32(x, lo);
+            d = _mm_andnot_si128(_mm_srai_epi32(d, 31), d);
+            d = _mm_srl_epi32(d, shift);
+            __m128i over = _mm_cmpgt_epi32(d, last);
+            return _mm_or_si128(_mm_and_si128(over, last), _mm_andnot_si128(over, d));
+        }
+
+        WLIB_SSE2 void sse2_histogram_i16(const int16_t *p, size_t n, int16_t lo, uint8_t shift,
+                                          uint32_t *bins, int32_t last) {
+            const __m128i vlo = _mm_set1_epi32(lo);
+            const __m128i vshift = _mm_cvtsi32_si128(shift);
+            const __m128i vlast = _mm_set1_epi32(last);
+            bin_counts counts(bins, last, n);
+            int32_t index[8];
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+                // sign extend by shifting each sample down from the high half
+                __m128i a = _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+                __m128i b = _mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(index), sse2_bin_i32(a, vlo, vshift, vlast));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(index + 4), sse2_bin_i32(b, vlo, vshift, vlast));
+                counts.add(index, 8);
+            }
+            counts.merge();
+            scalar_histogram_i16(p + i, n - i, lo, shift, bins, last);
+        }
+
+        const simd_kernels sse2_kernels = {
+                simd_level::sse2,
+                sse2_sum_f32,
+                sse2_sum_i16,
+                sse2_minmax_f32,
+                sse2_minmax_i16,
+                sse2_find_f32,
+                sse2_find_i16,
+                sse2_count_f32,
+                sse2_count_i16,
+                sse2_clamp_f32,
+                sse2_clamp_i16,
+                sse2_saxpy_f32,
+                sse2_prefix_f32,
+                sse2_prefix_i32,
+                sse2_histogram_i16
+        };
+
+        // AVX2 kernels, eight floats or sixteen 16-bit samples at a time.
+
+        WLIB_AVX2 int64_t avx2_hsum_i32(__m256i v) {
+            int32_t lane[8];
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(lane), v);
+            int64_t sum = 0;
+            for (int32_t x : lane) {
+                sum += x;
+            }
+            return sum;
+        }
+
+        WLIB_AVX2 float avx2_sum_f32(const float *p, size_t n) {
+            __m256 a = _mm256_setzero_ps();
+            __m256 b = _mm256_setzero_ps();
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                a = _mm256_add_ps(a, _mm256_loadu_ps(p + i));
+                b = _mm256_add_ps(b, _mm256_loadu_ps(p + i + 8));
+            }
+            a = _mm256_add_ps(a, b);
+            __m128 h = _mm_add_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+            float lane[4];
+            _mm_storeu_ps(lane, h);
+            return (lane[0] + lane[1]) + (lane[2] + lane[3]) + scalar_sum_f32(p + i, n - i);
+        }
+
+        WLIB_AVX2 int64_t avx2_sum_i16(const int16_t *p, size_t n) {
+            const __m256i ones = _mm256_set1_epi16(1);
+            int64_t sum = 0;
+            size_t i = 0;
+            while (i + 16 <= n) {
+                __m256i acc = _mm256_setzero_si256();
+                for (size_t k = 0; k < i16_block && i + 16 <= n; ++k, i += 16) {
+                    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+                    acc = _mm256_add_epi32(acc, _mm256_madd_epi16(v, ones));
+                }
+                sum += avx2_hsum_i32(acc);
+            }
+            return sum + scalar_sum_i16(p + i, n - i);
+        }
+
+        WLIB_AVX2 min_max<float> avx2_minmax_f32(const float *p, size_t n) {
+            if (n < 8) {
+                return scalar_minmax(p, n);
+            }
+            __m256 lo = _mm256_loadu_ps(p);
+            __m256 hi = lo;
+            size_t i = 8;
+            for (; i + 8 <= n; i += 8) {
+                __m256 v = _mm256_loadu_ps(p + i);
+                lo = _mm256_min_ps(lo, v);
+                hi = _mm256_max_ps(hi, v);
+            }
+            float lo_lane[8];
+            float hi_lane[8];
+            _mm256_storeu_ps(lo_lane, lo);
+            _mm256_storeu_ps(hi_lane, hi);
+            min_max<float> r = scalar_minmax(lo_lane, 8);
+            r.max = scalar_minmax(hi_lane, 8).max;
+            min_max<float> tail = scalar_minmax(p + i, n - i);
+            if (i < n) {
+                r.min = tail.min < r.min ? tail.min : r.min;
+                r.max = r.max < tail.max ? tail.max : r.max;
+            }
+            return r;
+        }
+
+        WLIB_AVX2 min_max<int16_t> avx2_minmax_i16(const int16_t *p, size_t n) {
+            if (n < 16) {
+                return scalar_minmax(p, n);
+            }
+            __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+            __m256i hi = lo;
+            size_t i = 16;
+            for (; i + 16 <= n; i += 16) {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+                lo = _mm256_min_epi16(lo, v);
+                hi = _mm256_max_epi16(hi, v);
+            }
+            int16_t lo_lane[16];
+            int16_t hi_lane[16];
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(lo_lane), lo);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(hi_lane), hi);
+            min_max<int16_t> r = scalar_minmax(lo_lane, 16);
+            r.max = scalar_minmax(hi_lane, 16).max;
+            min_max<int16_t> tail = scalar_minmax(p + i, n - i);
+            if (i < n) {
+                r.min = tail.min < r.min ? tail.min : r.min;
+                r.max = r.max < tail.max ? tail.max : r.max;
+            }
+            return r;
+        }
+
+        WLIB_AVX2 size_t avx2_find_f32(const float *p, size_t n, float val) {
+            const __m256 v = _mm256_set1_ps(val);
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(p + i), v, _CMP_EQ_OQ));
+                if (mask) {
+                    return i + static_cast<size_t>(__builtin_ctz(static_cast<unsigned>(mask)));
+                }
+            }
+            return i + scalar_find(p + i, n - i, val);
+        }
+
+        WLIB_AVX2 size_t avx2_find_i16(const int16_t *p, size_t n, int16_t val) {
+            const __m256i v = _mm256_set1_epi16(val);
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+                int mask = _mm256_movemask_epi8(_mm256_cmpeq_epi16(x, v));
+                if (mask) {
+                    return i + static_cast<size_t>(__builtin_ctz(static_cast<unsigned>(mask)) / 2);
+                }
+            }
+            return i + scalar_find(p + i, n - i, val);
+        }
+
+        WLIB_AVX2 size_t avx2_count_f32(const float *p, size_t n, float threshold) {
+            const __m256 t = _mm256_set1_ps(threshold);
+            __m256i acc = _mm256_setzero_si256();
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __m256 gt = _mm256_cmp_ps(_mm256_loadu_ps(p + i), t, _CMP_GT_OQ);
+                acc = _mm256_sub_epi32(acc, _mm256_castps_si256(gt));
+            }
+            return static_cast<size_t>(avx2_hsum_i32(acc)) + scalar_count(p + i, n - i, threshold);
+        }
+
+        WLIB_AVX2 size_t avx2_count_i16(const int16_t *p, size_t n, int16_t threshold) {
+            const __m256i t = _mm256_set1_epi16(threshold);
+            const __m256i ones = _mm256_set1_epi16(1);
+            size_t c = 0;
+            size_t i = 0;
+            while (i + 16 <= n) {
+                __m256i acc = _mm256_setzero_si256();
+                for (size_t k = 0; k < i16_block && i + 16 <= n; ++k, i += 16) {
+                    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+                    acc = _mm256_sub_epi16(acc, _mm256_cmpgt_epi16(x, t));
+                }
+                c += static_cast<size_t>(avx2_hsum_i32(_mm256_madd_epi16(acc, ones)));
+            }
+            return c + scalar_count(p + i, n - i, threshold);
+        }
+
+        WLIB_AVX2 void avx2_clamp_f32(float *p, size_t n, float lo, float hi) {
+            const __m256 vlo = _mm256_set1_ps(lo);
+            const __m256 vhi = _mm256_set1_ps(hi);
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                _mm256_storeu_ps(p + i, _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(p + i), vlo), vhi));
+            }
+            scalar_clamp(p + i, n - i, lo, hi);
+        }
+
+        WLIB_AVX2 void avx2_clamp_i16(int16_t *p, size_t n, int16_t lo, int16_t hi) {
+            const __m256i vlo = _mm256_set1_epi16(lo);
+            const __m256i vhi = _mm256_set1_epi16(hi);
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                __m256i *q = reinterpret_cast<__m256i *>(p + i);
+                _mm256_storeu_si256(q, _mm256_min_epi16(_mm256_max_epi16(_mm256_loadu_si256(q), vlo), vhi));
+            }
+            scalar_clamp(p + i, n - i, lo, hi);
+        }
+
+        WLIB_AVX2 void avx2_saxpy_f32(float a, const float *x, float *y, size_t n) {
+            const __m256 va = _mm256_set1_ps(a);
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __m256 v = _mm256_add_ps(_mm256_mul_ps(va, _mm256_loadu_ps(x + i)), _mm256_loadu_ps(y + i));
+                _mm256_storeu_ps(y + i, v);
+            }
+            scalar_saxpy_f32(a, x + i, y + i, n - i);
+        }
+
+        /*
+         * The 256-bit shifts and shuffles stay within 128-bit halves, so
+         * after scanning each half the total of the low half is moved up
+         * and added to the high half.
+         */
+
+        WLIB_AVX2 void avx2_prefix_f32(float *p, size_t n) {
+            __m256 carry = _mm256_setzero_ps();
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __m256 x = _mm256_loadu_ps(p + i);
+                x = _mm256_add_ps(x, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(x), 4)));
+                x = _mm256_add_ps(x, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(x), 8)));
+                __m256 top = _mm256_shuffle_ps(x, x, 0xff);
+                x = _mm256_add_ps(x, _mm256_permute2f128_ps(top, top, 0x08));
+                x = _mm256_add_ps(x, carry);
+                _mm256_storeu_ps(p + i, x);
+                top = _mm256_shuffle_ps(x, x, 0xff);
+                carry = _mm256_permute2f128_ps(top, top, 0x11);
+            }
+            float sum = _mm256_cvtss_f32(carry);
+            for (; i < n; ++i) {
+                sum += p[i];
+                p[i] = sum;
+            }
+        }
+
+        WLIB_AVX2 void avx2_prefix_i32(int32_t *p, size_t n) {
+            __m256i carry = _mm256_setzero_si256();
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __m256i *q = reinterpret_cast<__m256i *>(p + i);
+                __m256i x = _mm256_loadu_si256(q);
+                x = _mm256_add_epi32(x, _mm256_slli_si256(x, 4));
+                x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+                __m256i top = _mm256_shuffle_epi32(x, 0xff);
+                x = _mm256_add_epi32(x, _mm256_permute2x128_si256(top, top, 0x08));
+                x = _mm256_add_epi32(x, carry);
+                _mm256_storeu_si256(q, x);
+                top = _mm256_shuffle_epi32(x, 0xff);
+                carry = _mm256_permute2x128_si256(top, top, 0x11);
+            }
+            uint32_t sum = static_cast<uint32_t>(_mm256_cvtsi256_si32(carry));
+            for (; i < n; ++i) {
+                sum += static_cast<uint32_t>(p[i]);
+                p[i] = static_cast<int32_t>(sum);
+            }
+        }
+
+        const simd_kernels avx2_kernels = {
+                simd_level::avx2,
+                avx2_sum_f32,
+                avx2_sum_i16,
+                avx2_minmax_f32,
+                avx2_minmax_i16,
+                avx2_find_f32,
+                avx2_find_i16,
+                avx2_count_f32,
+                avx2_count_i16,
+                avx2_clamp_f32,
+                avx2_clamp_i16,
+                avx2_saxpy_f32,
+                avx2_prefix_f32,
+                avx2_prefix_i32,
+                // wider index vectors gain nothing on the scalar increments
+                sse2_histogram_i16
+        };
+
+#endif
+
+        const simd_kernels *kernels_for(simd_level level) {
+#ifdef WLIB_SIMD_X86
+            if (level == simd_level::avx2) {
+                return &avx2_kernels;
+            }
+            if (level == simd_level::sse2) {
+                return &sse2_kernels;
+            }
+#endif
+            (void) level;
+            return &scalar_kernels;
+        }
+
+        // null until the first kernel call or selection
+        const simd_kernels *s_kernels = nullptr;
+
+        const simd_kernels &kernels() {
+            const simd_kernels *k = __atomic_load_n(&s_kernels, __ATOMIC_ACQUIRE);
+            if (!k) {
+                // racing threads pick the same table
+                k = kernels_for(simd_supported());
+                __atomic_store_n(&s_kernels, k, __ATOMIC_RELEASE);
+            }
+            return *k;
+        }
+
+    }
+
+    simd_level simd_supported() {
+#ifdef WLIB_SIMD_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return simd_level::avx2;
+        }
+        if (__builtin_cpu_supports("sse2")) {
+            return simd_level::sse2;
+        }
+#endif
+        return simd_level::scalar;
+    }
+
+    simd_level simd_active() {
+        return kernels().level;
+    }
+
+    simd_level simd_select(simd_level level) {
+        simd_level best = simd_supported();
+        const simd_kernels *k = kernels_for(level < best ? level : best);
+        __atomic_store_n(&s_kernels, k, __ATOMIC_RELEASE);
+        return k->level;
+    }
+
+    float simd_sum(span<const float> s) {
+        return kernels().sum_f32(s.data(), s.size());
+    }
+
+    int64_t simd_sum(span<const int16_t> s) {
+        return kernels().sum_i16(s.data(), s.size());
+    }
+
+    float simd_mean(span<const float> s) {
+        return s.empty() ? 0.0f : simd_sum(s) / static_cast<float>(s.size());
+    }
+
+    float simd_mean(span<const int16_t> s) {
+        return s.empty() ? 0.0f : static_cast<float>(static_cast<double>(simd_sum(s)) / static_cast<double>(s.size()));
+    }
+
+    min_max<float> simd_minmax(span<const float> s) {
+        return kernels().minmax_f32(s.data(), s.size());
+    }
+
+    min_max<int16_t> simd_minmax(span<const int16_t> s) {
+        return kernels().minmax_i16(s.data(), s.size());
+    }
+
+    size_t simd_find(span<const float> s, float val) {
+        return kernels().find_f32(s.data(), s.size(), val);
+    }
+
+    size_t simd_find(span<const int16_t> s, int16_t val) {
+        return kernels().find_i16(s.data(), s.size(), val);
+    }
+
+    size_t simd_count_greater(span<const float> s, float threshold) {
+        return kernels().count_f32(s.data(), s.size(), threshold);
+    }
+
+    size_t simd_count_greater(span<const int16_t> s, int16_t threshold) {
+        return kernels().count_i16(s.data(), s.size(), threshold);
+    }
+
+    void simd_clamp(span<float> s, float lo, float hi) {
+        kernels().clamp_f32(s.data(), s.size(), lo, hi);
+    }
+
+    void simd_clamp(span<int16_t> s, int16_t lo, int16_t hi) {
+        kernels().clamp_i16(s.data(), s.size(), lo, hi);
+    }
+
+    void simd_saxpy(float a, span<const float> x, span<float> y) {
+        kernels().saxpy_f32(a, x.data(), y.data(), x.size() < y.size() ? x.size() : y.size());
+    }
+
+    void simd_prefix_sum(span<float> s) {
+        kernels().prefix_f32(s.data(), s.size());
+    }
+
+    void simd_prefix_sum(span<int32_t> s) {
+        kernels().prefix_i32(s.data(), s.size());
+    }
+
+    void simd_histogram(span<const int16_t> s, int16_t lo, uint8_t shift, span<uint32_t> bins) {
+        if (bins.empty()) {
+            return;
+        }
+        // no sample is past bin 2^16 - 1, so the last index fits in 32 bits
+        const size_t last = bins.size() - 1 < 0xffff ? bins.size() - 1 : 0xffff;
+        kernels().histogram_i16(s.data(), s.size(), lo, shift, bins.data(), static_cast<int32_t>(last));
+    }
+
+}
@@ -0,0 +1,139 @@
+/**
+ * @file Simd.h
+ * @brief Vectorized kernels over sensor sample buffers.
+ *
+ * Reductions, searches and transforms over spans of @code float @endcode
+ * and @code int16_t @endcode samples, such as the backing array of an
+ * array list or a row of a 2D array. On x86 each kernel has SSE2 and
+ * AVX2 versions, and the best one the processor supports is picked by
+ * CPUID the first time a kernel is called. Other targets, and
+ * processors with neither, use the scalar loops.
+ *
+ * Floating point sums and prefix sums add in a different order in the
+ * vector kernels, so they may round differently than the scalar loops.
+ * The kernels do not order NaNs; buffers are assumed to hold numbers.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_SIMD_H
+#define EMBEDDEDCPLUSPLUS_SIMD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <wlib/stl/Span.h>
+
+namespace wlp {
+
+    /**
+     * Instruction sets the kernels are written for, in increasing order.
+     */
+    enum class simd_level : uint8_t {
+        scalar,
+        sse2,
+        avx2
+    };
+
+    /**
+     * @return the best level the processor supports
+     */
+    simd_level simd_supported();
+
+    /**
+     * @return the level of the kernels in use
+     */
+    simd_level simd_active();
+
+    /**
+     * Use the kernels of a level, or the best supported level below it
+     * if the processor lacks it. Benchmarks and tests use this to
+     * compare levels; otherwise there is no reason to call it.
+     *
+     * @param level the level to use
+     * @return the level now in use
+     */
+    simd_level simd_select(simd_level level);
+
+    template<typename T>
+    struct min_max {
+        T min;
+        T max;
+    };
+
+    float simd_sum(span<const float> s);
+
+    /**
+     * Samples are added in 32 bits and flushed to 64 bits often enough
+     * that no buffer can overflow.
+     */
+    int64_t simd_sum(span<const int16_t> s);
+
+    /**
+     * @return the mean of the samples, or zero for an empty span
+     */
+    float simd_mean(span<const float> s);
+
+    float simd_mean(span<const int16_t> s);
+
+    /**
+     * @return the smallest and largest samples, or zeros for an empty
+     * span
+     */
+    min_max<float> simd_minmax(span<const float> s);
+
+    min_max<int16_t> simd_minmax(span<const int16_t> s);
+
+    /**
+     * @return the index of the first sample equal to the value, or the
+     * size of the span
+     */
+    size_t simd_find(span<const float> s, float val);
+
+    size_t simd_find(span<const int16_t> s, int16_t val);
+
+    /**
+     * @return the number of samples greater than the threshold
+     */
+    size_t simd_count_greater(span<const float> s, float threshold);
+
+    size_t simd_count_greater(span<const int16_t> s, int16_t threshold);
+
+    /**
+     * Clamp every sample into [lo, hi] in place.
+     */
+    void simd_clamp(span<float> s, float lo, float hi);
+
+    void simd_clamp(span<int16_t> s, int16_t lo, int16_t hi);
+
+    /**
+     * Compute y = a * x + y, up to the shorter of the two spans.
+     */
+    void simd_saxpy(float a, span<const float> x, span<float> y);
+
+    /**
+     * Replace every element with the sum of itself and the elements
+     * before it.
+     */
+    void simd_prefix_sum(span<float> s);
+
+    void simd_prefix_sum(span<int32_t> s);
+
+    /**
+     * Count samples into bins of width 2^shift, the first starting at
+     * @p lo. Samples below the first bin are counted in it, and samples
+     * past the last bin in the last. Counts are added to the bins,
+     * which are not cleared first.
+     *
+     * @param s     the samples
+     * @param lo    the smallest sample of the first bin
+     * @param shift log2 of the bin width, less than 16
+     * @param bins  the bin counts
+     */
+    void simd_histogram(span<const int16_t> s, int16_t lo, uint8_t shift, span<uint32_t> bins);
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_SIMD_H
@@ -0,0 +1,350 @@
+/**
+ * @file SlabAllocator.cpp
+ * @brief Segregated-fit allocator with thread caches.
+ *
+ * A thread cache holds a loaded and a previous magazine for each
+ * class. Allocation pops from the loaded magazine and frees push to
+ * it; when it runs dry or fills up, the previous magazine is tried,
+ * and only then does the thread go to the depot, trading a full or
+ * empty magazine for one of the other kind. Keeping two magazines
+ * means a thread that alternates between allocating and freeing
+ * around a magazine boundary does not go to the depot every time.
+ * When a depot has no full magazines, a magazine is filled with
+ * blocks cut from the current slab of the class.
+ *
+ * Compiled in when wlib is built with WLIB_SLAB_ALLOCATOR, since the
+ * thread caches and spin locks only suit hosted targets.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifdef WLIB_SLAB_ALLOCATOR
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <wlib/stl/SlabAllocator.h>
+
+namespace wlp {
+
+    namespace {
+
+        enum : size_t {
+            num_classes = 8,
+            min_payload = 16,
+            max_payload = min_payload << (num_classes - 1),
+            header_size = 16,
+            slab_size = 64 << 10,
+            magazine_size = 32
+        };
+
+        const uint32_t large_class = 0xffffffffu;
+
+        /**
+         * The class is at the start of the header; large blocks put
+         * their size after it.
+         */
+        struct header {
+            uint32_t cls;
+            uint32_t pad;
+            size_t size;
+        };
+
+        static_assert(sizeof(header) <= header_size, "block header does not fit");
+
+        struct magazine {
+            magazine *next;
+            size_t count;
+            char *blocks[magazine_size];
+        };
+
+        struct spin_lock {
+            bool flag;
+
+            void lock() {
+                while (__atomic_test_and_set(&flag, __ATOMIC_ACQUIRE)) {
+                    while (__atomic_load_n(&flag, __ATOMIC_RELAXED)) {
+                    }
+                }
+            }
+
+            void unlock() {
+                __atomic_clear(&flag, __ATOMIC_RELEASE);
+            }
+        };
+
+        /**
+         * The depot of a class holds magazines returned by threads and
+         * the slab that new blocks are cut from. Everything is guarded
+         * by the lock.
+         */
+        struct depot {
+            spin_lock guard;
+            magazine *full;
+            magazine *empty;
+            size_t num_full;
+            size_t num_empty;
+            char *loose;
+            char *cursor;
+            char *limit;
+            size_t slab_bytes;
+        };
+
+        depot depots[num_classes];
+        size_t large_bytes;
+
+        size_t block_size(size_t cls) {
+            return header_size + (static_cast<size_t>(min_payload) << cls);
+        }
+
+        size_t size_class(size_t bytes) {
+            if (bytes <= min_payload) {
+                return 0;
+            }
+            const unsigned width = static_cast<unsigned>(8 * sizeof(unsigned long)) -
+                                   static_cast<unsigned>(__builtin_clzl(static_cast<unsigned long>(bytes - 1)));
+            return width - 4;
+        }
+
+        header *header_of(const void *ptr) {
+            return reinterpret_cast<header *>(static_cast<char *>(const_cast<void *>(ptr)) - header_size);
+        }
+
+        /**
+         * Take an empty magazine from a locked depot, or make one.
+         */
+        magazine *take_empty(depot &d) {
+            magazine *m = d.empty;
+            if (m) {
+                d.empty = m->next;
+                --d.num_empty;
+                return m;
+            }
+            m = static_cast<magazine *>(malloc(sizeof(magazine)));
+            if (m) {
+                m->count = 0;
+            }
+            return m;
+        }
+
+        void give_full(depot &d, magazine *m) {
+            m->next = d.full;
+            d.full = m;
+            ++d.num_full;
+        }
+
+        void give_empty(depot &d, magazine *m) {
+            m->next = d.empty;
+            d.empty = m;
+            ++d.num_empty;
+        }
+
+        /**
+         * Fill an empty magazine from a locked depot, first with loose
+         * blocks and then with new blocks from the slab, starting a new
+         * slab if it runs out.
+         */
+        void fill(depot &d, size_t cls, magazine *m) {
+            while (d.loose && m->count < magazine_size) {
+                m->blocks[m->count++] = d.loose;
+                memcpy(&d.loose, d.loose + header_size, sizeof(char *));
+            }
+            const size_t bsize = block_size(cls);
+            while (m->count < magazine_size) {
+                if (d.cursor == d.limit) {
+                    char *slab = static_cast<char *>(malloc(slab_size));
+                    if (!slab) {
+                        return;
+                    }
+                    d.cursor = slab;
+                    d.limit = slab + slab_size / bsize * bsize;
+                    d.slab_bytes += slab_size;
+                }
+                header *h = reinterpret_cast<header *>(d.cursor);
+                h->cls = static_cast<uint32_t>(cls);
+                m->blocks[m->count++] = d.cursor;
+                d.cursor += bsize;
+            }
+        }
+
+        struct thread_cache {
+            magazine *loaded[num_classes];
+            magazine *previous[num_classes];
+
+            ~thread_cache() {
+                flush();
+            }
+
+            void flush() {
+                for (size_t cls = 0; cls < num_classes; ++cls) {
+                    magazine *mags[2] = {loaded[cls], previous[cls]};
+                    loaded[cls] = nullptr;
+                    previous[cls] = nullptr;
+                    depot &d = depots[cls];
+                    d.guard.lock();
+                    for (magazine *m : mags) {
+                        if (!m) {
+                            continue;
+                        }
+                        if (m->count) {
+                            give_full(d, m);
+                        } else {
+                            give_empty(d, m);
+                        }
+                    }
+                    d.guard.unlock();
+                }
+            }
+
+            char *pop(size_t cls) {
+                magazine *m = loaded[cls];
+                if (m && m->count) {
+                    return m->blocks[--m->count];
+                }
+                magazine *p = previous[cls];
+                if (p && p->count) {
+                    loaded[cls] = p;
+                    previous[cls] = m;
+                    return p->blocks[--p->count];
+                }
+                depot &d = depots[cls];
+                d.guard.lock();
+                magazine *full = d.full;
+                if (full) {
+                    d.full = full->next;
+                    --d.num_full;
+                    if (p) {
+                        give_empty(d, p);
+                    }
+                    previous[cls] = m;
+                } else {
+                    if (!m) {
+                        m = p;
+                        previous[cls] = nullptr;
+                    }
+                    full = m ? m : take_empty(d);
+                    if (full) {
+                        fill(d, cls, full);
+                    }
+                }
+                d.guard.unlock();
+                loaded[cls] = full;
+                return full && full->count ? full->blocks[--full->count] : nullptr;
+            }
+
+            void push(size_t cls, char *block) {
+                magazine *m = loaded[cls];
+                if (m && m->count < magazine_size) {
+                    m->blocks[m->count++] = block;
+                    return;
+                }
+                magazine *p = previous[cls];
+                if (p && p->count == 0) {
+                    loaded[cls] = p;
+                    previous[cls] = m;
+                    p->blocks[p->count++] = block;
+                    return;
+                }
+                depot &d = depots[cls];
+                d.guard.lock();
+                if (p) {
+                    give_full(d, p);
+                }
+                magazine *e = take_empty(d);
+                if (!e) {
+                    // without a new magazine the block is kept loose
+                    // in the depot, linked through its payload
+                    memcpy(block + header_size, &d.loose, sizeof(char *));
+                    d.loose = block;
+                    previous[cls] = nullptr;
+                    d.guard.unlock();
+                    return;
+                }
+                d.guard.unlock();
+                previous[cls] = m;
+                loaded[cls] = e;
+                e->blocks[e->count++] = block;
+            }
+        };
+
+        thread_local thread_cache cache;
+
+        void *large_alloc(size_t bytes) {
+            char *block = static_cast<char *>(malloc(header_size + bytes));
+            if (!block) {
+                return nullptr;
+            }
+            header *h = reinterpret_cast<header *>(block);
+            h->cls = large_class;
+            h->size = bytes;
+            __atomic_add_fetch(&large_bytes, bytes, __ATOMIC_RELAXED);
+            return block + header_size;
+        }
+
+    }
+
+    void *slab_alloc(size_t bytes) {
+        if (bytes > max_payload) {
+            return large_alloc(bytes);
+        }
+        char *block = cache.pop(size_class(bytes));
+        return block ? block + header_size : nullptr;
+    }
+
+    void slab_free(void *ptr) {
+        if (!ptr) {
+            return;
+        }
+        header *h = header_of(ptr);
+        if (h->cls == large_class) {
+            __atomic_sub_fetch(&large_bytes, h->size, __ATOMIC_RELAXED);
+            free(h);
+            return;
+        }
+        cache.push(h->cls, reinterpret_cast<char *>(h));
+    }
+
+    void *slab_realloc(void *ptr, size_t bytes) {
+        if (!ptr) {
+            return slab_alloc(bytes);
+        }
+        const size_t usable = slab_usable_size(ptr);
+        if (bytes <= usable) {
+            return ptr;
+        }
+        void *moved = slab_alloc(bytes);
+        if (moved) {
+            memcpy(moved, ptr, usable);
+            slab_free(ptr);
+        }
+        return moved;
+    }
+
+    size_t slab_usable_size(const void *ptr) {
+        const header *h = header_of(ptr);
+        return h->cls == large_class ? h->size : static_cast<size_t>(min_payload) << h->cls;
+    }
+
+    void slab_flush_cache() {
+        cache.flush();
+    }
+
+    slab_stats slab_get_stats() {
+        slab_stats stats = {};
+        for (depot &d : depots) {
+            d.guard.lock();
+            stats.slab_bytes += d.slab_bytes;
+            stats.full_magazines += d.num_full;
+            stats.empty_magazines += d.num_empty;
+            d.guard.unlock();
+        }
+        stats.large_bytes = __atomic_load_n(&large_bytes, __ATOMIC_RELAXED);
+        return stats;
+    }
+
+}
+
+#endif
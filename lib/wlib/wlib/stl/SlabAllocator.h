@@ -0,0 +1,80 @@
+/**
+ * @file SlabAllocator.h
+ * @brief Segregated-fit allocator with thread caches.
+ *
+ * Requests up to 2 KB are rounded up to a power of two size class.
+ * Blocks of a class are cut from 64 KB slabs and passed around in
+ * magazines, fixed size stacks of free blocks. Each thread keeps two
+ * magazines per class and allocates and frees against them without
+ * locking; only when both are empty, or both are full, does it swap a
+ * magazine with the central depot of the class, which is guarded by a
+ * spin lock. Larger requests go to the system heap.
+ *
+ * Every block starts with a 16 byte header naming its class, so
+ * blocks can be freed without their size and from any thread, and
+ * stay aligned to 16 bytes. Slabs are never returned to the system.
+ *
+ * The allocator is only built into wlib with
+ * @code WLIB_SLAB_ALLOCATOR @endcode, which also defines the memory
+ * hooks behind @code create @endcode and @code destroy @endcode with
+ * it; the application must then not define them.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_SLABALLOCATOR_H
+#define EMBEDDEDCPLUSPLUS_SLABALLOCATOR_H
+
+#include <stddef.h>
+
+namespace wlp {
+
+    /**
+     * Byte and magazine counts of the slab allocator. Magazines are
+     * counted while held by the depots, not by threads.
+     */
+    struct slab_stats {
+        size_t slab_bytes;
+        size_t large_bytes;
+        size_t full_magazines;
+        size_t empty_magazines;
+    };
+
+    /**
+     * @param bytes the number of bytes needed
+     * @return a block of at least that many bytes, aligned to 16 bytes,
+     * or null if the system is out of memory
+     */
+    void *slab_alloc(size_t bytes);
+
+    /**
+     * Free a block from @code slab_alloc @endcode, which may have been
+     * allocated on another thread. Null is ignored.
+     */
+    void slab_free(void *ptr);
+
+    /**
+     * Resize a block, which stays in place if its class is large
+     * enough. Null allocates a new block.
+     */
+    void *slab_realloc(void *ptr, size_t bytes);
+
+    /**
+     * @return the number of bytes the block can hold
+     */
+    size_t slab_usable_size(const void *ptr);
+
+    /**
+     * Return the magazines of the calling thread to the depots. This
+     * is done when a thread exits, and lets blocks freed by one thread
+     * be allocated by others sooner.
+     */
+    void slab_flush_cache();
+
+    slab_stats slab_get_stats();
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_SLABALLOCATOR_H
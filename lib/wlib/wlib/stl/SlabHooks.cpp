@@ -0,0 +1,34 @@
+/**
+ * @file SlabHooks.cpp
+ * @brief Memory hooks backed by the slab allocator.
+ *
+ * Compiled in when wlib is built with WLIB_SLAB_ALLOCATOR, so that
+ * create and destroy allocate from size-class slabs with thread
+ * caches instead of the hooks the application would define.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifdef WLIB_SLAB_ALLOCATOR
+
+#include <wlib/stl/SlabAllocator.h>
+
+namespace wlp {
+    namespace mem {
+        void *alloc(size_t bytes) {
+            return slab_alloc(bytes);
+        }
+
+        void free(void *ptr) {
+            slab_free(ptr);
+        }
+
+        void *realloc(void *ptr, size_t bytes) {
+            return slab_realloc(ptr, bytes);
+        }
+    }
+}
+
+#endif
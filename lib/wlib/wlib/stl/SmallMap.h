@@ -0,0 +1,484 @@
+/**
+ * @file SmallMap.h
+ * @brief Map that stores a few entries inline before using a hash map.
+ *
+ * Maps that usually hold a handful of entries pay more for the bucket
+ * array and per-node allocations of a hash map than for a linear scan.
+ * The small map keeps up to N entries in inline arrays and only
+ * allocates a hash map once it outgrows them.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_SMALLMAP_H
+#define EMBEDDEDCPLUSPLUS_SMALLMAP_H
+
+#include <string.h>
+
+#include <wlib/stl/Equal.h>
+#include <wlib/stl/Hash.h>
+#include <wlib/stl/HashMap.h>
+#include <wlib/stl/Helper.h>
+#include <wlib/stl/Pair.h>
+#include <wlib/memory>
+#include <wlib/type_traits>
+#include <wlib/utility>
+
+namespace wlp {
+
+    /**
+     * Linear search over packed integer keys that compares a whole
+     * 64-bit word of keys at once. The probe is broadcast to every
+     * lane and XORed with the keys, after which a lane is zero exactly
+     * where a key matched; the zero lanes are found without carries
+     * crossing between lanes.
+     *
+     * @tparam Bytes size of a key, at most 4
+     */
+    template<size_t Bytes>
+    struct __small_map_swar {
+        static constexpr size_t lanes = 8 / Bytes;
+        static constexpr uint64_t lane = (static_cast<uint64_t>(1) << (8 * Bytes)) - 1;
+        static constexpr uint64_t ones = ~static_cast<uint64_t>(0) / lane;
+        static constexpr uint64_t low = ones * (lane >> 1);
+
+        /**
+         * @return the number of keys to store so that whole words
+         * can be loaded
+         */
+        static constexpr size_t slots(size_t n) {
+            return (n + lanes - 1) / lanes * lanes;
+        }
+
+        /**
+         * @param keys array of at least @code slots(n) @endcode keys
+         * @param n    number of valid keys
+         * @param key  key to find
+         * @return index of the key, or n if not present
+         */
+        template<typename Key>
+        static size_t find(const Key *keys, size_t n, Key key) {
+            const uint64_t probe = ones * (static_cast<uint64_t>(key) & lane);
+            const size_t words = (n + lanes - 1) / lanes;
+            for (size_t w = 0; w < words; ++w) {
+                uint64_t x;
+                memcpy(&x, keys + w * lanes, sizeof(x));
+                x ^= probe;
+                const uint64_t zero = ~(((x & low) + low) | x | low);
+                if (zero != 0) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+                    const size_t i = w * lanes + static_cast<size_t>(__builtin_clzll(zero)) / (8 * Bytes);
+#else
+                    const size_t i = w * lanes + static_cast<size_t>(__builtin_ctzll(zero)) / (8 * Bytes);
+#endif
+                    return i < n ? i : n;
+                }
+            }
+            return n;
+        }
+    };
+
+    /**
+     * Iterator over a small map. While the map is inline it walks the
+     * entry arrays by index; once promoted it wraps an iterator of the
+     * backing hash map.
+     *
+     * @tparam Key     key type
+     * @tparam Val     value type
+     * @tparam Ref     reference type to value
+     * @tparam Ptr     pointer type to value
+     * @tparam TableIt iterator type of the backing hash map
+     */
+    template<typename Key, typename Val, typename Ref, typename Ptr, typename TableIt>
+    struct SmallMapIterator {
+        typedef SmallMapIterator<Key, Val, Ref, Ptr, TableIt> self_type;
+
+        typedef Key key_type;
+        typedef Val val_type;
+        typedef Ref reference;
+        typedef Ptr pointer;
+
+        typedef size_t size_type;
+
+        /**
+         * Inline key array, or null if the map has been promoted.
+         */
+        const key_type *m_keys;
+        /**
+         * Inline value array.
+         */
+        pointer m_vals;
+        /**
+         * Index into the inline arrays.
+         */
+        size_type m_index;
+        /**
+         * Iterator into the hash map once promoted.
+         */
+        TableIt m_it;
+
+        SmallMapIterator()
+                : m_keys(nullptr),
+                  m_vals(nullptr),
+                  m_index(0),
+                  m_it() {
+        }
+
+        SmallMapIterator(const key_type *keys, pointer vals, size_type index)
+                : m_keys(keys),
+                  m_vals(vals),
+                  m_index(index),
+                  m_it() {
+        }
+
+        explicit SmallMapIterator(const TableIt &it)
+                : m_keys(nullptr),
+                  m_vals(nullptr),
+                  m_index(0),
+                  m_it(it) {
+        }
+
+        SmallMapIterator(const self_type &it) = default;
+
+        reference operator*() const {
+            return m_keys ? m_vals[m_index] : *m_it;
+        }
+
+        pointer operator->() const {
+            return &(operator*());
+        }
+
+        const key_type &key() const {
+            return m_keys ? m_keys[m_index] : m_it.key();
+        }
+
+        self_type &operator++() {
+            if (m_keys) {
+                ++m_index;
+            } else {
+                ++m_it;
+            }
+            return *this;
+        }
+
+        self_type operator++(int) {
+            self_type tmp(*this);
+            ++*this;
+            return tmp;
+        }
+
+        bool operator==(const self_type &it) const {
+            return m_keys ? m_index == it.m_index && m_keys == it.m_keys : m_it == it.m_it;
+        }
+
+        bool operator!=(const self_type &it) const {
+            return !(*this == it);
+        }
+
+        self_type &operator=(const self_type &it) = default;
+    };
+
+    /**
+     * Map that holds up to @code N @endcode entries in unsorted inline
+     * arrays, searched linearly, and moves them into a heap allocated
+     * hash map when an insertion would exceed that. An empty or small
+     * map performs no allocation at all. Keys and values are kept in
+     * separate arrays so that integer keys of up to 32 bits can be
+     * compared several at a time.
+     *
+     * Erasing an inline entry moves the last entry into its place, so
+     * iteration order is not insertion order.
+     *
+     * @tparam Key    key type, default constructible
+     * @tparam Val    value type, default constructible
+     * @tparam N      number of inline entries
+     * @tparam Hasher hash function of the backing hash map
+     * @tparam Equals key equality function
+     */
+    template<typename Key,
+            typename Val,
+            size_t N = 8,
+            typename Hasher = hash<Key, uint16_t>,
+            typename Equals = equals<Key>>
+    class small_map {
+        static_assert(N > 0, "Inline entry count must be positive");
+
+    public:
+        typedef small_map<Key, Val, N, Hasher, Equals> map_type;
+        typedef hash_map<Key, Val, Hasher, Equals> table_map_type;
+        typedef SmallMapIterator<Key, Val, Val &, Val *,
+                typename table_map_type::iterator> iterator;
+        typedef SmallMapIterator<Key, Val, const Val &, const Val *,
+                typename table_map_type::const_iterator> const_iterator;
+        typedef typename table_map_type::size_type size_type;
+
+        typedef Key key_type;
+        typedef Val val_type;
+
+    private:
+        /**
+         * Whether keys are small integers searched a word at a time.
+         */
+        typedef integral_constant<bool, is_integral<Key>::value && sizeof(Key) <= 4> packed_keys;
+        typedef __small_map_swar<sizeof(Key) <= 4 ? sizeof(Key) : 1> swar_type;
+
+        static constexpr size_t s_slots = packed_keys::value ? swar_type::slots(N) : N;
+
+        key_type m_keys[s_slots];
+        val_type m_vals[N];
+        size_type m_size;
+        /**
+         * Backing hash map, allocated on promotion.
+         */
+        table_map_type *m_map;
+
+        Equals m_equals;
+
+        template<typename K>
+        size_type index_of(const K &key, true_type) const {
+            return swar_type::find(m_keys, m_size, key);
+        }
+
+        size_type index_of(const key_type &key, false_type) const {
+            for (size_type i = 0; i < m_size; ++i) {
+                if (m_equals(m_keys[i], key)) {
+                    return i;
+                }
+            }
+            return m_size;
+        }
+
+        /**
+         * @return index of the key in the inline arrays, or the
+         * current size if it is not present
+         */
+        size_type index_of(const key_type &key) const {
+            return index_of(key, packed_keys());
+        }
+
+        /**
+         * Move the inline entries into a newly allocated hash map.
+         */
+        void promote() {
+            m_map = create<table_map_type>(static_cast<size_type>(4 * N));
+            for (size_type i = 0; i < m_size; ++i) {
+                m_map->insert(move(m_keys[i]), move(m_vals[i]));
+                m_keys[i] = key_type();
+                m_vals[i] = val_type();
+            }
+            m_size = 0;
+        }
+
+        void release() {
+            if (m_map) {
+                destroy<table_map_type>(m_map);
+                m_map = nullptr;
+            }
+        }
+
+    public:
+        small_map()
+                : m_keys(),
+                  m_size(0),
+                  m_map(nullptr) {
+        }
+
+        small_map(const map_type &) = delete;
+
+        small_map(map_type &&map)
+                : m_keys(),
+                  m_size(map.m_size),
+                  m_map(map.m_map) {
+            for (size_type i = 0; i < m_size; ++i) {
+                m_keys[i] = move(map.m_keys[i]);
+                m_vals[i] = move(map.m_vals[i]);
+            }
+            map.m_size = 0;
+            map.m_map = nullptr;
+        }
+
+        ~small_map() {
+            release();
+        }
+
+        size_type size() const {
+            return m_map ? m_map->size() : m_size;
+        }
+
+        size_type capacity() const {
+            return m_map ? m_map->capacity() : N;
+        }
+
+        bool empty() const {
+            return size() == 0;
+        }
+
+        /**
+         * @return true if the entries have moved into a hash map
+         */
+        bool is_promoted() const {
+            return m_map != nullptr;
+        }
+
+        iterator begin() {
+            return m_map ? iterator(m_map->begin()) : iterator(m_keys, m_vals, 0);
+        }
+
+        const_iterator begin() const {
+            return m_map ? const_iterator(static_cast<const table_map_type *>(m_map)->begin())
+                         : const_iterator(m_keys, m_vals, 0);
+        }
+
+        iterator end() {
+            return m_map ? iterator(m_map->end()) : iterator(m_keys, m_vals, m_size);
+        }
+
+        const_iterator end() const {
+            return m_map ? const_iterator(static_cast<const table_map_type *>(m_map)->end())
+                         : const_iterator(m_keys, m_vals, m_size);
+        }
+
+        /**
+         * Remove all entries and free the hash map, if any, so the
+         * map returns to inline storage.
+         */
+        void clear() noexcept {
+            release();
+            for (size_type i = 0; i < m_size; ++i) {
+                m_keys[i] = key_type();
+                m_vals[i] = val_type();
+            }
+            m_size = 0;
+        }
+
+        template<typename K, typename V>
+        pair<iterator, bool> insert(K &&key, V &&val) {
+            if (!m_map) {
+                const size_type i = index_of(key);
+                if (i < m_size) {
+                    return pair<iterator, bool>(iterator(m_keys, m_vals, i), false);
+                }
+                if (m_size < N) {
+                    m_keys[m_size] = forward<K>(key);
+                    m_vals[m_size] = forward<V>(val);
+                    ++m_size;
+                    return pair<iterator, bool>(iterator(m_keys, m_vals, m_size - 1), true);
+                }
+                promote();
+            }
+            pair<typename table_map_type::iterator, bool> res = m_map->insert(forward<K>(key), forward<V>(val));
+            return pair<iterator, bool>(iterator(res.first()), res.second());
+        }
+
+        template<typename K, typename V>
+        pair<iterator, bool> insert_or_assign(K &&key, V &&val) {
+            iterator it = find(key);
+            if (it == end()) {
+                return insert(forward<K>(key), forward<V>(val));
+            }
+            *it = forward<V>(val);
+            return pair<iterator, bool>(it, false);
+        }
+
+        /**
+         * Erase the entry at the iterator. For an inline map the last
+         * entry takes its slot, and the returned iterator points to it.
+         *
+         * @param pos iterator to an entry
+         * @return iterator to the next entry to visit
+         */
+        iterator erase(const iterator &pos) {
+            if (m_map) {
+                return iterator(m_map->erase(pos.m_it));
+            }
+            const size_type i = pos.m_index;
+            --m_size;
+            if (i != m_size) {
+                m_keys[i] = move(m_keys[m_size]);
+                m_vals[i] = move(m_vals[m_size]);
+            }
+            m_keys[m_size] = key_type();
+            m_vals[m_size] = val_type();
+            return iterator(m_keys, m_vals, i);
+        }
+
+        bool erase(const key_type &key) {
+            iterator it = find(key);
+            if (it == end()) {
+                return false;
+            }
+            erase(it);
+            return true;
+        }
+
+        val_type &at(const key_type &key) {
+            return *find(key);
+        }
+
+        const val_type &at(const key_type &key) const {
+            return *find(key);
+        }
+
+        bool contains(const key_type &key) const {
+            return m_map ? m_map->contains(key) : index_of(key) < m_size;
+        }
+
+        iterator find(const key_type &key) {
+            if (m_map) {
+                return iterator(m_map->find(key));
+            }
+            return iterator(m_keys, m_vals, index_of(key));
+        }
+
+        const_iterator find(const key_type &key) const {
+            if (m_map) {
+                return const_iterator(static_cast<const table_map_type *>(m_map)->find(key));
+            }
+            return const_iterator(m_keys, m_vals, index_of(key));
+        }
+
+        template<typename K>
+        val_type &operator[](K &&key) {
+            return *insert(forward<K>(key), val_type()).first();
+        }
+
+        map_type &operator=(const map_type &) = delete;
+
+        map_type &operator=(map_type &&map) {
+            if (this == &map) {
+                return *this;
+            }
+            clear();
+            m_size = map.m_size;
+            m_map = map.m_map;
+            for (size_type i = 0; i < m_size; ++i) {
+                m_keys[i] = move(map.m_keys[i]);
+                m_vals[i] = move(map.m_vals[i]);
+            }
+            map.m_size = 0;
+            map.m_map = nullptr;
+            return *this;
+        }
+
+        /**
+         * Exchange the contents of two maps. Inline entries are
+         * swapped one at a time and a promoted table by pointer.
+         *
+         * @param map the map to swap with
+         */
+        void swap(map_type &map) {
+            const size_type n = m_size > map.m_size ? m_size : map.m_size;
+            for (size_type i = 0; i < n; ++i) {
+                wlp::swap(m_keys[i], map.m_keys[i]);
+                wlp::swap(m_vals[i], map.m_vals[i]);
+            }
+            wlp::swap(m_size, map.m_size);
+            wlp::swap(m_map, map.m_map);
+        }
+    };
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_SMALLMAP_H
@@ -0,0 +1,327 @@
+/**
+ * @file Span.h
+ * @brief Non-owning view of a contiguous array of elements.
+ *
+ * A span is a pointer and a length into an array owned elsewhere, such
+ * as the backing array of an array list, a row of a 2D array, or a
+ * fixed size C array. Loops over a span index or walk plain memory,
+ * with none of the per-step bounds handling of the container
+ * iterators, so compilers can unroll and vectorize them.
+ *
+ * Span iterators are raw pointers, unless checked iterators are
+ * enabled with @code WLIB_CHECKED_ITERATORS @endcode, which debug
+ * builds do. Checked iterators remember the span bounds and stop at
+ * them the way the container iterators do.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_SPAN_H
+#define EMBEDDEDCPLUSPLUS_SPAN_H
+
+#include <stddef.h>
+
+#include <wlib/type_traits>
+
+#if defined(WLIB_DEBUG) && !defined(WLIB_CHECKED_ITERATORS)
+#define WLIB_CHECKED_ITERATORS
+#endif
+
+namespace wlp {
+
+    /**
+     * Bounds-checked iterator over a span. Moving it before the first
+     * element or past the end leaves it at the first element or at
+     * the end.
+     *
+     * @tparam T element type, which may be const
+     */
+    template<typename T>
+    class span_iterator {
+    public:
+        typedef size_t size_type;
+        typedef ptrdiff_t diff_type;
+        typedef T val_type;
+        typedef T &reference;
+        typedef T *pointer;
+        typedef span_iterator<T> self_type;
+
+    private:
+        T *m_ptr;
+        T *m_begin;
+        T *m_end;
+
+        template<typename U>
+        friend class span_iterator;
+
+        void check_bounds() {
+            if (m_ptr < m_begin) {
+                m_ptr = m_begin;
+            } else if (m_ptr > m_end) {
+                m_ptr = m_end;
+            }
+        }
+
+    public:
+        span_iterator()
+                : m_ptr(nullptr),
+                  m_begin(nullptr),
+                  m_end(nullptr) {
+        }
+
+        span_iterator(T *ptr, T *begin, T *end)
+                : m_ptr(ptr),
+                  m_begin(begin),
+                  m_end(end) {
+            check_bounds();
+        }
+
+        /**
+         * Conversion from an iterator over mutable elements.
+         */
+        template<typename U, typename = typename enable_if<is_same<const U, T>::value>::type>
+        span_iterator(const span_iterator<U> &it)
+                : m_ptr(it.m_ptr),
+                  m_begin(it.m_begin),
+                  m_end(it.m_end) {
+        }
+
+        reference operator*() const {
+            return *m_ptr;
+        }
+
+        pointer operator->() const {
+            return m_ptr;
+        }
+
+        reference operator[](diff_type d) const {
+            return *(*this + d);
+        }
+
+        self_type &operator++() {
+            if (m_ptr != m_end) {
+                ++m_ptr;
+            }
+            return *this;
+        }
+
+        self_type operator++(int) {
+            self_type tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        self_type &operator--() {
+            if (m_ptr != m_begin) {
+                --m_ptr;
+            }
+            return *this;
+        }
+
+        self_type operator--(int) {
+            self_type tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        self_type &operator+=(diff_type d) {
+            if (d > m_end - m_ptr) {
+                m_ptr = m_end;
+            } else if (d < m_begin - m_ptr) {
+                m_ptr = m_begin;
+            } else {
+                m_ptr += d;
+            }
+            return *this;
+        }
+
+        self_type &operator-=(diff_type d) {
+            return *this += -d;
+        }
+
+        self_type operator+(diff_type d) const {
+            self_type tmp = *this;
+            return tmp += d;
+        }
+
+        self_type operator-(diff_type d) const {
+            self_type tmp = *this;
+            return tmp -= d;
+        }
+
+        diff_type operator-(const self_type &it) const {
+            return m_ptr - it.m_ptr;
+        }
+
+        bool operator==(const self_type &it) const {
+            return m_ptr == it.m_ptr;
+        }
+
+        bool operator!=(const self_type &it) const {
+            return m_ptr != it.m_ptr;
+        }
+
+        bool operator<(const self_type &it) const {
+            return m_ptr < it.m_ptr;
+        }
+
+        bool operator<=(const self_type &it) const {
+            return m_ptr <= it.m_ptr;
+        }
+
+        bool operator>(const self_type &it) const {
+            return m_ptr > it.m_ptr;
+        }
+
+        bool operator>=(const self_type &it) const {
+            return m_ptr >= it.m_ptr;
+        }
+    };
+
+    /**
+     * View of a contiguous array of elements.
+     *
+     * @tparam T element type, which is const for a read-only view
+     */
+    template<typename T>
+    class span {
+    public:
+        typedef size_t size_type;
+        typedef ptrdiff_t diff_type;
+        typedef T val_type;
+        typedef T &reference;
+        typedef T *pointer;
+#ifdef WLIB_CHECKED_ITERATORS
+        typedef span_iterator<T> iterator;
+#else
+        typedef T *iterator;
+#endif
+
+    private:
+        T *m_data;
+        size_type m_size;
+
+    public:
+        span()
+                : m_data(nullptr),
+                  m_size(0) {
+        }
+
+        span(T *data, size_type size)
+                : m_data(data),
+                  m_size(size) {
+        }
+
+        template<size_t N>
+        span(T (&array)[N])
+                : m_data(array),
+                  m_size(N) {
+        }
+
+        /**
+         * Conversion from a view of mutable elements.
+         */
+        template<typename U, typename = typename enable_if<is_same<const U, T>::value>::type>
+        span(const span<U> &s)
+                : m_data(s.data()),
+                  m_size(s.size()) {
+        }
+
+        T *data() const {
+            return m_data;
+        }
+
+        size_type size() const {
+            return m_size;
+        }
+
+        size_type size_bytes() const {
+            return m_size * sizeof(T);
+        }
+
+        bool empty() const {
+            return m_size == 0;
+        }
+
+        /**
+         * Access an element without bounds checking.
+         */
+        reference operator[](size_type i) const {
+            return m_data[i];
+        }
+
+        reference front() const {
+            return m_data[0];
+        }
+
+        reference back() const {
+            return m_data[m_size - 1];
+        }
+
+#ifdef WLIB_CHECKED_ITERATORS
+        iterator begin() const {
+            return iterator(m_data, m_data, m_data + m_size);
+        }
+
+        iterator end() const {
+            return iterator(m_data + m_size, m_data, m_data + m_size);
+        }
+#else
+        iterator begin() const {
+            return m_data;
+        }
+
+        iterator end() const {
+            return m_data + m_size;
+        }
+#endif
+
+        /**
+         * Make a view of part of this span. If @p pos is out of
+         * bounds, the result is empty, and if the length runs past
+         * the end, the result ends with this span.
+         *
+         * @param pos   starting position
+         * @param count number of elements
+         * @return the subspan
+         */
+        span<T> subspan(size_type pos, size_type count = static_cast<size_type>(-1)) const {
+            if (pos >= m_size) {
+                return span<T>(m_data + m_size, 0);
+            }
+            if (count > m_size - pos) {
+                count = m_size - pos;
+            }
+            return span<T>(m_data + pos, count);
+        }
+
+        /**
+         * @return a view of the first elements, at most all of them
+         */
+        span<T> first(size_type count) const {
+            return span<T>(m_data, count < m_size ? count : m_size);
+        }
+
+        /**
+         * @return a view of the last elements, at most all of them
+         */
+        span<T> last(size_type count) const {
+            return count < m_size ? span<T>(m_data + m_size - count, count) : *this;
+        }
+    };
+
+    template<typename T>
+    span<T> make_span(T *data, size_t size) {
+        return span<T>(data, size);
+    }
+
+    template<typename T, size_t N>
+    span<T> make_span(T (&array)[N]) {
+        return span<T>(array);
+    }
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_SPAN_H
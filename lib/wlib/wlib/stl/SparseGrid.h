@@ -0,0 +1,498 @@
+/**
+ * @file SparseGrid.h
+ * @brief Sparse two-dimensional grid built from dense tiles.
+ *
+ * The grid is divided into square tiles of @code 2^TileBits @endcode
+ * cells per side. Tiles are only allocated once a cell inside them is
+ * written, and are indexed through an @code open_map @endcode keyed by
+ * the packed tile coordinates. Reads of cells in unallocated tiles
+ * return the grid's unknown value without allocating.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_SPARSEGRID_H
+#define EMBEDDEDCPLUSPLUS_SPARSEGRID_H
+
+#include <stdint.h>
+
+#include <wlib/stl/OpenMap.h>
+#include <wlib/memory>
+
+namespace wlp {
+
+    /**
+     * Hash function for packed tile coordinates. Packed keys place
+     * the tile x coordinate in the upper half, which the default
+     * integer cast hash would discard, so both halves are mixed.
+     */
+    struct __sparse_grid_hash {
+        uint32_t operator()(uint32_t key) const {
+            key ^= key >> 16;
+            key *= 0x45d9f3bu;
+            key ^= key >> 16;
+            return key;
+        }
+    };
+
+    /**
+     * Iterator over the allocated tiles of a sparse grid. Tiles
+     * are visited in no particular order.
+     *
+     * @tparam val_t    cell value type
+     * @tparam MapIt    backing map iterator type
+     * @tparam TileBits log2 of the tile side length
+     */
+    template<typename val_t, typename MapIt, uint8_t TileBits>
+    class SparseGridTileIterator {
+    public:
+        typedef SparseGridTileIterator<val_t, MapIt, TileBits> self_type;
+        typedef uint32_t size_type;
+        typedef val_t val_type;
+
+        SparseGridTileIterator()
+                : m_it() {}
+
+        explicit SparseGridTileIterator(const MapIt &it)
+                : m_it(it) {}
+
+        /**
+         * @return x coordinate of the first cell in the tile
+         */
+        size_type x() const {
+            return (m_it.key() >> 16) << TileBits;
+        }
+
+        /**
+         * @return y coordinate of the first cell in the tile
+         */
+        size_type y() const {
+            return (m_it.key() & 0xffffu) << TileBits;
+        }
+
+        /**
+         * @return the tile cells in row-major order, indexed
+         * by @code (x - tile x) << TileBits | (y - tile y) @endcode
+         */
+        val_t *data() const {
+            return *m_it;
+        }
+
+        val_t *operator*() const {
+            return *m_it;
+        }
+
+        self_type &operator++() {
+            ++m_it;
+            return *this;
+        }
+
+        self_type operator++(int) {
+            self_type tmp = *this;
+            ++m_it;
+            return tmp;
+        }
+
+        bool operator==(const self_type &it) const {
+            return m_it == it.m_it;
+        }
+
+        bool operator!=(const self_type &it) const {
+            return m_it != it.m_it;
+        }
+
+    private:
+        MapIt m_it;
+    };
+
+    /**
+     * Sparse grid of cells backed by lazily allocated dense tiles.
+     * The grid remembers the last tile that was accessed so runs of
+     * accesses that stay inside a tile skip the map lookup.
+     *
+     * Each axis is limited to @code max_side @endcode cells so that
+     * tile coordinates pack into 32 bits; larger grids are clamped.
+     *
+     * @tparam val_t    cell value type
+     * @tparam TileBits log2 of the tile side length
+     */
+    template<typename val_t, uint8_t TileBits = 4>
+    class sparse_grid {
+        static_assert(TileBits > 0 && TileBits <= 8, "Tile side must be between 2 and 256 cells");
+
+    public:
+        typedef uint32_t size_type;
+        typedef val_t val_type;
+        typedef sparse_grid<val_t, TileBits> grid_type;
+        typedef open_map<uint32_t, val_t *, __sparse_grid_hash> map_type;
+        typedef SparseGridTileIterator<val_t, typename map_type::iterator, TileBits> iterator;
+        typedef SparseGridTileIterator<const val_t, typename map_type::const_iterator, TileBits> const_iterator;
+
+        /**
+         * Number of cells along each side of a tile.
+         */
+        static constexpr size_type tile_side = static_cast<size_type>(1u << TileBits);
+        /**
+         * Number of cells in a tile.
+         */
+        static constexpr size_type tile_area = tile_side * tile_side;
+        /**
+         * Largest number of cells along each axis. Tile coordinates
+         * take 16 bits each, and the last tile along both axes would
+         * pack to the key that marks an empty tile cache, so it is
+         * left out.
+         */
+        static constexpr size_type max_side = static_cast<size_type>(0xffffu << TileBits);
+
+    private:
+        static constexpr size_type tile_mask = tile_side - 1;
+        static constexpr uint32_t no_tile = 0xffffffffu;
+
+        /**
+         * Tile lookup by packed tile coordinate.
+         */
+        map_type m_tiles;
+        /**
+         * Value reported for cells of unallocated tiles.
+         */
+        val_t m_unknown;
+        size_type m_x;
+        size_type m_y;
+
+        /**
+         * Key and data of the most recently accessed tile. The
+         * cache does not change the logical contents of the grid
+         * so it is updated from const accessors.
+         */
+        mutable uint32_t m_cache_key;
+        mutable val_t *m_cache_tile;
+
+    public:
+        /**
+         * Create an empty grid. No tiles are allocated.
+         *
+         * @param x       number of cells along x, at most @code max_side @endcode
+         * @param y       number of cells along y, at most @code max_side @endcode
+         * @param unknown value of cells that have not been written
+         * @param n       initial capacity of the tile map
+         */
+        sparse_grid(size_type x, size_type y, const val_t &unknown = val_t(), size_type n = 16)
+                : m_tiles(n),
+                  m_unknown(unknown),
+                  m_x(x < max_side ? x : max_side),
+                  m_y(y < max_side ? y : max_side),
+                  m_cache_key(no_tile),
+                  m_cache_tile(nullptr) {}
+
+        sparse_grid(const grid_type &) = delete;
+
+        sparse_grid(grid_type &&grid)
+                : m_tiles(move(grid.m_tiles)),
+                  m_unknown(move(grid.m_unknown)),
+                  m_x(grid.m_x),
+                  m_y(grid.m_y),
+                  m_cache_key(grid.m_cache_key),
+                  m_cache_tile(grid.m_cache_tile) {
+            grid.m_x = 0;
+            grid.m_y = 0;
+            grid.m_cache_key = no_tile;
+            grid.m_cache_tile = nullptr;
+        }
+
+        ~sparse_grid() {
+            release_tiles();
+        }
+
+    private:
+        static uint32_t tile_key(size_type x, size_type y) {
+            return ((x >> TileBits) << 16) | (y >> TileBits);
+        }
+
+        static size_type tile_offset(size_type x, size_type y) {
+            return ((x & tile_mask) << TileBits) | (y & tile_mask);
+        }
+
+        void release_tiles() {
+            for (typename map_type::iterator it = m_tiles.begin(); it != m_tiles.end(); ++it) {
+                destroy<val_t[]>(*it);
+            }
+            m_cache_key = no_tile;
+            m_cache_tile = nullptr;
+        }
+
+        /**
+         * Find the tile with the given key without allocating.
+         *
+         * @param key packed tile coordinate
+         * @return the tile data or null if it is not allocated
+         */
+        val_t *find_tile(uint32_t key) const {
+            if (key == m_cache_key) {
+                return m_cache_tile;
+            }
+            typename map_type::const_iterator it = m_tiles.find(key);
+            if (it == m_tiles.end()) {
+                return nullptr;
+            }
+            m_cache_key = key;
+            m_cache_tile = *it;
+            return m_cache_tile;
+        }
+
+        /**
+         * Find the tile with the given key, allocating and filling
+         * it with the unknown value if it does not exist.
+         *
+         * @param key packed tile coordinate
+         * @return the tile data
+         */
+        val_t *obtain_tile(uint32_t key) {
+            val_t *tile = find_tile(key);
+            if (tile) {
+                return tile;
+            }
+            tile = create<val_t[]>(tile_area);
+            for (size_type i = 0; i < tile_area; ++i) {
+                tile[i] = m_unknown;
+            }
+            m_tiles.insert(key, tile);
+            m_cache_key = key;
+            m_cache_tile = tile;
+            return tile;
+        }
+
+    public:
+        size_type x() const {
+            return m_x;
+        }
+
+        size_type y() const {
+            return m_y;
+        }
+
+        /**
+         * @return the value reported for unwritten cells
+         */
+        const val_t &unknown() const {
+            return m_unknown;
+        }
+
+        /**
+         * @return the number of allocated tiles
+         */
+        size_type tile_count() const {
+            return static_cast<size_type>(m_tiles.size());
+        }
+
+        /**
+         * @return whether the coordinate lies inside the grid
+         */
+        bool in_bounds(size_type x, size_type y) const {
+            return x < m_x && y < m_y;
+        }
+
+        /**
+         * @return whether the tile containing the cell is allocated
+         */
+        bool allocated(size_type x, size_type y) const {
+            return find_tile(tile_key(x, y)) != nullptr;
+        }
+
+        /**
+         * Estimate the heap memory held by the grid: tile data,
+         * map nodes, and the map bucket array.
+         *
+         * @return approximate number of bytes used
+         */
+        size_t memory_usage() const {
+            return m_tiles.size() * (tile_area * sizeof(val_t) + sizeof(typename map_type::table_type::element_type))
+                   + m_tiles.capacity() * sizeof(void *);
+        }
+
+        /**
+         * Read a cell. Cells outside the grid or inside unallocated
+         * tiles read as the unknown value.
+         *
+         * @param x cell x coordinate
+         * @param y cell y coordinate
+         * @return the cell value
+         */
+        const val_t &get(size_type x, size_type y) const {
+            if (!in_bounds(x, y)) {
+                return m_unknown;
+            }
+            const val_t *tile = find_tile(tile_key(x, y));
+            return tile ? tile[tile_offset(x, y)] : m_unknown;
+        }
+
+        /**
+         * Obtain a writable reference to a cell, allocating its tile
+         * if needed. The coordinate must be inside the grid.
+         *
+         * @param x cell x coordinate
+         * @param y cell y coordinate
+         * @return reference to the cell
+         */
+        val_t &at(size_type x, size_type y) {
+            return obtain_tile(tile_key(x, y))[tile_offset(x, y)];
+        }
+
+        /**
+         * Write a cell. Writes outside the grid are ignored.
+         *
+         * @param x   cell x coordinate
+         * @param y   cell y coordinate
+         * @param val value to write
+         */
+        void set(size_type x, size_type y, const val_t &val) {
+            if (in_bounds(x, y)) {
+                at(x, y) = val;
+            }
+        }
+
+        /**
+         * Visit every cell on the line from @code (x0, y0) @endcode to
+         * @code (x1, y1) @endcode, inclusive, using Bresenham's algorithm.
+         * The visitor is called as @code f(cell, x, y, last) @endcode where
+         * @code last @endcode is true only for the end cell. Cells outside
+         * the grid are skipped. Tiles are looked up once per tile crossed.
+         *
+         * @param x0 start x
+         * @param y0 start y
+         * @param x1 end x
+         * @param y1 end y
+         * @param f  cell visitor
+         */
+        template<typename F>
+        void for_each_on_line(size_type x0, size_type y0, size_type x1, size_type y1, F f);
+
+        /**
+         * Write a value to every cell on a line.
+         */
+        void line(size_type x0, size_type y0, size_type x1, size_type y1, const val_t &val) {
+            for_each_on_line(x0, y0, x1, y1, [&val](val_t &cell, size_type, size_type, bool) {
+                cell = val;
+            });
+        }
+
+        /**
+         * Apply a sensor ray: every cell between the origin and the hit
+         * point is written as free space and the hit cell as occupied.
+         *
+         * @param x0       sensor x
+         * @param y0       sensor y
+         * @param x1       hit x
+         * @param y1       hit y
+         * @param free_val value for cells the ray passed through
+         * @param hit_val  value for the cell the ray ended on
+         */
+        void raycast(size_type x0, size_type y0, size_type x1, size_type y1,
+                     const val_t &free_val, const val_t &hit_val) {
+            for_each_on_line(x0, y0, x1, y1, [&free_val, &hit_val](val_t &cell, size_type, size_type, bool last) {
+                cell = last ? hit_val : free_val;
+            });
+        }
+
+        /**
+         * Release every tile so that all cells read as unknown.
+         */
+        void clear() {
+            release_tiles();
+            m_tiles.clear();
+        }
+
+        iterator begin() {
+            return iterator(m_tiles.begin());
+        }
+
+        iterator end() {
+            return iterator(m_tiles.end());
+        }
+
+        const_iterator begin() const {
+            return const_iterator(m_tiles.begin());
+        }
+
+        const_iterator end() const {
+            return const_iterator(m_tiles.end());
+        }
+
+        grid_type &operator=(const grid_type &) = delete;
+
+        grid_type &operator=(grid_type &&grid) {
+            if (this == &grid) {
+                return *this;
+            }
+            release_tiles();
+            m_tiles = move(grid.m_tiles);
+            m_unknown = move(grid.m_unknown);
+            m_x = grid.m_x;
+            m_y = grid.m_y;
+            m_cache_key = grid.m_cache_key;
+            m_cache_tile = grid.m_cache_tile;
+            grid.m_x = 0;
+            grid.m_y = 0;
+            grid.m_cache_key = no_tile;
+            grid.m_cache_tile = nullptr;
+            return *this;
+        }
+
+        void swap(grid_type &grid) {
+            m_tiles.swap(grid.m_tiles);
+            wlp::swap(m_unknown, grid.m_unknown);
+            wlp::swap(m_x, grid.m_x);
+            wlp::swap(m_y, grid.m_y);
+            wlp::swap(m_cache_key, grid.m_cache_key);
+            wlp::swap(m_cache_tile, grid.m_cache_tile);
+        }
+    };
+
+    template<typename val_t, uint8_t TileBits>
+    constexpr typename sparse_grid<val_t, TileBits>::size_type sparse_grid<val_t, TileBits>::tile_side;
+
+    template<typename val_t, uint8_t TileBits>
+    constexpr typename sparse_grid<val_t, TileBits>::size_type sparse_grid<val_t, TileBits>::tile_area;
+
+    template<typename val_t, uint8_t TileBits>
+    constexpr typename sparse_grid<val_t, TileBits>::size_type sparse_grid<val_t, TileBits>::max_side;
+
+    template<typename val_t, uint8_t TileBits>
+    template<typename F>
+    void sparse_grid<val_t, TileBits>
+    ::for_each_on_line(size_type x0, size_type y0, size_type x1, size_type y1, F f) {
+        int32_t x = static_cast<int32_t>(x0);
+        int32_t y = static_cast<int32_t>(y0);
+        const int32_t ex = static_cast<int32_t>(x1);
+        const int32_t ey = static_cast<int32_t>(y1);
+        const int32_t dx = ex > x ? ex - x : x - ex;
+        const int32_t dy = ey > y ? ey - y : y - ey;
+        const int32_t sx = x < ex ? 1 : -1;
+        const int32_t sy = y < ey ? 1 : -1;
+        int32_t err = dx - dy;
+        for (;;) {
+            const bool last = x == ex && y == ey;
+            const size_type cx = static_cast<size_type>(x);
+            const size_type cy = static_cast<size_type>(y);
+            if (x >= 0 && y >= 0 && in_bounds(cx, cy)) {
+                f(obtain_tile(tile_key(cx, cy))[tile_offset(cx, cy)], cx, cy, last);
+            }
+            if (last) {
+                return;
+            }
+            const int32_t e2 = 2 * err;
+            if (e2 > -dy) {
+                err -= dy;
+                x += sx;
+            }
+            if (e2 < dx) {
+                err += dx;
+                y += sy;
+            }
+        }
+    }
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_SPARSEGRID_H
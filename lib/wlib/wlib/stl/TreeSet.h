@@ -125,6 +125,10 @@ namespace wlp {
             return *this;
         }
 
+        void swap(set_type &set) noexcept {
+            m_table.swap(set.m_table);
+        }
+
     };
 
 }
@@ -19,6 +19,7 @@
 #define EMBEDDEDCPLUSPLUS_TUPLE_H
 
 #include <wlib/tmp/IntegralConstant.h>
+#include <wlib/stl/Helper.h>
 #include <wlib/stl/Pair.h>
 #include <wlib/type_traits>
 
@@ -128,59 +129,6 @@ namespace wlp {
 
     };
 
-    /**
-     * An index sequence is a container object for
-     * an index pack and is needed to expand the index
-     * pack to instantiate tuples.
-     * @tparam Indices the index pack to expand
-     */
-    template<int... Indices>
-    struct IndexSequence {
-        using type = IndexSequence<Indices...>;
-    };
-
-    /**
-     * This type is used in the creation of an index
-     * sequence and appends an index to the sequence.
-     * This is the undefined base type.
-     * @tparam I index to append
-     * @tparam Sequence index sequence to append to
-     */
-    template<int I, typename Sequence>
-    struct AppendIndexSequence;
-
-    /**
-     * Append an index to a index sequence pack.
-     * This template specialization creates an
-     * index sequence with the appended index
-     * and the existing index sequence.
-     * @tparam I index to append
-     * @tparam Indices existing index pack
-     */
-    template<int I, int... Indices>
-    struct AppendIndexSequence<I, IndexSequence<Indices...>>
-            : IndexSequence<Indices..., I> {
-    };
-
-    /**
-     * Recursive type instantiates an index sequence
-     * with value up to N.
-     * @tparam N the current index to append
-     */
-    template<int N>
-    struct MakeIndexSequence
-            : AppendIndexSequence<N - 1, typename MakeIndexSequence<N - 1>::type>::type {
-    };
-
-    /**
-     * Base case type creates an index sequence
-     * with one value.
-     */
-    template<>
-    struct MakeIndexSequence<1>
-            : IndexSequence<0> {
-    };
-
     /**
      * Recursive type contains the type in a type pack
      * at a certain index.
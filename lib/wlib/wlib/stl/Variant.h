@@ -0,0 +1,398 @@
+/**
+ * @file Variant.h
+ * @brief Tagged union of a fixed list of types.
+ *
+ * A variant holds a value of exactly one of its alternative types in
+ * storage inside the variant, sized and aligned for the largest
+ * alternative, and the index of the alternative it holds. Copies,
+ * moves, and destruction look up the held alternative's routine in a
+ * table generated from the alternatives, so each costs one indexed
+ * call regardless of the number of alternatives. Visitation of a
+ * variant with a few alternatives branches on the index instead, so
+ * the visitor's calls are inlined, and uses a generated table of the
+ * visitor's calls otherwise.
+ *
+ * A variant of trivially copyable alternatives is itself trivially
+ * copyable and destructible, so containers of such variants copy
+ * them as bytes and the elements of an @code array_list @endcode of
+ * them are stored contiguously like plain structs.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_VARIANT_H
+#define EMBEDDEDCPLUSPLUS_VARIANT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <wlib/stl/Helper.h>
+#include <wlib/stl/Tuple.h>
+#include <wlib/tmp/Declval.h>
+#include <wlib/memory>
+#include <wlib/type_traits>
+
+namespace wlp {
+
+    /**
+     * The largest size of a pack of types.
+     */
+    template<typename... Types>
+    struct __variant_size : integral_constant<size_t, 0> {
+    };
+
+    template<typename Head, typename... Tail>
+    struct __variant_size<Head, Tail...> : integral_constant<size_t,
+            (sizeof(Head) > __variant_size<Tail...>::value ? sizeof(Head) : __variant_size<Tail...>::value)> {
+    };
+
+    /**
+     * Whether every type of a pack is trivially copyable, which also
+     * means trivially destructible.
+     */
+    template<typename... Types>
+    struct __variant_trivial : true_type {
+    };
+
+    template<typename Head, typename... Tail>
+    struct __variant_trivial<Head, Tail...> : integral_constant<bool,
+            __is_trivially_copyable(Head) && __variant_trivial<Tail...>::value> {
+    };
+
+    /**
+     * Copy, move, and destroy routines of one alternative, on untyped
+     * storage.
+     */
+    template<typename T>
+    struct __variant_ops {
+        static void copy(void *dst, const void *src) {
+            new(dst) T(*static_cast<const T *>(src));
+        }
+
+        static void move(void *dst, void *src) {
+            new(dst) T(wlp::move(*static_cast<T *>(src)));
+        }
+
+        static void destroy(void *p) {
+            static_cast<T *>(p)->~T();
+        }
+    };
+
+    /**
+     * Tables of the routines of each alternative, by index.
+     */
+    template<typename... Types>
+    struct __variant_table {
+        typedef void (*copy_fn)(void *, const void *);
+        typedef void (*move_fn)(void *, void *);
+        typedef void (*destroy_fn)(void *);
+
+        static copy_fn copy(uint8_t i) {
+            static const copy_fn fns[] = {&__variant_ops<Types>::copy...};
+            return fns[i];
+        }
+
+        static move_fn move(uint8_t i) {
+            static const move_fn fns[] = {&__variant_ops<Types>::move...};
+            return fns[i];
+        }
+
+        static destroy_fn destroy(uint8_t i) {
+            static const destroy_fn fns[] = {&__variant_ops<Types>::destroy...};
+            return fns[i];
+        }
+    };
+
+    /**
+     * Storage of a variant. The copy and move constructors, the
+     * assignments, and the destructor are left implicit when every
+     * alternative is trivially copyable, which keeps them trivial.
+     */
+    template<bool Trivial, typename... Types>
+    class __variant_storage {
+    protected:
+        alignas(Types...) unsigned char m_data[__variant_size<Types...>::value];
+        uint8_t m_index;
+
+        void destroy() {
+        }
+    };
+
+    template<typename... Types>
+    class __variant_storage<false, Types...> {
+    protected:
+        typedef __variant_table<Types...> table;
+        typedef __variant_storage<false, Types...> storage_type;
+
+        alignas(Types...) unsigned char m_data[__variant_size<Types...>::value];
+        uint8_t m_index;
+
+        void destroy() {
+            table::destroy(m_index)(m_data);
+        }
+
+        __variant_storage() {
+        }
+
+        __variant_storage(const storage_type &s)
+                : m_index(s.m_index) {
+            table::copy(m_index)(m_data, s.m_data);
+        }
+
+        __variant_storage(storage_type &&s)
+                : m_index(s.m_index) {
+            table::move(m_index)(m_data, s.m_data);
+        }
+
+        ~__variant_storage() {
+            destroy();
+        }
+
+        storage_type &operator=(const storage_type &s) {
+            if (this != &s) {
+                destroy();
+                m_index = s.m_index;
+                table::copy(m_index)(m_data, s.m_data);
+            }
+            return *this;
+        }
+
+        storage_type &operator=(storage_type &&s) {
+            if (this != &s) {
+                destroy();
+                m_index = s.m_index;
+                table::move(m_index)(m_data, s.m_data);
+            }
+            return *this;
+        }
+    };
+
+    /**
+     * A value of one of a list of types. Each type may appear in the
+     * list once. A variant always holds a value; a default constructed
+     * variant holds a value initialized first alternative.
+     *
+     * @tparam Types the alternatives
+     */
+    template<typename... Types>
+    class variant : public __variant_storage<__variant_trivial<Types...>::value, Types...> {
+        static_assert(sizeof...(Types) > 0 && sizeof...(Types) < 256, "Variant must have 1 to 255 alternatives");
+
+        typedef __variant_storage<__variant_trivial<Types...>::value, Types...> base_type;
+
+    public:
+        typedef variant<Types...> variant_type;
+
+        /**
+         * @tparam T an alternative
+         * @return the index of the alternative in the list
+         */
+        template<typename T>
+        static constexpr uint8_t index_of() {
+            return static_cast<uint8_t>(find<T, Types...>());
+        }
+
+        variant() {
+            typedef TypeAtIndexType<0, Types...> first_type;
+            new(this->m_data) first_type();
+            this->m_index = 0;
+        }
+
+        /**
+         * Hold a value of the alternative of its type.
+         */
+        template<typename T, typename = typename enable_if<
+                count<typename decay<T>::type, Types...>() == 1
+        >::type>
+        variant(T &&value) {
+            typedef typename decay<T>::type type;
+            new(this->m_data) type(forward<T>(value));
+            this->m_index = index_of<type>();
+        }
+
+        /**
+         * @return the index of the held alternative
+         */
+        uint8_t index() const {
+            return this->m_index;
+        }
+
+        /**
+         * @return true if the variant holds the alternative
+         */
+        template<typename T>
+        bool holds() const {
+            return this->m_index == index_of<T>();
+        }
+
+        /**
+         * Replace the held value with a new value of an alternative,
+         * constructed in place.
+         *
+         * @return the new value
+         */
+        template<typename T, typename... Args>
+        T &emplace(Args &&... args) {
+            static_assert(count<T, Types...>() == 1, "Type must be a unique alternative");
+            this->destroy();
+            T *value = new(this->m_data) T(forward<Args>(args)...);
+            this->m_index = index_of<T>();
+            return *value;
+        }
+
+        /**
+         * Replace the held value with a value of the alternative of
+         * its type.
+         */
+        template<typename T, typename = typename enable_if<
+                count<typename decay<T>::type, Types...>() == 1
+        >::type>
+        variant_type &operator=(T &&value) {
+            emplace<typename decay<T>::type>(forward<T>(value));
+            return *this;
+        }
+
+        /**
+         * @return the storage of the held value
+         */
+        void *data() {
+            return this->m_data;
+        }
+
+        const void *data() const {
+            return this->m_data;
+        }
+    };
+
+    /**
+     * @pre the variant holds the alternative
+     * @return the held value
+     */
+    template<typename T, typename... Types>
+    T &get(variant<Types...> &v) {
+        return *static_cast<T *>(v.data());
+    }
+
+    template<typename T, typename... Types>
+    const T &get(const variant<Types...> &v) {
+        return *static_cast<const T *>(v.data());
+    }
+
+    /**
+     * @return the held value if the variant holds the alternative,
+     *         otherwise null
+     */
+    template<typename T, typename... Types>
+    T *get_if(variant<Types...> *v) {
+        return v->template holds<T>() ? static_cast<T *>(v->data()) : nullptr;
+    }
+
+    template<typename T, typename... Types>
+    const T *get_if(const variant<Types...> *v) {
+        return v->template holds<T>() ? static_cast<const T *>(v->data()) : nullptr;
+    }
+
+    /**
+     * Result of calling a visitor on an alternative, which may be const
+     * qualified.
+     */
+    template<typename F, typename T>
+    using __visit_result = decltype(declval<F &>()(declval<T &>()));
+
+    /**
+     * Table of a visitor's calls on each alternative.
+     */
+    template<typename R, typename F, typename... Types>
+    struct __variant_visit {
+        typedef R (*call_fn)(F &, void *);
+
+        template<typename T>
+        static R call(F &f, void *p) {
+            return f(*static_cast<T *>(p));
+        }
+
+        static R apply(F &f, void *p, uint8_t i) {
+            static const call_fn fns[] = {&call<Types>...};
+            return fns[i](f, p);
+        }
+    };
+
+    /**
+     * Calls a visitor on the alternative at an index by comparing the
+     * index against each alternative from the I-th to the last.
+     */
+    template<size_t I, size_t Last>
+    struct __variant_branch {
+        template<typename R, typename F, typename... Types>
+        static R apply(F &f, void *p, uint8_t i) {
+            if (i == I) {
+                return f(*static_cast<TypeAtIndexType<I, Types...> *>(p));
+            }
+            return __variant_branch<I + 1, Last>::template apply<R, F, Types...>(f, p, i);
+        }
+    };
+
+    template<size_t Last>
+    struct __variant_branch<Last, Last> {
+        template<typename R, typename F, typename... Types>
+        static R apply(F &f, void *p, uint8_t) {
+            return f(*static_cast<TypeAtIndexType<Last, Types...> *>(p));
+        }
+    };
+
+    enum : size_t {
+        /**
+         * Largest number of alternatives visited by branches rather
+         * than through the table.
+         */
+        __variant_branch_limit = 8
+    };
+
+    /**
+     * Call a visitor on the held value at storage, as the alternative at
+     * an index. A few alternatives are told apart with branches, which
+     * the compiler turns into a jump table or a short chain of compares
+     * with the visitor's calls inlined. Beyond that, the call goes
+     * through the generated table of calls, one per alternative.
+     */
+    template<typename R, typename F, typename... Types>
+    R __variant_dispatch(F &f, void *p, uint8_t i, true_type) {
+        return __variant_branch<0, sizeof...(Types) - 1>::template apply<R, F, Types...>(f, p, i);
+    }
+
+    template<typename R, typename F, typename... Types>
+    R __variant_dispatch(F &f, void *p, uint8_t i, false_type) {
+        return __variant_visit<R, F, Types...>::apply(f, p, i);
+    }
+
+    template<typename R, typename F, typename... Types>
+    R __variant_dispatch(F &f, void *p, uint8_t i) {
+        typedef integral_constant<bool, sizeof...(Types) <= __variant_branch_limit> branch;
+        return __variant_dispatch<R, F, Types...>(f, p, i, branch());
+    }
+
+    /**
+     * Call a function on the held value. The function is called with
+     * a reference to the value's alternative type and must return the
+     * same type for every alternative.
+     *
+     * @param f the visitor, such as a struct with an overload for each
+     *          alternative
+     * @param v the variant
+     * @return the visitor's result
+     */
+    template<typename F, typename... Types, typename R = __visit_result<F, TypeAtIndexType<0, Types...>>>
+    R visit(F &&f, variant<Types...> &v) {
+        return __variant_dispatch<R, F, Types...>(f, v.data(), v.index());
+    }
+
+    template<typename F, typename... Types, typename R = __visit_result<F, const TypeAtIndexType<0, Types...>>>
+    R visit(F &&f, const variant<Types...> &v) {
+        return __variant_dispatch<R, F, const Types...>(f, const_cast<void *>(v.data()), v.index());
+    }
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_VARIANT_H
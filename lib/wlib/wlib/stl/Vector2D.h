@@ -132,6 +132,20 @@ namespace wlp {
             };
         };
 
+        vector2d<val_t> operator*(const val_t &b) const {
+            return {
+                static_cast<val_t>(m_x * b),
+                static_cast<val_t>(m_y * b)
+            };
+        }
+
+        vector2d<val_t> operator/(const val_t &b) const {
+            return {
+                static_cast<val_t>(m_x / b),
+                static_cast<val_t>(m_y / b)
+            };
+        }
+
         val_t dot(const vector2d<val_t> &v) const {
             return m_x * v.m_x + m_y * v.m_y;
         }
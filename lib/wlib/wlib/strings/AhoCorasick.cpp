@@ -0,0 +1,357 @@
+/**
+ * @file AhoCorasick.cpp
+ * @brief Construction of the Aho-Corasick automaton tables.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <wlib/stl/Helper.h>
+#include <wlib/strings/AhoCorasick.h>
+#include <wlib/memory>
+
+namespace wlp {
+
+    namespace {
+
+        const uint32_t no_state = 0xffffffffu;
+
+    }
+
+    aho_corasick::aho_corasick()
+            : m_bytes(),
+              m_offsets(),
+              m_classes(0),
+              m_states(0),
+              m_dense(0),
+              m_mode(automatic),
+              m_compiled(false),
+              m_delta(1),
+              m_edge_begin(1),
+              m_edge_class(1),
+              m_edge_target(1),
+              m_fail(1),
+              m_out_begin(1),
+              m_out(1),
+              m_dict(1) {
+        memset(m_class, 0, sizeof(m_class));
+        m_offsets.push_back(0u);
+    }
+
+    aho_corasick::aho_corasick(aho_corasick &&ac)
+            : m_bytes(move(ac.m_bytes)),
+              m_offsets(move(ac.m_offsets)),
+              m_classes(ac.m_classes),
+              m_states(ac.m_states),
+              m_dense(ac.m_dense),
+              m_mode(ac.m_mode),
+              m_compiled(ac.m_compiled),
+              m_delta(move(ac.m_delta)),
+              m_edge_begin(move(ac.m_edge_begin)),
+              m_edge_class(move(ac.m_edge_class)),
+              m_edge_target(move(ac.m_edge_target)),
+              m_fail(move(ac.m_fail)),
+              m_out_begin(move(ac.m_out_begin)),
+              m_out(move(ac.m_out)),
+              m_dict(move(ac.m_dict)) {
+        memcpy(m_class, ac.m_class, sizeof(m_class));
+        // the moved-from lists have no storage and hold no patterns
+        ac.m_classes = 0;
+        ac.m_states = 0;
+        ac.m_dense = 0;
+        ac.m_mode = automatic;
+        ac.m_compiled = false;
+    }
+
+    void aho_corasick::reset() {
+        m_delta = array_list<uint32_t>(1);
+        m_edge_begin = array_list<uint32_t>(1);
+        m_edge_class = array_list<uint16_t>(1);
+        m_edge_target = array_list<uint32_t>(1);
+        m_fail = array_list<uint32_t>(1);
+        m_out_begin = array_list<uint32_t>(1);
+        m_out = array_list<uint32_t>(1);
+        m_dict = array_list<uint32_t>(1);
+        memset(m_class, 0, sizeof(m_class));
+        m_classes = 0;
+        m_states = 0;
+        m_dense = 0;
+        m_mode = automatic;
+        m_compiled = false;
+    }
+
+    void aho_corasick::clear() {
+        reset();
+        m_bytes = array_list<uint8_t>();
+        m_offsets = array_list<uint32_t>();
+        m_offsets.push_back(0u);
+    }
+
+    int32_t aho_corasick::add(const char *pattern, size_type len) {
+        if (m_compiled || len == 0) {
+            return -1;
+        }
+        if (m_offsets.empty()) {
+            m_offsets.push_back(0u);
+        }
+        for (size_type i = 0; i < len; ++i) {
+            m_bytes.push_back(static_cast<uint8_t>(pattern[i]));
+        }
+        m_offsets.push_back(static_cast<uint32_t>(m_bytes.size()));
+        return static_cast<int32_t>(m_offsets.size() - 2);
+    }
+
+    void aho_corasick::compile(mode_type mode, size_type table_budget) {
+        if (m_compiled) {
+            return;
+        }
+        const uint32_t patterns = static_cast<uint32_t>(pattern_count());
+
+        // Bytes absent from every pattern share class 0, unless every
+        // byte value appears.
+        bool used[256] = {};
+        for (size_type i = 0; i < m_bytes.size(); ++i) {
+            used[m_bytes[i]] = true;
+        }
+        uint32_t distinct = 0;
+        for (uint32_t b = 0; b < 256; ++b) {
+            distinct += used[b] ? 1u : 0u;
+        }
+        m_classes = distinct == 256 ? 0u : 1u;
+        for (uint32_t b = 0; b < 256; ++b) {
+            m_class[b] = static_cast<uint16_t>(used[b] ? m_classes++ : 0u);
+        }
+
+        // Build the trie with sorted child lists.
+        array_list<uint32_t> first_child(64);
+        array_list<uint32_t> next_sibling(64);
+        array_list<uint16_t> state_class(64);
+        array_list<uint32_t> end_state(patterns + 1);
+        first_child.push_back(no_state);
+        next_sibling.push_back(no_state);
+        state_class.push_back(static_cast<uint16_t>(0));
+        for (uint32_t p = 0; p < patterns; ++p) {
+            uint32_t s = 0;
+            for (uint32_t i = m_offsets[p]; i < m_offsets[p + 1]; ++i) {
+                const uint16_t c = m_class[m_bytes[i]];
+                uint32_t *link = &first_child[s];
+                while (*link != no_state && state_class[*link] < c) {
+                    link = &next_sibling[*link];
+                }
+                if (*link == no_state || state_class[*link] != c) {
+                    const uint32_t t = static_cast<uint32_t>(first_child.size());
+                    const uint32_t next = *link;
+                    first_child.push_back(no_state);
+                    next_sibling.push_back(next);
+                    state_class.push_back(c);
+                    // the lists may have moved
+                    link = &first_child[s];
+                    while (*link != next) {
+                        link = &next_sibling[*link];
+                    }
+                    *link = t;
+                }
+                s = *link;
+            }
+            end_state.push_back(s);
+        }
+        m_states = static_cast<uint32_t>(first_child.size());
+
+        // Renumber the states in breadth-first order, so that parents
+        // and failure link targets come before a state.
+        array_list<uint32_t> order(m_states);
+        array_list<uint32_t> rank(m_states);
+        for (uint32_t s = 0; s < m_states; ++s) {
+            rank.push_back(0u);
+        }
+        order.push_back(0u);
+        for (uint32_t q = 0; q < order.size(); ++q) {
+            for (uint32_t t = first_child[order[q]]; t != no_state; t = next_sibling[t]) {
+                rank[t] = static_cast<uint32_t>(order.size());
+                order.push_back(t);
+            }
+        }
+        auto child = [&](uint32_t s, uint32_t c) -> uint32_t {
+            for (uint32_t t = first_child[order[s]]; t != no_state; t = next_sibling[t]) {
+                if (state_class[t] == c) {
+                    return rank[t];
+                }
+            }
+            return no_state;
+        };
+
+        // Group pattern IDs by end state.
+        m_out_begin = array_list<uint32_t>(m_states + 1);
+        for (uint32_t s = 0; s <= m_states; ++s) {
+            m_out_begin.push_back(0u);
+        }
+        for (uint32_t p = 0; p < patterns; ++p) {
+            ++m_out_begin[rank[end_state[p]] + 1];
+        }
+        for (uint32_t s = 0; s < m_states; ++s) {
+            m_out_begin[s + 1] += m_out_begin[s];
+        }
+        m_out = array_list<uint32_t>(patterns + 1);
+        for (uint32_t p = 0; p < patterns; ++p) {
+            m_out.push_back(0u);
+        }
+        {
+            array_list<uint32_t> fill(m_states);
+            for (uint32_t s = 0; s < m_states; ++s) {
+                fill.push_back(m_out_begin[s]);
+            }
+            for (uint32_t p = 0; p < patterns; ++p) {
+                m_out[fill[rank[end_state[p]]]++] = p;
+            }
+        }
+
+        // Failure and dictionary links.
+        array_list<uint32_t> fail(m_states);
+        m_dict = array_list<uint32_t>(m_states);
+        for (uint32_t s = 0; s < m_states; ++s) {
+            fail.push_back(0u);
+            m_dict.push_back(0u);
+        }
+        for (uint32_t s = 0; s < m_states; ++s) {
+            for (uint32_t u = first_child[order[s]]; u != no_state; u = next_sibling[u]) {
+                const uint32_t t = rank[u];
+                const uint32_t c = state_class[u];
+                uint32_t f = 0;
+                if (s != 0) {
+                    f = fail[s];
+                    uint32_t g;
+                    while ((g = child(f, c)) == no_state && f != 0) {
+                        f = fail[f];
+                    }
+                    f = g == no_state ? 0u : g;
+                }
+                fail[t] = f;
+                m_dict[t] = m_out_begin[f] != m_out_begin[f + 1] ? f : m_dict[f];
+            }
+        }
+
+        // Pick the number of full rows. Row offsets of a full table
+        // must fit below the output flag.
+        const size_type fit = MIN(table_budget / (m_classes * sizeof(uint32_t)),
+                                  static_cast<size_type>(state_mask / m_classes));
+        if (mode == automatic) {
+            mode = fit >= m_states ? dfa : compact;
+        }
+        if (mode == dfa && static_cast<size_type>(m_states) * m_classes > state_mask) {
+            mode = compact;
+        }
+        m_mode = mode;
+        m_dense = m_mode == dfa ? m_states : static_cast<uint32_t>(MAX(MIN(fit, m_states), static_cast<size_type>(1)));
+        const uint32_t scale = m_mode == dfa ? m_classes : 1u;
+        auto target = [this, scale](uint32_t t) -> uint32_t {
+            const bool out = m_out_begin[t] != m_out_begin[t + 1] || m_dict[t] != 0;
+            return t * scale | (out ? static_cast<uint32_t>(output_flag) : 0u);
+        };
+
+        // Full rows, resolving missing edges through the failure link,
+        // whose row is complete by then.
+        const size_type cells = static_cast<size_type>(m_dense) * m_classes;
+        m_delta = array_list<uint32_t>(cells);
+        for (size_type i = 0; i < cells; ++i) {
+            m_delta.push_back(0u);
+        }
+        for (uint32_t s = 0; s < m_dense; ++s) {
+            uint32_t *row = m_delta.data() + static_cast<size_type>(s) * m_classes;
+            if (s != 0) {
+                memcpy(row, m_delta.data() + static_cast<size_type>(fail[s]) * m_classes,
+                       m_classes * sizeof(uint32_t));
+            }
+            for (uint32_t u = first_child[order[s]]; u != no_state; u = next_sibling[u]) {
+                row[state_class[u]] = target(rank[u]);
+            }
+        }
+
+        // Edge lists and failure links of the other states.
+        const uint32_t sparse = m_states - m_dense;
+        m_edge_begin = array_list<uint32_t>(sparse + 1);
+        m_edge_class = array_list<uint16_t>(sparse + 1);
+        m_edge_target = array_list<uint32_t>(sparse + 1);
+        m_fail = array_list<uint32_t>(sparse + 1);
+        for (uint32_t s = m_dense; s < m_states; ++s) {
+            m_edge_begin.push_back(static_cast<uint32_t>(m_edge_class.size()));
+            for (uint32_t u = first_child[order[s]]; u != no_state; u = next_sibling[u]) {
+                m_edge_class.push_back(state_class[u]);
+                m_edge_target.push_back(target(rank[u]));
+            }
+            m_fail.push_back(fail[s]);
+        }
+        m_edge_begin.push_back(static_cast<uint32_t>(m_edge_class.size()));
+        m_compiled = true;
+    }
+
+    aho_corasick::size_type aho_corasick::memory_usage() const {
+        return sizeof(aho_corasick)
+               + m_delta.capacity() * sizeof(uint32_t)
+               + m_edge_begin.capacity() * sizeof(uint32_t)
+               + m_edge_class.capacity() * sizeof(uint16_t)
+               + m_edge_target.capacity() * sizeof(uint32_t)
+               + m_fail.capacity() * sizeof(uint32_t)
+               + m_out_begin.capacity() * sizeof(uint32_t)
+               + m_out.capacity() * sizeof(uint32_t)
+               + m_dict.capacity() * sizeof(uint32_t);
+    }
+
+    int32_t aho_corasick::find_first(const char *text, size_type len, size_type *end) const {
+        if (!m_compiled) {
+            return -1;
+        }
+        const uint8_t *data = reinterpret_cast<const uint8_t *>(text);
+        uint32_t next = 0;
+        for (size_type i = 0; i < len; ++i) {
+            uint32_t state;
+            if (m_mode == dfa) {
+                next = m_delta[(next & state_mask) + m_class[data[i]]];
+                state = (next & state_mask) / m_classes;
+            } else {
+                next = step_compact(next & state_mask, m_class[data[i]]);
+                state = next & state_mask;
+            }
+            if (next & output_flag) {
+                if (m_out_begin[state] == m_out_begin[state + 1]) {
+                    state = m_dict[state];
+                }
+                if (end) {
+                    *end = i + 1;
+                }
+                return static_cast<int32_t>(m_out[m_out_begin[state]]);
+            }
+        }
+        return -1;
+    }
+
+    aho_corasick &aho_corasick::operator=(aho_corasick &&ac) {
+        if (this != &ac) {
+            aho_corasick tmp(move(ac));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    void aho_corasick::swap(aho_corasick &ac) noexcept {
+        m_bytes.swap(ac.m_bytes);
+        m_offsets.swap(ac.m_offsets);
+        for (size_type b = 0; b < 256; ++b) {
+            wlp::swap(m_class[b], ac.m_class[b]);
+        }
+        wlp::swap(m_classes, ac.m_classes);
+        wlp::swap(m_states, ac.m_states);
+        wlp::swap(m_dense, ac.m_dense);
+        wlp::swap(m_mode, ac.m_mode);
+        wlp::swap(m_compiled, ac.m_compiled);
+        m_delta.swap(ac.m_delta);
+        m_edge_begin.swap(ac.m_edge_begin);
+        m_edge_class.swap(ac.m_edge_class);
+        m_edge_target.swap(ac.m_edge_target);
+        m_fail.swap(ac.m_fail);
+        m_out_begin.swap(ac.m_out_begin);
+        m_out.swap(ac.m_out);
+        m_dict.swap(ac.m_dict);
+    }
+
+}
@@ -0,0 +1,334 @@
+/**
+ * @file AhoCorasick.h
+ * @brief Multi-pattern string matching with an Aho-Corasick automaton.
+ *
+ * Patterns are added, then compiled into flat tables indexed by byte
+ * class, where bytes that appear in no pattern share one class. Small
+ * automatons are compiled to a full transition table so that a scan
+ * costs one table load per byte. Large ones keep full rows only for
+ * the states closest to the root, where a scan spends most of its
+ * time, and sorted trie edges with failure links for the rest. Either
+ * way a text is scanned once for every pattern.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_AHOCORASICK_H
+#define EMBEDDEDCPLUSPLUS_AHOCORASICK_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include <wlib/stl/ArrayList.h>
+#include <wlib/strings/String.h>
+#include <wlib/utility>
+
+namespace wlp {
+
+    /**
+     * Aho-Corasick automaton over byte strings. Matches are reported
+     * in order of their end position, and matches ending at the same
+     * position are reported longest first. Overlapping matches and
+     * patterns contained in other patterns are all reported.
+     *
+     * Patterns may not be added after compiling, except by clearing
+     * the automaton.
+     */
+    class aho_corasick {
+    public:
+        typedef size_t size_type;
+
+        /**
+         * Table layout chosen when compiling.
+         */
+        enum mode_type : uint8_t {
+            /**
+             * Choose the full table if it fits the table budget, and
+             * the compact layout otherwise.
+             */
+            automatic = 0,
+            /**
+             * Full transition table, one load per scanned byte.
+             */
+            dfa = 1,
+            /**
+             * Full rows for as many states as fit the table budget,
+             * nearest to the root first, and for at least the root.
+             * Other states follow trie edges and failure links.
+             */
+            compact = 2
+        };
+
+        /**
+         * Default size limit in bytes of the transition rows.
+         */
+        enum : size_t {
+            default_table_budget = 64 * 1024
+        };
+
+    private:
+        enum : uint32_t {
+            /**
+             * Set on a transition whose target state reports matches.
+             */
+            output_flag = 0x80000000u,
+            state_mask = 0x7fffffffu
+        };
+
+        /**
+         * Concatenated pattern bytes and the offset of each pattern.
+         */
+        array_list<uint8_t> m_bytes;
+        array_list<uint32_t> m_offsets;
+
+        /**
+         * Byte to class map and number of classes.
+         */
+        uint16_t m_class[256];
+        uint32_t m_classes;
+        uint32_t m_states;
+        /**
+         * States are numbered in breadth-first order, and those below
+         * this count have a full transition row.
+         */
+        uint32_t m_dense;
+        mode_type m_mode;
+        bool m_compiled;
+
+        /**
+         * Transitions of a dense state s are at s * classes. In DFA
+         * mode each holds the offset of the target row, and in compact
+         * mode the target state, flagged if the target reports matches.
+         */
+        array_list<uint32_t> m_delta;
+        /**
+         * Trie edges of each state past the dense ones, sorted by
+         * class, as ranges of the edge arrays holding flagged target
+         * states, and the failure link of each of those states.
+         */
+        array_list<uint32_t> m_edge_begin;
+        array_list<uint16_t> m_edge_class;
+        array_list<uint32_t> m_edge_target;
+        array_list<uint32_t> m_fail;
+        /**
+         * Patterns ending at each state, as ranges of the output
+         * array, and the nearest state along the failure links
+         * that also has patterns ending at it, or zero.
+         */
+        array_list<uint32_t> m_out_begin;
+        array_list<uint32_t> m_out;
+        array_list<uint32_t> m_dict;
+
+        /**
+         * Report the matches of a state entered at text position i.
+         */
+        template<typename F>
+        void report(uint32_t state, size_type i, F &f) const {
+            do {
+                for (uint32_t k = m_out_begin[state]; k < m_out_begin[state + 1]; ++k) {
+                    f(static_cast<size_type>(m_out[k]), i + 1);
+                }
+                state = m_dict[state];
+            } while (state != 0);
+        }
+
+        /**
+         * Follow one byte in compact mode.
+         *
+         * @return the flagged target state
+         */
+        uint32_t step_compact(uint32_t state, uint32_t cls) const {
+            const uint32_t *begin = m_edge_begin.data();
+            const uint16_t *classes = m_edge_class.data();
+            while (state >= m_dense) {
+                const uint32_t s = state - m_dense;
+                for (uint32_t e = begin[s]; e < begin[s + 1]; ++e) {
+                    if (classes[e] == cls) {
+                        return m_edge_target[e];
+                    }
+                }
+                state = m_fail[s];
+            }
+            return m_delta[state * m_classes + cls];
+        }
+
+        void reset();
+
+    public:
+        aho_corasick();
+
+        aho_corasick(const aho_corasick &) = delete;
+
+        aho_corasick(aho_corasick &&ac);
+
+        /**
+         * Add a pattern. Empty patterns are ignored, and patterns
+         * cannot be added to a compiled automaton.
+         *
+         * @return the pattern ID reported on matches, which counts
+         * up from zero, or -1 if the pattern was not added
+         */
+        int32_t add(const char *pattern, size_type len);
+
+        int32_t add(const char *pattern) {
+            return add(pattern, strlen(pattern));
+        }
+
+        int32_t add(const dynamic_string &pattern) {
+            return add(pattern.c_str(), pattern.length());
+        }
+
+        template<size_t tSize>
+        int32_t add(const static_string<tSize> &pattern) {
+            return add(pattern.c_str(), pattern.length());
+        }
+
+        /**
+         * Build the automaton from the added patterns.
+         *
+         * @param mode         the table layout to use
+         * @param table_budget in automatic mode, the largest full
+         *                     transition table in bytes
+         */
+        void compile(mode_type mode = automatic, size_type table_budget = default_table_budget);
+
+        /**
+         * Remove all patterns and return to building mode.
+         */
+        void clear();
+
+        bool compiled() const {
+            return m_compiled;
+        }
+
+        /**
+         * @return the table layout in use, or automatic if the
+         * automaton is not compiled
+         */
+        mode_type mode() const {
+            return m_mode;
+        }
+
+        size_type pattern_count() const {
+            return m_offsets.empty() ? 0 : m_offsets.size() - 1;
+        }
+
+        size_type pattern_length(size_type id) const {
+            return m_offsets[id + 1] - m_offsets[id];
+        }
+
+        /**
+         * @return the number of automaton states, or zero if not compiled
+         */
+        size_type state_count() const {
+            return m_states;
+        }
+
+        /**
+         * @return the number of states with a full transition row
+         */
+        size_type dense_state_count() const {
+            return m_dense;
+        }
+
+        /**
+         * @return bytes used by the compiled tables
+         */
+        size_type memory_usage() const;
+
+        /**
+         * Scan a text for every pattern. The function is called for
+         * each match with the pattern ID and the position one past the
+         * end of the match in the text.
+         *
+         * @param text the text bytes
+         * @param len  length of the text
+         * @param f    function of (size_type id, size_type end)
+         * @return the number of matches
+         */
+        template<typename F>
+        size_type scan(const char *text, size_type len, F &&f) const {
+            if (!m_compiled) {
+                return 0;
+            }
+            const uint8_t *data = reinterpret_cast<const uint8_t *>(text);
+            const uint32_t *delta = m_delta.data();
+            size_type count = 0;
+            auto counted = [&f, &count](size_type id, size_type end) {
+                ++count;
+                f(id, end);
+            };
+            uint32_t next = 0;
+            if (m_mode == dfa) {
+                for (size_type i = 0; i < len; ++i) {
+                    next = delta[(next & state_mask) + m_class[data[i]]];
+                    if (next & output_flag) {
+                        report((next & state_mask) / m_classes, i, counted);
+                    }
+                }
+            } else {
+                for (size_type i = 0; i < len; ++i) {
+                    next = step_compact(next & state_mask, m_class[data[i]]);
+                    if (next & output_flag) {
+                        report(next & state_mask, i, counted);
+                    }
+                }
+            }
+            return count;
+        }
+
+        template<typename F>
+        size_type scan(const char *text, F &&f) const {
+            return scan(text, strlen(text), forward<F>(f));
+        }
+
+        template<typename F>
+        size_type scan(const dynamic_string &text, F &&f) const {
+            return scan(text.c_str(), text.length(), forward<F>(f));
+        }
+
+        template<size_t tSize, typename F>
+        size_type scan(const static_string<tSize> &text, F &&f) const {
+            return scan(text.c_str(), text.length(), forward<F>(f));
+        }
+
+        /**
+         * Find the first match in a text, stopping the scan there.
+         *
+         * @param text the text bytes
+         * @param len  length of the text
+         * @param end  if not null, receives the position one past the
+         *             end of the match
+         * @return the ID of the longest pattern ending at the earliest
+         * match position, or -1 if no pattern occurs in the text
+         */
+        int32_t find_first(const char *text, size_type len, size_type *end = nullptr) const;
+
+        int32_t find_first(const char *text) const {
+            return find_first(text, strlen(text));
+        }
+
+        int32_t find_first(const dynamic_string &text) const {
+            return find_first(text.c_str(), text.length());
+        }
+
+        template<size_t tSize>
+        int32_t find_first(const static_string<tSize> &text) const {
+            return find_first(text.c_str(), text.length());
+        }
+
+        aho_corasick &operator=(const aho_corasick &) = delete;
+
+        aho_corasick &operator=(aho_corasick &&ac);
+
+        /**
+         * Exchange the patterns and tables of two automata.
+         */
+        void swap(aho_corasick &ac) noexcept;
+    };
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_AHOCORASICK_H
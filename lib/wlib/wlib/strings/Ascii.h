@@ -0,0 +1,203 @@
+/**
+ * @file Ascii.h
+ * @brief ASCII case conversion and case-insensitive string kernels.
+ *
+ * Case is folded for the ASCII letters only; every other byte,
+ * including the bytes of multi-byte UTF-8 sequences, is left as it
+ * is, so folding never breaks an encoded character. The kernels work
+ * on eight bytes at a time by finding the letters of a whole word
+ * with a few additions and masks.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_ASCII_H
+#define EMBEDDEDCPLUSPLUS_ASCII_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include <wlib/strings/StringView.h>
+
+namespace wlp {
+
+    /**
+     * @return the high bit of each byte of a word between two
+     * characters inclusive, excluding non-ASCII bytes
+     */
+    inline uint64_t __ascii_range_mask(uint64_t w, uint8_t first, uint8_t last) {
+        const uint64_t ones = 0x0101010101010101ULL;
+        const uint64_t heptets = w & 0x7f7f7f7f7f7f7f7fULL;
+        const uint64_t at_least_first = heptets + ones * static_cast<uint8_t>(0x80 - first);
+        const uint64_t above_last = heptets + ones * static_cast<uint8_t>(0x7f - last);
+        return (at_least_first ^ above_last) & ~w & 0x8080808080808080ULL;
+    }
+
+    inline uint64_t __ascii_lower_word(uint64_t w) {
+        return w | (__ascii_range_mask(w, 'A', 'Z') >> 2);
+    }
+
+    inline uint64_t __ascii_upper_word(uint64_t w) {
+        return w & ~(__ascii_range_mask(w, 'a', 'z') >> 2);
+    }
+
+    inline char ascii_lower(char c) {
+        return c >= 'A' && c <= 'Z' ? static_cast<char>(c | 0x20) : c;
+    }
+
+    inline char ascii_upper(char c) {
+        return c >= 'a' && c <= 'z' ? static_cast<char>(c & ~0x20) : c;
+    }
+
+    /**
+     * Convert the ASCII letters of a buffer to lower case in place.
+     *
+     * @param str the characters
+     * @param len the number of characters
+     */
+    inline void ascii_to_lower(char *str, size_t len) {
+        for (; len >= 8; str += 8, len -= 8) {
+            uint64_t w;
+            memcpy(&w, str, sizeof(w));
+            w = __ascii_lower_word(w);
+            memcpy(str, &w, sizeof(w));
+        }
+        for (; len; ++str, --len) {
+            *str = ascii_lower(*str);
+        }
+    }
+
+    /**
+     * Convert the ASCII letters of a buffer to upper case in place.
+     *
+     * @param str the characters
+     * @param len the number of characters
+     */
+    inline void ascii_to_upper(char *str, size_t len) {
+        for (; len >= 8; str += 8, len -= 8) {
+            uint64_t w;
+            memcpy(&w, str, sizeof(w));
+            w = __ascii_upper_word(w);
+            memcpy(str, &w, sizeof(w));
+        }
+        for (; len; ++str, --len) {
+            *str = ascii_upper(*str);
+        }
+    }
+
+    inline void ascii_to_lower(dynamic_string &str) {
+        ascii_to_lower(str.c_str(), str.length());
+    }
+
+    inline void ascii_to_upper(dynamic_string &str) {
+        ascii_to_upper(str.c_str(), str.length());
+    }
+
+    template<size_t tSize>
+    inline void ascii_to_lower(static_string<tSize> &str) {
+        ascii_to_lower(str.c_str(), str.length());
+    }
+
+    template<size_t tSize>
+    inline void ascii_to_upper(static_string<tSize> &str) {
+        ascii_to_upper(str.c_str(), str.length());
+    }
+
+    /**
+     * @return whether two strings are equal ignoring ASCII case
+     */
+    inline bool equals_ignore_case(const string_view &lhs, const string_view &rhs) {
+        if (lhs.length() != rhs.length()) {
+            return false;
+        }
+        const char *a = lhs.data();
+        const char *b = rhs.data();
+        size_t len = lhs.length();
+        for (; len >= 8; a += 8, b += 8, len -= 8) {
+            uint64_t wa;
+            uint64_t wb;
+            memcpy(&wa, a, sizeof(wa));
+            memcpy(&wb, b, sizeof(wb));
+            if (wa != wb && __ascii_lower_word(wa) != __ascii_lower_word(wb)) {
+                return false;
+            }
+        }
+        for (; len; ++a, ++b, --len) {
+            if (ascii_lower(*a) != ascii_lower(*b)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Compare two strings byte-wise with the ASCII letters in lower
+     * case, ordering a prefix before any longer string it begins.
+     *
+     * @return negative, zero, or positive as the first string is less
+     * than, equal to, or greater than the second
+     */
+    inline int compare_ignore_case(const string_view &lhs, const string_view &rhs) {
+        const char *a = lhs.data();
+        const char *b = rhs.data();
+        size_t len = lhs.length() < rhs.length() ? lhs.length() : rhs.length();
+        // Skip the words that fold equal, then find the difference
+        // within the remaining bytes.
+        for (; len >= 8; a += 8, b += 8, len -= 8) {
+            uint64_t wa;
+            uint64_t wb;
+            memcpy(&wa, a, sizeof(wa));
+            memcpy(&wb, b, sizeof(wb));
+            if (wa != wb && __ascii_lower_word(wa) != __ascii_lower_word(wb)) {
+                break;
+            }
+        }
+        for (; len; ++a, ++b, --len) {
+            const uint8_t ca = static_cast<uint8_t>(ascii_lower(*a));
+            const uint8_t cb = static_cast<uint8_t>(ascii_lower(*b));
+            if (ca != cb) {
+                return ca < cb ? -1 : 1;
+            }
+        }
+        return lhs.length() < rhs.length() ? -1 : (lhs.length() > rhs.length() ? 1 : 0);
+    }
+
+    /**
+     * Hash a string ignoring ASCII case, so that strings equal by
+     * @code equals_ignore_case @endcode hash the same. Each word is
+     * folded and mixed in with one multiplication.
+     *
+     * @tparam IntType the integer return type
+     * @param str the string to hash
+     * @return a hash code of the string
+     */
+    template<class IntType>
+    inline IntType hash_ignore_case(const string_view &str) {
+        const uint64_t mul = 0x9e3779b97f4a7c15ULL;
+        const char *p = str.data();
+        size_t len = str.length();
+        uint64_t h = static_cast<uint64_t>(len) * mul;
+        for (; len >= 8; p += 8, len -= 8) {
+            uint64_t w;
+            memcpy(&w, p, sizeof(w));
+            h = (h ^ __ascii_lower_word(w)) * mul;
+            h ^= h >> 32;
+        }
+        if (len) {
+            // The length is already mixed in, so padding the last
+            // word with zeros is unambiguous.
+            uint64_t w = 0;
+            memcpy(&w, p, len);
+            h = (h ^ __ascii_lower_word(w)) * mul;
+        }
+        h ^= h >> 29;
+        h *= 0xbf58476d1ce4e5b9ULL;
+        h ^= h >> 32;
+        return static_cast<IntType>(h);
+    }
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_ASCII_H
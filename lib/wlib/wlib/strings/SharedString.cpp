@@ -0,0 +1,45 @@
+/**
+ * @file SharedString.cpp
+ * @brief Shared string block management.
+ *
+ * Blocks are allocated as an array of headers so that the header is
+ * aligned; the characters start right after the first one.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <wlib/memory>
+#include <wlib/stl/Hash.h>
+#include <wlib/strings/SharedString.h>
+
+namespace wlp {
+
+    shared_string::rep shared_string::s_empty[2] = {};
+
+    shared_string::rep *shared_string::make(const char *str, size_type len) {
+        if (len == 0) {
+            return s_empty;
+        }
+        rep *r = create<rep[]>(1 + (len + sizeof(rep)) / sizeof(rep));
+        char *buf = chars(r);
+        memcpy(buf, str, len);
+        buf[len] = '\0';
+        uint32_t h = 0;
+        for (size_type i = 0; i < len; ++i) {
+            h = static_cast<uint32_t>(MUL_127(h) + buf[i]);
+        }
+        r->refs = 1;
+        r->length = len;
+        r->hash = h;
+        return r;
+    }
+
+    void shared_string::release() {
+        if (m_rep != s_empty && __atomic_sub_fetch(&m_rep->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+            destroy<rep[]>(m_rep);
+        }
+    }
+
+}
@@ -0,0 +1,246 @@
+/**
+ * @file SharedString.h
+ * @brief Immutable reference counted string.
+ *
+ * A shared string puts its reference count, length, and hash in the
+ * same allocation as its characters. Copying one only increments the
+ * count, so the same configuration string can be stored in many lists
+ * and maps while its characters are allocated once. The characters
+ * are never changed after construction, which makes it safe for
+ * copies to be used from different threads; the count is updated
+ * atomically. The hash is computed when the string is made and is
+ * returned by the hash functor without looking at the characters.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_SHAREDSTRING_H
+#define EMBEDDEDCPLUSPLUS_SHAREDSTRING_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include <wlib/strings/String.h>
+#include <wlib/strings/StringView.h>
+
+namespace wlp {
+
+    class shared_string {
+    public:
+        typedef size_t size_type;
+        typedef ptrdiff_t diff_type;
+        typedef const char *const_iterator;
+
+    private:
+        /**
+         * Block header, followed by the characters and a null
+         * terminator.
+         */
+        struct rep {
+            size_type refs;
+            size_type length;
+            uint32_t hash;
+        };
+
+        rep *m_rep;
+
+        /**
+         * Empty strings point here. The block is never freed and
+         * its count is never touched.
+         */
+        static rep s_empty[2];
+
+        static rep *make(const char *str, size_type len);
+
+        static char *chars(rep *r) {
+            return reinterpret_cast<char *>(r + 1);
+        }
+
+        void retain() const {
+            if (m_rep != s_empty) {
+                __atomic_add_fetch(&m_rep->refs, 1, __ATOMIC_RELAXED);
+            }
+        }
+
+        void release();
+
+    public:
+        shared_string()
+                : m_rep(s_empty) {
+        }
+
+        shared_string(const char *str)
+                : m_rep(make(str, strlen(str))) {
+        }
+
+        shared_string(const char *str, size_type len)
+                : m_rep(make(str, len)) {
+        }
+
+        explicit shared_string(const string_view &str)
+                : m_rep(make(str.data(), str.length())) {
+        }
+
+        explicit shared_string(const dynamic_string &str)
+                : m_rep(make(str.c_str(), str.length())) {
+        }
+
+        /**
+         * Share the characters of another string.
+         */
+        shared_string(const shared_string &str)
+                : m_rep(str.m_rep) {
+            retain();
+        }
+
+        /**
+         * Take the characters of another string, which is left
+         * empty.
+         */
+        shared_string(shared_string &&str) noexcept
+                : m_rep(str.m_rep) {
+            str.m_rep = s_empty;
+        }
+
+        ~shared_string() {
+            release();
+        }
+
+        shared_string &operator=(const shared_string &str) {
+            str.retain();
+            release();
+            m_rep = str.m_rep;
+            return *this;
+        }
+
+        shared_string &operator=(shared_string &&str) noexcept {
+            if (this != &str) {
+                release();
+                m_rep = str.m_rep;
+                str.m_rep = s_empty;
+            }
+            return *this;
+        }
+
+        void swap(shared_string &str) noexcept {
+            rep *tmp = m_rep;
+            m_rep = str.m_rep;
+            str.m_rep = tmp;
+        }
+
+        const char *c_str() const {
+            return chars(m_rep);
+        }
+
+        const char *data() const {
+            return chars(m_rep);
+        }
+
+        size_type length() const {
+            return m_rep->length;
+        }
+
+        size_type size() const {
+            return m_rep->length;
+        }
+
+        bool empty() const {
+            return m_rep->length == 0;
+        }
+
+        /**
+         * @return the number of strings sharing these characters,
+         * or zero for an empty string
+         */
+        size_type use_count() const {
+            return __atomic_load_n(&m_rep->refs, __ATOMIC_RELAXED);
+        }
+
+        /**
+         * @return the hash code computed when the string was made,
+         * which matches @code hash_string @endcode for hash types
+         * up to 32 bits
+         */
+        uint32_t hash() const {
+            return m_rep->hash;
+        }
+
+        /**
+         * Access a character without bounds checking.
+         */
+        char operator[](size_type i) const {
+            return chars(m_rep)[i];
+        }
+
+        const_iterator begin() const {
+            return chars(m_rep);
+        }
+
+        const_iterator end() const {
+            return chars(m_rep) + m_rep->length;
+        }
+
+        string_view view() const {
+            return string_view(chars(m_rep), m_rep->length);
+        }
+
+        operator string_view() const {
+            return view();
+        }
+
+        /**
+         * Strings that share characters are equal without comparing
+         * them, and strings with different lengths or hashes are not.
+         */
+        bool equals(const shared_string &str) const {
+            return m_rep == str.m_rep ||
+                   (m_rep->length == str.m_rep->length &&
+                    m_rep->hash == str.m_rep->hash &&
+                    memcmp(chars(m_rep), chars(str.m_rep), m_rep->length) == 0);
+        }
+
+        /**
+         * Compare byte-wise, with a prefix ordered before any longer
+         * string it begins.
+         */
+        diff_type compare(const shared_string &str) const {
+            return m_rep == str.m_rep ? 0 : view().compare(str.view());
+        }
+
+        /**
+         * @return a dynamic string holding a copy of the characters
+         */
+        dynamic_string to_dynamic_string() const {
+            return dynamic_string(chars(m_rep), m_rep->length);
+        }
+    };
+
+    inline bool operator==(const shared_string &lhs, const shared_string &rhs) {
+        return lhs.equals(rhs);
+    }
+
+    inline bool operator!=(const shared_string &lhs, const shared_string &rhs) {
+        return !lhs.equals(rhs);
+    }
+
+    inline bool operator<(const shared_string &lhs, const shared_string &rhs) {
+        return lhs.compare(rhs) < 0;
+    }
+
+    inline bool operator<=(const shared_string &lhs, const shared_string &rhs) {
+        return lhs.compare(rhs) <= 0;
+    }
+
+    inline bool operator>(const shared_string &lhs, const shared_string &rhs) {
+        return lhs.compare(rhs) > 0;
+    }
+
+    inline bool operator>=(const shared_string &lhs, const shared_string &rhs) {
+        return lhs.compare(rhs) >= 0;
+    }
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_SHAREDSTRING_H
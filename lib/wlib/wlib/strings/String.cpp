@@ -13,11 +13,55 @@
 
 namespace wlp {
 
-    dynamic_string::dynamic_string() :
-        dynamic_string(nullptr, nullptr, 0, 0) {}
+    namespace {
 
-    dynamic_string::dynamic_string(nullptr_t) :
-        dynamic_string(nullptr, nullptr, 0, 0) {}
+        const char empty_buffer[1] = {'\0'};
+
+        /**
+         * The shared empty array is read-only; strings only hold it
+         * through a non-const pointer until they first write.
+         */
+        char *shared_empty() {
+            return const_cast<char *>(empty_buffer);
+        }
+
+        char *heap_allocate(void *, size_t size) {
+            return create<char[]>(size);
+        }
+
+        void heap_deallocate(void *, char *buffer) {
+            destroy<char[]>(buffer);
+        }
+
+        const string_allocator heap_allocator = {heap_allocate, heap_deallocate, nullptr, nullptr};
+
+        const string_allocator *buffer_allocator = &heap_allocator;
+
+        char *allocate(size_t size) {
+            return buffer_allocator->allocate(buffer_allocator->context, size);
+        }
+
+        /**
+         * Free a string buffer through the policy that allocated it,
+         * unless it is the shared empty array.
+         */
+        void release(const string_allocator *owner, char *buffer) {
+            if (buffer != empty_buffer) {
+                owner->deallocate(owner->context, buffer);
+            }
+        }
+
+    }
+
+    dynamic_string::dynamic_string()
+            : m_buffer(shared_empty()),
+              m_len(0),
+              m_alloc(nullptr) {}
+
+    dynamic_string::dynamic_string(nullptr_t)
+            : m_buffer(shared_empty()),
+              m_len(0),
+              m_alloc(nullptr) {}
 
     dynamic_string::dynamic_string(const char *str)
             : dynamic_string(str, nullptr, static_cast<size_type>(strlen(str)), 0) {}
@@ -27,36 +71,48 @@ namespace wlp {
 
     dynamic_string::dynamic_string(size_type len, char *str)
             : m_buffer(str),
-              m_len(len) {}
+              m_len(len),
+              m_alloc(buffer_allocator) {}
 
-    dynamic_string::dynamic_string(const dynamic_string &str) : dynamic_string(str.c_str()) {}
+    dynamic_string::dynamic_string(const dynamic_string &str)
+            : dynamic_string(str.c_str(), nullptr, str.length(), 0) {}
 
     dynamic_string::dynamic_string(dynamic_string &&str) noexcept
             : m_buffer(str.m_buffer),
-              m_len(str.m_len) {
+              m_len(str.m_len),
+              m_alloc(str.m_alloc) {
+        str.m_buffer = shared_empty();
         str.m_len = 0;
-        str.m_buffer = create<char[]>(1);
-        str.m_buffer[0] = '\0';
+        str.m_alloc = nullptr;
     }
 
     dynamic_string::dynamic_string(const char *str1, const char *str2, size_type len1, size_type len2) {
         m_len = len1 + len2;
-        m_buffer = create<char[]>(static_cast<size_type>(m_len + 1));
+        if (m_len == 0) {
+            m_buffer = shared_empty();
+            m_alloc = nullptr;
+            return;
+        }
+        m_buffer = allocate(static_cast<size_type>(m_len + 1));
+        m_alloc = buffer_allocator;
         memcpy(m_buffer, str1, len1);
         memcpy(m_buffer + len1, str2, len2);
         m_buffer[m_len] = '\0';
     }
 
     dynamic_string::~dynamic_string() {
-        if (m_buffer) {
-            destroy<char[]>(m_buffer);
-        }
+        release(m_alloc, m_buffer);
     }
 
     void dynamic_string::set_value(const char *str, size_type len) {
-        if (len > m_len) {
-            destroy<char[]>(m_buffer);
-            m_buffer = create<char[]>(static_cast<size_type>(len + 1));
+        if (len == 0) {
+            clear();
+            return;
+        }
+        if (len >= buffer_capacity()) {
+            release(m_alloc, m_buffer);
+            m_buffer = allocate(static_cast<size_type>(len + 1));
+            m_alloc = buffer_allocator;
         }
         m_len = len;
         memcpy(m_buffer, str, len);
@@ -74,22 +130,47 @@ namespace wlp {
     }
 
     dynamic_string &dynamic_string::operator=(dynamic_string &&str) noexcept {
-        destroy<char[]>(m_buffer);
-        m_buffer = str.m_buffer;
-        m_len = str.m_len;
-        str.m_len = 0;
-        str.m_buffer = create<char[]>(1);
-        str.m_buffer[0] = '\0';
+        if (this != &str) {
+            release(m_alloc, m_buffer);
+            m_buffer = str.m_buffer;
+            m_len = str.m_len;
+            m_alloc = str.m_alloc;
+            str.m_buffer = shared_empty();
+            str.m_len = 0;
+            str.m_alloc = nullptr;
+        }
         return *this;
     }
 
+    void dynamic_string::swap(dynamic_string &str) noexcept {
+        wlp::swap(m_buffer, str.m_buffer);
+        wlp::swap(m_len, str.m_len);
+        wlp::swap(m_alloc, str.m_alloc);
+    }
+
     dynamic_string &dynamic_string::operator=(const char c) {
-        destroy<char[]>(m_buffer);
-        m_buffer = create<char[]>(2);
-        reinterpret_cast<uint16_t *>(m_buffer)[0] = static_cast<uint16_t>(c);
+        const char array[2] = {c, '\0'};
+        set_value(array, 1);
         return *this;
     }
 
+    const string_allocator *dynamic_string::set_allocator(const string_allocator *alloc) {
+        const string_allocator *prev = buffer_allocator;
+        buffer_allocator = alloc ? alloc : &heap_allocator;
+        return prev;
+    }
+
+    const string_allocator *dynamic_string::allocator() {
+        return buffer_allocator;
+    }
+
+    dynamic_string::size_type dynamic_string::buffer_capacity() const {
+        if (m_buffer != empty_buffer && m_alloc->capacity) {
+            return m_alloc->capacity(m_alloc->context, m_buffer);
+        }
+        return static_cast<size_type>(m_len + 1);
+    }
+
     dynamic_string::size_type dynamic_string::length() const {
         return m_len;
     }
@@ -99,12 +180,23 @@ namespace wlp {
     }
 
     void dynamic_string::clear() noexcept {
-        m_buffer[0] = '\0';
-        m_len = 0;
+        if (m_len != 0) {
+            m_buffer[0] = '\0';
+            m_len = 0;
+        }
+    }
+
+    char *dynamic_string::writable_buffer() {
+        if (m_buffer == empty_buffer) {
+            m_buffer = allocate(1);
+            m_alloc = buffer_allocator;
+            m_buffer[0] = '\0';
+        }
+        return m_buffer;
     }
 
     char &dynamic_string::operator[](size_type pos) {
-        return m_buffer[pos];
+        return writable_buffer()[pos];
     }
 
     const char &dynamic_string::operator[](size_type pos) const {
@@ -112,7 +204,8 @@ namespace wlp {
     }
 
     char &dynamic_string::at(size_type pos) {
-        return pos < m_len ? m_buffer[pos] : m_buffer[m_len];
+        char *buffer = writable_buffer();
+        return pos < m_len ? buffer[pos] : buffer[m_len];
     }
 
     const char &dynamic_string::at(size_type pos) const {
@@ -124,7 +217,7 @@ namespace wlp {
     }
 
     char &dynamic_string::front() {
-        return m_buffer[0];
+        return writable_buffer()[0];
     }
 
     const char &dynamic_string::front() const {
@@ -132,7 +225,8 @@ namespace wlp {
     }
 
     char &dynamic_string::back() {
-        return empty() ? m_buffer[0] : m_buffer[m_len - 1];
+        char *buffer = writable_buffer();
+        return empty() ? buffer[0] : buffer[m_len - 1];
     }
 
     const char &dynamic_string::back() const {
@@ -153,12 +247,20 @@ namespace wlp {
     }
 
     dynamic_string &dynamic_string::append(const char *c_str, size_type len) {
+        if (len == 0) {
+            return *this;
+        }
         auto newLength = static_cast<size_type>(m_len + len);
-        char *newBuffer = create<char[]>(newLength + 1);
-        memcpy(newBuffer, m_buffer, m_len);
-        memcpy(newBuffer + m_len, c_str, len);
-        destroy<char[]>(m_buffer);
-        m_buffer = newBuffer;
+        if (newLength < buffer_capacity()) {
+            memcpy(m_buffer + m_len, c_str, len);
+        } else {
+            char *newBuffer = allocate(newLength + 1);
+            memcpy(newBuffer, m_buffer, m_len);
+            memcpy(newBuffer + m_len, c_str, len);
+            release(m_alloc, m_buffer);
+            m_buffer = newBuffer;
+            m_alloc = buffer_allocator;
+        }
 
         m_buffer[newLength] = '\0';
         m_len = newLength;
@@ -194,7 +296,7 @@ namespace wlp {
     }
 
     char *dynamic_string::c_str() {
-        return m_buffer;
+        return writable_buffer();
     }
 
     const char *dynamic_string::c_str() const {
@@ -202,8 +304,9 @@ namespace wlp {
     }
 
     void dynamic_string::resize(size_type len) {
-        if (m_buffer) { destroy<char[]>(m_buffer); }
-        m_buffer = create<char[]>(static_cast<size_type>(len + 1));
+        release(m_alloc, m_buffer);
+        m_buffer = allocate(static_cast<size_type>(len + 1));
+        m_alloc = buffer_allocator;
         m_buffer[0] = '\0';
         m_len = 0;
     }
@@ -214,7 +317,7 @@ namespace wlp {
 
     dynamic_string dynamic_string::substr(size_type pos, size_type length) const {
         length = pos >= m_len ? 0 : MIN(length, m_len - pos);
-        char *newBuffer = create<char[]>(static_cast<size_type>(length + 1));
+        char *newBuffer = allocate(static_cast<size_type>(length + 1));
         memcpy(newBuffer, m_buffer + pos, length);
         newBuffer[length] = '\0';
         return {length, newBuffer};
@@ -15,6 +15,7 @@
 #include <wlib/strings/StringIterator.h>
 #include <wlib/tmp/NullptrType.h>
 #include <wlib/stl/Helper.h>
+#include <wlib/type_traits>
 #include <stdint.h>
 #include <string.h>
 
@@ -25,6 +26,16 @@ namespace wlp {
 
     class dynamic_string;
 
+    /**
+     * A string of at most tSize characters stored inline.
+     *
+     * Characters past the length are kept zero, so static strings are
+     * fully initialized, can be built at compile time from literals,
+     * and are trivially copyable. Small strings compare equal by
+     * comparing their whole buffers.
+     *
+     * @tparam tSize the maximum number of characters
+     */
     template<size_t tSize>
     class static_string {
     public:
@@ -39,31 +50,48 @@ namespace wlp {
         /**
          * Default constructor creates string with no character
          */
-        static_string<tSize>() {
-            clear();
-        }
+        constexpr static_string<tSize>()
+                : m_buffer{},
+                  m_len(0) {}
 
         /**
          * Constructor to nullptr_t is empty string.
          */
-        explicit static_string<tSize>(nullptr_t) {
-            clear();
-        }
+        explicit constexpr static_string<tSize>(nullptr_t)
+                : m_buffer{},
+                  m_len(0) {}
 
         /**
-         * Constructor creates string using static string object
+         * Copy constructor copies the whole object, so that static
+         * strings remain trivially copyable.
          *
          * @param str @code StaticString @endcode object
          */
-        static_string<tSize>(const static_string<tSize> &str)
-                : static_string{str.c_str()} {}
+        static_string<tSize>(const static_string<tSize> &str) = default;
+
+        static_string<tSize>(static_string<tSize> &&str) = default;
+
+        /**
+         * Constructor creates string from a string literal or a
+         * character array, up to the first null character. The string
+         * is built at compile time if the array is a constant.
+         *
+         * @param str character array
+         */
+        template<size_t tLen>
+        explicit constexpr static_string<tSize>(const char (&str)[tLen])
+                : static_string(str, literal_length(str, tLen, 0),
+                                typename MakeIndexSequence<static_cast<int>(tSize)>::type()) {}
 
         /**
-         * Constructor creates string using character array
+         * Constructor creates string using a pointer to a character string
          *
          * @param str char string
          */
-        explicit static_string<tSize>(const char *str)
+        template<typename Ptr, typename = typename enable_if<
+                is_same<Ptr, const char *>::value || is_same<Ptr, char *>::value
+        >::type>
+        explicit static_string<tSize>(Ptr str)
                 : static_string(str, static_cast<size_type>(strlen(str))) {}
 
         /**
@@ -82,7 +110,7 @@ namespace wlp {
         static_string<tSize>(const char *str, size_type len) {
             m_len = MIN(len, tSize);
             memcpy(m_buffer, str, m_len);
-            m_buffer[m_len] = '\0';
+            memset(m_buffer + m_len, 0, tSize + 1 - m_len);
         }
 
         /**
@@ -91,11 +119,7 @@ namespace wlp {
          * @param str @code StaticString @endcode object
          * @return current object
          */
-        static_string<tSize> &operator=(const static_string<tSize> &str) {
-            m_len = str.m_len;
-            memcpy(m_buffer, str.m_buffer, m_len + 1);
-            return *this;
-        }
+        static_string<tSize> &operator=(const static_string<tSize> &str) = default;
 
         /**
          * Assignment operator to copy a Dynamic String
@@ -113,10 +137,23 @@ namespace wlp {
          * @param str string to move
          * @return reference to this string
          */
-        static_string<tSize> &operator=(static_string<tSize> &&str) noexcept {
-            m_len = str.m_len;
-            memcpy(m_buffer, str.m_buffer, m_len + 1);
-            return *this;
+        static_string<tSize> &operator=(static_string<tSize> &&str) = default;
+
+        /**
+         * Exchange the characters of two strings. Since the bytes
+         * past each length are zero, only the longer of the two
+         * lengths needs to be exchanged.
+         *
+         * @param str the string to swap with
+         */
+        void swap(static_string<tSize> &str) noexcept {
+            const size_type len = MAX(m_len, str.m_len);
+            for (size_type i = 0; i < len; ++i) {
+                const char c = m_buffer[i];
+                m_buffer[i] = str.m_buffer[i];
+                str.m_buffer[i] = c;
+            }
+            wlp::swap(m_len, str.m_len);
         }
 
         /**
@@ -126,8 +163,10 @@ namespace wlp {
          * @return current object
          */
         static_string<tSize> &operator=(const char *str) {
+            const size_type old_len = m_len;
             m_len = MIN(static_cast<size_type>(strlen(str)), tSize);
-            memcpy(m_buffer, str, m_len + 1);
+            memcpy(m_buffer, str, m_len);
+            terminate(old_len);
             return *this;
         }
 
@@ -141,8 +180,10 @@ namespace wlp {
             if (tSize == 0) {
                 return *this;
             }
+            const size_type old_len = m_len;
+            m_buffer[0] = c;
             m_len = 1;
-            reinterpret_cast<uint16_t *>(m_buffer)[0] = static_cast<uint16_t>(c);
+            terminate(old_len);
             return *this;
         }
 
@@ -151,7 +192,7 @@ namespace wlp {
          *
          * @return string length
          */
-        size_type length() const {
+        constexpr size_type length() const {
             return m_len;
         }
 
@@ -160,7 +201,7 @@ namespace wlp {
          *
          * @return string capacity
          */
-        size_type capacity() const {
+        constexpr size_type capacity() const {
             return tSize;
         }
 
@@ -169,7 +210,7 @@ namespace wlp {
          *
          * @return if string is empty or not
          */
-        bool empty() const {
+        constexpr bool empty() const {
             return m_len == 0;
         }
 
@@ -177,8 +218,9 @@ namespace wlp {
          * Clears the string such that there are no characters left in it
          */
         void clear() noexcept {
-            m_buffer[0] = '\0';
+            const size_type old_len = m_len;
             m_len = 0;
+            terminate(old_len);
         }
 
         /**
@@ -198,7 +240,7 @@ namespace wlp {
          * @param pos the position of the character
          * @return character at @p pos
          */
-        const char &operator[](size_type pos) const {
+        constexpr const char &operator[](size_type pos) const {
             return at(pos);
         }
 
@@ -223,10 +265,8 @@ namespace wlp {
          * @param pos the position of the character
          * @return character at @p pos
          */
-        const char &at(size_type pos) const {
-            if (pos >= m_len) { return back(); }
-
-            return m_buffer[pos];
+        constexpr const char &at(size_type pos) const {
+            return pos >= m_len ? back() : m_buffer[pos];
         }
 
         /**
@@ -244,9 +284,8 @@ namespace wlp {
          *
          * @return the last character
          */
-        const char &back() const {
-            if (empty()) { return m_buffer[0]; }
-            return m_buffer[m_len - 1];
+        constexpr const char &back() const {
+            return m_len == 0 ? m_buffer[0] : m_buffer[m_len - 1];
         }
 
         /**
@@ -263,7 +302,7 @@ namespace wlp {
          *
          * @return the first character
          */
-        const char &front() const {
+        constexpr const char &front() const {
             return m_buffer[0];
         }
 
@@ -381,7 +420,7 @@ namespace wlp {
             if (m_len == tSize) {
                 return;
             }
-            reinterpret_cast<uint16_t *>(m_buffer + m_len)[0] = static_cast<uint16_t>(c);
+            m_buffer[m_len] = c;
             ++m_len;
         }
 
@@ -421,7 +460,7 @@ namespace wlp {
          *
          * @return character array
          */
-        const char *c_str() const {
+        constexpr const char *c_str() const {
             return m_buffer;
         }
 
@@ -443,7 +482,7 @@ namespace wlp {
             }
             static_string<tSize> sub;
             memcpy(sub.m_buffer, m_buffer + pos, length);
-            sub.m_buffer[length] = '\0';
+            sub.m_len = length;
             return sub;
         }
 
@@ -456,7 +495,42 @@ namespace wlp {
          * @return a signed number based on how strings compare
          */
         diff_type compare(const static_string<tSize> &str) const {
-            return compare(str.c_str());
+            return compare(str.m_buffer, str.m_len);
+        }
+
+        /**
+         * Compare with a character array of known length, byte-wise,
+         * with a prefix ordered before any longer string it begins.
+         *
+         * @param str character array
+         * @param len length of the array
+         * @return a signed number based on how strings compare
+         */
+        diff_type compare(const char *str, size_type len) const {
+            const int c = memcmp(m_buffer, str, MIN(m_len, len));
+            if (c != 0) {
+                return static_cast<diff_type>(c);
+            }
+            return m_len < len ? -1 : (m_len > len ? 1 : 0);
+        }
+
+        /**
+         * Whether two strings are equal, which is decided by their
+         * lengths and then by their characters. The whole buffers of
+         * small strings are compared, which the compiler turns into a
+         * few word comparisons.
+         *
+         * @param str string to compare against
+         * @return true if the strings are equal
+         */
+        bool equals(const static_string<tSize> &str) const {
+            if (m_len != str.m_len) {
+                return false;
+            }
+            if (sizeof(m_buffer) <= 32) {
+                return memcmp(m_buffer, str.m_buffer, sizeof(m_buffer)) == 0;
+            }
+            return memcmp(m_buffer, str.m_buffer, m_len) == 0;
         }
 
         /**
@@ -529,11 +603,11 @@ namespace wlp {
 
         // Comparison operators with static string and dynamic string
         bool operator==(const static_string<tSize> &str) const {
-            return compare(str) == 0;
+            return equals(str);
         }
 
         bool operator!=(const static_string<tSize> &str) const {
-            return compare(str) != 0;
+            return !equals(str);
         }
 
         bool operator>(const static_string<tSize> &str) const {
@@ -582,7 +656,30 @@ namespace wlp {
             size_type min_len = MIN(m_len, len1);
             memcpy(m_buffer, str1, min_len);
             memcpy(m_buffer + min_len, str2, m_len - min_len);
+            memset(m_buffer + m_len, 0, tSize + 1 - m_len);
+        }
+
+        template<int... tIs>
+        constexpr static_string(const char *str, size_type len, IndexSequence<tIs...>)
+                : m_buffer{(static_cast<size_type>(tIs) < len ? str[tIs] : '\0')...},
+                  m_len(MIN(len, tSize)) {}
+
+        /**
+         * @return the length of a string in an array of @p n characters
+         */
+        static constexpr size_type literal_length(const char *str, size_type n, size_type len) {
+            return len == n || str[len] == '\0' ? len : literal_length(str, n, len + 1);
+        }
+
+        /**
+         * Write the null terminator and zero the characters between
+         * the length and a previous, longer length.
+         */
+        void terminate(size_type old_len) {
             m_buffer[m_len] = '\0';
+            if (old_len > m_len) {
+                memset(m_buffer + m_len + 1, 0, old_len - m_len);
+            }
         }
 
         char m_buffer[tSize + 1];
@@ -746,6 +843,26 @@ namespace wlp {
         return {&lhs, rhs.c_str(), 1, rhs.length()};
     }
 
+    /**
+     * Allocation policy for dynamic string buffers. A buffer of at
+     * least @code size @endcode characters is returned by
+     * @code allocate @endcode and given back to @code deallocate @endcode
+     * of the same policy. If @code capacity @endcode is set, it returns
+     * how many characters a buffer can hold, including the null
+     * terminator, so that strings can grow in place; strings assume
+     * nothing past their length otherwise. The context is passed
+     * to each function.
+     */
+    struct string_allocator {
+        char *(*allocate)(void *context, size_t size);
+
+        void (*deallocate)(void *context, char *buffer);
+
+        size_t (*capacity)(void *context, const char *buffer);
+
+        void *context;
+    };
+
     class dynamic_string {
     public:
         // Required types for concept check
@@ -800,6 +917,7 @@ namespace wlp {
 
         /**
          * Move constructor will transfer the underlying string.
+         * The moved-from string is left empty without allocating.
          *
          * @param str the @code DynamicString @endcode to move
          */
@@ -842,6 +960,13 @@ namespace wlp {
          */
         dynamic_string &operator=(dynamic_string &&str) noexcept;
 
+        /**
+         * Exchange the underlying character arrays of two strings.
+         *
+         * @param str the string to swap with
+         */
+        void swap(dynamic_string &str) noexcept;
+
         /**
          * Assignment operator for a single character.
          *
@@ -850,6 +975,23 @@ namespace wlp {
          */
         dynamic_string &operator=(char c);
 
+        /**
+         * Set the policy that allocates the buffers of all dynamic
+         * strings from now on. Each string keeps the policy that
+         * allocated its buffer and frees the buffer through it, so
+         * the policy can be changed while strings hold buffers from
+         * the previous one, which must outlive those buffers.
+         *
+         * @param alloc the new policy, or null for the heap
+         * @return the previous policy
+         */
+        static const string_allocator *set_allocator(const string_allocator *alloc);
+
+        /**
+         * @return the policy that allocates string buffers
+         */
+        static const string_allocator *allocator();
+
         /**
          * Provides current length of string.
          *
@@ -1104,8 +1246,19 @@ namespace wlp {
         }
 
     private:
+        /**
+         * Empty strings that have not needed a buffer, including
+         * default constructed and moved-from strings, point to a
+         * shared read-only empty array that is never freed. Mutable
+         * access gives such a string its own buffer first.
+         */
         char *m_buffer;
         size_type m_len;
+        /**
+         * Policy that allocated the buffer, or null while the string
+         * holds the shared empty array.
+         */
+        const string_allocator *m_alloc;
 
         /**
          * Constructor used by other String constructors to create @code dynamic_string @endcode.
@@ -1120,12 +1273,25 @@ namespace wlp {
         /**
          * Constructor for populating a dynamic_string with a dynamically allocated
          * character array which the string takes ownership of and its length.
+         * The array must come from the current allocation policy.
          *
          * @param str dynamically allocated character array filled with characters
          * @param len length of the string
          */
         dynamic_string(size_type len, char *str);
 
+        /**
+         * @return the number of characters the buffer can hold,
+         * including the null terminator
+         */
+        size_type buffer_capacity() const;
+
+        /**
+         * @return the buffer, after replacing the shared empty array
+         * with an allocated one so that it can be written
+         */
+        char *writable_buffer();
+
         /**
          * Append method used by other public append methods.
          *
@@ -1169,9 +1335,10 @@ namespace wlp {
 
     template<size_t tSize>
     static_string<tSize> &static_string<tSize>::operator=(const dynamic_string &str) {
+        const size_type old_len = m_len;
         m_len = MIN(str.length(), tSize);
         memcpy(m_buffer, str.c_str(), m_len);
-        m_buffer[m_len] = '\0';
+        terminate(old_len);
         return *this;
     }
 
@@ -1187,7 +1354,7 @@ namespace wlp {
 
     template<size_t tSize>
     ptrdiff_t static_string<tSize>::compare(const dynamic_string &str) const {
-        return compare(str.c_str());
+        return compare(str.c_str(), str.length());
     }
 
     // Static Strings
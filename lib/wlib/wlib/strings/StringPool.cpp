@@ -0,0 +1,162 @@
+/**
+ * @file StringPool.cpp
+ * @brief Size-class pool for string buffers.
+ *
+ * A chunk begins with a link to the previously allocated chunk and is
+ * handed out from front to back to blocks of one size class. Free
+ * blocks are linked through their first bytes. Links are copied in
+ * and out with memcpy, since blocks are not aligned.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <string.h>
+
+#include <wlib/memory>
+#include <wlib/strings/StringPool.h>
+
+namespace wlp {
+
+    namespace {
+
+        const size_t link_size = sizeof(char *);
+        const size_t large_header = sizeof(size_t) + 1;
+
+        char *load_link(const char *p) {
+            char *link;
+            memcpy(&link, p, link_size);
+            return link;
+        }
+
+        void store_link(char *p, char *link) {
+            memcpy(p, &link, link_size);
+        }
+
+        /**
+         * @return the smallest size class with blocks of at least
+         * @p size bytes
+         */
+        uint8_t size_class(size_t size) {
+            if (size <= string_pool::min_block) {
+                return 0;
+            }
+            const unsigned width = static_cast<unsigned>(8 * sizeof(unsigned long)) -
+                                   static_cast<unsigned>(__builtin_clzl(static_cast<unsigned long>(size - 1)));
+            return static_cast<uint8_t>(width - 4);
+        }
+
+        size_t block_size(uint8_t cls) {
+            return string_pool::min_block << cls;
+        }
+
+        char *pool_allocate(void *context, size_t size) {
+            return static_cast<string_pool *>(context)->allocate(size);
+        }
+
+        void pool_deallocate(void *context, char *buffer) {
+            static_cast<string_pool *>(context)->deallocate(buffer);
+        }
+
+        size_t pool_capacity(void *context, const char *buffer) {
+            return static_cast<string_pool *>(context)->capacity(buffer);
+        }
+
+    }
+
+    string_pool::string_pool(size_type chunk_size)
+            : m_free{},
+              m_cursor{},
+              m_limit{},
+              m_chunks(nullptr),
+              m_chunk_size(MAX(chunk_size, static_cast<size_type>(link_size + max_block))),
+              m_stats{},
+              m_allocator{pool_allocate, pool_deallocate, pool_capacity, this} {
+    }
+
+    string_pool::~string_pool() {
+        while (m_chunks) {
+            char *next = load_link(m_chunks);
+            destroy<char[]>(m_chunks);
+            m_chunks = next;
+        }
+    }
+
+    char *string_pool::refill(uint8_t cls) {
+        char *chunk = create<char[]>(m_chunk_size);
+        store_link(chunk, m_chunks);
+        m_chunks = chunk;
+        const size_type bsize = block_size(cls);
+        const size_type blocks = (m_chunk_size - link_size) / bsize;
+        m_cursor[cls] = chunk + link_size + bsize;
+        m_limit[cls] = chunk + link_size + blocks * bsize;
+        m_stats.reserved_bytes += m_chunk_size;
+        m_stats.free_bytes += (blocks - 1) * bsize;
+        return chunk + link_size;
+    }
+
+    char *string_pool::allocate(size_type size) {
+        ++m_stats.allocations;
+        m_stats.requested_bytes += size;
+        if (size >= max_block) {
+            const size_type total = large_header + size;
+            char *block = create<char[]>(total);
+            memcpy(block, &size, sizeof(size));
+            block[sizeof(size)] = static_cast<char>(large_class);
+            ++m_stats.large_allocations;
+            m_stats.reserved_bytes += total;
+            m_stats.live_bytes += total;
+            m_stats.granted_bytes += size;
+            return block + large_header;
+        }
+        const uint8_t cls = size_class(size + 1);
+        const size_type bsize = block_size(cls);
+        char *block = m_free[cls];
+        if (block) {
+            m_free[cls] = load_link(block);
+            m_stats.free_bytes -= bsize;
+        } else if (m_cursor[cls] != m_limit[cls]) {
+            block = m_cursor[cls];
+            m_cursor[cls] += bsize;
+            m_stats.free_bytes -= bsize;
+        } else {
+            block = refill(cls);
+        }
+        block[0] = static_cast<char>(cls);
+        m_stats.live_bytes += bsize;
+        m_stats.granted_bytes += bsize - 1;
+        return block + 1;
+    }
+
+    void string_pool::deallocate(char *buffer) {
+        char *block = buffer - 1;
+        const uint8_t cls = static_cast<uint8_t>(block[0]);
+        if (cls == large_class) {
+            block -= sizeof(size_type);
+            size_type size;
+            memcpy(&size, block, sizeof(size));
+            const size_type total = large_header + size;
+            m_stats.reserved_bytes -= total;
+            m_stats.live_bytes -= total;
+            destroy<char[]>(block);
+            return;
+        }
+        const size_type bsize = block_size(cls);
+        store_link(block, m_free[cls]);
+        m_free[cls] = block;
+        m_stats.live_bytes -= bsize;
+        m_stats.free_bytes += bsize;
+    }
+
+    string_pool::size_type string_pool::capacity(const char *buffer) const {
+        const uint8_t cls = static_cast<uint8_t>(buffer[-1]);
+        if (cls == large_class) {
+            size_type size;
+            memcpy(&size, buffer - large_header, sizeof(size));
+            return size;
+        }
+        return block_size(cls) - 1;
+    }
+
+}
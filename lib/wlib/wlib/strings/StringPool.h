@@ -0,0 +1,125 @@
+/**
+ * @file StringPool.h
+ * @brief Size-class pool for string buffers.
+ *
+ * Requests are rounded up to a power of two block size between 16 and
+ * 512 bytes, and each size class keeps a free list of its blocks, so
+ * buffers freed by one string are reused by the next string of about
+ * the same length instead of splitting the heap into odd sized holes.
+ * Blocks are cut from chunks taken from the heap a few kilobytes at a
+ * time. Larger requests go to the heap directly. Each block starts
+ * with a byte holding its size class, which lets a buffer be freed
+ * without its size and lets strings append in place up to the end of
+ * the block.
+ *
+ * The pool is not thread safe, and it must outlive the buffers it
+ * hands out; chunks are only returned to the heap when it is
+ * destroyed.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_STRINGPOOL_H
+#define EMBEDDEDCPLUSPLUS_STRINGPOOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <wlib/strings/String.h>
+
+namespace wlp {
+
+    /**
+     * Byte counts kept by a string pool. Reserved bytes are held from
+     * the heap, in chunks or as large blocks, and live bytes are in
+     * blocks handed out; the difference sits in free lists or in the
+     * untouched end of the newest chunk of each class. Requested and
+     * granted bytes add up every allocation, so their ratio is the
+     * share of block space lost to rounding.
+     */
+    struct string_pool_stats {
+        size_t reserved_bytes;
+        size_t live_bytes;
+        size_t free_bytes;
+        size_t requested_bytes;
+        size_t granted_bytes;
+        size_t allocations;
+        size_t large_allocations;
+    };
+
+    class string_pool {
+    public:
+        typedef size_t size_type;
+
+        enum : size_type {
+            num_classes = 6,
+            min_block = 16,
+            max_block = min_block << (num_classes - 1),
+            default_chunk_size = 4096
+        };
+
+    private:
+        /**
+         * Block layout is the class byte followed by the buffer; large
+         * blocks put their size in front of the class byte.
+         */
+        enum : uint8_t {
+            large_class = 0xff
+        };
+
+        char *m_free[num_classes];
+        char *m_cursor[num_classes];
+        char *m_limit[num_classes];
+        char *m_chunks;
+        size_type m_chunk_size;
+        string_pool_stats m_stats;
+        string_allocator m_allocator;
+
+        char *refill(uint8_t cls);
+
+    public:
+        explicit string_pool(size_type chunk_size = default_chunk_size);
+
+        ~string_pool();
+
+        string_pool(const string_pool &) = delete;
+
+        string_pool &operator=(const string_pool &) = delete;
+
+        /**
+         * @param size the number of characters needed, including the
+         *             null terminator
+         * @return a buffer of at least that many characters
+         */
+        char *allocate(size_type size);
+
+        /**
+         * Return a buffer from this pool to its free list, or to the
+         * heap if it is large.
+         */
+        void deallocate(char *buffer);
+
+        /**
+         * @return the number of characters a buffer from this pool can
+         * hold
+         */
+        size_type capacity(const char *buffer) const;
+
+        const string_pool_stats &stats() const {
+            return m_stats;
+        }
+
+        /**
+         * @return a policy for @code dynamic_string::set_allocator @endcode
+         * that uses this pool
+         */
+        const string_allocator *allocator() const {
+            return &m_allocator;
+        }
+    };
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_STRINGPOOL_H
@@ -0,0 +1,207 @@
+/**
+ * @file StringView.h
+ * @brief Non-owning view of a range of characters.
+ *
+ * A view holds a pointer and a length into memory owned elsewhere,
+ * such as a static string, a dynamic string, or a raw buffer, and is
+ * not null terminated. Taking a view or a subview never allocates or
+ * copies, so views are cheap to pass around and store, but they must
+ * not outlive the characters they refer to.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_STRINGVIEW_H
+#define EMBEDDEDCPLUSPLUS_STRINGVIEW_H
+
+#include <stddef.h>
+#include <string.h>
+
+#include <wlib/strings/String.h>
+
+namespace wlp {
+
+    class string_view {
+    public:
+        typedef size_t size_type;
+        typedef ptrdiff_t diff_type;
+        typedef const char *const_iterator;
+
+    private:
+        const char *m_data;
+        size_type m_len;
+
+    public:
+        string_view()
+                : m_data(""),
+                  m_len(0) {
+        }
+
+        string_view(const char *str)
+                : m_data(str),
+                  m_len(strlen(str)) {
+        }
+
+        string_view(const char *str, size_type len)
+                : m_data(str),
+                  m_len(len) {
+        }
+
+        template<size_t tSize>
+        string_view(const static_string<tSize> &str)
+                : m_data(str.c_str()),
+                  m_len(str.length()) {
+        }
+
+        string_view(const dynamic_string &str)
+                : m_data(str.c_str()),
+                  m_len(str.length()) {
+        }
+
+        const char *data() const {
+            return m_data;
+        }
+
+        size_type length() const {
+            return m_len;
+        }
+
+        size_type size() const {
+            return m_len;
+        }
+
+        bool empty() const {
+            return m_len == 0;
+        }
+
+        /**
+         * Access a character without bounds checking.
+         */
+        char operator[](size_type i) const {
+            return m_data[i];
+        }
+
+        char front() const {
+            return m_data[0];
+        }
+
+        char back() const {
+            return m_data[m_len - 1];
+        }
+
+        const_iterator begin() const {
+            return m_data;
+        }
+
+        const_iterator end() const {
+            return m_data + m_len;
+        }
+
+        /**
+         * Make a view of part of this view. If @p pos is out of
+         * bounds, the result is empty, and if the length runs past
+         * the end, the result ends with this view.
+         *
+         * @param pos    starting position
+         * @param length length of the subview
+         * @return the subview
+         */
+        string_view substr(size_type pos, size_type length = static_cast<size_type>(-1)) const {
+            if (pos >= m_len) {
+                return string_view(m_data + m_len, 0);
+            }
+            if (length > m_len - pos) {
+                length = m_len - pos;
+            }
+            return string_view(m_data + pos, length);
+        }
+
+        /**
+         * Remove characters from the front of the view.
+         */
+        void remove_prefix(size_type n) {
+            n = n < m_len ? n : m_len;
+            m_data += n;
+            m_len -= n;
+        }
+
+        /**
+         * Remove characters from the back of the view.
+         */
+        void remove_suffix(size_type n) {
+            m_len -= n < m_len ? n : m_len;
+        }
+
+        /**
+         * @return the position of the first occurrence of a character
+         * at or after a position, or the length if there is none
+         */
+        size_type find(char c, size_type pos = 0) const {
+            if (pos >= m_len) {
+                return m_len;
+            }
+            const void *p = memchr(m_data + pos, c, m_len - pos);
+            return p ? static_cast<size_type>(static_cast<const char *>(p) - m_data) : m_len;
+        }
+
+        bool starts_with(const string_view &str) const {
+            return str.m_len <= m_len && memcmp(m_data, str.m_data, str.m_len) == 0;
+        }
+
+        bool ends_with(const string_view &str) const {
+            return str.m_len <= m_len && memcmp(m_data + m_len - str.m_len, str.m_data, str.m_len) == 0;
+        }
+
+        /**
+         * Compare byte-wise, with a prefix ordered before any longer
+         * view it begins.
+         *
+         * @return negative, zero, or positive as this view is less
+         * than, equal to, or greater than the other
+         */
+        diff_type compare(const string_view &str) const {
+            const size_type len = m_len < str.m_len ? m_len : str.m_len;
+            const int c = len ? memcmp(m_data, str.m_data, len) : 0;
+            if (c != 0) {
+                return c;
+            }
+            return m_len < str.m_len ? -1 : (m_len > str.m_len ? 1 : 0);
+        }
+
+        /**
+         * @return a dynamic string holding a copy of the characters
+         */
+        dynamic_string to_dynamic_string() const {
+            return dynamic_string(m_data, m_len);
+        }
+    };
+
+    inline bool operator==(const string_view &lhs, const string_view &rhs) {
+        return lhs.length() == rhs.length() && memcmp(lhs.data(), rhs.data(), lhs.length()) == 0;
+    }
+
+    inline bool operator!=(const string_view &lhs, const string_view &rhs) {
+        return !(lhs == rhs);
+    }
+
+    inline bool operator<(const string_view &lhs, const string_view &rhs) {
+        return lhs.compare(rhs) < 0;
+    }
+
+    inline bool operator<=(const string_view &lhs, const string_view &rhs) {
+        return lhs.compare(rhs) <= 0;
+    }
+
+    inline bool operator>(const string_view &lhs, const string_view &rhs) {
+        return lhs.compare(rhs) > 0;
+    }
+
+    inline bool operator>=(const string_view &lhs, const string_view &rhs) {
+        return lhs.compare(rhs) >= 0;
+    }
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_STRINGVIEW_H
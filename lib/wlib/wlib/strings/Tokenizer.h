@@ -0,0 +1,340 @@
+/**
+ * @file Tokenizer.h
+ * @brief Split text into fields without copying.
+ *
+ * A tokenizer walks a text and yields each field as a view into it,
+ * so splitting a line costs no allocations. Fields are separated by
+ * any character of a delimiter set, may be quoted to contain
+ * delimiters, and runs of delimiters may be treated as one, as for
+ * whitespace separated values.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_TOKENIZER_H
+#define EMBEDDEDCPLUSPLUS_TOKENIZER_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include <wlib/stl/ArrayList.h>
+#include <wlib/strings/StringView.h>
+
+namespace wlp {
+
+    /**
+     * Set of delimiter characters and the splitting options that go
+     * with them. Build one per format and share it between tokenizers.
+     *
+     * Sets of up to four delimiters are searched eight bytes at a time
+     * by testing every byte of a word against each delimiter at once;
+     * larger sets look up each byte in a table.
+     */
+    class delimiter_set {
+    public:
+        enum : uint32_t {
+            max_word_delimiters = 4
+        };
+
+    private:
+        bool m_table[256];
+        uint64_t m_probes[max_word_delimiters];
+        uint32_t m_count;
+        char m_quote;
+        bool m_collapse;
+
+        static uint64_t zero_lanes(uint64_t x) {
+            const uint64_t low = 0x7f7f7f7f7f7f7f7fULL;
+            return ~(((x & low) + low) | x | low);
+        }
+
+    public:
+        /**
+         * @return the offset of the first lane set in a word mask
+         */
+        static uint32_t first_lane(uint64_t lanes) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            return static_cast<uint32_t>(__builtin_clzll(lanes)) / 8;
+#else
+            return static_cast<uint32_t>(__builtin_ctzll(lanes)) / 8;
+#endif
+        }
+
+        /**
+         * @return a word mask without its first lane
+         */
+        static uint64_t clear_first_lane(uint64_t lanes) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            return lanes & ~(0x8000000000000000ULL >> __builtin_clzll(lanes));
+#else
+            return lanes & (lanes - 1);
+#endif
+        }
+
+        /**
+         * @param delimiters the delimiter characters
+         * @param quote      character that encloses fields containing
+         *                   delimiters, or zero for none
+         * @param collapse   whether runs of delimiters separate a
+         *                   single pair of fields, and leading and
+         *                   trailing delimiters are ignored
+         */
+        explicit delimiter_set(const char *delimiters, char quote = '\0', bool collapse = false)
+                : m_table(),
+                  m_probes(),
+                  m_count(0),
+                  m_quote(quote),
+                  m_collapse(collapse) {
+            for (const char *d = delimiters; *d; ++d) {
+                const uint8_t c = static_cast<uint8_t>(*d);
+                if (!m_table[c]) {
+                    m_table[c] = true;
+                    if (m_count < max_word_delimiters) {
+                        m_probes[m_count] = 0x0101010101010101ULL * c;
+                    }
+                    ++m_count;
+                }
+            }
+            // Unused probes repeat the first delimiter.
+            for (uint32_t i = m_count; i < max_word_delimiters; ++i) {
+                m_probes[i] = m_probes[0];
+            }
+        }
+
+        bool contains(char c) const {
+            return m_table[static_cast<uint8_t>(c)];
+        }
+
+        char quote() const {
+            return m_quote;
+        }
+
+        bool collapse() const {
+            return m_collapse;
+        }
+
+        /**
+         * @return whether the set is small enough to search by word
+         */
+        bool word_search() const {
+            return m_count != 0 && m_count <= max_word_delimiters;
+        }
+
+        /**
+         * Test the eight bytes at a position, which must all be
+         * readable, for delimiters. Only valid for word searches.
+         *
+         * @return a mask with the high bit of each delimiter lane set
+         */
+        uint64_t match_word(const char *p) const {
+            uint64_t w;
+            memcpy(&w, p, sizeof(w));
+            return zero_lanes(w ^ m_probes[0]) | zero_lanes(w ^ m_probes[1])
+                   | zero_lanes(w ^ m_probes[2]) | zero_lanes(w ^ m_probes[3]);
+        }
+
+        /**
+         * @return the first delimiter in a range, or the range end
+         */
+        const char *find(const char *p, const char *end) const {
+            if (!word_search()) {
+                return find_scalar(p, end);
+            }
+            while (end - p >= 8) {
+                const uint64_t hits = match_word(p);
+                if (hits != 0) {
+                    return p + first_lane(hits);
+                }
+                p += 8;
+            }
+            return find_scalar(p, end);
+        }
+
+        /**
+         * Find the first delimiter one byte at a time.
+         */
+        const char *find_scalar(const char *p, const char *end) const {
+            while (p != end && !m_table[static_cast<uint8_t>(*p)]) {
+                ++p;
+            }
+            return p;
+        }
+
+        /**
+         * @return the first non-delimiter in a range, or the range end
+         */
+        const char *skip(const char *p, const char *end) const {
+            while (p != end && m_table[static_cast<uint8_t>(*p)]) {
+                ++p;
+            }
+            return p;
+        }
+    };
+
+    /**
+     * Splits a text into fields, yielding a view of each field.
+     *
+     * Without collapsing, every delimiter separates two fields, so
+     * "a,,b," has the fields "a", "", "b", and "". An empty text has no
+     * fields. A field starting with the quote character extends to the
+     * matching quote, and its view excludes the quotes; two quotes in a
+     * row inside it stand for one quote but are left as they are in the
+     * view, see @code unescape @endcode. Characters between a closing
+     * quote and the next delimiter are dropped.
+     *
+     * The text and the delimiter set must outlive the tokenizer.
+     */
+    class tokenizer {
+    public:
+        typedef size_t size_type;
+
+    private:
+        const char *m_pos;
+        const char *m_end;
+        const delimiter_set *m_delims;
+        /**
+         * Whether another field follows, which is the case after a
+         * delimiter even at the end of the text.
+         */
+        bool m_more;
+        bool m_quoted;
+
+    public:
+        tokenizer(const string_view &text, const delimiter_set &delims)
+                : m_pos(text.data()),
+                  m_end(text.data() + text.length()),
+                  m_delims(&delims),
+                  m_more(!text.empty()),
+                  m_quoted(false) {
+        }
+
+        /**
+         * Get the next field.
+         *
+         * @param field receives the field
+         * @return false if there are no more fields
+         */
+        bool next(string_view &field) {
+            const delimiter_set &d = *m_delims;
+            if (d.collapse()) {
+                m_pos = d.skip(m_pos, m_end);
+                if (m_pos == m_end) {
+                    m_more = false;
+                    return false;
+                }
+            } else if (!m_more) {
+                return false;
+            }
+            const char *start = m_pos;
+            m_quoted = d.quote() != '\0' && m_pos != m_end && *m_pos == d.quote();
+            if (m_quoted) {
+                ++start;
+                const char *close = start;
+                for (;;) {
+                    close = static_cast<const char *>(memchr(close, d.quote(), static_cast<size_t>(m_end - close)));
+                    if (!close || close + 1 == m_end || close[1] != d.quote()) {
+                        break;
+                    }
+                    close += 2;
+                }
+                if (!close) {
+                    close = m_end;
+                }
+                field = string_view(start, static_cast<size_type>(close - start));
+                m_pos = close == m_end ? m_end : d.find(close + 1, m_end);
+            } else {
+                m_pos = d.find(m_pos, m_end);
+                field = string_view(start, static_cast<size_type>(m_pos - start));
+            }
+            m_more = m_pos != m_end;
+            if (m_more) {
+                ++m_pos;
+            }
+            return true;
+        }
+
+        /**
+         * Append the remaining fields to a list, which may have been
+         * reserved ahead so that no allocation takes place.
+         *
+         * @return the number of fields appended
+         */
+        size_type split(array_list<string_view> &fields) {
+            const delimiter_set &d = *m_delims;
+            size_type count = 0;
+            if (d.quote() != '\0' || d.collapse() || !d.word_search()) {
+                string_view field;
+                while (next(field)) {
+                    fields.push_back(field);
+                    ++count;
+                }
+                return count;
+            }
+            if (!m_more) {
+                return 0;
+            }
+            // Take every delimiter of a word from its match mask
+            // instead of searching again for each field.
+            const char *start = m_pos;
+            const char *p = m_pos;
+            for (; m_end - p >= 8; p += 8) {
+                for (uint64_t hits = d.match_word(p); hits != 0; hits = delimiter_set::clear_first_lane(hits)) {
+                    const char *delim = p + delimiter_set::first_lane(hits);
+                    fields.push_back(string_view(start, static_cast<size_type>(delim - start)));
+                    start = delim + 1;
+                    ++count;
+                }
+            }
+            for (; p != m_end; ++p) {
+                if (d.contains(*p)) {
+                    fields.push_back(string_view(start, static_cast<size_type>(p - start)));
+                    start = p + 1;
+                    ++count;
+                }
+            }
+            fields.push_back(string_view(start, static_cast<size_type>(m_end - start)));
+            m_pos = m_end;
+            m_more = false;
+            m_quoted = false;
+            return count + 1;
+        }
+
+        /**
+         * @return whether the last field returned was quoted
+         */
+        bool quoted() const {
+            return m_quoted;
+        }
+
+        /**
+         * @return the text that has not been split yet
+         */
+        string_view rest() const {
+            return string_view(m_pos, static_cast<size_type>(m_end - m_pos));
+        }
+
+        /**
+         * Copy a quoted field, replacing each pair of quotes with one.
+         *
+         * @param field the field as returned by the tokenizer
+         * @param quote the quote character
+         * @param out   buffer of at least the field length
+         * @return the length of the unescaped field
+         */
+        static size_type unescape(const string_view &field, char quote, char *out) {
+            size_type n = 0;
+            for (size_type i = 0; i < field.length(); ++i) {
+                out[n++] = field[i];
+                if (field[i] == quote && i + 1 < field.length() && field[i + 1] == quote) {
+                    ++i;
+                }
+            }
+            return n;
+        }
+    };
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_TOKENIZER_H
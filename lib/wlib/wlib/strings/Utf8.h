@@ -0,0 +1,52 @@
+/**
+ * @file Utf8.h
+ * @brief UTF-8 validation.
+ *
+ * Text is valid UTF-8 if it is a sequence of well-formed encoded
+ * characters: no stray continuation bytes, no truncated sequences, no
+ * overlong encodings, no surrogates, and nothing above U+10FFFF. Runs
+ * of ASCII, the common case for telemetry, are skipped sixteen bytes
+ * at a time.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#ifndef EMBEDDEDCPLUSPLUS_UTF8_H
+#define EMBEDDEDCPLUSPLUS_UTF8_H
+
+#include <stddef.h>
+
+#include <wlib/strings/StringView.h>
+
+namespace wlp {
+
+    /**
+     * Find the longest valid UTF-8 prefix of a buffer.
+     *
+     * @param str the bytes to validate
+     * @param len the number of bytes
+     * @return the length of the prefix, which is the offset of the
+     * first invalid or truncated sequence, or the length if the whole
+     * buffer is valid
+     */
+    size_t utf8_valid_length(const char *str, size_t len);
+
+    /**
+     * @return whether a buffer is entirely valid UTF-8
+     */
+    inline bool utf8_valid(const char *str, size_t len) {
+        return utf8_valid_length(str, len) == len;
+    }
+
+    /**
+     * @return whether a string is entirely valid UTF-8
+     */
+    inline bool utf8_valid(const string_view &str) {
+        return utf8_valid(str.data(), str.length());
+    }
+
+}
+
+#endif //EMBEDDEDCPLUSPLUS_UTF8_H
@@ -1,12 +1,20 @@
+#include <wlib/aho_corasick>
+#include <wlib/algorithm>
 #include <wlib/array_heap>
 #include <wlib/array_list>
+#include <wlib/ascii>
 #include <wlib/array2d>
 #include <wlib/bit_set>
 #include <wlib/comparator>
+#include <wlib/csr_graph>
+#include <wlib/direct_map>
+#include <wlib/disjoint_set>
 #include <wlib/dynamic_string>
 #include <wlib/equals>
+#include <wlib/fenwick_tree>
 #include <wlib/hash>
 #include <wlib/hash_map>
+#include <wlib/hash_multimap>
 #include <wlib/hash_set>
 #include <wlib/hash_table>
 #include <wlib/initializer_list>
@@ -16,16 +24,34 @@
 #include <wlib/open_set>
 #include <wlib/open_table>
 #include <wlib/pair>
+#include <wlib/parallel>
 #include <wlib/shared_ptr>
+#include <wlib/shared_string>
+#include <wlib/simd>
+#include <wlib/slab_allocator>
+#include <wlib/small_map>
+#include <wlib/radix_tree>
+#include <wlib/range>
+#include <wlib/segment_tree>
+#include <wlib/span>
+#include <wlib/sparse_grid>
+#include <wlib/fixed>
+#include <wlib/packed_sequence>
+#include <wlib/roaring_bitmap>
 #include <wlib/static_string>
 #include <wlib/string>
+#include <wlib/string_pool>
+#include <wlib/string_view>
+#include <wlib/tokenizer>
 #include <wlib/tree>
 #include <wlib/tree_map>
 #include <wlib/tree_set>
 #include <wlib/tuple>
 #include <wlib/type_traits>
 #include <wlib/unique_ptr>
+#include <wlib/utf8>
 #include <wlib/utility>
+#include <wlib/variant>
 #include <wlib/vector2d>
 
 void include_test() {
@@ -516,3 +516,32 @@ TEST(list_const_iterator_test, test_bulk_functions) {
     cit g9 = move(g8);
     ASSERT_EQ(list.begin(), g9);
 }
+
+TEST(array_list_test, test_swap_and_moved_from) {
+    static_assert(has_member_swap<array_list<int>>::value, "array_list has a member swap");
+    array_list<int> a(4);
+    array_list<int> b(8);
+    a.push_back(1);
+    b.push_back(2);
+    b.push_back(3);
+    const int *a_data = a.data();
+    const int *b_data = b.data();
+    swap(a, b);
+    ASSERT_EQ(b_data, a.data());
+    ASSERT_EQ(a_data, b.data());
+    ASSERT_EQ(2u, a.size());
+    ASSERT_EQ(8u, a.capacity());
+    ASSERT_EQ(1u, b.size());
+    ASSERT_EQ(3, a.back());
+    array_list<int> c(move(a));
+    ASSERT_EQ(b_data, c.data());
+    ASSERT_EQ(0u, a.capacity());
+    for (int i = 0; i < 20; ++i) {
+        a.push_back(i);
+    }
+    ASSERT_EQ(20u, a.size());
+    ASSERT_EQ(19, a.back());
+    c = move(c);
+    ASSERT_EQ(b_data, c.data());
+    ASSERT_EQ(2u, c.size());
+}
@@ -15,6 +15,9 @@ namespace wlp {
     template
     class bit_set<176>;
 
+    template
+    class bit_set<4096>;
+
 }
 
 using namespace wlp;
@@ -131,3 +134,29 @@ TEST(bitset_test, test_to_string) {
     ASSERT_STREQ(expected, bits.to_static_string().c_str());
     ASSERT_STREQ(expected, bits.to_dynamic_string().c_str());
 }
+
+TEST(bitset_test, test_find_next) {
+    bit_set<4096> bits;
+    ASSERT_EQ(4096, bits.find_next(0));
+    bits.set(0);
+    bits.set(31);
+    bits.set(32);
+    bits.set(1000);
+    bits.set(4095);
+    ASSERT_EQ(0, bits.find_next(0));
+    ASSERT_EQ(31, bits.find_next(1));
+    ASSERT_EQ(32, bits.find_next(32));
+    ASSERT_EQ(1000, bits.find_next(33));
+    ASSERT_EQ(4095, bits.find_next(1001));
+    ASSERT_EQ(4096, bits.find_next(4096));
+    bits.reset(4095);
+    ASSERT_EQ(4096, bits.find_next(1001));
+    ASSERT_TRUE(bits.test(1000));
+    ASSERT_FALSE(bits.test(999));
+
+    bit_set<46> small;
+    small.set(45);
+    ASSERT_EQ(45, small.find_next(3));
+    small.reset(45);
+    ASSERT_EQ(46, small.find_next(3));
+}
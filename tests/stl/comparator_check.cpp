@@ -109,3 +109,25 @@ TEST(comparator_test, test_reverse_comparator) {
     ASSERT_TRUE(cmp.__le__(5, 5));
     ASSERT_FALSE(cmp.__le__(5, 6));
 }
+
+TEST(comparator_test, test_case_insensitive_comparator) {
+    case_insensitive_comparator<dynamic_string> cmp;
+    dynamic_string alpha("ALPHA");
+    dynamic_string alpha_lower("alpha");
+    dynamic_string beta("beta");
+    dynamic_string alphabet("Alphabet");
+    ASSERT_TRUE(cmp.__eq__(alpha, alpha_lower));
+    ASSERT_FALSE(cmp.__ne__(alpha, alpha_lower));
+    ASSERT_TRUE(cmp.__lt__(alpha, beta));
+    ASSERT_TRUE(cmp.__gt__(beta, alpha_lower));
+    ASSERT_TRUE(cmp.__lt__(alpha, alphabet));
+    ASSERT_TRUE(cmp.__le__(alpha_lower, alpha));
+    ASSERT_TRUE(cmp.__ge__(alphabet, alpha));
+    ASSERT_FALSE(cmp.__lt__(alpha, alpha_lower));
+
+    case_insensitive_comparator<const char *> c_cmp;
+    // '_' sits between the upper and lower case letters
+    ASSERT_TRUE(c_cmp.__lt__("SENSOR_B", "sensorb"));
+    ASSERT_TRUE(c_cmp.__lt__("abcdefghijklmnopQ", "ABCDEFGHIJKLMNOPr"));
+    ASSERT_TRUE(c_cmp.__gt__("abcdefghijklmnop\xff", "ABCDEFGHIJKLMNOPZ"));
+}
@@ -1,8 +1,10 @@
 #include <gtest/gtest.h>
 #include <wlib/strings/String.h>
 #include <wlib/stl/Comparator.h>
+#include <wlib/stl/DirectMap.h>
 #include <wlib/stl/HashMap.h>
 #include <wlib/stl/OpenMap.h>
+#include <wlib/stl/SmallMap.h>
 #include <wlib/stl/TreeMap.h>
 #include <wlib/stl/ArrayList.h>
 #include <wlib/stl/HashSet.h>
@@ -86,6 +88,8 @@ TEST(concept_checks, check_map_concept) {
     ASSERT_TRUE((is_map<hash_map<int, int>>()));
     ASSERT_TRUE((is_map<open_map<int, int>>()));
     ASSERT_TRUE((is_map<tree_map<int, int>>()));
+    ASSERT_TRUE((is_map<direct_map<int, 255>>()));
+    ASSERT_TRUE((is_map<small_map<int, int>>()));
 
     ASSERT_FALSE((is_map<int>()));
     ASSERT_FALSE((is_map<array_list<int>>()));
@@ -0,0 +1,132 @@
+/**
+ * @file csr_graph_check.cpp
+ * @brief Unit testing for the compressed sparse row graph and searches
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <gtest/gtest.h>
+#include <wlib/stl/CsrGraph.h>
+
+using namespace wlp;
+
+namespace {
+
+    /*
+     *  0 --4-- 1 --1-- 2
+     *  |       |       |
+     *  1       9       2
+     *  |       |       |
+     *  3 --1-- 4 --5-- 5     6 --1-- 7
+     */
+    graph_edge<uint32_t> track[] = {
+            {0, 1, 4}, {1, 2, 1}, {0, 3, 1}, {1, 4, 9},
+            {2, 5, 2}, {3, 4, 1}, {4, 5, 5}, {6, 7, 1}
+    };
+
+}
+
+TEST(csr_graph_test, test_build) {
+    csr_graph<uint32_t> directed(8, make_span(track));
+    ASSERT_EQ(8u, directed.vertices());
+    ASSERT_EQ(8u, directed.edges());
+    ASSERT_EQ(2u, directed.degree(0));
+    ASSERT_EQ(0u, directed.degree(5));
+    ASSERT_EQ(1u, directed.neighbors(0)[0]);
+    ASSERT_EQ(3u, directed.neighbors(0)[1]);
+    ASSERT_EQ(4u, directed.weights(0)[0]);
+    ASSERT_EQ(1u, directed.weights(0)[1]);
+
+    csr_graph<uint32_t> graph(8, make_span(track), true);
+    ASSERT_EQ(16u, graph.edges());
+    ASSERT_EQ(3u, graph.degree(1));
+    // the edges of a vertex keep list order, reversed edges included
+    uint32_t out[] = {0, 2, 4};
+    uint32_t weight[] = {4, 1, 9};
+    for (size_t e = 0; e < 3; ++e) {
+        ASSERT_EQ(out[e], graph.neighbors(1)[e]);
+        ASSERT_EQ(weight[e], graph.weights(1)[e]);
+    }
+    uint32_t total = 0;
+    for (uint32_t v = 0; v < graph.vertices(); ++v) {
+        total += graph.degree(v);
+    }
+    ASSERT_EQ(16u, total);
+
+    csr_graph<uint32_t> moved(move(graph));
+    ASSERT_EQ(0u, graph.vertices());
+    ASSERT_EQ(8u, moved.vertices());
+    ASSERT_EQ(16u, moved.edges());
+}
+
+TEST(csr_graph_test, test_breadth_first) {
+    csr_graph<uint32_t> graph(8, make_span(track), true);
+    uint32_t depth[8];
+    ASSERT_EQ(6u, breadth_first(graph, 0, make_span(depth)));
+    uint32_t expected[] = {0, 1, 2, 1, 2, 3, graph_unreached, graph_unreached};
+    for (size_t v = 0; v < 8; ++v) {
+        ASSERT_EQ(expected[v], depth[v]);
+    }
+
+    uint32_t sources[] = {5, 6, 5};
+    ASSERT_EQ(8u, breadth_first(graph, make_span(sources), make_span(depth)));
+    uint32_t multi[] = {3, 2, 1, 2, 1, 0, 0, 1};
+    for (size_t v = 0; v < 8; ++v) {
+        ASSERT_EQ(multi[v], depth[v]);
+    }
+}
+
+TEST(csr_graph_test, test_dijkstra) {
+    csr_graph<uint32_t> graph(8, make_span(track), true);
+    uint32_t distance[8];
+    uint32_t parent[8];
+    ASSERT_EQ(6u, dijkstra(graph, 0, make_span(distance), make_span(parent)));
+    uint32_t expected[] = {0, 4, 5, 1, 2, 7, UINT32_MAX, UINT32_MAX};
+    uint32_t via[] = {0, 0, 1, 0, 3, 4, graph_unreached, graph_unreached};
+    for (size_t v = 0; v < 8; ++v) {
+        ASSERT_EQ(expected[v], distance[v]);
+        ASSERT_EQ(via[v], parent[v]);
+    }
+
+    // nearest of two depots, without parents
+    uint32_t depots[] = {2, 7};
+    ASSERT_EQ(8u, dijkstra(graph, make_span(depots), make_span(distance)));
+    uint32_t nearest[] = {5, 1, 0, 6, 7, 2, 1, 0};
+    for (size_t v = 0; v < 8; ++v) {
+        ASSERT_EQ(nearest[v], distance[v]);
+    }
+
+    // a directed graph only follows edges forward
+    csr_graph<uint32_t> directed(8, make_span(track));
+    ASSERT_EQ(4u, dijkstra(directed, 1, make_span(distance)));
+    ASSERT_EQ(UINT32_MAX, distance[0]);
+    ASSERT_EQ(3u, distance[5]);
+}
+
+TEST(csr_graph_test, test_grid_agrees) {
+    // on a grid of unit weights, Dijkstra's distances are BFS depths
+    const uint32_t side = 30;
+    array_list<graph_edge<uint16_t>> edges;
+    for (uint32_t x = 0; x < side; ++x) {
+        for (uint32_t y = 0; y < side; ++y) {
+            const uint32_t v = x * side + y;
+            if (x + 1 < side && (x + y) % 7 != 3) {
+                edges.push_back(graph_edge<uint16_t>{v, v + side, 1});
+            }
+            if (y + 1 < side) {
+                edges.push_back(graph_edge<uint16_t>{v, v + 1, 1});
+            }
+        }
+    }
+    csr_graph<uint16_t> graph(side * side, edges.as_span(), true);
+    uint32_t depth[side * side];
+    uint16_t distance[side * side];
+    uint32_t sources[] = {0, side * side - 1};
+    ASSERT_EQ(side * side, breadth_first(graph, make_span(sources), make_span(depth)));
+    ASSERT_EQ(side * side, dijkstra(graph, make_span(sources), make_span(distance)));
+    for (uint32_t v = 0; v < side * side; ++v) {
+        ASSERT_EQ(depth[v], distance[v]);
+    }
+}
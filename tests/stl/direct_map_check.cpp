@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+#include <wlib/stl/DirectMap.h>
+#include <wlib/strings/String.h>
+
+namespace wlp {
+
+    template
+    class direct_map<int, 100>;
+
+    template
+    class direct_map<dynamic_string, 4095>;
+
+}
+
+using namespace wlp;
+
+typedef direct_map<int, 4095> int_map;
+typedef int_map::iterator imi;
+typedef pair<imi, bool> P_imi_b;
+
+TEST(direct_map_test, test_empty_on_construct) {
+    int_map map;
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(0u, map.size());
+    ASSERT_EQ(4096u, map.capacity());
+    ASSERT_EQ(map.begin(), map.end());
+}
+
+TEST(direct_map_test, test_insert_and_find) {
+    int_map map;
+    P_imi_b res = map.insert(7, 70);
+    ASSERT_TRUE(res.second());
+    ASSERT_EQ(7, res.first().key());
+    ASSERT_EQ(70, *res.first());
+    res = map.insert(7, 71);
+    ASSERT_FALSE(res.second());
+    ASSERT_EQ(70, *res.first());
+    ASSERT_TRUE(map.insert(0, 1).second());
+    ASSERT_TRUE(map.insert(4095, 2).second());
+    ASSERT_FALSE(map.insert(4096, 3).second());
+    ASSERT_EQ(map.end(), map.insert(4096, 3).first());
+    ASSERT_EQ(3u, map.size());
+    ASSERT_TRUE(map.contains(0));
+    ASSERT_TRUE(map.contains(4095));
+    ASSERT_FALSE(map.contains(4096));
+    ASSERT_FALSE(map.contains(8));
+    ASSERT_EQ(2, *map.find(4095));
+    ASSERT_EQ(map.end(), map.find(8));
+    ASSERT_EQ(map.end(), map.find(60000));
+    ASSERT_EQ(70, map.at(7));
+}
+
+TEST(direct_map_test, test_insert_or_assign_and_subscript) {
+    int_map map;
+    ASSERT_TRUE(map.insert_or_assign(5, 1).second());
+    ASSERT_FALSE(map.insert_or_assign(5, 2).second());
+    ASSERT_EQ(2, map[5]);
+    ASSERT_EQ(0, map[6]);
+    ASSERT_EQ(2u, map.size());
+    map[6] = 9;
+    ASSERT_EQ(9, map.at(6));
+    ASSERT_EQ(2u, map.size());
+}
+
+TEST(direct_map_test, test_erase) {
+    int_map map;
+    for (uint16_t k = 0; k < 100; k += 3) {
+        map[k] = k;
+    }
+    ASSERT_EQ(34u, map.size());
+    ASSERT_TRUE(map.erase(9));
+    ASSERT_FALSE(map.erase(9));
+    ASSERT_FALSE(map.erase(10));
+    ASSERT_FALSE(map.erase(5000));
+    ASSERT_EQ(33u, map.size());
+    imi it = map.erase(map.find(3));
+    ASSERT_EQ(6, it.key());
+    ASSERT_FALSE(map.contains(3));
+    it = map.erase(map.find(99));
+    ASSERT_EQ(map.end(), it);
+    ASSERT_EQ(31u, map.size());
+    ASSERT_TRUE(map.insert(9, 1).second());
+    ASSERT_EQ(1, map.at(9));
+}
+
+TEST(direct_map_test, test_iteration_in_key_order) {
+    int_map map;
+    const uint16_t keys[] = {4095, 0, 31, 32, 33, 64, 1000, 2047};
+    for (uint16_t k : keys) {
+        map.insert(k, k * 2);
+    }
+    const uint16_t sorted[] = {0, 31, 32, 33, 64, 1000, 2047, 4095};
+    size_t i = 0;
+    for (imi it = map.begin(); it != map.end(); ++it) {
+        ASSERT_EQ(sorted[i], it.key());
+        ASSERT_EQ(sorted[i] * 2, *it);
+        ++i;
+    }
+    ASSERT_EQ(8u, i);
+    const int_map &const_map = map;
+    i = 0;
+    for (int_map::const_iterator it = const_map.begin(); it != const_map.end(); it++) {
+        ASSERT_EQ(sorted[i++], it.key());
+    }
+    ASSERT_EQ(8u, i);
+}
+
+TEST(direct_map_test, test_clear_releases_values) {
+    direct_map<dynamic_string, 4095> map;
+    map[12] = "twelve";
+    map[4000] = "four thousand";
+    ASSERT_STREQ("twelve", map.at(12).c_str());
+    map.clear();
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.begin(), map.end());
+    ASSERT_EQ(0u, map.at(12).length());
+    map[4000] = "again";
+    ASSERT_EQ(1u, map.size());
+}
+
+TEST(direct_map_test, test_move) {
+    int_map map;
+    map[1] = 10;
+    map[2] = 20;
+    int_map moved(move(map));
+    ASSERT_EQ(2u, moved.size());
+    ASSERT_EQ(20, moved.at(2));
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.begin(), map.end());
+    int_map other;
+    other[3] = 30;
+    other = move(moved);
+    ASSERT_EQ(2u, other.size());
+    ASSERT_FALSE(other.contains(3));
+    ASSERT_EQ(10, other.at(1));
+}
+
+TEST(direct_map_test, test_reuse_moved_from) {
+    int_map map;
+    map[1] = 10;
+    int_map moved(move(map));
+    // a moved-from map allocates its values on the next insertion
+    ASSERT_TRUE(map.insert(7, 70).second());
+    ASSERT_FALSE(map.insert_or_assign(7, 71).second());
+    map[9] = 90;
+    ASSERT_EQ(2u, map.size());
+    ASSERT_EQ(71, map.at(7));
+    ASSERT_EQ(90, *map.find(9));
+
+    int_map other;
+    other = move(map);
+    map[4] = 40;
+    ASSERT_EQ(40, map.at(4));
+    ASSERT_EQ(1u, map.size());
+    ASSERT_EQ(10, moved.at(1));
+}
+
+TEST(direct_map_test, test_iteration_partial_last_word) {
+    direct_map<int, 100> map;
+    map[100] = 1;
+    map[95] = 2;
+    map[96] = 3;
+    direct_map<int, 100>::iterator it = map.begin();
+    ASSERT_EQ(95, it.key());
+    ASSERT_EQ(96, (++it).key());
+    ASSERT_EQ(100, (++it).key());
+    ASSERT_EQ(map.end(), ++it);
+    map.erase(100);
+    it = map.find(96);
+    ASSERT_EQ(map.end(), ++it);
+}
@@ -0,0 +1,157 @@
+/**
+ * @file disjoint_set_check.cpp
+ * @brief Unit testing for union-find and grid component labeling
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <gtest/gtest.h>
+#include <wlib/stl/DisjointSet.h>
+#include <wlib/stl/Pair.h>
+
+using namespace wlp;
+
+namespace {
+
+    bool is_set(uint8_t cell) {
+        return cell != 0;
+    }
+
+    template<size_t X, size_t Y>
+    void fill(array2d<uint8_t> &grid, const uint8_t (&cells)[X][Y]) {
+        for (size_t x = 0; x < X; ++x) {
+            for (size_t y = 0; y < Y; ++y) {
+                grid[x][y] = cells[x][y];
+            }
+        }
+    }
+
+}
+
+TEST(disjoint_set_test, test_unite_find) {
+    disjoint_set sets(10);
+    ASSERT_EQ(10u, sets.size());
+    ASSERT_EQ(10u, sets.count());
+    ASSERT_TRUE(sets.unite(0, 1));
+    ASSERT_TRUE(sets.unite(2, 3));
+    ASSERT_TRUE(sets.unite(1, 3));
+    ASSERT_FALSE(sets.unite(0, 2));
+    ASSERT_EQ(7u, sets.count());
+    ASSERT_TRUE(sets.same(0, 3));
+    ASSERT_FALSE(sets.same(0, 4));
+    ASSERT_EQ(4u, sets.set_size(2));
+    ASSERT_EQ(1u, sets.set_size(9));
+    ASSERT_EQ(sets.find(0), sets.find(3));
+
+    ASSERT_EQ(10u, sets.add());
+    ASSERT_TRUE(sets.unite(10, 9));
+    ASSERT_EQ(7u, sets.count());
+    ASSERT_EQ(2u, sets.set_size(10));
+
+    sets.reset();
+    ASSERT_EQ(11u, sets.count());
+    ASSERT_FALSE(sets.same(0, 1));
+}
+
+TEST(disjoint_set_test, test_long_chain) {
+    const uint32_t n = 100000;
+    disjoint_set sets(n);
+    for (uint32_t i = 1; i < n; ++i) {
+        sets.unite(i - 1, i);
+    }
+    ASSERT_EQ(1u, sets.count());
+    ASSERT_EQ(n, sets.set_size(n - 1));
+    ASSERT_TRUE(sets.same(0, n - 1));
+}
+
+TEST(disjoint_set_test, test_batch_and_move) {
+    // two partitions of a network: {0, 1, 2, 5} and {3, 4}, and 6 alone
+    pair<uint32_t, uint32_t> links[] = {
+            pair<uint32_t, uint32_t>(0, 1),
+            pair<uint32_t, uint32_t>(1, 2),
+            pair<uint32_t, uint32_t>(3, 4),
+            pair<uint32_t, uint32_t>(2, 0),
+            pair<uint32_t, uint32_t>(5, 1)
+    };
+    disjoint_set sets(7);
+    ASSERT_EQ(4u, sets.unite(make_span(links)));
+    ASSERT_EQ(3u, sets.count());
+    ASSERT_TRUE(sets.same(5, 0));
+    ASSERT_TRUE(sets.same(3, 4));
+    ASSERT_FALSE(sets.same(4, 6));
+
+    disjoint_set moved(move(sets));
+    ASSERT_EQ(3u, moved.count());
+    ASSERT_EQ(0u, sets.count());
+    ASSERT_EQ(0u, sets.size());
+    disjoint_set empty;
+    empty.swap(moved);
+    ASSERT_EQ(7u, empty.size());
+    ASSERT_EQ(4u, empty.set_size(2));
+}
+
+TEST(disjoint_set_test, test_label_components) {
+    const uint8_t cells[5][5] = {
+            {1, 1, 0, 0, 1},
+            {0, 1, 0, 1, 1},
+            {1, 0, 0, 0, 0},
+            {1, 0, 1, 1, 0},
+            {0, 1, 0, 1, 1}
+    };
+    array2d<uint8_t> grid(5, 5);
+    fill(grid, cells);
+    array2d<uint32_t> labels(5, 5);
+    ASSERT_EQ(5u, label_components(grid, labels, is_set));
+    uint32_t four[5][5] = {
+            {1, 1, 0, 0, 2},
+            {0, 1, 0, 2, 2},
+            {3, 0, 0, 0, 0},
+            {3, 0, 4, 4, 0},
+            {0, 5, 0, 4, 4}
+    };
+    for (size_t x = 0; x < 5; ++x) {
+        for (size_t y = 0; y < 5; ++y) {
+            ASSERT_EQ(four[x][y], labels[x][y]);
+        }
+    }
+
+    // the corner at (4, 1) joins the lower shapes to the first
+    ASSERT_EQ(2u, label_components(grid, labels, is_set, true));
+    uint32_t eight[5][5] = {
+            {1, 1, 0, 0, 2},
+            {0, 1, 0, 2, 2},
+            {1, 0, 0, 0, 0},
+            {1, 0, 1, 1, 0},
+            {0, 1, 0, 1, 1}
+    };
+    for (size_t x = 0; x < 5; ++x) {
+        for (size_t y = 0; y < 5; ++y) {
+            ASSERT_EQ(eight[x][y], labels[x][y]);
+        }
+    }
+}
+
+TEST(disjoint_set_test, test_label_merging_shapes) {
+    // a U shape whose arms meet at the bottom, and a hook that curls back
+    const uint8_t cells[4][7] = {
+            {1, 0, 1, 0, 1, 1, 1},
+            {1, 0, 1, 0, 0, 0, 1},
+            {1, 1, 1, 0, 1, 0, 1},
+            {0, 0, 0, 0, 1, 1, 1}
+    };
+    array2d<uint8_t> grid(4, 7);
+    fill(grid, cells);
+    array2d<uint32_t> labels(4, 7);
+    ASSERT_EQ(2u, label_components(grid, labels, is_set));
+    ASSERT_EQ(1u, labels[0][0]);
+    ASSERT_EQ(1u, labels[0][2]);
+    ASSERT_EQ(2u, labels[0][4]);
+    ASSERT_EQ(2u, labels[2][4]);
+    ASSERT_EQ(0u, labels[3][0]);
+
+    array2d<uint8_t> none(3, 3);
+    array2d<uint32_t> none_labels(3, 3);
+    ASSERT_EQ(0u, label_components(none, none_labels, is_set));
+}
@@ -44,4 +44,38 @@ TEST(equals_test, test_integer_equal) {
     ASSERT_TRUE(comparator(15, 15));
     ASSERT_FALSE(comparator(1, 14));
     ASSERT_FALSE(comparator(14, 1));
-}
\ No newline at end of file
+}
+
+TEST(equals_test, test_case_insensitive_equals) {
+    case_insensitive_equals<String16> static_equals;
+    case_insensitive_equals<dynamic_string> dynamic_equals;
+    case_insensitive_equals<const char *> c_equals;
+    ASSERT_TRUE(static_equals(String16("Sat-ID 42"), String16("sAT-id 42")));
+    ASSERT_FALSE(static_equals(String16("Sat-ID 42"), String16("Sat-ID 43")));
+    ASSERT_FALSE(static_equals(String16("Sat"), String16("Sat ")));
+    ASSERT_TRUE(dynamic_equals(dynamic_string("ANTENNA_AZIMUTH_DEG"), dynamic_string("antenna_azimuth_deg")));
+    ASSERT_FALSE(dynamic_equals(dynamic_string("ANTENNA_AZIMUTH_DEG"), dynamic_string("antenna_azimuth_deh")));
+    // only ASCII letters fold, so '@' and '`' stay distinct
+    ASSERT_FALSE(c_equals("@", "`"));
+    ASSERT_FALSE(c_equals("[", "{"));
+    ASSERT_TRUE(c_equals("caf\xc3\xa9", "CAF\xc3\xa9"));
+    ASSERT_FALSE(c_equals("caf\xc3\xa9", "caf\xc3\x89"));
+}
+
+TEST(equals_test, test_pair_and_tuple_equals) {
+    equals<pair<int, int>> pair_equals;
+    ASSERT_TRUE(pair_equals(pair<int, int>(1, 2), pair<int, int>(1, 2)));
+    ASSERT_FALSE(pair_equals(pair<int, int>(1, 2), pair<int, int>(1, 3)));
+    ASSERT_FALSE(pair_equals(pair<int, int>(1, 2), pair<int, int>(2, 2)));
+
+    // fields compare with their own equality, so C strings compare by content
+    typedef tuple<const char *, int, dynamic_string> key;
+    equals<key> tuple_equals;
+    char station[] = "relay";
+    key a(static_cast<const char *>(station), 4, dynamic_string("uplink"));
+    key b("relay", 4, dynamic_string("uplink"));
+    key c("relay", 4, dynamic_string("downlink"));
+    ASSERT_TRUE(tuple_equals(a, b));
+    ASSERT_FALSE(tuple_equals(a, c));
+    ASSERT_TRUE(equals<tuple<>>()(tuple<>(), tuple<>()));
+}
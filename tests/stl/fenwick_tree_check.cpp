@@ -0,0 +1,101 @@
+/**
+ * @file fenwick_tree_check.cpp
+ * @brief Unit testing for the Fenwick tree
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <gtest/gtest.h>
+#include <wlib/stl/FenwickTree.h>
+
+using namespace wlp;
+
+TEST(fenwick_tree_test, test_add_prefix_range) {
+    const size_t n = 37;
+    int32_t naive[n];
+    memset(naive, 0, sizeof(naive));
+    fenwick_tree<int32_t> tree(n);
+    ASSERT_EQ(n, tree.size());
+    ASSERT_EQ(0, tree.prefix(n));
+    uint32_t state = 3;
+    for (int op = 0; op < 500; ++op) {
+        state = state * 1103515245u + 12345u;
+        const size_t i = (state >> 8) % n;
+        const int32_t v = static_cast<int32_t>((state >> 16) % 100) - 50;
+        tree.add(i, v);
+        naive[i] += v;
+        const size_t begin = (state >> 4) % n;
+        const size_t end = begin + (state >> 12) % (n - begin + 1);
+        int32_t expected = 0;
+        for (size_t k = begin; k < end; ++k) {
+            expected += naive[k];
+        }
+        ASSERT_EQ(expected, tree.range(begin, end));
+        ASSERT_EQ(naive[i], tree.get(i));
+    }
+    int32_t sum = 0;
+    for (size_t k = 0; k <= n; ++k) {
+        ASSERT_EQ(sum, tree.prefix(k));
+        if (k < n) {
+            sum += naive[k];
+        }
+    }
+}
+
+TEST(fenwick_tree_test, test_build_set) {
+    uint32_t values[] = {4, 0, 7, 1, 1, 9, 3, 0, 2, 5, 8};
+    fenwick_tree<uint32_t> tree(make_span(values));
+    uint32_t sum = 0;
+    for (size_t k = 0; k < 11; ++k) {
+        ASSERT_EQ(values[k], tree.get(k));
+        sum += values[k];
+        ASSERT_EQ(sum, tree.prefix(k + 1));
+    }
+    tree.set(2, 3);
+    tree.set(10, 0);
+    ASSERT_EQ(sum - 4 - 8, tree.prefix(11));
+    ASSERT_EQ(3u, tree.get(2));
+    ASSERT_EQ(0u, tree.range(7, 8));
+
+    fenwick_tree<uint32_t> moved(move(tree));
+    ASSERT_EQ(0u, tree.size());
+    ASSERT_EQ(11u, moved.size());
+    ASSERT_EQ(3u, moved.get(2));
+    fenwick_tree<uint32_t> empty;
+    empty.swap(moved);
+    ASSERT_EQ(11u, empty.size());
+    ASSERT_EQ(0u, moved.size());
+    ASSERT_EQ(0u, moved.prefix(0));
+}
+
+TEST(fenwick_tree_test, test_lower_bound) {
+    // bucket counts: 2 0 3 0 0 1 4
+    uint32_t counts[] = {2, 0, 3, 0, 0, 1, 4};
+    fenwick_tree<uint32_t> tree(make_span(counts));
+    ASSERT_EQ(0u, tree.lower_bound(0));
+    ASSERT_EQ(0u, tree.lower_bound(1));
+    ASSERT_EQ(0u, tree.lower_bound(2));
+    ASSERT_EQ(2u, tree.lower_bound(3));
+    ASSERT_EQ(2u, tree.lower_bound(5));
+    ASSERT_EQ(5u, tree.lower_bound(6));
+    ASSERT_EQ(6u, tree.lower_bound(10));
+    ASSERT_EQ(7u, tree.lower_bound(11));
+    fenwick_tree<uint32_t> empty;
+    ASSERT_EQ(0u, empty.lower_bound(1));
+}
+
+TEST(fenwick_tree_test, test_max_prefix) {
+    fenwick_tree<int16_t, max_monoid<int16_t>> tree(10);
+    ASSERT_EQ(INT16_MIN, tree.prefix(10));
+    tree.add(4, 25);
+    tree.add(7, 31);
+    tree.add(1, -3);
+    ASSERT_EQ(INT16_MIN, tree.prefix(1));
+    ASSERT_EQ(-3, tree.prefix(4));
+    ASSERT_EQ(25, tree.prefix(7));
+    ASSERT_EQ(31, tree.prefix(10));
+    tree.add(2, 40);
+    ASSERT_EQ(40, tree.prefix(5));
+}
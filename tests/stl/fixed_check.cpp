@@ -0,0 +1,148 @@
+#include <math.h>
+
+#include <gtest/gtest.h>
+#include <wlib/stl/Fixed.h>
+#include <wlib/stl/Vector2D.h>
+#include <wlib/stl/Array2D.h>
+
+namespace wlp {
+
+    template
+    class fixed<15, 16>;
+
+    template
+    class fixed<7, 8, fixed_saturate>;
+
+    template
+    class vector2d<q15_16>;
+
+}
+
+using namespace wlp;
+
+static const double q16_eps = 1.0 / 65536;
+
+TEST(fixed_test, test_conversions) {
+    q15_16 a(3);
+    q15_16 b(-2.25);
+    ASSERT_EQ(3 << 16, a.raw());
+    ASSERT_EQ(-2.25f, b.to_float());
+    ASSERT_EQ(-2, b.to_int());
+    ASSERT_EQ(3, a.to_int());
+    ASSERT_EQ(1, q15_16::epsilon().raw());
+    ASSERT_EQ(0.5, static_cast<double>(q15_16::from_raw(1 << 15)));
+    constexpr q7_8 c(1.5);
+    static_assert(c.raw() == 384, "constexpr construction");
+    ASSERT_EQ(q7_8::max_value(), q7_8(1000.0));
+    ASSERT_EQ(q7_8::min_value(), q7_8(-1000.0));
+}
+
+TEST(fixed_test, test_arithmetic) {
+    q15_16 a(1.5);
+    q15_16 b(-0.25);
+    ASSERT_EQ(q15_16(1.25), a + b);
+    ASSERT_EQ(q15_16(1.75), a - b);
+    ASSERT_EQ(q15_16(-0.375), a * b);
+    ASSERT_EQ(q15_16(-6), a / b);
+    ASSERT_EQ(q15_16(4.5), a * 3);
+    ASSERT_EQ(q15_16(4.5), 3 * a);
+    ASSERT_EQ(q15_16(0.75), a / 2);
+    ASSERT_EQ(q15_16(0.75), a * 0.5);
+    ASSERT_EQ(q15_16(0.25), -b);
+    ASSERT_EQ(q15_16(0.25), abs(b));
+    a += 1;
+    a *= b;
+    ASSERT_EQ(q15_16(-0.625), a);
+    ASSERT_FALSE(b < a);
+    ASSERT_TRUE(b > a);
+    ASSERT_TRUE(a < 0);
+    ASSERT_TRUE(q15_16(1) / q15_16(0) == q15_16::max_value());
+    ASSERT_TRUE(q15_16(-1) / 0 == q15_16::min_value());
+}
+
+TEST(fixed_test, test_wrap_and_saturate) {
+    q7_8 w(127);
+    w += 1;
+    ASSERT_EQ(-128, w.to_int());
+    sat_q7_8 s(127);
+    s += 1;
+    ASSERT_EQ(sat_q7_8::max_value(), s);
+    ASSERT_EQ(sat_q7_8::max_value(), sat_q7_8(100) * sat_q7_8(100));
+    ASSERT_EQ(sat_q7_8::min_value(), sat_q7_8(-100) * 100);
+    ASSERT_EQ(sat_q7_8::min_value(), sat_q7_8(-100) - sat_q7_8(100));
+    ASSERT_EQ(sat_q7_8::max_value(), -sat_q7_8::min_value());
+}
+
+TEST(fixed_test, test_sqrt_accuracy) {
+    for (double v = 0; v < 30000; v = v * 1.37 + 0.01) {
+        double expect = ::sqrt(static_cast<double>(q15_16(v)));
+        ASSERT_NEAR(expect, sqrt(q15_16(v)).to_double(), q16_eps) << v;
+    }
+    ASSERT_EQ(0, sqrt(q15_16(-4)).raw());
+    ASSERT_EQ(q7_8(3), sqrt(q7_8(9)));
+    ASSERT_NEAR(::sqrt(0.5), sqrt(q1_30(0.5)).to_double(), 1e-8);
+}
+
+TEST(fixed_test, test_reciprocal_accuracy) {
+    for (double v = 0.001; v < 30000; v = v * 1.21) {
+        const double expect = 1.0 / static_cast<double>(q15_16(v));
+        ASSERT_NEAR(expect, reciprocal(q15_16(v)).to_double(), fmax(q16_eps, fabs(expect) * 1e-6)) << v;
+        ASSERT_NEAR(-expect, reciprocal(q15_16(-v)).to_double(), fmax(q16_eps, fabs(expect) * 1e-6)) << v;
+    }
+    ASSERT_EQ(q15_16::max_value(), reciprocal(q15_16(0)));
+    ASSERT_EQ(q7_8(0.25), reciprocal(q7_8(4)));
+    ASSERT_EQ(0.5f, reciprocal(2.0f));
+}
+
+TEST(fixed_test, test_trig_accuracy) {
+    for (double a = -20; a < 20; a += 0.013) {
+        const double raw = static_cast<double>(q15_16(a));
+        ASSERT_NEAR(::sin(raw), sin(q15_16(a)).to_double(), 2 * q16_eps) << a;
+        ASSERT_NEAR(::cos(raw), cos(q15_16(a)).to_double(), 2 * q16_eps) << a;
+    }
+    ASSERT_EQ(q7_8(1), sin(q7_8(1.5707963)));
+    ASSERT_NEAR(::sin(0.3), sin(q1_30(0.3)).to_double(), 1e-7);
+}
+
+TEST(fixed_test, test_atan2_accuracy) {
+    for (double a = -3.1; a < 3.1; a += 0.01) {
+        for (double r = 0.5; r < 1000; r *= 7) {
+            q15_16 y(r * ::sin(a));
+            q15_16 x(r * ::cos(a));
+            const double expect = ::atan2(static_cast<double>(y), static_cast<double>(x));
+            ASSERT_NEAR(expect, atan2(y, x).to_double(), 2 * q16_eps) << a << " " << r;
+        }
+    }
+    ASSERT_EQ(0, atan2(q15_16(0), q15_16(0)).raw());
+}
+
+TEST(fixed_test, test_vector2d_interop) {
+    vector2d<q15_16> v(q15_16(3), q15_16(4));
+    ASSERT_EQ(q15_16(25), v.norm_sq());
+    ASSERT_EQ(q15_16(5), v.norm());
+    vector2d<q15_16> n = v.n();
+    ASSERT_NEAR(0.6, n.x().to_double(), q16_eps);
+    ASSERT_NEAR(0.8, n.y().to_double(), q16_eps);
+    vector2d<q15_16> w = v * 2;
+    ASSERT_EQ(q15_16(8), w.y());
+    w = v * q15_16(0.5);
+    ASSERT_EQ(q15_16(1.5), w.x());
+    ASSERT_EQ(q15_16(0), v.cross(v));
+    vector2d<float> f(v);
+    ASSERT_EQ(3.0f, f.x());
+    vector2d<q15_16> g(vector2d<float>(1.5f, -2.0f));
+    ASSERT_EQ(q15_16(-2), g.y());
+}
+
+TEST(fixed_test, test_array2d_interop) {
+    array2d<q15_16, uint16_t> grid(4, 5);
+    ASSERT_EQ(q15_16(0), grid[3][4]);
+    for (uint16_t x = 0; x < 4; ++x) {
+        for (uint16_t y = 0; y < 5; ++y) {
+            grid[x][y] = q15_16(x) + q15_16(y) * 0.5;
+        }
+    }
+    ASSERT_EQ(q15_16(5), grid[3][4]);
+    grid.zero_clear();
+    ASSERT_EQ(q15_16(0), grid[3][4]);
+}
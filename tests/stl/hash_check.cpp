@@ -29,4 +29,66 @@ TEST(hash_test, test_hash_integer) {
     ASSERT_EQ(4, hasher(4));
     ASSERT_EQ(hasher(10), hasher(10));
     ASSERT_EQ(1556, hasher(1556));
-}
\ No newline at end of file
+}
+
+TEST(hash_test, test_case_insensitive_hash) {
+    case_insensitive_hash<String16, uint16_t> static_hasher;
+    case_insensitive_hash<dynamic_string, uint32_t> dynamic_hasher;
+    case_insensitive_hash<const char *, uint32_t> c_hasher;
+    ASSERT_EQ(static_hasher(String16("GroundStation")), static_hasher(String16("groundstation")));
+    ASSERT_NE(static_hasher(String16("GroundStation")), static_hasher(String16("groundstatio")));
+    dynamic_string upper("TELEMETRY/DOWNLINK/ALPHA");
+    dynamic_string lower("telemetry/downlink/alpha");
+    ASSERT_EQ(dynamic_hasher(upper), dynamic_hasher(lower));
+    ASSERT_EQ(dynamic_hasher(upper), c_hasher("Telemetry/Downlink/Alpha"));
+    ASSERT_NE(c_hasher("telemetry/downlink/alpha"), c_hasher("telemetry/downlink/alphb"));
+    ASSERT_NE(c_hasher(""), c_hasher("\x80"));
+}
+
+TEST(hash_test, test_hash_pair_and_tuple) {
+    hash<pair<uint32_t, uint32_t>, uint16_t> pair_hasher;
+    ASSERT_EQ(pair_hasher(pair<uint32_t, uint32_t>(3u, 7u)), pair_hasher(pair<uint32_t, uint32_t>(3u, 7u)));
+    // the order of the fields matters
+    ASSERT_NE(pair_hasher(pair<uint32_t, uint32_t>(3u, 7u)), pair_hasher(pair<uint32_t, uint32_t>(7u, 3u)));
+
+    typedef tuple<uint32_t, dynamic_string, uint8_t> route;
+    hash<route, uint32_t> hasher;
+    hash<route, uint64_t> wide_hasher;
+    route a(5u, dynamic_string("north"), static_cast<uint8_t>(2));
+    route b(5u, dynamic_string("north"), static_cast<uint8_t>(2));
+    route c(5u, dynamic_string("north"), static_cast<uint8_t>(3));
+    ASSERT_EQ(hasher(a), hasher(b));
+    ASSERT_NE(hasher(a), hasher(c));
+    ASSERT_EQ(wide_hasher(a), wide_hasher(b));
+    ASSERT_NE(wide_hasher(a), wide_hasher(c));
+
+    // neighbouring grid cells spread over the low bits
+    hash<tuple<int32_t, int32_t>, uint32_t> cell_hasher;
+    uint32_t buckets[16] = {0};
+    for (int32_t x = 0; x < 32; ++x) {
+        for (int32_t y = 0; y < 32; ++y) {
+            ++buckets[cell_hasher(tuple<int32_t, int32_t>(x, y)) % 16];
+        }
+    }
+    for (uint32_t count : buckets) {
+        ASSERT_LT(32u, count);
+        ASSERT_GT(96u, count);
+    }
+}
+
+TEST(hash_test, test_hash_pair_narrow_code) {
+    // every bit of every field reaches a 16-bit hash code
+    typedef pair<uint16_t, uint16_t> key;
+    hash<key, uint16_t> hasher;
+    const uint16_t low = 0;
+    const uint16_t high = 2048;
+    const uint16_t second = 7;
+    ASSERT_NE(hasher(key(low, second)), hasher(key(high, second)));
+    uint16_t codes[32];
+    for (uint16_t i = 0; i < 32; ++i) {
+        codes[i] = hasher(key(static_cast<uint16_t>(i << 11), second));
+        for (uint16_t j = 0; j < i; ++j) {
+            ASSERT_NE(codes[j], codes[i]);
+        }
+    }
+}
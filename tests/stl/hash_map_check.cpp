@@ -471,3 +471,46 @@ TEST(chain_map_test, insert_or_assign_rvalue) {
     ASSERT_FALSE(ret3.second());
     ASSERT_STREQ("val2", ret3.first()->c_str());
 }
+
+TEST(chain_map_test, test_swap_and_moved_from) {
+    int_map a(8);
+    int_map b(16);
+    a[1] = 10;
+    b[2] = 20;
+    b[3] = 30;
+    swap(a, b);
+    ASSERT_EQ(2u, a.size());
+    ASSERT_EQ(16u, a.capacity());
+    ASSERT_EQ(20, *a.find(2));
+    ASSERT_EQ(1u, b.size());
+    ASSERT_EQ(10, *b.find(1));
+    int_map c(move(a));
+    ASSERT_EQ(0u, a.size());
+    ASSERT_EQ(a.end(), a.find(2));
+    ASSERT_EQ(a.end(), a.begin());
+    ASSERT_FALSE(a.erase(2));
+    for (int i = 0; i < 20; ++i) {
+        a[i] = i;
+    }
+    ASSERT_EQ(20u, a.size());
+    ASSERT_EQ(13, *a.find(13));
+    ASSERT_EQ(30, *c.find(3));
+}
+
+TEST(chain_map_test, test_tuple_keys) {
+    hash_map<tuple<uint32_t, uint32_t, dynamic_string>, int> map(16);
+    for (uint32_t x = 0; x < 10; ++x) {
+        for (uint32_t y = 0; y < 10; ++y) {
+            map[tuple<uint32_t, uint32_t, dynamic_string>(x, y, dynamic_string("cell"))] = static_cast<int>(x * 10 + y);
+        }
+    }
+    ASSERT_EQ(100u, map.size());
+    ASSERT_EQ(47, *map.find(tuple<uint32_t, uint32_t, dynamic_string>(4u, 7u, dynamic_string("cell"))));
+    ASSERT_EQ(map.end(), map.find(tuple<uint32_t, uint32_t, dynamic_string>(4u, 7u, dynamic_string("cel"))));
+
+    hash_map<pair<int, int>, int> pairs;
+    pairs[pair<int, int>(3, 4)] = 7;
+    pairs[pair<int, int>(4, 3)] = 1;
+    ASSERT_EQ(2u, pairs.size());
+    ASSERT_EQ(7, *pairs.find(pair<int, int>(3, 4)));
+}
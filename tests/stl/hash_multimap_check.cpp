@@ -0,0 +1,160 @@
+/**
+ * @file hash_multimap_check.cpp
+ * @brief Unit testing for the hash multimap and value groups
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <gtest/gtest.h>
+#include <wlib/stl/HashMap.h>
+#include <wlib/stl/HashMultimap.h>
+#include <wlib/strings/String.h>
+
+using namespace wlp;
+
+namespace {
+
+    typedef hash_multimap<uint32_t, uint32_t> int_multimap;
+
+}
+
+TEST(hash_multimap_test, test_value_group) {
+    value_group<dynamic_string, 2> group;
+    ASSERT_TRUE(group.empty());
+    ASSERT_EQ(2u, group.capacity());
+    group.push_back(dynamic_string("a"));
+    group.push_back(dynamic_string("b"));
+    const dynamic_string *inline_data = group.data();
+    group.push_back(dynamic_string("c"));
+    ASSERT_NE(inline_data, group.data());
+    ASSERT_EQ(4u, group.capacity());
+    ASSERT_STREQ("c", group[2].c_str());
+
+    value_group<dynamic_string, 2> moved(move(group));
+    ASSERT_EQ(0u, group.size());
+    ASSERT_EQ(3u, moved.size());
+    ASSERT_STREQ("a", moved.as_span()[0].c_str());
+
+    moved.swap_remove(0);
+    ASSERT_EQ(2u, moved.size());
+    ASSERT_STREQ("c", moved[0].c_str());
+    ASSERT_STREQ("b", moved[1].c_str());
+
+    value_group<dynamic_string, 2> small;
+    small.push_back(dynamic_string("x"));
+    moved.swap(small);
+    ASSERT_EQ(1u, moved.size());
+    ASSERT_STREQ("x", moved[0].c_str());
+    ASSERT_EQ(2u, small.size());
+    ASSERT_STREQ("b", small[1].c_str());
+}
+
+TEST(hash_multimap_test, test_insert_and_range) {
+    int_multimap map;
+    ASSERT_TRUE(map.equal_range(3).empty());
+    ASSERT_EQ(0u, map.count(3));
+    for (uint32_t i = 0; i < 300; ++i) {
+        map.insert(i % 7, i);
+    }
+    ASSERT_EQ(300u, map.size());
+    ASSERT_EQ(7u, map.keys());
+    ASSERT_EQ(43u, map.count(3));
+    ASSERT_EQ(42u, map.count(6));
+    ASSERT_FALSE(map.contains(7));
+
+    // values of a key are contiguous and in insertion order
+    span<uint32_t> values = map.equal_range(3);
+    ASSERT_EQ(43u, values.size());
+    for (size_t j = 0; j < values.size(); ++j) {
+        ASSERT_EQ(3 + 7 * j, values[j]);
+    }
+    const int_multimap &c = map;
+    ASSERT_EQ(43u, c.equal_range(5).size());
+    ASSERT_EQ(5u, c.equal_range(5)[0]);
+
+    int_multimap::iterator it = map.find(4);
+    ASSERT_EQ(4u, it.key());
+    ASSERT_EQ(43u, it->size());
+
+    uint32_t total = 0;
+    size_t groups = 0;
+    for (int_multimap::const_iterator g = c.begin(); g != c.end(); ++g) {
+        total += static_cast<uint32_t>(g->size());
+        ++groups;
+    }
+    ASSERT_EQ(300u, total);
+    ASSERT_EQ(7u, groups);
+}
+
+TEST(hash_multimap_test, test_erase) {
+    hash_multimap<dynamic_string, int> map;
+    map.insert(dynamic_string("north"), 1);
+    map.insert(dynamic_string("north"), 2);
+    map.insert(dynamic_string("north"), 3);
+    map.insert(dynamic_string("south"), 4);
+    ASSERT_EQ(4u, map.size());
+
+    ASSERT_TRUE(map.erase_value(dynamic_string("north"), 1));
+    ASSERT_FALSE(map.erase_value(dynamic_string("north"), 1));
+    ASSERT_EQ(3u, map.size());
+    ASSERT_EQ(3, map.equal_range(dynamic_string("north"))[0]);
+    // removing a key's last value removes the key
+    ASSERT_TRUE(map.erase_value(dynamic_string("south"), 4));
+    ASSERT_FALSE(map.contains(dynamic_string("south")));
+    ASSERT_EQ(1u, map.keys());
+
+    ASSERT_EQ(2u, map.erase(dynamic_string("north")));
+    ASSERT_EQ(0u, map.erase(dynamic_string("north")));
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(0u, map.keys());
+
+    map.insert(dynamic_string("east"), 5);
+    map.insert(dynamic_string("east"), 6);
+    ASSERT_EQ(map.end(), map.erase(map.begin()));
+    ASSERT_EQ(0u, map.size());
+}
+
+TEST(hash_multimap_test, test_rehash_and_move) {
+    int_multimap map(4);
+    for (uint32_t i = 0; i < 2000; ++i) {
+        map.insert(i % 100, i);
+    }
+    ASSERT_EQ(100u, map.keys());
+    ASSERT_LT(4u, map.capacity());
+    for (uint32_t k = 0; k < 100; ++k) {
+        span<uint32_t> values = map.equal_range(k);
+        ASSERT_EQ(20u, values.size());
+        ASSERT_EQ(k + 1900, values[19]);
+    }
+    int_multimap moved(move(map));
+    ASSERT_EQ(0u, map.size());
+    ASSERT_EQ(2000u, moved.size());
+    int_multimap other;
+    other.insert(1u, 1u);
+    other.swap(moved);
+    ASSERT_EQ(1u, moved.size());
+    ASSERT_EQ(2000u, other.size());
+    moved = move(other);
+    ASSERT_EQ(2000u, moved.size());
+    ASSERT_EQ(20u, moved.count(42));
+}
+
+TEST(hash_multimap_test, test_table_equal_range) {
+    // the range of a key that ends its bucket reaches the next
+    // nonempty bucket, even past the number of elements
+    typedef hash_map<uint32_t, uint32_t>::table_type table_type;
+    table_type table(16);
+    table.insert_equal(make_tuple(1u, 10u));
+    table.insert_equal(make_tuple(1u, 11u));
+    table.insert_equal(make_tuple(9u, 90u));
+    pair<table_type::iterator, table_type::iterator> range = table.equal_range(1);
+    size_t n = 0;
+    for (table_type::iterator it = range.first(); it != range.second(); ++it) {
+        ASSERT_EQ(1u, it.key());
+        ++n;
+    }
+    ASSERT_EQ(2u, n);
+    ASSERT_EQ(9u, range.second().key());
+}
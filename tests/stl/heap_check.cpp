@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <wlib/stl/ArrayHeap.h>
+#include <wlib/strings/String.h>
 
 #include "../template_defs.h"
 
@@ -158,3 +159,42 @@ TEST(heap_test, test_move_assignment_operator) {
     heap0.pop();
     ASSERT_EQ(0u, heap0.size());
 }
+
+TEST(heap_test, test_heap_sort_moves_strings) {
+    const char *words[] = {"pear", "fig", "apple", "plum", "kiwi", "date", "lime", "cherry"};
+    const char *sorted[] = {"apple", "cherry", "date", "fig", "kiwi", "lime", "pear", "plum"};
+    array_list<dynamic_string> list(8);
+    const char *buffers[8];
+    for (int i = 0; i < 8; ++i) {
+        list.push_back(dynamic_string(words[i]));
+        buffers[i] = list[static_cast<size_t>(i)].c_str();
+    }
+    heap_sort(list);
+    // each string keeps the buffer it was created with
+    for (int i = 0; i < 8; ++i) {
+        const dynamic_string &str = list[static_cast<size_t>(i)];
+        ASSERT_STREQ(sorted[i], str.c_str());
+        int found = 0;
+        for (int j = 0; j < 8; ++j) {
+            found += buffers[j] == str.c_str() ? 1 : 0;
+        }
+        ASSERT_EQ(1, found);
+    }
+}
+
+TEST(heap_test, test_reuse_moved_from) {
+    array_heap<int> heap(4);
+    heap.push(3);
+    heap.push(7);
+    array_heap<int> moved(move(heap));
+    for (int i = 0; i < 10; ++i) {
+        heap.push(i);
+    }
+    ASSERT_EQ(10u, heap.size());
+    ASSERT_EQ(9, heap.top());
+    ASSERT_EQ(7, moved.top());
+    moved = move(heap);
+    heap.push(-2);
+    ASSERT_EQ(-2, heap.top());
+    ASSERT_EQ(9, moved.top());
+}
@@ -203,3 +203,21 @@ TEST(linked_list_test, test_find) {
     ASSERT_EQ(1, *list.find(1));
     ASSERT_EQ(list.begin(), list.find(1));
 }
+
+TEST(linked_list_test, test_reuse_moved_from) {
+    linked_list<int> list;
+    list.push_back(1);
+    list.push_back(2);
+    linked_list<int> moved(move(list));
+    ASSERT_EQ(list.begin(), list.end());
+    list.push_back(3);
+    list.push_front(4);
+    ASSERT_EQ(2u, list.size());
+    ASSERT_EQ(4, list.front());
+    ASSERT_EQ(3, list.back());
+    ASSERT_EQ(2, moved.back());
+    moved = move(list);
+    list.push_front(5);
+    ASSERT_EQ(5, list.back());
+    ASSERT_EQ(3, moved.back());
+}
@@ -388,3 +388,23 @@ TEST(open_map_test, insert_or_assign_rvalue) {
     ASSERT_FALSE(ret.second());
     ASSERT_STREQ("val2", ret.first()->c_str());
 }
+
+TEST(open_map_test, test_reuse_moved_from) {
+    int_map map(4);
+    map[1] = 10;
+    map[2] = 20;
+    int_map moved(move(map));
+    ASSERT_EQ(0u, map.capacity());
+    ASSERT_EQ(map.end(), map.find(1));
+    ASSERT_EQ(0u, map.erase(1));
+    for (int i = 0; i < 20; ++i) {
+        map[i] = i * 2;
+    }
+    ASSERT_EQ(20u, map.size());
+    ASSERT_EQ(26, *map.find(13));
+    ASSERT_EQ(20, *moved.find(2));
+    moved = move(map);
+    ASSERT_EQ(20u, moved.size());
+    ASSERT_TRUE(map.insert(5, 50).second());
+    ASSERT_EQ(50, map.at(5));
+}
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include <wlib/stl/PackedSequence.h>
+
+namespace wlp {
+
+    template
+    class packed_sequence<32>;
+
+    template
+    class packed_sequence<128>;
+
+}
+
+using namespace wlp;
+
+TEST(packed_sequence_test, test_empty) {
+    packed_sequence<> seq;
+    ASSERT_TRUE(seq.empty());
+    ASSERT_EQ(0u, seq.size());
+    ASSERT_EQ(0u, seq.block_count());
+    ASSERT_EQ(0u, seq.lower_bound(5));
+    ASSERT_EQ(seq.begin(), seq.end());
+}
+
+TEST(packed_sequence_test, test_monotonic_round_trip) {
+    packed_sequence<32> seq;
+    uint32_t t = 1000000;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        t += 10 + i % 7;
+        seq.push_back(t);
+    }
+    ASSERT_EQ(1000u, seq.size());
+    ASSERT_EQ(32u, seq.block_count());
+    uint32_t expect = 1000000;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        expect += 10 + i % 7;
+        ASSERT_EQ(expect, seq[i]);
+    }
+    uint32_t out[1000];
+    seq.decode(out);
+    ASSERT_EQ(seq[0], out[0]);
+    ASSERT_EQ(seq[999], out[999]);
+    ASSERT_EQ(seq[517], out[517]);
+}
+
+TEST(packed_sequence_test, test_signed_deltas_and_wraparound) {
+    packed_sequence<32> seq;
+    const uint32_t values[] = {5, 3, 0xffffffffu, 0, 7, 0x80000000u, 1, 1, 1, 0x7fffffffu};
+    for (uint32_t r = 0; r < 10; ++r) {
+        for (uint32_t i = 0; i < 10; ++i) {
+            seq.push_back(values[i]);
+        }
+    }
+    for (uint32_t i = 0; i < 100; ++i) {
+        ASSERT_EQ(values[i % 10], seq.at(i));
+    }
+    uint32_t i = 0;
+    for (packed_sequence<32>::const_iterator it = seq.begin(); it != seq.end(); ++it) {
+        ASSERT_EQ(values[i % 10], *it);
+        ++i;
+    }
+    ASSERT_EQ(100u, i);
+}
+
+TEST(packed_sequence_test, test_constant_block_uses_no_words) {
+    packed_sequence<> seq(1);
+    size_t before = seq.memory_usage();
+    for (uint32_t i = 0; i < 128 * 8; ++i) {
+        seq.push_back(42);
+    }
+    ASSERT_EQ(42u, seq[1000]);
+    ASSERT_GE(before + 8 * 12, seq.memory_usage());
+}
+
+TEST(packed_sequence_test, test_compresses_slow_counter) {
+    packed_sequence<> seq;
+    for (uint32_t i = 0; i < 128 * 64; ++i) {
+        seq.push_back(50000 + i / 16);
+    }
+    seq.shrink();
+    ASSERT_LT(seq.memory_usage(), 128 * 64 * sizeof(uint32_t) / 8);
+    ASSERT_EQ(50000u + 8191 / 16, seq[8191]);
+}
+
+TEST(packed_sequence_test, test_lower_bound) {
+    packed_sequence<32> seq;
+    for (uint32_t i = 0; i < 500; ++i) {
+        seq.push_back(i * 2 + 10);
+    }
+    ASSERT_EQ(0u, seq.lower_bound(0));
+    ASSERT_EQ(0u, seq.lower_bound(10));
+    ASSERT_EQ(1u, seq.lower_bound(11));
+    ASSERT_EQ(32u, seq.lower_bound(74));
+    ASSERT_EQ(33u, seq.lower_bound(75));
+    ASSERT_EQ(499u, seq.lower_bound(1008));
+    ASSERT_EQ(500u, seq.lower_bound(1009));
+    for (uint32_t v = 0; v < 1020; v += 3) {
+        const size_t idx = seq.lower_bound(v);
+        ASSERT_TRUE(idx == seq.size() || seq[idx] >= v);
+        ASSERT_TRUE(idx == 0 || seq[idx - 1] < v);
+    }
+}
+
+TEST(packed_sequence_test, test_lower_bound_duplicates) {
+    packed_sequence<32> seq;
+    for (uint32_t i = 0; i < 100; ++i) {
+        seq.push_back(i / 40);
+    }
+    ASSERT_EQ(40u, seq.lower_bound(1));
+    ASSERT_EQ(80u, seq.lower_bound(2));
+    ASSERT_EQ(100u, seq.lower_bound(3));
+}
+
+TEST(packed_sequence_test, test_clear_and_move) {
+    packed_sequence<32> seq;
+    for (uint32_t i = 0; i < 70; ++i) {
+        seq.push_back(i * i);
+    }
+    packed_sequence<32> moved(move(seq));
+    ASSERT_EQ(70u, moved.size());
+    ASSERT_EQ(69u * 69u, moved[69]);
+    ASSERT_EQ(40u * 40u, moved[40]);
+    moved.clear();
+    ASSERT_TRUE(moved.empty());
+    moved.push_back(9);
+    ASSERT_EQ(9u, moved[0]);
+}
+
+TEST(packed_sequence_test, test_reuse_moved_from) {
+    packed_sequence<32> seq;
+    for (uint32_t i = 0; i < 40; ++i) {
+        seq.push_back(i);
+    }
+    packed_sequence<32> moved(move(seq));
+    ASSERT_TRUE(seq.empty());
+    ASSERT_EQ(sizeof(packed_sequence<32>), seq.memory_usage());
+    // refill past several blocks, each packed after the sentinel
+    for (uint32_t i = 0; i < 100; ++i) {
+        seq.push_back(3 * i);
+    }
+    ASSERT_EQ(100u, seq.size());
+    ASSERT_EQ(297u, seq[99]);
+    ASSERT_EQ(96u, seq[32]);
+
+    packed_sequence<32> other;
+    other = move(seq);
+    ASSERT_EQ(sizeof(packed_sequence<32>), seq.memory_usage());
+    for (uint32_t i = 0; i < 70; ++i) {
+        seq.push_back(i + 1000);
+    }
+    ASSERT_EQ(1069u, seq[69]);
+    ASSERT_EQ(297u, other[99]);
+    ASSERT_EQ(39u, moved[39]);
+}
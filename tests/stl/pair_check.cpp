@@ -30,3 +30,13 @@ TEST(pair_test, test_pair_const_equality) {
     const pair<int, const char *> pair2{8, "nothing"};
     ASSERT_FALSE(pair1 == pair2);
 }
+
+TEST(pair_test, test_pair_of_references_move) {
+    int a = 1;
+    int b = 2;
+    pair<int &, int &> pair1(a, b);
+    pair<int &, int &> pair2(move(pair1));
+    pair2.first() = 3;
+    ASSERT_EQ(3, a);
+    ASSERT_EQ(&b, &pair2.second());
+}
@@ -0,0 +1,207 @@
+/**
+ * @file parallel_check.cpp
+ * @brief Unit testing for the thread team and parallel algorithms
+ *
+ * Inputs span several blocks with a partial last block, and each
+ * algorithm is checked against a sequential loop for teams of one,
+ * two, and four threads.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <gtest/gtest.h>
+#include <wlib/stl/ArrayList.h>
+#include <wlib/stl/Parallel.h>
+
+using namespace wlp;
+
+namespace {
+
+    const size_t count = 5 * parallel_block + 123;
+    const size_t team_sizes[] = {1, 2, 4};
+
+    void fill(array_list<int32_t> &list, size_t n) {
+        uint32_t state = 7;
+        list.clear();
+        for (size_t i = 0; i < n; ++i) {
+            state = state * 1103515245u + 12345u;
+            list.push_back(static_cast<int32_t>((state >> 8) % 1000) - 500);
+        }
+    }
+
+    int32_t add(int32_t a, int32_t b) {
+        return a + b;
+    }
+
+    bool is_positive(int32_t v) {
+        return v > 0;
+    }
+
+}
+
+TEST(parallel_test, test_team_runs_every_task) {
+    for (size_t threads : team_sizes) {
+        thread_team team(threads);
+        ASSERT_EQ(threads, team.size());
+        uint32_t hits[100];
+        memset(hits, 0, sizeof(hits));
+        team.run(100, [&hits](size_t task) { ++hits[task]; });
+        for (uint32_t h : hits) {
+            ASSERT_EQ(1u, h);
+        }
+        // a team runs many jobs
+        size_t total = 0;
+        for (int job = 0; job < 50; ++job) {
+            team.run(8, [&total](size_t task) { __atomic_fetch_add(&total, task, __ATOMIC_RELAXED); });
+        }
+        ASSERT_EQ(50u * 28u, total);
+        team.run(0, [](size_t) { FAIL(); });
+    }
+    thread_team hardware;
+    ASSERT_LE(1u, hardware.size());
+}
+
+TEST(parallel_test, test_reduce) {
+    array_list<int32_t> list;
+    fill(list, count);
+    int32_t expected = 0;
+    int32_t largest = -1000;
+    for (size_t i = 0; i < count; ++i) {
+        expected += list[i];
+        largest = list[i] > largest ? list[i] : largest;
+    }
+    for (size_t threads : team_sizes) {
+        thread_team team(threads);
+        ASSERT_EQ(expected, parallel_reduce(team, list.as_span(), 0, add));
+        ASSERT_EQ(largest, parallel_reduce(team, list.as_span(), -1000,
+                                           [](int32_t a, int32_t b) { return a > b ? a : b; }));
+        ASSERT_EQ(7, parallel_reduce(team, span<const int32_t>(), 7, add));
+        ASSERT_EQ(list[0] + list[1], parallel_reduce(team, list.as_span().first(2), 0, add));
+    }
+}
+
+TEST(parallel_test, test_reduce_deterministic) {
+    array_list<float> list;
+    for (size_t i = 0; i < count; ++i) {
+        list.push_back(1.0f / static_cast<float>(i + 1));
+    }
+    auto add_float = [](float a, float b) { return a + b; };
+    thread_team one(1);
+    const float expected = parallel_reduce(one, list.as_span(), 0.0f, add_float);
+    for (size_t threads : team_sizes) {
+        thread_team team(threads);
+        for (int run = 0; run < 5; ++run) {
+            ASSERT_EQ(expected, parallel_reduce(team, list.as_span(), 0.0f, add_float));
+        }
+    }
+}
+
+TEST(parallel_test, test_scan) {
+    array_list<int32_t> list;
+    array_list<int32_t> out(count);
+    fill(list, count);
+    for (size_t i = 0; i < count; ++i) {
+        out.push_back(0);
+    }
+    for (size_t threads : team_sizes) {
+        thread_team team(threads);
+        ASSERT_EQ(count, parallel_inclusive_scan(team, list.as_span(), out.as_span(), 0, add));
+        int32_t sum = 0;
+        for (size_t i = 0; i < count; ++i) {
+            sum += list[i];
+            ASSERT_EQ(sum, out[i]);
+        }
+        ASSERT_EQ(count, parallel_exclusive_scan(team, list.as_span(), out.as_span(), 0, add));
+        sum = 0;
+        for (size_t i = 0; i < count; ++i) {
+            ASSERT_EQ(sum, out[i]);
+            sum += list[i];
+        }
+    }
+
+    // in place, and with an output shorter than the input
+    array_list<int32_t> copy;
+    fill(copy, count);
+    thread_team team(2);
+    parallel_inclusive_scan(team, copy.as_span(), copy.as_span(), 0, add);
+    ASSERT_EQ(out[count - 1] + list[count - 1], copy[count - 1]);
+    ASSERT_EQ(10u, parallel_inclusive_scan(team, list.as_span(), out.as_span().first(10), 0, add));
+    // a single block starts from the identity
+    ASSERT_EQ(10u, parallel_exclusive_scan(team, list.as_span().first(10), out.as_span(), 5, add));
+    ASSERT_EQ(5, out[0]);
+    ASSERT_EQ(5 + list[0], out[1]);
+}
+
+TEST(parallel_test, test_partition_compact) {
+    array_list<int32_t> list;
+    array_list<int32_t> out(count);
+    fill(list, count);
+    for (size_t i = 0; i < count; ++i) {
+        out.push_back(0);
+    }
+    array_list<int32_t> pass;
+    array_list<int32_t> fail;
+    for (size_t i = 0; i < count; ++i) {
+        if (is_positive(list[i])) {
+            pass.push_back(list[i]);
+        } else {
+            fail.push_back(list[i]);
+        }
+    }
+    for (size_t threads : team_sizes) {
+        thread_team team(threads);
+        ASSERT_EQ(pass.size(), parallel_partition(team, list.as_span(), out.as_span(), is_positive));
+        for (size_t i = 0; i < pass.size(); ++i) {
+            ASSERT_EQ(pass[i], out[i]);
+        }
+        for (size_t i = 0; i < fail.size(); ++i) {
+            ASSERT_EQ(fail[i], out[pass.size() + i]);
+        }
+
+        fill(out, count);
+        ASSERT_EQ(pass.size(), parallel_compact(team, list.as_span(), out.as_span(), is_positive));
+        for (size_t i = 0; i < pass.size(); ++i) {
+            ASSERT_EQ(pass[i], out[i]);
+        }
+    }
+
+    // a short output keeps the leading elements
+    thread_team team(2);
+    int32_t few[4];
+    ASSERT_EQ(pass.size(), parallel_compact(team, list.as_span(), make_span(few), is_positive));
+    for (size_t i = 0; i < 4; ++i) {
+        ASSERT_EQ(pass[i], few[i]);
+    }
+}
+
+TEST(parallel_test, test_histogram) {
+    array_list<int32_t> list;
+    fill(list, count);
+    uint32_t expected[10];
+    memset(expected, 0, sizeof(expected));
+    for (size_t i = 0; i < count; ++i) {
+        ++expected[(list[i] + 500) / 100];
+    }
+    auto bin = [](int32_t v) { return static_cast<size_t>((v + 500) / 100); };
+    for (size_t threads : team_sizes) {
+        thread_team team(threads);
+        uint32_t bins[10];
+        memset(bins, 0, sizeof(bins));
+        parallel_histogram(team, list.as_span(), make_span(bins), bin);
+        for (size_t k = 0; k < 10; ++k) {
+            ASSERT_EQ(expected[k], bins[k]);
+        }
+        // elements past the last bin are dropped
+        uint32_t low[5];
+        memset(low, 0, sizeof(low));
+        parallel_histogram(team, list.as_span(), make_span(low), bin);
+        uint32_t total = 0;
+        for (size_t k = 0; k < 5; ++k) {
+            ASSERT_EQ(expected[k], low[k]);
+            total += low[k];
+        }
+        ASSERT_GT(count, total);
+    }
+}
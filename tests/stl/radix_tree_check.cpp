@@ -0,0 +1,235 @@
+#include <gtest/gtest.h>
+#include <wlib/stl/RadixTree.h>
+
+namespace wlp {
+
+    template
+    class radix_tree<int>;
+
+    template
+    class radix_tree<dynamic_string>;
+
+}
+
+using namespace wlp;
+
+typedef radix_tree<int> int_tree;
+
+TEST(radix_tree_test, test_empty_on_construct) {
+    int_tree tree;
+    ASSERT_TRUE(tree.empty());
+    ASSERT_EQ(0u, tree.size());
+    ASSERT_EQ(nullptr, tree.find("a"));
+    ASSERT_EQ(nullptr, tree.find(""));
+    ASSERT_EQ(nullptr, tree.longest_prefix("abc"));
+    ASSERT_FALSE(tree.erase("a"));
+    ASSERT_EQ(0u, tree.for_each([](const char *, size_t, int &) {}));
+}
+
+TEST(radix_tree_test, test_insert_find) {
+    int_tree tree;
+    pair<int *, bool> res = tree.insert("sensor/temp", 1);
+    ASSERT_TRUE(res.second());
+    ASSERT_EQ(1, *res.first());
+    res = tree.insert("sensor/temp", 2);
+    ASSERT_FALSE(res.second());
+    ASSERT_EQ(1, *res.first());
+    res = tree.insert_or_assign("sensor/temp", 3);
+    ASSERT_FALSE(res.second());
+    ASSERT_EQ(3, *res.first());
+    tree.insert("sensor/humidity", 4);
+    tree.insert("motor/left", 5);
+    ASSERT_EQ(3u, tree.size());
+    ASSERT_EQ(3, *tree.find("sensor/temp"));
+    ASSERT_EQ(4, *tree.find("sensor/humidity"));
+    ASSERT_EQ(5, *tree.find("motor/left"));
+    ASSERT_EQ(nullptr, tree.find("sensor/"));
+    ASSERT_EQ(nullptr, tree.find("sensor/tempx"));
+    ASSERT_EQ(nullptr, tree.find("motor/right"));
+    ASSERT_FALSE(tree.contains("motor"));
+    tree["motor"] = 6;
+    ASSERT_TRUE(tree.contains("motor"));
+    ASSERT_EQ(4u, tree.size());
+    const int_tree &ctree = tree;
+    ASSERT_EQ(6, *ctree.find("motor"));
+}
+
+TEST(radix_tree_test, test_prefix_keys) {
+    int_tree tree;
+    tree.insert("abcdef", 6);
+    tree.insert("abc", 3);
+    tree.insert("", 0);
+    tree.insert("abcdefghijklmnopqrstuvwxyz0123456789", 36);
+    tree.insert("ab", 2);
+    ASSERT_EQ(5u, tree.size());
+    ASSERT_EQ(0, *tree.find(""));
+    ASSERT_EQ(2, *tree.find("ab"));
+    ASSERT_EQ(3, *tree.find("abc"));
+    ASSERT_EQ(6, *tree.find("abcdef"));
+    ASSERT_EQ(36, *tree.find("abcdefghijklmnopqrstuvwxyz0123456789"));
+    ASSERT_EQ(nullptr, tree.find("a"));
+    ASSERT_EQ(nullptr, tree.find("abcdefghijklmnopqrstuvwxyz012345678"));
+    tree.insert("abcdefghijklmnopqrstuvwxyz0123", 30);
+    tree.insert("abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz", 62);
+    tree.insert("abcdefghijklmnopqrstuvwxyz0123456789abcdefghij", 46);
+    ASSERT_EQ(30, *tree.find("abcdefghijklmnopqrstuvwxyz0123"));
+    ASSERT_EQ(36, *tree.find("abcdefghijklmnopqrstuvwxyz0123456789"));
+    ASSERT_EQ(46, *tree.find("abcdefghijklmnopqrstuvwxyz0123456789abcdefghij"));
+    ASSERT_EQ(62, *tree.find("abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz"));
+    ASSERT_TRUE(tree.erase("abcdefghijklmnopqrstuvwxyz0123456789abcdefghij"));
+    ASSERT_TRUE(tree.erase("abcdefghijklmnopqrstuvwxyz0123456789"));
+    ASSERT_EQ(62, *tree.find("abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz"));
+    ASSERT_EQ(30, *tree.find("abcdefghijklmnopqrstuvwxyz0123"));
+    const char bytes[] = {'a', '\0', 'b'};
+    tree.insert(radix_key(bytes, 3), 7);
+    ASSERT_EQ(7, *tree.find(radix_key(bytes, 3)));
+    ASSERT_EQ(nullptr, tree.find(radix_key(bytes, 2)));
+}
+
+TEST(radix_tree_test, test_node_growth_and_shrink) {
+    int_tree tree;
+    char key[3] = {'k', 0, 0};
+    for (int c = 0; c < 256; ++c) {
+        key[1] = static_cast<char>(c);
+        ASSERT_TRUE(tree.insert(radix_key(key, 2), c).second());
+    }
+    ASSERT_EQ(256u, tree.size());
+    for (int c = 0; c < 256; ++c) {
+        key[1] = static_cast<char>(c);
+        ASSERT_EQ(c, *tree.find(radix_key(key, 2)));
+    }
+    const size_t full = tree.memory_usage();
+    for (int c = 255; c >= 2; --c) {
+        key[1] = static_cast<char>(c);
+        ASSERT_TRUE(tree.erase(radix_key(key, 2)));
+        ASSERT_FALSE(tree.contains(radix_key(key, 2)));
+        for (int d = 0; d < c; d += 17) {
+            key[1] = static_cast<char>(d);
+            ASSERT_EQ(d, *tree.find(radix_key(key, 2)));
+        }
+    }
+    ASSERT_EQ(2u, tree.size());
+    ASSERT_LT(tree.memory_usage(), full / 8);
+    key[1] = 1;
+    ASSERT_EQ(1, *tree.find(radix_key(key, 2)));
+}
+
+TEST(radix_tree_test, test_longest_prefix) {
+    int_tree tree;
+    tree.insert("/", 1);
+    tree.insert("/api", 2);
+    tree.insert("/api/v1/users", 3);
+    tree.insert("/static", 4);
+    size_t matched = 99;
+    ASSERT_EQ(3, *tree.longest_prefix("/api/v1/users/17", &matched));
+    ASSERT_EQ(13u, matched);
+    ASSERT_EQ(2, *tree.longest_prefix("/api/v1/groups", &matched));
+    ASSERT_EQ(4u, matched);
+    ASSERT_EQ(2, *tree.longest_prefix("/api", &matched));
+    ASSERT_EQ(4u, matched);
+    ASSERT_EQ(1, *tree.longest_prefix("/stat", &matched));
+    ASSERT_EQ(1u, matched);
+    ASSERT_EQ(nullptr, tree.longest_prefix("api", &matched));
+    ASSERT_EQ(0u, matched);
+    tree.insert("", 0);
+    ASSERT_EQ(0, *tree.longest_prefix("api"));
+}
+
+TEST(radix_tree_test, test_prefix_iteration_order) {
+    int_tree tree;
+    const char *keys[] = {"car", "cart", "carbon", "cat", "dog", "ca", "c", "cartel", "zebra"};
+    for (int i = 0; i < 9; ++i) {
+        tree.insert(keys[i], i);
+    }
+    char seen[128];
+    size_t pos = 0;
+    auto collect = [&seen, &pos](const char *key, size_t len, int &) {
+        memcpy(seen + pos, key, len);
+        pos += len;
+        seen[pos++] = ' ';
+        seen[pos] = '\0';
+    };
+    ASSERT_EQ(4u, tree.for_each_prefix("car", collect));
+    ASSERT_STREQ("car carbon cart cartel ", seen);
+    pos = 0;
+    ASSERT_EQ(2u, tree.for_each_prefix("cart", collect));
+    ASSERT_STREQ("cart cartel ", seen);
+    pos = 0;
+    ASSERT_EQ(1u, tree.for_each_prefix("carb", collect));
+    ASSERT_STREQ("carbon ", seen);
+    pos = 0;
+    ASSERT_EQ(0u, tree.for_each_prefix("cab", collect));
+    ASSERT_EQ(0u, tree.for_each_prefix("dogs", collect));
+    ASSERT_EQ(0u, pos);
+    ASSERT_EQ(9u, tree.for_each(collect));
+    ASSERT_STREQ("c ca car carbon cart cartel cat dog zebra ", seen);
+    tree.for_each_prefix("ca", [](const char *, size_t, int &val) { val = -1; });
+    ASSERT_EQ(-1, *tree.find("cartel"));
+    ASSERT_EQ(6, *tree.find("c"));
+}
+
+TEST(radix_tree_test, test_erase_merges_paths) {
+    int_tree tree;
+    tree.insert("romane", 1);
+    tree.insert("romanus", 2);
+    tree.insert("romulus", 3);
+    tree.insert("rubens", 4);
+    tree.insert("ruber", 5);
+    tree.insert("rom", 6);
+    const size_t before = tree.memory_usage();
+    ASSERT_FALSE(tree.erase("roman"));
+    ASSERT_FALSE(tree.erase("romanes"));
+    ASSERT_TRUE(tree.erase("romane"));
+    ASSERT_TRUE(tree.erase("rom"));
+    ASSERT_TRUE(tree.erase("rubens"));
+    ASSERT_EQ(3u, tree.size());
+    ASSERT_LT(tree.memory_usage(), before);
+    ASSERT_EQ(2, *tree.find("romanus"));
+    ASSERT_EQ(3, *tree.find("romulus"));
+    ASSERT_EQ(5, *tree.find("ruber"));
+    ASSERT_EQ(nullptr, tree.find("rom"));
+    ASSERT_TRUE(tree.erase("romanus"));
+    ASSERT_TRUE(tree.erase("romulus"));
+    ASSERT_EQ(5, *tree.find("ruber"));
+    ASSERT_TRUE(tree.erase("ruber"));
+    ASSERT_TRUE(tree.empty());
+    tree.insert("again", 7);
+    ASSERT_EQ(7, *tree.find("again"));
+}
+
+TEST(radix_tree_test, test_string_keys_and_move) {
+    radix_tree<dynamic_string> tree;
+    static_string<16> route("home/kitchen");
+    dynamic_string light("home/kitchen/light");
+    tree.insert(route, dynamic_string("room"));
+    tree.insert(light, dynamic_string("lamp"));
+    ASSERT_STREQ("room", tree.find("home/kitchen")->c_str());
+    ASSERT_STREQ("lamp", tree.find(light)->c_str());
+    ASSERT_STREQ("lamp", tree.longest_prefix(static_string<32>("home/kitchen/light/on"))->c_str());
+    radix_tree<dynamic_string> moved(move(tree));
+    ASSERT_TRUE(tree.empty());
+    ASSERT_EQ(nullptr, tree.find(route));
+    ASSERT_EQ(2u, moved.size());
+    tree = move(moved);
+    ASSERT_STREQ("room", tree.find(route)->c_str());
+    tree.clear();
+    ASSERT_TRUE(tree.empty());
+}
+
+TEST(radix_tree_test, test_reuse_moved_from) {
+    int_tree tree;
+    tree.insert("alpha", 1);
+    tree.insert("alps", 2);
+    int_tree moved(move(tree));
+    ASSERT_EQ(nullptr, tree.longest_prefix("alpha"));
+    ASSERT_FALSE(tree.erase("alpha"));
+    tree.insert("beta", 3);
+    tree.insert("bet", 4);
+    ASSERT_EQ(2u, tree.size());
+    ASSERT_EQ(3, *tree.find("beta"));
+    ASSERT_EQ(2, *moved.find("alps"));
+    moved = move(tree);
+    tree.insert("gamma", 5);
+    ASSERT_EQ(5, *tree.find("gamma"));
+    ASSERT_EQ(4, *moved.find("bet"));
+}
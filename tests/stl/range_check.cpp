@@ -0,0 +1,170 @@
+/**
+ * @file range_check.cpp
+ * @brief Unit testing for ranges and the range adaptors
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <gtest/gtest.h>
+#include <wlib/stl/ArrayList.h>
+#include <wlib/stl/HashMap.h>
+#include <wlib/stl/LinkedList.h>
+#include <wlib/stl/OpenMap.h>
+#include <wlib/stl/Range.h>
+#include <wlib/stl/TreeMap.h>
+
+using namespace wlp;
+
+namespace {
+
+    bool is_even(int v) {
+        return v % 2 == 0;
+    }
+
+    int square(int v) {
+        return v * v;
+    }
+
+    template<typename Range>
+    int sum(const Range &r) {
+        int total = 0;
+        for (int v : r) {
+            total += v;
+        }
+        return total;
+    }
+
+}
+
+TEST(range_test, test_make_range) {
+    array_list<int> list;
+    ASSERT_TRUE(make_range(list).empty());
+    for (int i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    range<array_list<int>::iterator> r = make_range(list);
+    ASSERT_FALSE(r.empty());
+    ASSERT_EQ(10u, r.size());
+    ASSERT_EQ(45, sum(r));
+    for (int &v : r) {
+        v *= 2;
+    }
+    ASSERT_EQ(18, list[9]);
+
+    const array_list<int> &clist = list;
+    range<array_list<int>::const_iterator> cr = make_range(clist);
+    ASSERT_EQ(90, sum(cr));
+    ASSERT_EQ(90, sum(make_range(list.begin(), list.end())));
+}
+
+TEST(range_test, test_filter_transform) {
+    array_list<int> list;
+    for (int i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    ASSERT_EQ(20, sum(make_range(list) | filtered(is_even)));
+    ASSERT_EQ(285, sum(make_range(list) | transformed(square)));
+    ASSERT_EQ(120, sum(make_range(list) | filtered(is_even) | transformed(square)));
+    ASSERT_EQ(120, sum(make_range(list) | transformed(square) | filtered(is_even)));
+    ASSERT_EQ(0u, (make_range(list) | filtered([](int v) { return v > 100; })).size());
+
+    // filtered elements are references into the container
+    for (int &v : make_range(list) | filtered(is_even)) {
+        v = -1;
+    }
+    ASSERT_EQ(-1, list[4]);
+    ASSERT_EQ(5, list[5]);
+
+    int offset = 3;
+    auto shifted = make_range(list) | transformed([offset](int v) { return v + offset; });
+    ASSERT_EQ(2, *shifted.begin());
+}
+
+TEST(range_test, test_take_drop) {
+    array_list<int> list;
+    for (int i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    ASSERT_EQ(3, sum(make_range(list) | taken(3)));
+    ASSERT_EQ(45, sum(make_range(list) | taken(30)));
+    ASSERT_TRUE((make_range(list) | taken(0)).empty());
+    ASSERT_EQ(42, sum(make_range(list) | dropped(3)));
+    ASSERT_TRUE((make_range(list) | dropped(30)).empty());
+    ASSERT_EQ(12, sum(make_range(list) | dropped(3) | taken(3)));
+    ASSERT_EQ(6, sum(make_range(list) | filtered(is_even) | dropped(1) | taken(2)));
+}
+
+TEST(range_test, test_zip_enumerate) {
+    array_list<int> a;
+    linked_list<int> b;
+    for (int i = 0; i < 5; ++i) {
+        a.push_back(i);
+        b.push_back(i * 10);
+    }
+    b.push_back(50);
+    int total = 0;
+    size_t n = 0;
+    for (pair<int &, int &> p : zip(make_range(a), make_range(b))) {
+        total += p.first() * p.second();
+        p.first() = -p.first();
+        ++n;
+    }
+    ASSERT_EQ(5u, n);
+    ASSERT_EQ(300, total);
+    ASSERT_EQ(-4, a[4]);
+
+    size_t expected = 0;
+    for (pair<size_t, int &> p : make_range(b) | enumerated()) {
+        ASSERT_EQ(expected, p.first());
+        ASSERT_EQ(static_cast<int>(expected * 10), p.second());
+        ++expected;
+    }
+    ASSERT_EQ(6u, expected);
+}
+
+TEST(range_test, test_chunk) {
+    array_list<int> list;
+    for (int i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    int sums[4] = {0, 0, 0, 0};
+    size_t chunks = 0;
+    for (auto chunk : make_range(list) | chunked(3)) {
+        sums[chunks++] = sum(chunk);
+    }
+    ASSERT_EQ(4u, chunks);
+    ASSERT_EQ(3, sums[0]);
+    ASSERT_EQ(12, sums[1]);
+    ASSERT_EQ(21, sums[2]);
+    ASSERT_EQ(9, sums[3]);
+    ASSERT_EQ(2u, (make_range(list) | chunked(5)).size());
+}
+
+TEST(range_test, test_map_iterators) {
+    hash_map<int, int> hmap(16);
+    open_map<int, int> omap(16);
+    tree_map<int, int> tmap;
+    for (int i = 0; i < 10; ++i) {
+        hmap.insert(i, i);
+        omap.insert(i, i);
+        tmap.insert(i, i);
+    }
+    ASSERT_EQ(120, sum(make_range(hmap) | filtered(is_even) | transformed(square)));
+    ASSERT_EQ(120, sum(make_range(omap) | filtered(is_even) | transformed(square)));
+    ASSERT_EQ(120, sum(make_range(tmap) | filtered(is_even) | transformed(square)));
+    range<hash_map<int, int>::iterator> hr = make_range(hmap);
+    range<hash_map<int, int>::iterator> hcopy(hr);
+    hr = make_range(hmap.begin(), hmap.begin());
+    ASSERT_TRUE(hr.empty());
+    ASSERT_EQ(45, sum(hcopy));
+    // tree maps iterate in key order
+    ASSERT_EQ(3, sum(make_range(tmap) | taken(3)));
+    size_t i = 0;
+    for (pair<size_t, int &> p : make_range(tmap) | enumerated()) {
+        ASSERT_EQ(static_cast<int>(i++), p.second());
+        ASSERT_EQ(i - 1, p.first());
+    }
+    ASSERT_EQ(10u, i);
+}
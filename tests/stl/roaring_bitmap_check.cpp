@@ -0,0 +1,282 @@
+#include <gtest/gtest.h>
+#include <wlib/stl/RoaringBitmap.h>
+
+using namespace wlp;
+
+TEST(roaring_bitmap_test, test_empty) {
+    roaring_bitmap set;
+    ASSERT_TRUE(set.empty());
+    ASSERT_EQ(0u, set.cardinality());
+    ASSERT_FALSE(set.contains(0));
+    ASSERT_FALSE(set.remove(7));
+    ASSERT_EQ(set.begin(), set.end());
+}
+
+TEST(roaring_bitmap_test, test_add_contains_remove) {
+    roaring_bitmap set;
+    ASSERT_TRUE(set.add(5));
+    ASSERT_FALSE(set.add(5));
+    ASSERT_TRUE(set.add(0xffffffffu));
+    ASSERT_TRUE(set.add(70000));
+    ASSERT_TRUE(set.add(0));
+    ASSERT_EQ(4u, set.cardinality());
+    ASSERT_EQ(3u, set.chunk_count());
+    ASSERT_TRUE(set.contains(0));
+    ASSERT_TRUE(set.contains(5));
+    ASSERT_TRUE(set.contains(70000));
+    ASSERT_TRUE(set.contains(0xffffffffu));
+    ASSERT_FALSE(set.contains(6));
+    ASSERT_FALSE(set.contains(70001));
+    ASSERT_TRUE(set.remove(70000));
+    ASSERT_FALSE(set.remove(70000));
+    ASSERT_FALSE(set.contains(70000));
+    ASSERT_EQ(2u, set.chunk_count());
+    ASSERT_EQ(3u, set.cardinality());
+}
+
+TEST(roaring_bitmap_test, test_array_bitmap_transitions) {
+    roaring_bitmap set;
+    for (uint32_t i = 0; i < 4096; ++i) {
+        set.add(i * 16);
+    }
+    set.add(3);
+    ASSERT_EQ(4097u, set.cardinality());
+    for (uint32_t i = 0; i < 4096; ++i) {
+        ASSERT_TRUE(set.contains(i * 16));
+        ASSERT_FALSE(set.contains(i * 16 + 1));
+    }
+    ASSERT_TRUE(set.contains(3));
+    set.remove(3);
+    ASSERT_EQ(4096u, set.cardinality());
+    ASSERT_FALSE(set.contains(3));
+    for (uint32_t i = 0; i < 4096; ++i) {
+        set.remove(i * 16);
+    }
+    ASSERT_TRUE(set.empty());
+}
+
+TEST(roaring_bitmap_test, test_ranges_and_runs) {
+    roaring_bitmap set;
+    set.add_range(100, 200000);
+    ASSERT_EQ(200000u - 100u + 1u, set.cardinality());
+    ASSERT_EQ(4u, set.chunk_count());
+    ASSERT_LT(set.memory_usage(), 256u);
+    ASSERT_FALSE(set.contains(99));
+    ASSERT_TRUE(set.contains(100));
+    ASSERT_TRUE(set.contains(65535));
+    ASSERT_TRUE(set.contains(65536));
+    ASSERT_TRUE(set.contains(200000));
+    ASSERT_FALSE(set.contains(200001));
+
+    ASSERT_TRUE(set.remove(1000));
+    ASSERT_FALSE(set.contains(1000));
+    ASSERT_TRUE(set.contains(999));
+    ASSERT_TRUE(set.contains(1001));
+    ASSERT_TRUE(set.add(1000));
+    ASSERT_TRUE(set.add(99));
+    ASSERT_TRUE(set.add(200001));
+    ASSERT_EQ(200001u - 99u + 1u, set.cardinality());
+
+    set.add_range(0xfffffff0u, 0xffffffffu);
+    ASSERT_TRUE(set.contains(0xffffffffu));
+    ASSERT_EQ(200001u - 99u + 1u + 16u, set.cardinality());
+}
+
+TEST(roaring_bitmap_test, test_run_optimize) {
+    roaring_bitmap set;
+    for (uint32_t i = 0; i < 60000; ++i) {
+        if (i % 1000 < 900) {
+            set.add(i);
+        }
+    }
+    const size_t before = set.memory_usage();
+    set.run_optimize();
+    ASSERT_LT(set.memory_usage(), before / 10);
+    ASSERT_EQ(54000u, set.cardinality());
+    for (uint32_t i = 0; i < 60000; i += 7) {
+        ASSERT_EQ(i % 1000 < 900, set.contains(i));
+    }
+}
+
+TEST(roaring_bitmap_test, test_set_operations) {
+    roaring_bitmap evens;
+    roaring_bitmap threes;
+    roaring_bitmap range;
+    for (uint32_t i = 0; i < 300000; i += 2) {
+        evens.add(i);
+    }
+    for (uint32_t i = 0; i < 300000; i += 3) {
+        threes.add(i);
+    }
+    range.add_range(50000, 150000);
+
+    roaring_bitmap both = evens & threes;
+    roaring_bitmap either = evens | threes;
+    roaring_bitmap only = evens - threes;
+    roaring_bitmap clipped = threes & range;
+    roaring_bitmap outside = threes - range;
+    roaring_bitmap merged = range | evens;
+    for (uint32_t i = 0; i < 300000; ++i) {
+        const bool e = i % 2 == 0;
+        const bool t = i % 3 == 0;
+        const bool r = i >= 50000 && i <= 150000;
+        ASSERT_EQ(e && t, both.contains(i));
+        ASSERT_EQ(e || t, either.contains(i));
+        ASSERT_EQ(e && !t, only.contains(i));
+        ASSERT_EQ(t && r, clipped.contains(i));
+        ASSERT_EQ(t && !r, outside.contains(i));
+        ASSERT_EQ(r || e, merged.contains(i));
+    }
+    ASSERT_EQ(50000u, both.cardinality());
+    ASSERT_EQ(200000u, either.cardinality());
+
+    roaring_bitmap acc = evens.clone();
+    acc |= threes;
+    ASSERT_TRUE(acc == either);
+    acc &= range;
+    acc -= threes;
+    ASSERT_TRUE(acc == ((evens & range) - threes));
+    ASSERT_TRUE(acc != either);
+    ASSERT_TRUE((evens - evens).empty());
+}
+
+TEST(roaring_bitmap_test, test_run_set_operations) {
+    roaring_bitmap a;
+    roaring_bitmap b;
+    a.add_range(10, 100);
+    a.add_range(200, 300);
+    b.add_range(50, 250);
+    b.add_range(1000, 1010);
+    roaring_bitmap u = a | b;
+    roaring_bitmap n = a & b;
+    roaring_bitmap d = a - b;
+    for (uint32_t i = 0; i < 1100; ++i) {
+        const bool x = (i >= 10 && i <= 100) || (i >= 200 && i <= 300);
+        const bool y = (i >= 50 && i <= 250) || (i >= 1000 && i <= 1010);
+        ASSERT_EQ(x || y, u.contains(i));
+        ASSERT_EQ(x && y, n.contains(i));
+        ASSERT_EQ(x && !y, d.contains(i));
+    }
+    ASSERT_EQ(291u + 11u, u.cardinality());
+    ASSERT_EQ(51u + 51u, n.cardinality());
+    ASSERT_EQ(40u + 50u, d.cardinality());
+}
+
+TEST(roaring_bitmap_test, test_iteration_order) {
+    roaring_bitmap set;
+    set.add(0xfffffffeu);
+    set.add_range(65530, 65545);
+    for (uint32_t i = 0; i < 5000; ++i) {
+        set.add(1000000 + i * 3);
+    }
+    set.add(7);
+    uint32_t prev = 0;
+    size_t n = 0;
+    for (roaring_bitmap::iterator it = set.begin(); it != set.end(); ++it) {
+        ASSERT_TRUE(set.contains(*it));
+        ASSERT_TRUE(n == 0 || *it > prev);
+        prev = *it;
+        ++n;
+    }
+    ASSERT_EQ(set.cardinality(), n);
+    ASSERT_EQ(0xfffffffeu, prev);
+    ASSERT_EQ(7u, *set.begin());
+}
+
+TEST(roaring_bitmap_test, test_serialize_round_trip) {
+    roaring_bitmap set;
+    set.add(3);
+    set.add(100000);
+    set.add_range(500000, 600000);
+    for (uint32_t i = 0; i < 10000; ++i) {
+        set.add(2000000 + i * 5);
+    }
+    const size_t n = set.serialized_size();
+    uint8_t *buf = create<uint8_t[]>(n);
+    ASSERT_EQ(n, set.serialize(buf));
+
+    roaring_bitmap copy;
+    copy.add(42);
+    ASSERT_TRUE(copy.deserialize(buf, n));
+    ASSERT_FALSE(copy.contains(42));
+    ASSERT_TRUE(copy == set);
+    ASSERT_EQ(set.cardinality(), copy.cardinality());
+
+    ASSERT_FALSE(copy.deserialize(buf, n - 1));
+    ASSERT_TRUE(copy.empty());
+    buf[4] = 0xff;
+    buf[5] = 0xff;
+    ASSERT_FALSE(copy.deserialize(buf, n));
+    destroy<uint8_t[]>(buf);
+}
+
+namespace {
+
+    void put16(uint8_t *&out, uint32_t v) {
+        *out++ = static_cast<uint8_t>(v);
+        *out++ = static_cast<uint8_t>(v >> 8);
+    }
+
+    /**
+     * Write a bitmap with one chunk holding the values below
+     * @code card @endcode, as an array or as a bitmap container.
+     *
+     * @return the number of bytes written
+     */
+    size_t write_chunk(uint8_t *buf, uint8_t kind, uint32_t card) {
+        uint8_t *out = buf;
+        put16(out, 1);
+        put16(out, 0);
+        put16(out, 0);
+        *out++ = kind;
+        *out++ = 0;
+        put16(out, card - 1);
+        if (kind == 0) {
+            put16(out, card);
+            for (uint32_t v = 0; v < card; ++v) {
+                put16(out, v);
+            }
+        } else {
+            put16(out, 0);
+            for (uint32_t bit = 0; bit < 65536; bit += 8) {
+                const uint32_t left = card > bit ? card - bit : 0;
+                *out++ = static_cast<uint8_t>(left >= 8 ? 0xffu : (1u << left) - 1);
+            }
+        }
+        return static_cast<size_t>(out - buf);
+    }
+
+}
+
+TEST(roaring_bitmap_test, test_deserialize_container_kinds) {
+    uint8_t *buf = create<uint8_t[]>(16 + 2 * 65536);
+    roaring_bitmap set;
+    ASSERT_TRUE(set.deserialize(buf, write_chunk(buf, 0, 4096)));
+    ASSERT_EQ(4096u, set.cardinality());
+    ASSERT_TRUE(set.deserialize(buf, write_chunk(buf, 1, 4097)));
+    ASSERT_EQ(4097u, set.cardinality());
+    ASSERT_TRUE(set.contains(4096));
+
+    // an array past the array limit and a bitmap within it
+    ASSERT_FALSE(set.deserialize(buf, write_chunk(buf, 0, 5000)));
+    ASSERT_TRUE(set.empty());
+    ASSERT_FALSE(set.deserialize(buf, write_chunk(buf, 1, 10)));
+    ASSERT_TRUE(set.empty());
+    ASSERT_FALSE(set.deserialize(buf, write_chunk(buf, 1, 4096)));
+    destroy<uint8_t[]>(buf);
+}
+
+TEST(roaring_bitmap_test, test_move_and_clear) {
+    roaring_bitmap set;
+    set.add_range(0, 99999);
+    roaring_bitmap moved(move(set));
+    ASSERT_TRUE(set.empty());
+    ASSERT_EQ(100000u, moved.cardinality());
+    set.add(1);
+    ASSERT_TRUE(set.contains(1));
+    set = move(moved);
+    ASSERT_EQ(100000u, set.cardinality());
+    set.clear();
+    ASSERT_TRUE(set.empty());
+    ASSERT_EQ(0u, set.cardinality());
+}
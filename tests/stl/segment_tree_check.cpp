@@ -0,0 +1,153 @@
+/**
+ * @file segment_tree_check.cpp
+ * @brief Unit testing for the lazy segment tree
+ *
+ * Random point sets, range updates, and range queries are checked
+ * against the same operations on a plain array.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <gtest/gtest.h>
+#include <wlib/stl/SegmentTree.h>
+
+using namespace wlp;
+
+namespace {
+
+    const size_t count = 45;
+
+    struct lcg {
+        uint32_t state = 11;
+
+        uint32_t next(uint32_t bound) {
+            state = state * 1103515245u + 12345u;
+            return (state >> 8) % bound;
+        }
+    };
+
+    /**
+     * Run random operations on a tree and an array, where @p fold
+     * combines array elements the way the tree's monoid does.
+     */
+    template<typename Tree, typename Fold, typename Apply>
+    void check_random(Tree &tree, int64_t (&naive)[count], int64_t identity, Fold fold, Apply apply) {
+        lcg r;
+        for (int op = 0; op < 2000; ++op) {
+            const size_t begin = r.next(count + 1);
+            const size_t end = begin + r.next(static_cast<uint32_t>(count - begin + 1));
+            const int64_t v = static_cast<int64_t>(r.next(200)) - 100;
+            switch (r.next(3)) {
+                case 0:
+                    if (begin < count) {
+                        tree.set(begin, v);
+                        naive[begin] = v;
+                    }
+                    break;
+                case 1:
+                    tree.apply(begin, end, v);
+                    for (size_t k = begin; k < end; ++k) {
+                        naive[k] = apply(v, naive[k]);
+                    }
+                    break;
+                default:
+                    break;
+            }
+            int64_t expected = identity;
+            for (size_t k = begin; k < end; ++k) {
+                expected = fold(expected, naive[k]);
+            }
+            ASSERT_EQ(expected, tree.query(begin, end));
+            if (begin < count) {
+                ASSERT_EQ(naive[begin], tree.get(begin));
+            }
+        }
+        int64_t all = identity;
+        for (size_t k = 0; k < count; ++k) {
+            all = fold(all, naive[k]);
+        }
+        ASSERT_EQ(all, tree.all());
+    }
+
+    int64_t add(int64_t a, int64_t b) {
+        return a + b;
+    }
+
+    int64_t larger(int64_t a, int64_t b) {
+        return a > b ? a : b;
+    }
+
+    int64_t assign(int64_t u, int64_t) {
+        return u;
+    }
+
+}
+
+TEST(segment_tree_test, test_sum_range_add) {
+    int64_t naive[count];
+    for (size_t k = 0; k < count; ++k) {
+        naive[k] = static_cast<int64_t>(k);
+    }
+    segment_tree<int64_t> tree(make_span(naive));
+    ASSERT_EQ(count, tree.size());
+    check_random(tree, naive, 0, add, add);
+}
+
+TEST(segment_tree_test, test_max_range_add) {
+    int64_t naive[count];
+    for (size_t k = 0; k < count; ++k) {
+        naive[k] = INT64_MIN / 2;
+    }
+    segment_tree<int64_t, max_monoid<int64_t>> tree(make_span(naive));
+    check_random(tree, naive, INT64_MIN, larger, add);
+}
+
+TEST(segment_tree_test, test_sum_range_assign) {
+    int64_t naive[count];
+    memset(naive, 0, sizeof(naive));
+    segment_tree<int64_t, sum_monoid<int64_t>, range_assign<sum_monoid<int64_t>>> tree(count);
+    check_random(tree, naive, 0, add, assign);
+}
+
+TEST(segment_tree_test, test_max_range_assign) {
+    int64_t naive[count];
+    for (size_t k = 0; k < count; ++k) {
+        naive[k] = INT64_MIN;
+    }
+    segment_tree<int64_t, max_monoid<int64_t>, range_assign<max_monoid<int64_t>>> tree(count);
+    check_random(tree, naive, INT64_MIN, larger, assign);
+}
+
+TEST(segment_tree_test, test_small_and_move) {
+    segment_tree<int32_t> empty;
+    ASSERT_EQ(0u, empty.size());
+    ASSERT_EQ(0, empty.query(0, 0));
+    ASSERT_EQ(0, empty.all());
+
+    segment_tree<int32_t> one(1);
+    one.apply(0, 1, 5);
+    one.apply(0, 1, 2);
+    ASSERT_EQ(7, one.get(0));
+    ASSERT_EQ(7, one.query(0, 1));
+
+    int32_t values[] = {3, 1, 4, 1, 5};
+    segment_tree<int32_t, min_monoid<int32_t>> tree(make_span(values));
+    tree.apply(1, 4, 10);
+    ASSERT_EQ(3, tree.all());
+    ASSERT_EQ(11, tree.query(1, 4));
+    segment_tree<int32_t, min_monoid<int32_t>> moved(move(tree));
+    ASSERT_EQ(0u, tree.size());
+    ASSERT_EQ(min_monoid<int32_t>::identity(), tree.all());
+    ASSERT_EQ(min_monoid<int32_t>::identity(), tree.query(0, 0));
+    tree.apply(0, 0, 1);
+    ASSERT_EQ(14, moved.get(2));
+    tree = move(moved);
+    ASSERT_EQ(5u, tree.size());
+    ASSERT_EQ(5, tree.query(4, 5));
+    ASSERT_EQ(min_monoid<int32_t>::identity(), moved.all());
+    moved = move(tree);
+    moved.set(0, 0);
+    ASSERT_EQ(0, moved.all());
+}
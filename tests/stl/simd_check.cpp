@@ -0,0 +1,214 @@
+/**
+ * @file simd_check.cpp
+ * @brief Unit testing for the vectorized sample kernels
+ *
+ * Every level the processor supports is checked against the scalar
+ * kernels on buffers whose lengths leave tails after the last vector.
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <gtest/gtest.h>
+#include <wlib/stl/Array2D.h>
+#include <wlib/stl/ArrayList.h>
+#include <wlib/stl/Simd.h>
+
+using namespace wlp;
+
+namespace {
+
+    const size_t lengths[] = {0, 1, 7, 8, 15, 16, 33, 1000};
+
+    uint32_t next_random(uint32_t &state) {
+        state = state * 1103515245u + 12345u;
+        return state >> 8;
+    }
+
+    void fill_samples(array_list<float> &f, array_list<int16_t> &s, size_t n) {
+        uint32_t state = static_cast<uint32_t>(n) + 17;
+        f.clear();
+        s.clear();
+        for (size_t i = 0; i < n; ++i) {
+            f.push_back(static_cast<float>(next_random(state) % 2000) / 8.0f - 125.0f);
+            s.push_back(static_cast<int16_t>(next_random(state) % 65536 - 32768));
+        }
+    }
+
+    simd_level levels[] = {simd_level::sse2, simd_level::avx2};
+
+}
+
+TEST(simd_test, test_select) {
+    simd_level best = simd_supported();
+    ASSERT_EQ(simd_level::scalar, simd_select(simd_level::scalar));
+    ASSERT_EQ(simd_level::scalar, simd_active());
+    ASSERT_EQ(best, simd_select(simd_level::avx2));
+    ASSERT_EQ(best, simd_active());
+}
+
+TEST(simd_test, test_reductions) {
+    array_list<float> f;
+    array_list<int16_t> s;
+    for (simd_level level : levels) {
+        for (size_t n : lengths) {
+            fill_samples(f, s, n);
+            simd_select(simd_level::scalar);
+            float sum_f = simd_sum(f.as_span());
+            int64_t sum_s = simd_sum(s.as_span());
+            min_max<float> mm_f = simd_minmax(f.as_span());
+            min_max<int16_t> mm_s = simd_minmax(s.as_span());
+            size_t count_f = simd_count_greater(f.as_span(), 10.5f);
+            size_t count_s = simd_count_greater(s.as_span(), static_cast<int16_t>(-100));
+            simd_select(level);
+            ASSERT_NEAR(sum_f, simd_sum(f.as_span()), 0.01f);
+            ASSERT_EQ(sum_s, simd_sum(s.as_span()));
+            ASSERT_EQ(mm_f.min, simd_minmax(f.as_span()).min);
+            ASSERT_EQ(mm_f.max, simd_minmax(f.as_span()).max);
+            ASSERT_EQ(mm_s.min, simd_minmax(s.as_span()).min);
+            ASSERT_EQ(mm_s.max, simd_minmax(s.as_span()).max);
+            ASSERT_EQ(count_f, simd_count_greater(f.as_span(), 10.5f));
+            ASSERT_EQ(count_s, simd_count_greater(s.as_span(), static_cast<int16_t>(-100)));
+        }
+    }
+    simd_select(simd_supported());
+
+    int16_t values[] = {-4, 8, 15, 16, 23, 42};
+    ASSERT_EQ(100, simd_sum(make_span<const int16_t>(values, 6)));
+    ASSERT_FLOAT_EQ(100.0f / 6, simd_mean(make_span<const int16_t>(values, 6)));
+    ASSERT_EQ(0.0f, simd_mean(span<const float>()));
+    min_max<int16_t> mm = simd_minmax(span<const int16_t>());
+    ASSERT_EQ(0, mm.min);
+    ASSERT_EQ(0, mm.max);
+}
+
+TEST(simd_test, test_sum_no_overflow) {
+    array_list<int16_t> s(1 << 16);
+    for (size_t i = 0; i < (1 << 16); ++i) {
+        s.push_back(static_cast<int16_t>(32767));
+    }
+    ASSERT_EQ(int64_t(32767) << 16, simd_sum(s.as_span()));
+    ASSERT_EQ(0u, simd_count_greater(s.as_span(), static_cast<int16_t>(32767)));
+    ASSERT_EQ(s.size(), simd_count_greater(s.as_span(), static_cast<int16_t>(0)));
+}
+
+TEST(simd_test, test_find) {
+    array_list<float> f;
+    array_list<int16_t> s;
+    fill_samples(f, s, 100);
+    const size_t positions[] = {0, 3, 8, 17, 99};
+    for (simd_level level : levels) {
+        simd_select(level);
+        for (size_t i : positions) {
+            // the first equal sample may come before i
+            size_t first_f = 0;
+            while (f[first_f] != f[i]) {
+                ++first_f;
+            }
+            size_t first_s = 0;
+            while (s[first_s] != s[i]) {
+                ++first_s;
+            }
+            ASSERT_EQ(first_f, simd_find(f.as_span(), f[i]));
+            ASSERT_EQ(first_s, simd_find(s.as_span(), s[i]));
+        }
+        ASSERT_EQ(100u, simd_find(f.as_span(), 1000.0f));
+        ASSERT_EQ(37u, simd_find(f.as_span().first(37), 1000.0f));
+    }
+    simd_select(simd_supported());
+}
+
+TEST(simd_test, test_transforms) {
+    array_list<float> f;
+    array_list<int16_t> s;
+    array_list<float> fx;
+    array_list<int16_t> sx;
+    for (simd_level level : levels) {
+        for (size_t n : lengths) {
+            fill_samples(f, s, n);
+            fill_samples(fx, sx, n);
+            simd_select(simd_level::scalar);
+            simd_clamp(f.as_span(), -50.0f, 50.0f);
+            simd_clamp(s.as_span(), static_cast<int16_t>(-1000), static_cast<int16_t>(2000));
+            simd_saxpy(0.5f, f.as_span(), f.as_span());
+            simd_select(level);
+            simd_clamp(fx.as_span(), -50.0f, 50.0f);
+            simd_clamp(sx.as_span(), static_cast<int16_t>(-1000), static_cast<int16_t>(2000));
+            simd_saxpy(0.5f, fx.as_span(), fx.as_span());
+            for (size_t i = 0; i < n; ++i) {
+                ASSERT_EQ(f[i], fx[i]);
+                ASSERT_EQ(s[i], sx[i]);
+                ASSERT_LE(fx[i], 75.0f);
+                ASSERT_GE(sx[i], -1000);
+            }
+        }
+    }
+    simd_select(simd_supported());
+}
+
+TEST(simd_test, test_prefix_sum) {
+    array_list<int32_t> a;
+    array_list<int32_t> b;
+    array_list<float> f;
+    array_list<float> g;
+    for (simd_level level : levels) {
+        for (size_t n : lengths) {
+            a.clear();
+            b.clear();
+            f.clear();
+            g.clear();
+            for (size_t i = 0; i < n; ++i) {
+                int32_t v = static_cast<int32_t>(i * 7 % 13) - 6;
+                a.push_back(v);
+                b.push_back(v);
+                f.push_back(static_cast<float>(v) / 4);
+                g.push_back(static_cast<float>(v) / 4);
+            }
+            simd_select(simd_level::scalar);
+            simd_prefix_sum(a.as_span());
+            simd_prefix_sum(f.as_span());
+            simd_select(level);
+            simd_prefix_sum(b.as_span());
+            simd_prefix_sum(g.as_span());
+            for (size_t i = 0; i < n; ++i) {
+                ASSERT_EQ(a[i], b[i]);
+                // quarters add exactly in any order
+                ASSERT_EQ(f[i], g[i]);
+            }
+        }
+    }
+    simd_select(simd_supported());
+}
+
+TEST(simd_test, test_histogram) {
+    array_list<float> f;
+    array_list<int16_t> s;
+    fill_samples(f, s, 1000);
+    s[0] = -32768;
+    s[1] = 32767;
+    for (simd_level level : levels) {
+        array2d<uint32_t> bins(2, 20);
+        simd_select(simd_level::scalar);
+        simd_histogram(s.as_span(), -20000, 11, bins.row(0));
+        simd_select(level);
+        simd_histogram(s.as_span(), -20000, 11, bins.row(1));
+        uint32_t total = 0;
+        for (size_t i = 0; i < 20; ++i) {
+            ASSERT_EQ(bins[0][i], bins[1][i]);
+            total += bins[1][i];
+        }
+        ASSERT_EQ(1000u, total);
+        ASSERT_LT(0u, bins[1][0]);
+        ASSERT_LT(0u, bins[1][19]);
+    }
+    simd_select(simd_supported());
+
+    int16_t values[] = {-5, 0, 1, 3, 4, 7, 8, 100};
+    uint32_t counts[3] = {0, 0, 0};
+    simd_histogram(make_span<const int16_t>(values, 8), 0, 2, make_span(counts));
+    ASSERT_EQ(4u, counts[0]);
+    ASSERT_EQ(2u, counts[1]);
+    ASSERT_EQ(2u, counts[2]);
+    simd_histogram(make_span<const int16_t>(values, 8), 0, 2, span<uint32_t>());
+}
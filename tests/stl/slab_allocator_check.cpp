@@ -0,0 +1,74 @@
+/**
+ * @file slab_allocator_check.cpp
+ * @brief Unit testing for the slab allocator
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <gtest/gtest.h>
+#include <wlib/stl/SlabAllocator.h>
+
+using namespace wlp;
+
+TEST(slab_allocator_test, test_size_classes) {
+    void *a = slab_alloc(1);
+    void *b = slab_alloc(17);
+    void *c = slab_alloc(2048);
+    void *d = slab_alloc(2049);
+    ASSERT_EQ(16u, slab_usable_size(a));
+    ASSERT_EQ(32u, slab_usable_size(b));
+    ASSERT_EQ(2048u, slab_usable_size(c));
+    ASSERT_EQ(2049u, slab_usable_size(d));
+    for (void *p : {a, b, c, d}) {
+        ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(p) % 16);
+    }
+    memset(c, 'c', 2048);
+    memset(d, 'd', 2049);
+    ASSERT_LE(2049u, slab_get_stats().large_bytes);
+    slab_free(a);
+    slab_free(b);
+    slab_free(c);
+    slab_free(d);
+    slab_free(nullptr);
+}
+
+TEST(slab_allocator_test, test_reuse) {
+    void *a = slab_alloc(40);
+    slab_free(a);
+    ASSERT_EQ(a, slab_alloc(60));
+    slab_free(a);
+
+    // more blocks than a thread keeps go through the depot
+    void *blocks[200];
+    for (void *&p : blocks) {
+        p = slab_alloc(100);
+        memset(p, 0x5a, 100);
+    }
+    for (size_t i = 0; i < 200; ++i) {
+        for (size_t j = i + 1; j < 200; ++j) {
+            ASSERT_NE(blocks[i], blocks[j]);
+        }
+    }
+    for (void *p : blocks) {
+        slab_free(p);
+    }
+    slab_flush_cache();
+    const slab_stats stats = slab_get_stats();
+    ASSERT_LT(0u, stats.slab_bytes);
+    ASSERT_LT(0u, stats.full_magazines);
+}
+
+TEST(slab_allocator_test, test_realloc) {
+    char *p = static_cast<char *>(slab_realloc(nullptr, 20));
+    memcpy(p, "slab allocator test", 20);
+    ASSERT_EQ(p, slab_realloc(p, 32));
+    char *q = static_cast<char *>(slab_realloc(p, 4000));
+    ASSERT_STREQ("slab allocator test", q);
+    ASSERT_EQ(4000u, slab_usable_size(q));
+    slab_free(q);
+}
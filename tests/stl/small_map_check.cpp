@@ -0,0 +1,223 @@
+#include <gtest/gtest.h>
+#include <wlib/stl/SmallMap.h>
+#include <wlib/strings/String.h>
+
+namespace wlp {
+
+    template
+    class small_map<int, int>;
+
+    template
+    class small_map<dynamic_string, dynamic_string, 4>;
+
+}
+
+using namespace wlp;
+
+typedef small_map<int, int, 4> int_map;
+typedef int_map::iterator imi;
+typedef pair<imi, bool> P_imi_b;
+
+TEST(small_map_test, test_empty_on_construct) {
+    int_map map;
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(0u, map.size());
+    ASSERT_EQ(4u, map.capacity());
+    ASSERT_FALSE(map.is_promoted());
+    ASSERT_EQ(map.begin(), map.end());
+    ASSERT_FALSE(map.contains(0));
+}
+
+TEST(small_map_test, test_inline_insert_find) {
+    int_map map;
+    P_imi_b res = map.insert(5, 50);
+    ASSERT_TRUE(res.second());
+    ASSERT_EQ(5, res.first().key());
+    ASSERT_EQ(50, *res.first());
+    res = map.insert(5, 51);
+    ASSERT_FALSE(res.second());
+    ASSERT_EQ(50, *res.first());
+    map.insert(0, 1);
+    map.insert(-3, 2);
+    ASSERT_EQ(3u, map.size());
+    ASSERT_FALSE(map.is_promoted());
+    ASSERT_TRUE(map.contains(0));
+    ASSERT_TRUE(map.contains(-3));
+    ASSERT_FALSE(map.contains(1));
+    ASSERT_EQ(2, map.at(-3));
+    ASSERT_EQ(map.end(), map.find(7));
+    ASSERT_EQ(1, *map.find(0));
+}
+
+TEST(small_map_test, test_promotion_keeps_entries) {
+    int_map map;
+    for (int i = 0; i < 4; ++i) {
+        map[i] = i * 10;
+    }
+    ASSERT_FALSE(map.is_promoted());
+    map[4] = 40;
+    ASSERT_TRUE(map.is_promoted());
+    for (int i = 5; i < 100; ++i) {
+        ASSERT_TRUE(map.insert(i, i * 10).second());
+    }
+    ASSERT_EQ(100u, map.size());
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(i * 10, map.at(i));
+    }
+    ASSERT_FALSE(map.insert(3, 0).second());
+    ASSERT_FALSE(map.contains(100));
+    size_t count = 0;
+    int sum = 0;
+    for (imi it = map.begin(); it != map.end(); ++it) {
+        ASSERT_EQ(it.key() * 10, *it);
+        sum += it.key();
+        ++count;
+    }
+    ASSERT_EQ(100u, count);
+    ASSERT_EQ(99 * 100 / 2, sum);
+    imi found = map.find(42);
+    imi copy(found);
+    found = map.find(7);
+    ASSERT_EQ(420, *copy);
+    ASSERT_EQ(70, *found);
+    map.clear();
+    ASSERT_FALSE(map.is_promoted());
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(4u, map.capacity());
+}
+
+TEST(small_map_test, test_inline_erase) {
+    int_map map;
+    for (int i = 0; i < 4; ++i) {
+        map[i] = i;
+    }
+    ASSERT_TRUE(map.erase(1));
+    ASSERT_FALSE(map.erase(1));
+    ASSERT_EQ(3u, map.size());
+    ASSERT_FALSE(map.contains(1));
+    ASSERT_EQ(3, map.at(3));
+    int sum = 0;
+    for (imi it = map.begin(); it != map.end();) {
+        sum += *it;
+        it = map.erase(it);
+    }
+    ASSERT_EQ(0 + 2 + 3, sum);
+    ASSERT_TRUE(map.empty());
+    map[9] = 9;
+    ASSERT_EQ(1u, map.size());
+}
+
+TEST(small_map_test, test_promoted_erase_and_assign) {
+    int_map map;
+    for (int i = 0; i < 10; ++i) {
+        map[i] = i;
+    }
+    ASSERT_TRUE(map.erase(7));
+    ASSERT_FALSE(map.erase(7));
+    ASSERT_EQ(9u, map.size());
+    ASSERT_FALSE(map.insert_or_assign(2, 20).second());
+    ASSERT_TRUE(map.insert_or_assign(7, 70).second());
+    ASSERT_EQ(20, map.at(2));
+    ASSERT_EQ(70, map.at(7));
+    size_t count = 0;
+    for (imi it = map.begin(); it != map.end();) {
+        it = map.erase(it);
+        ++count;
+    }
+    ASSERT_EQ(10u, count);
+    ASSERT_TRUE(map.empty());
+}
+
+TEST(small_map_test, test_string_keys) {
+    typedef dynamic_string ds;
+    small_map<ds, ds, 4> map;
+    map[ds("alpha")] = ds("1");
+    map[ds("beta")] = ds("2");
+    ASSERT_TRUE(map.contains(ds("alpha")));
+    ASSERT_FALSE(map.contains(ds("gamma")));
+    ASSERT_STREQ("2", map.at(ds("beta")).c_str());
+    map[ds("gamma")] = ds("3");
+    map[ds("delta")] = ds("4");
+    map[ds("epsilon")] = ds("5");
+    ASSERT_TRUE(map.is_promoted());
+    ASSERT_STREQ("1", map.at(ds("alpha")).c_str());
+    ASSERT_STREQ("5", map.at(ds("epsilon")).c_str());
+    ASSERT_EQ(5u, map.size());
+}
+
+TEST(small_map_test, test_const_access_and_move) {
+    int_map map;
+    map[1] = 10;
+    map[2] = 20;
+    int_map moved(move(map));
+    ASSERT_TRUE(map.empty());
+    const int_map &cmap = moved;
+    ASSERT_EQ(20, cmap.at(2));
+    ASSERT_EQ(cmap.end(), cmap.find(3));
+    size_t count = 0;
+    for (int_map::const_iterator it = cmap.begin(); it != cmap.end(); ++it) {
+        ++count;
+    }
+    ASSERT_EQ(2u, count);
+
+    int_map big;
+    for (int i = 0; i < 20; ++i) {
+        big[i] = i;
+    }
+    moved = move(big);
+    ASSERT_TRUE(moved.is_promoted());
+    ASSERT_EQ(20u, moved.size());
+    ASSERT_EQ(19, moved.at(19));
+    ASSERT_FALSE(big.is_promoted());
+    ASSERT_TRUE(big.empty());
+}
+
+TEST(small_map_test, test_packed_key_widths) {
+    small_map<uint8_t, int, 11> bytes;
+    for (uint8_t k = 0; k < 11; ++k) {
+        bytes[static_cast<uint8_t>(k * 23)] = k;
+    }
+    ASSERT_FALSE(bytes.is_promoted());
+    for (uint8_t k = 0; k < 11; ++k) {
+        ASSERT_EQ(k, bytes.at(static_cast<uint8_t>(k * 23)));
+    }
+    ASSERT_FALSE(bytes.contains(1));
+    bytes.erase(static_cast<uint8_t>(230));
+    ASSERT_FALSE(bytes.contains(230));
+    ASSERT_TRUE(bytes.contains(0));
+    ASSERT_EQ(10u, bytes.size());
+
+    small_map<int32_t, int, 3> ints;
+    ints[-1] = 1;
+    ints[0x10000] = 3;
+    ASSERT_EQ(1, ints.at(-1));
+    ASSERT_EQ(3, ints.at(0x10000));
+    ASSERT_FALSE(ints.contains(0xffff));
+    ASSERT_FALSE(ints.contains(0));
+    ints.erase(0x10000);
+    ASSERT_FALSE(ints.contains(0x10000));
+    ASSERT_FALSE(ints.contains(0));
+    ints[0] = 2;
+    ASSERT_EQ(2, ints.at(0));
+    ASSERT_EQ(2u, ints.size());
+}
+
+TEST(small_map_test, test_reuse_moved_from) {
+    int_map big;
+    for (int i = 0; i < 20; ++i) {
+        big[i] = i;
+    }
+    int_map moved(move(big));
+    ASSERT_EQ(big.end(), big.find(3));
+    for (int i = 0; i < 10; ++i) {
+        big[i] = -i;
+    }
+    ASSERT_TRUE(big.is_promoted());
+    ASSERT_EQ(10u, big.size());
+    ASSERT_EQ(-9, big.at(9));
+    ASSERT_EQ(9, moved.at(9));
+    moved = move(big);
+    big[1] = 1;
+    ASSERT_EQ(1u, big.size());
+    ASSERT_FALSE(big.is_promoted());
+}
@@ -0,0 +1,135 @@
+/**
+ * @file span_check.cpp
+ * @brief Unit testing for spans and the span algorithms
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <gtest/gtest.h>
+#include <wlib/stl/Algorithm.h>
+#include <wlib/stl/Array2D.h>
+#include <wlib/stl/ArrayList.h>
+#include <wlib/stl/Span.h>
+
+using namespace wlp;
+
+TEST(span_test, test_construct) {
+    span<int> empty;
+    ASSERT_TRUE(empty.empty());
+    ASSERT_EQ(empty.begin(), empty.end());
+
+    int values[] = {3, 1, 4, 1, 5};
+    span<int> s(values);
+    ASSERT_EQ(5u, s.size());
+    ASSERT_EQ(5u * sizeof(int), s.size_bytes());
+    ASSERT_EQ(values, s.data());
+    ASSERT_EQ(3, s.front());
+    ASSERT_EQ(5, s.back());
+    s[1] = 9;
+    ASSERT_EQ(9, values[1]);
+
+    span<const int> c = s;
+    ASSERT_EQ(values, c.data());
+    span<const int> d = make_span(values + 2, 2);
+    ASSERT_EQ(4, d[0]);
+    ASSERT_EQ(2u, d.size());
+
+    int sum = 0;
+    for (int v : make_span(values)) {
+        sum += v;
+    }
+    ASSERT_EQ(22, sum);
+}
+
+TEST(span_test, test_subspan) {
+    int values[] = {0, 1, 2, 3, 4, 5, 6, 7};
+    span<int> s(values);
+    ASSERT_EQ(2, s.subspan(2, 3).front());
+    ASSERT_EQ(4, s.subspan(2, 3).back());
+    ASSERT_EQ(3u, s.subspan(5).size());
+    ASSERT_TRUE(s.subspan(8).empty());
+    ASSERT_TRUE(s.subspan(20, 2).empty());
+    ASSERT_EQ(3u, s.first(3).size());
+    ASSERT_EQ(8u, s.first(30).size());
+    ASSERT_EQ(5, s.last(3).front());
+    ASSERT_EQ(8u, s.last(30).size());
+}
+
+TEST(span_test, test_iterators) {
+    int values[] = {10, 20, 30, 40};
+    span<int> s(values);
+    span<int>::iterator it = s.begin();
+    ASSERT_EQ(10, *it);
+    ASSERT_EQ(30, it[2]);
+    it += 3;
+    ASSERT_EQ(40, *it);
+    ASSERT_EQ(3, it - s.begin());
+    *it-- = 45;
+    ASSERT_EQ(45, values[3]);
+    ASSERT_EQ(30, *it);
+    ASSERT_TRUE(s.begin() < it);
+    ASSERT_EQ(s.end(), it + 2);
+#ifdef WLIB_CHECKED_ITERATORS
+    // checked iterators stop at the ends of the span
+    ASSERT_EQ(s.end(), it + 10);
+    ASSERT_EQ(s.begin(), it - 10);
+    span<int>::iterator end = s.end();
+    ++end;
+    ASSERT_EQ(s.end(), end);
+    span<int>::iterator begin = s.begin();
+    --begin;
+    ASSERT_EQ(s.begin(), begin);
+#endif
+}
+
+TEST(span_test, test_containers) {
+    array_list<int> list(4);
+    for (int i = 0; i < 6; ++i) {
+        list.push_back(i * i);
+    }
+    span<int> s = list.as_span();
+    ASSERT_EQ(list.data(), s.data());
+    ASSERT_EQ(6u, s.size());
+    s[2] = 7;
+    ASSERT_EQ(7, list[2]);
+    const array_list<int> &clist = list;
+    span<const int> cs = clist.as_span();
+    ASSERT_EQ(25, cs.back());
+    ASSERT_EQ(1, list.at(7));
+
+    array2d<int> grid(3, 4);
+    span<int> row = grid.row(1);
+    ASSERT_EQ(4u, row.size());
+    fill(row, 2);
+    ASSERT_EQ(2, grid[1][3]);
+    ASSERT_EQ(0, grid[2][0]);
+}
+
+TEST(span_test, test_algorithms) {
+    int values[] = {4, 8, 15, 16, 23, 42};
+    span<const int> s(values);
+    ASSERT_EQ(108, accumulate(s, 0));
+    ASSERT_EQ(108.5, accumulate(s, 0.5));
+    ASSERT_EQ(2u, find(s, 15));
+    ASSERT_EQ(6u, find(s, 7));
+    ASSERT_EQ(1u, count(s, 23));
+    ASSERT_EQ(4u, count_if(s, [](int v) { return v % 2 == 0; }));
+    ASSERT_EQ(0u, min_element(s));
+    ASSERT_EQ(5u, max_element(s));
+    ASSERT_EQ(0u, max_element(span<const int>()));
+
+    int out[4];
+    ASSERT_EQ(4u, transform(s, make_span(out), [](int v) { return v * 2 + 1; }));
+    ASSERT_EQ(9, out[0]);
+    ASSERT_EQ(33, out[3]);
+    ASSERT_EQ(4u, copy(s.subspan(2), make_span(out)));
+    ASSERT_TRUE(equal(s.last(4), make_span(out)));
+    ASSERT_FALSE(equal(s.first(4), make_span(out)));
+
+    int total = 0;
+    for_each(make_span(out), [&total](int &v) { total += v; v = 0; });
+    ASSERT_EQ(96, total);
+    ASSERT_EQ(4u, count(make_span(out), 0));
+}
@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+#include <wlib/stl/SparseGrid.h>
+
+namespace wlp {
+
+    template
+    class sparse_grid<int8_t>;
+
+    template
+    class sparse_grid<uint16_t, 3>;
+
+}
+
+using namespace wlp;
+
+typedef sparse_grid<int8_t> grid8;
+
+TEST(sparse_grid_test, test_empty_reads_unknown) {
+    grid8 grid(100000, 100000, -1);
+    ASSERT_EQ(100000u, grid.x());
+    ASSERT_EQ(100000u, grid.y());
+    ASSERT_EQ(-1, grid.get(0, 0));
+    ASSERT_EQ(-1, grid.get(54321, 99999));
+    ASSERT_EQ(0u, grid.tile_count());
+    ASSERT_FALSE(grid.allocated(54321, 99999));
+    ASSERT_EQ(grid.begin(), grid.end());
+}
+
+TEST(sparse_grid_test, test_set_allocates_single_tile) {
+    grid8 grid(1000, 1000, -1);
+    grid.set(17, 18, 5);
+    ASSERT_EQ(1u, grid.tile_count());
+    ASSERT_EQ(5, grid.get(17, 18));
+    ASSERT_EQ(-1, grid.get(16, 16));
+    ASSERT_EQ(-1, grid.get(31, 31));
+    ASSERT_TRUE(grid.allocated(31, 31));
+    ASSERT_FALSE(grid.allocated(32, 31));
+    grid.set(31, 16, 7);
+    ASSERT_EQ(1u, grid.tile_count());
+    ASSERT_EQ(7, grid.get(31, 16));
+    ASSERT_EQ(5, grid.get(17, 18));
+}
+
+TEST(sparse_grid_test, test_out_of_bounds) {
+    grid8 grid(40, 40, -1);
+    grid.set(40, 0, 3);
+    grid.set(0, 45, 3);
+    ASSERT_EQ(0u, grid.tile_count());
+    ASSERT_EQ(-1, grid.get(40, 0));
+    ASSERT_FALSE(grid.in_bounds(40, 39));
+    ASSERT_TRUE(grid.in_bounds(39, 39));
+}
+
+TEST(sparse_grid_test, test_at_and_cache_across_tiles) {
+    sparse_grid<uint16_t, 3> grid(200, 200);
+    for (uint16_t i = 0; i < 200; ++i) {
+        grid.at(i, i) = i;
+    }
+    ASSERT_EQ(25u, grid.tile_count());
+    for (uint16_t i = 0; i < 200; ++i) {
+        ASSERT_EQ(i, grid.get(i, i));
+        ASSERT_EQ(0, grid.get(i, static_cast<uint16_t>(199 - i)));
+    }
+}
+
+TEST(sparse_grid_test, test_line_horizontal_and_diagonal) {
+    grid8 grid(100, 100, 0);
+    grid.line(2, 10, 40, 10, 1);
+    for (uint32_t x = 2; x <= 40; ++x) {
+        ASSERT_EQ(1, grid.get(x, 10));
+    }
+    ASSERT_EQ(0, grid.get(1, 10));
+    ASSERT_EQ(0, grid.get(41, 10));
+    grid.line(50, 50, 20, 20, 2);
+    for (uint32_t i = 20; i <= 50; ++i) {
+        ASSERT_EQ(2, grid.get(i, i));
+    }
+}
+
+TEST(sparse_grid_test, test_raycast_marks_free_and_hit) {
+    grid8 grid(100, 100, -1);
+    grid.raycast(10, 10, 30, 17, 0, 100);
+    ASSERT_EQ(0, grid.get(10, 10));
+    ASSERT_EQ(100, grid.get(30, 17));
+    uint32_t visited = 0;
+    grid.for_each_on_line(10, 10, 30, 17, [&visited](int8_t &cell, uint32_t, uint32_t, bool last) {
+        ASSERT_EQ(last ? 100 : 0, cell);
+        ++visited;
+    });
+    ASSERT_EQ(21u, visited);
+}
+
+TEST(sparse_grid_test, test_line_clipped_to_grid) {
+    grid8 grid(20, 20, -1);
+    uint32_t visited = 0;
+    grid.for_each_on_line(10, 10, 30, 10, [&visited](int8_t &, uint32_t x, uint32_t, bool) {
+        ASSERT_LT(x, 20u);
+        ++visited;
+    });
+    ASSERT_EQ(10u, visited);
+}
+
+TEST(sparse_grid_test, test_iterate_allocated_tiles) {
+    grid8 grid(1000, 1000, -1);
+    grid.set(5, 5, 1);
+    grid.set(500, 20, 2);
+    grid.set(999, 999, 3);
+    uint32_t count = 0;
+    int sum = 0;
+    for (grid8::iterator it = grid.begin(); it != grid.end(); ++it) {
+        ASSERT_EQ(0u, it.x() % grid8::tile_side);
+        ASSERT_EQ(0u, it.y() % grid8::tile_side);
+        for (uint32_t i = 0; i < grid8::tile_area; ++i) {
+            if (it.data()[i] > 0) {
+                sum += it.data()[i];
+            }
+        }
+        ++count;
+    }
+    ASSERT_EQ(3u, count);
+    ASSERT_EQ(6, sum);
+}
+
+TEST(sparse_grid_test, test_clear_and_move) {
+    grid8 grid(1000, 1000, -1);
+    grid.set(5, 5, 1);
+    grid.set(600, 600, 1);
+    ASSERT_GT(grid.memory_usage(), 2 * grid8::tile_area);
+    grid8 moved(move(grid));
+    ASSERT_EQ(2u, moved.tile_count());
+    ASSERT_EQ(1, moved.get(600, 600));
+    ASSERT_EQ(0u, grid.tile_count());
+    moved.clear();
+    ASSERT_EQ(0u, moved.tile_count());
+    ASSERT_EQ(-1, moved.get(600, 600));
+    moved.set(1, 1, 4);
+    ASSERT_EQ(4, moved.get(1, 1));
+}
+
+TEST(sparse_grid_test, test_reuse_moved_from) {
+    grid8 grid(1000, 1000, -1);
+    grid.set(5, 5, 1);
+    grid8 moved(move(grid));
+    // a moved-from grid has no cells, so writes to it are dropped
+    ASSERT_EQ(0u, grid.x());
+    ASSERT_FALSE(grid.allocated(5, 5));
+    grid.set(5, 5, 3);
+    ASSERT_EQ(0u, grid.tile_count());
+    ASSERT_EQ(1, moved.get(5, 5));
+    grid = grid8(800, 800, 0);
+    grid.set(700, 700, 2);
+    ASSERT_EQ(2, grid.get(700, 700));
+    moved = move(grid);
+    ASSERT_EQ(2, moved.get(700, 700));
+    ASSERT_EQ(0, moved.get(5, 5));
+    grid.set(1, 1, 4);
+    ASSERT_EQ(0u, grid.tile_count());
+}
+
+TEST(sparse_grid_test, test_dimension_limit) {
+    const uint32_t side = grid8::max_side;
+    ASSERT_EQ(0xffff0u, side);
+    grid8 grid(0xffffffffu, side + 1, -1);
+    ASSERT_EQ(side, grid.x());
+    ASSERT_EQ(side, grid.y());
+    // the corner tiles stay apart and the last one is found again
+    grid.set(0, 0, 1);
+    grid.set(side - 1, 0, 2);
+    grid.set(0, side - 1, 3);
+    grid.set(side - 1, side - 1, 4);
+    grid.set(side - 1, side - 2, 5);
+    ASSERT_EQ(4u, grid.tile_count());
+    ASSERT_EQ(1, grid.get(0, 0));
+    ASSERT_EQ(2, grid.get(side - 1, 0));
+    ASSERT_EQ(3, grid.get(0, side - 1));
+    ASSERT_EQ(4, grid.get(side - 1, side - 1));
+    ASSERT_EQ(5, grid.get(side - 1, side - 2));
+    grid.set(side, 0, 6);
+    ASSERT_EQ(-1, grid.get(side, 0));
+    ASSERT_EQ(4u, grid.tile_count());
+
+    sparse_grid<uint16_t, 3> small(100, 100);
+    ASSERT_EQ(100u, small.x());
+}
@@ -60,3 +60,46 @@ TEST(tree_map, test_iterator_get_key) {
     }
     ASSERT_EQ(0, sum);
 }
+
+TEST(tree_map, test_moved_keys_stay_ordered) {
+    tree_map<dynamic_string, int> map;
+    const char *keys[] = {"m", "c", "x", "a", "e", "z", "b"};
+    for (int i = 0; i < 7; ++i) {
+        map[dynamic_string(keys[i])] = i;
+    }
+    ASSERT_EQ(7u, map.size());
+    const char *sorted[] = {"a", "b", "c", "e", "m", "x", "z"};
+    int i = 0;
+    for (auto it = map.begin(); it != map.end(); ++it) {
+        ASSERT_STREQ(sorted[i++], it.key().c_str());
+    }
+    ASSERT_EQ(7, i);
+}
+
+TEST(tree_map, test_swap_and_moved_from) {
+    tree_map<int, int> a;
+    tree_map<int, int> b;
+    a[1] = 10;
+    b[2] = 20;
+    b[3] = 30;
+    swap(a, b);
+    ASSERT_EQ(2u, a.size());
+    ASSERT_EQ(30, *a.find(3));
+    ASSERT_EQ(1u, b.size());
+    ASSERT_EQ(10, *b.find(1));
+    tree_map<int, int> c(move(a));
+    ASSERT_EQ(0u, a.size());
+    ASSERT_EQ(a.end(), a.begin());
+    ASSERT_EQ(a.end(), a.find(3));
+    const int keys[] = {5, 2, 8, 1};
+    for (int i = 0; i < 4; ++i) {
+        a[keys[i]] = i;
+    }
+    int prev = 0;
+    for (auto it = a.begin(); it != a.end(); ++it) {
+        ASSERT_LT(prev, it.key());
+        prev = it.key();
+    }
+    ASSERT_EQ(4u, a.size());
+    ASSERT_EQ(20, *c.find(2));
+}
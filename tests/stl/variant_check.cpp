@@ -0,0 +1,239 @@
+/**
+ * @file variant_check.cpp
+ * @brief Unit testing for variant
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <gtest/gtest.h>
+#include <wlib/stl/ArrayList.h>
+#include <wlib/stl/Variant.h>
+
+using namespace wlp;
+
+namespace {
+
+    struct speed {
+        float value;
+    };
+
+    struct position {
+        int32_t x;
+        int32_t y;
+    };
+
+    typedef variant<uint8_t, speed, position> message;
+
+    /**
+     * Counts the live instances, copies, and moves of a type that is
+     * not trivially copyable.
+     */
+    struct tracked {
+        static int live;
+        static int copies;
+        static int moves;
+
+        int value;
+
+        explicit tracked(int value = 0)
+                : value(value) {
+            ++live;
+        }
+
+        tracked(const tracked &t)
+                : value(t.value) {
+            ++live;
+            ++copies;
+        }
+
+        tracked(tracked &&t)
+                : value(t.value) {
+            t.value = -1;
+            ++live;
+            ++moves;
+        }
+
+        ~tracked() {
+            --live;
+        }
+
+        tracked &operator=(const tracked &) = delete;
+    };
+
+    int tracked::live = 0;
+    int tracked::copies = 0;
+    int tracked::moves = 0;
+
+    void reset_tracked() {
+        tracked::live = 0;
+        tracked::copies = 0;
+        tracked::moves = 0;
+    }
+
+    struct describe {
+        int operator()(uint8_t code) const {
+            return code;
+        }
+
+        int operator()(const speed &s) const {
+            return static_cast<int>(s.value * 10);
+        }
+
+        int operator()(const position &p) const {
+            return p.x + p.y;
+        }
+    };
+
+    struct scale {
+        int factor;
+
+        void operator()(uint8_t &code) const {
+            code = static_cast<uint8_t>(code * factor);
+        }
+
+        void operator()(speed &s) const {
+            s.value *= static_cast<float>(factor);
+        }
+
+        void operator()(position &p) const {
+            p.x *= factor;
+            p.y *= factor;
+        }
+    };
+
+    struct twice {
+        template<typename T>
+        double operator()(T value) const {
+            return 2 * static_cast<double>(value);
+        }
+    };
+
+}
+
+TEST(variant_test, test_hold_and_get) {
+    static_assert(__is_trivially_copyable(message), "Variant of plain types must be trivially copyable");
+    static_assert(sizeof(message) == 3 * sizeof(int32_t), "Variant must be the largest type and an index");
+    static_assert(message::index_of<position>() == 2, "Alternatives must be indexed in list order");
+
+    message m;
+    ASSERT_EQ(0, m.index());
+    ASSERT_TRUE(m.holds<uint8_t>());
+    ASSERT_EQ(0, get<uint8_t>(m));
+
+    message p(position{3, -4});
+    ASSERT_EQ(2, p.index());
+    ASSERT_TRUE(p.holds<position>());
+    ASSERT_FALSE(p.holds<speed>());
+    ASSERT_EQ(3, get<position>(p).x);
+    ASSERT_EQ(nullptr, get_if<speed>(&p));
+    ASSERT_EQ(-4, get_if<position>(&p)->y);
+
+    p = speed{2.5f};
+    ASSERT_EQ(1, p.index());
+    ASSERT_FLOAT_EQ(2.5f, get<speed>(p).value);
+    get<speed>(p).value = 4.0f;
+    const message &c = p;
+    ASSERT_FLOAT_EQ(4.0f, get<speed>(c).value);
+    ASSERT_EQ(nullptr, get_if<position>(&c));
+
+    m = p;
+    ASSERT_TRUE(m.holds<speed>());
+    ASSERT_FLOAT_EQ(4.0f, get<speed>(m).value);
+
+    position &e = m.emplace<position>(position{7, 8});
+    ASSERT_EQ(&e, get_if<position>(&m));
+    ASSERT_EQ(15, e.x + e.y);
+}
+
+TEST(variant_test, test_visit) {
+    message m(static_cast<uint8_t>(9));
+    ASSERT_EQ(9, visit(describe(), m));
+    m = speed{1.5f};
+    ASSERT_EQ(15, visit(describe(), m));
+    m = position{1, 2};
+    visit(scale{3}, m);
+    const message &c = m;
+    ASSERT_EQ(9, visit(describe(), c));
+    ASSERT_EQ(3, get<position>(c).x);
+}
+
+TEST(variant_test, test_lifetime) {
+    typedef variant<int, tracked> holder;
+    static_assert(!__is_trivially_copyable(holder), "Variant of a managed type must not be trivially copyable");
+    reset_tracked();
+    {
+        holder a(tracked(5));
+        ASSERT_EQ(1, tracked::live);
+        ASSERT_EQ(1, tracked::moves);
+
+        holder b(a);
+        ASSERT_EQ(2, tracked::live);
+        ASSERT_EQ(1, tracked::copies);
+        ASSERT_EQ(5, get<tracked>(b).value);
+
+        holder c(move(a));
+        ASSERT_EQ(3, tracked::live);
+        ASSERT_EQ(-1, get<tracked>(a).value);
+        ASSERT_EQ(5, get<tracked>(c).value);
+
+        // replacing a managed value destroys it
+        a = 4;
+        ASSERT_EQ(2, tracked::live);
+        b = a;
+        ASSERT_EQ(1, tracked::live);
+        ASSERT_EQ(4, get<int>(b));
+
+        a = c;
+        ASSERT_EQ(2, tracked::live);
+        ASSERT_EQ(2, tracked::copies);
+        c.emplace<tracked>(11);
+        ASSERT_EQ(2, tracked::live);
+        ASSERT_EQ(11, get<tracked>(c).value);
+    }
+    ASSERT_EQ(0, tracked::live);
+}
+
+TEST(variant_test, test_array_list) {
+    array_list<message> log;
+    for (int i = 0; i < 60; ++i) {
+        switch (i % 3) {
+            case 0:
+                log.push_back(message(static_cast<uint8_t>(i)));
+                break;
+            case 1:
+                log.push_back(message(speed{static_cast<float>(i)}));
+                break;
+            default:
+                log.push_back(message(position{i, 1}));
+                break;
+        }
+    }
+    ASSERT_EQ(60u, log.size());
+    // elements are laid out back to back
+    ASSERT_EQ(reinterpret_cast<const char *>(&log[0]) + 59 * sizeof(message),
+              reinterpret_cast<const char *>(&log[59]));
+    int total = 0;
+    int expected = 0;
+    for (int i = 0; i < 60; ++i) {
+        total += visit(describe(), log[static_cast<size_t>(i)]);
+        expected += i % 3 == 0 ? i : i % 3 == 1 ? i * 10 : i + 1;
+    }
+    ASSERT_EQ(expected, total);
+}
+
+TEST(variant_test, test_visit_table) {
+    // more alternatives than are told apart with branches
+    typedef variant<int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t, int64_t, uint64_t, float, double> number;
+    number n(static_cast<uint64_t>(40));
+    ASSERT_EQ(7, n.index());
+    ASSERT_DOUBLE_EQ(80.0, visit(twice(), n));
+    n = 1.25f;
+    ASSERT_DOUBLE_EQ(2.5, visit(twice(), n));
+    n = -3.5;
+    const number &c = n;
+    ASSERT_DOUBLE_EQ(-7.0, visit(twice(), c));
+    n = static_cast<int8_t>(-2);
+    ASSERT_DOUBLE_EQ(-4.0, visit(twice(), n));
+}
@@ -0,0 +1,247 @@
+/**
+ * @file aho_corasick_check.cpp
+ * @brief Unit testing for the Aho-Corasick multi-pattern matcher
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <gtest/gtest.h>
+#include <wlib/strings/AhoCorasick.h>
+
+using namespace wlp;
+
+namespace {
+
+    struct match_log {
+        size_t ids[64];
+        size_t ends[64];
+        size_t count = 0;
+
+        void operator()(size_t id, size_t end) {
+            ids[count] = id;
+            ends[count] = end;
+            ++count;
+        }
+    };
+
+    /**
+     * Count occurrences of every pattern by direct comparison.
+     */
+    size_t naive_count(const char *const *patterns, size_t n, const char *text, size_t len) {
+        size_t count = 0;
+        for (size_t p = 0; p < n; ++p) {
+            const size_t plen = strlen(patterns[p]);
+            for (size_t i = 0; i + plen <= len; ++i) {
+                count += memcmp(text + i, patterns[p], plen) == 0 ? 1 : 0;
+            }
+        }
+        return count;
+    }
+
+}
+
+TEST(aho_corasick_test, test_classic_example) {
+    const aho_corasick::mode_type modes[] = {aho_corasick::dfa, aho_corasick::compact};
+    for (aho_corasick::mode_type mode : modes) {
+        aho_corasick ac;
+        ASSERT_EQ(0, ac.add("he"));
+        ASSERT_EQ(1, ac.add("she"));
+        ASSERT_EQ(2, ac.add("his"));
+        ASSERT_EQ(3, ac.add("hers"));
+        ac.compile(mode, 0);
+        ASSERT_EQ(mode, ac.mode());
+        match_log log;
+        ASSERT_EQ(3u, ac.scan("ushers", log));
+        ASSERT_EQ(3u, log.count);
+        ASSERT_EQ(1u, log.ids[0]);
+        ASSERT_EQ(4u, log.ends[0]);
+        ASSERT_EQ(0u, log.ids[1]);
+        ASSERT_EQ(4u, log.ends[1]);
+        ASSERT_EQ(3u, log.ids[2]);
+        ASSERT_EQ(6u, log.ends[2]);
+        ASSERT_EQ(4u, ac.pattern_length(3));
+    }
+}
+
+TEST(aho_corasick_test, test_overlapping_and_nested) {
+    aho_corasick ac;
+    ac.add("a");
+    ac.add("aa");
+    ac.add("aaa");
+    ac.add("aa");
+    ac.compile();
+    match_log log;
+    ASSERT_EQ(3u + 2u * 2u + 1u, ac.scan("aaa", log));
+    const size_t ids[] = {0, 1, 3, 0, 2, 1, 3, 0};
+    const size_t ends[] = {1, 2, 2, 2, 3, 3, 3, 3};
+    for (size_t i = 0; i < 8; ++i) {
+        ASSERT_EQ(ids[i], log.ids[i]);
+        ASSERT_EQ(ends[i], log.ends[i]);
+    }
+    ASSERT_EQ(0u, ac.scan("bbb", log));
+}
+
+TEST(aho_corasick_test, test_matches_naive_search) {
+    const char *patterns[] = {
+            "error", "err", "warn", "timeout", "out", "tim", "or", "rro",
+            "disk full", "ful", "x", "eee", "ee", "e", "unreachable"
+    };
+    const size_t n = sizeof(patterns) / sizeof(patterns[0]);
+    const char alphabet[] = "erortwaniuxdskfl mbhc";
+    char text[2048];
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < sizeof(text); ++i) {
+        seed = seed * 1103515245u + 12345u;
+        text[i] = alphabet[(seed >> 16) % (sizeof(alphabet) - 1)];
+    }
+    const size_t expected = naive_count(patterns, n, text, sizeof(text));
+    const aho_corasick::mode_type modes[] = {aho_corasick::dfa, aho_corasick::compact, aho_corasick::compact};
+    const size_t budgets[] = {0, 0, 2048};
+    for (size_t m = 0; m < 3; ++m) {
+        aho_corasick ac;
+        for (size_t p = 0; p < n; ++p) {
+            ac.add(patterns[p]);
+        }
+        ac.compile(modes[m], budgets[m]);
+        size_t last_end = 0;
+        bool ordered = true;
+        bool correct = true;
+        size_t count = ac.scan(text, sizeof(text), [&](size_t id, size_t end) {
+            ordered = ordered && end >= last_end;
+            last_end = end;
+            const size_t len = strlen(patterns[id]);
+            correct = correct && end >= len && memcmp(text + end - len, patterns[id], len) == 0;
+        });
+        ASSERT_EQ(expected, count);
+        ASSERT_TRUE(ordered);
+        ASSERT_TRUE(correct);
+    }
+}
+
+TEST(aho_corasick_test, test_find_first) {
+    aho_corasick ac;
+    ac.add("fatal");
+    ac.add("error");
+    ac.add("terror");
+    ac.compile();
+    size_t end = 0;
+    ASSERT_EQ(2, ac.find_first("state: terror then fatal", 24, &end));
+    ASSERT_EQ(13u, end);
+    ASSERT_EQ(0, ac.find_first("fatal error"));
+    ASSERT_EQ(-1, ac.find_first("all good"));
+    ASSERT_EQ(-1, ac.find_first(""));
+}
+
+TEST(aho_corasick_test, test_binary_and_full_alphabet) {
+    aho_corasick ac;
+    char all[256];
+    for (int b = 0; b < 256; ++b) {
+        all[b] = static_cast<char>(b);
+    }
+    ASSERT_EQ(0, ac.add(all, 256));
+    const char zeros[] = {'\0', '\0'};
+    ASSERT_EQ(1, ac.add(zeros, 2));
+    const char high[] = {'\xff', '\x00'};
+    ASSERT_EQ(2, ac.add(high, 2));
+    ac.compile();
+    char text[300];
+    memset(text, 0, sizeof(text));
+    memcpy(text + 10, all, 256);
+    // eleven zeros, every byte value, then 34 zeros
+    ASSERT_EQ(10u + 1u + 1u + 33u, ac.scan(text, sizeof(text), [](size_t, size_t) {}));
+    ASSERT_EQ(0, ac.find_first(all, 256));
+    ASSERT_EQ(1, ac.find_first(zeros, 2));
+    ASSERT_EQ(2, ac.find_first(high, 2));
+}
+
+TEST(aho_corasick_test, test_string_types) {
+    aho_corasick ac;
+    ac.add(dynamic_string("needle"));
+    ac.add(static_string<8>("hay"));
+    ac.compile();
+    dynamic_string text("haystack with a needle");
+    static_string<32> stext("no hay here");
+    size_t count = 0;
+    auto counter = [&count](size_t, size_t) { ++count; };
+    ASSERT_EQ(2u, ac.scan(text, counter));
+    ASSERT_EQ(1u, ac.scan(stext, counter));
+    ASSERT_EQ(3u, count);
+    ASSERT_EQ(1, ac.find_first(text));
+    ASSERT_EQ(1, ac.find_first(stext));
+}
+
+TEST(aho_corasick_test, test_building_state) {
+    aho_corasick ac;
+    ASSERT_EQ(-1, ac.add(""));
+    ASSERT_FALSE(ac.compiled());
+    ASSERT_EQ(0u, ac.scan("anything", [](size_t, size_t) {}));
+    ac.add("abc");
+    ac.add("abd");
+    ac.compile();
+    ASSERT_TRUE(ac.compiled());
+    ASSERT_EQ(5u, ac.state_count());
+    ASSERT_EQ(-1, ac.add("x"));
+    ASSERT_EQ(2u, ac.pattern_count());
+
+    aho_corasick moved(move(ac));
+    ASSERT_FALSE(ac.compiled());
+    ASSERT_EQ(0u, ac.pattern_count());
+    ASSERT_EQ(1, moved.find_first("xxabdxx"));
+    ac = move(moved);
+    ASSERT_EQ(0, ac.find_first("abc"));
+
+    ac.clear();
+    ASSERT_EQ(0u, ac.pattern_count());
+    ASSERT_EQ(0, ac.add("x"));
+    ac.compile();
+    ASSERT_EQ(0, ac.find_first("yyx"));
+}
+
+TEST(aho_corasick_test, test_automatic_mode) {
+    aho_corasick small;
+    small.add("abc");
+    small.compile();
+    ASSERT_EQ(aho_corasick::dfa, small.mode());
+
+    aho_corasick large;
+    char pattern[8];
+    for (int i = 0; i < 200; ++i) {
+        snprintf(pattern, sizeof(pattern), "k%03d", i);
+        large.add(pattern);
+    }
+    large.compile(aho_corasick::automatic, 1024);
+    ASSERT_EQ(aho_corasick::compact, large.mode());
+    ASSERT_GT(large.dense_state_count(), 1u);
+    ASSERT_LT(large.dense_state_count(), large.state_count());
+    ASSERT_EQ(199, large.find_first("key k199"));
+    aho_corasick dense;
+    for (int i = 0; i < 200; ++i) {
+        snprintf(pattern, sizeof(pattern), "k%03d", i);
+        dense.add(pattern);
+    }
+    dense.compile();
+    ASSERT_EQ(aho_corasick::dfa, dense.mode());
+    ASSERT_EQ(dense.state_count(), dense.dense_state_count());
+    ASSERT_LT(large.memory_usage(), dense.memory_usage());
+}
+
+TEST(aho_corasick_test, test_reuse_moved_from) {
+    aho_corasick ac;
+    ac.add("he");
+    ac.add("she");
+    ac.compile();
+    aho_corasick moved(move(ac));
+    ASSERT_EQ(-1, ac.find_first("she"));
+    ASSERT_EQ(0, ac.add("hers"));
+    ASSERT_EQ(1, ac.add("his"));
+    ac.compile();
+    ASSERT_EQ(1, ac.find_first("this"));
+    ASSERT_EQ(1, moved.find_first("ashe"));
+    moved = move(ac);
+    ASSERT_EQ(0, ac.add("x"));
+    ac.compile();
+    ASSERT_EQ(0, ac.find_first("yyx"));
+    ASSERT_EQ(0, moved.find_first("hers"));
+}
@@ -0,0 +1,80 @@
+/**
+ * @file ascii_check.cpp
+ * @brief Unit testing for ASCII case conversion kernels
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <gtest/gtest.h>
+#include <wlib/strings/Ascii.h>
+
+using namespace wlp;
+
+TEST(ascii_test, test_convert_every_byte) {
+    char bytes[256];
+    for (int i = 0; i < 256; ++i) {
+        bytes[i] = static_cast<char>(i);
+    }
+    char lower[256];
+    char upper[256];
+    memcpy(lower, bytes, sizeof(bytes));
+    memcpy(upper, bytes, sizeof(bytes));
+    ascii_to_lower(lower, sizeof(lower));
+    ascii_to_upper(upper, sizeof(upper));
+    for (int i = 0; i < 256; ++i) {
+        const int expected_lower = i >= 'A' && i <= 'Z' ? i + 32 : i;
+        const int expected_upper = i >= 'a' && i <= 'z' ? i - 32 : i;
+        ASSERT_EQ(expected_lower, static_cast<uint8_t>(lower[i]));
+        ASSERT_EQ(expected_upper, static_cast<uint8_t>(upper[i]));
+        ASSERT_EQ(lower[i], ascii_lower(bytes[i]));
+        ASSERT_EQ(upper[i], ascii_upper(bytes[i]));
+    }
+}
+
+TEST(ascii_test, test_convert_strings) {
+    dynamic_string d("Ground Station KIRUNA-03, band=X");
+    ascii_to_lower(d);
+    ASSERT_STREQ("ground station kiruna-03, band=x", d.c_str());
+    ascii_to_upper(d);
+    ASSERT_STREQ("GROUND STATION KIRUNA-03, BAND=X", d.c_str());
+    static_string<16> s("Caf\xc3\xa9 Zz");
+    ascii_to_upper(s);
+    ASSERT_STREQ("CAF\xc3\xa9 ZZ", s.c_str());
+    dynamic_string empty;
+    ascii_to_lower(empty);
+    ASSERT_STREQ("", empty.c_str());
+}
+
+TEST(ascii_test, test_equals_and_compare_ignore_case) {
+    ASSERT_TRUE(equals_ignore_case("", ""));
+    ASSERT_TRUE(equals_ignore_case("MiXeD cAsE over eight bytes", "mixed case OVER EIGHT BYTES"));
+    ASSERT_FALSE(equals_ignore_case("mixed case over eight bytes", "mixed case over eight bytez"));
+    ASSERT_FALSE(equals_ignore_case("abc", "abcd"));
+    ASSERT_EQ(0, compare_ignore_case("Telemetry Frame", "TELEMETRY frame"));
+    ASSERT_GT(0, compare_ignore_case("telemetry", "TELEMETRY FRAME"));
+    ASSERT_LT(0, compare_ignore_case("TELEMETRY FRAME", "telemetry"));
+    ASSERT_GT(0, compare_ignore_case("0123456789abcdefA", "0123456789ABCDEFb"));
+    ASSERT_LT(0, compare_ignore_case("0123456789abcdef\x80", "0123456789ABCDEFz"));
+    ASSERT_GT(0, compare_ignore_case("Z_", "z`"));
+}
+
+TEST(ascii_test, test_hash_ignore_case) {
+    char upper[40];
+    char lower[40];
+    for (size_t len = 0; len < sizeof(upper); ++len) {
+        for (size_t i = 0; i < len; ++i) {
+            upper[i] = static_cast<char>('A' + (i * 7) % 26);
+            lower[i] = ascii_lower(upper[i]);
+        }
+        ASSERT_EQ(hash_ignore_case<uint32_t>(string_view(upper, len)),
+                  hash_ignore_case<uint32_t>(string_view(lower, len)));
+        if (len) {
+            ASSERT_NE(hash_ignore_case<uint32_t>(string_view(lower, len)),
+                      hash_ignore_case<uint32_t>(string_view(lower, len - 1)));
+        }
+    }
+    const char zeros[2] = {0, 0};
+    ASSERT_NE(hash_ignore_case<uint32_t>(string_view(zeros, 1)), hash_ignore_case<uint32_t>(string_view(zeros, 2)));
+}
@@ -153,3 +153,51 @@ TEST(dynamic_string_tests, resize_length_set) {
     ASSERT_EQ(length, str.length());
 }
 
+
+TEST(dynamic_string_tests, move_and_swap_keep_buffers) {
+    const dynamic_string empty;
+    const char *empty_buffer = empty.c_str();
+    dynamic_string s1("Something is rotten in the state of Denmark");
+    const char *buffer = s1.c_str();
+    dynamic_string s2(move(s1));
+    ASSERT_EQ(buffer, s2.c_str());
+    ASSERT_EQ(empty_buffer, static_cast<const dynamic_string &>(s1).c_str());
+    dynamic_string s3("Brevity is the soul of wit");
+    s3 = move(s2);
+    ASSERT_EQ(buffer, s3.c_str());
+    ASSERT_EQ(empty_buffer, static_cast<const dynamic_string &>(s2).c_str());
+    s3 = move(s3);
+    ASSERT_STREQ("Something is rotten in the state of Denmark", s3.c_str());
+    dynamic_string s4("Brevity is the soul of wit");
+    const char *other = s4.c_str();
+    swap(s3, s4);
+    ASSERT_EQ(buffer, s4.c_str());
+    ASSERT_EQ(other, s3.c_str());
+    ASSERT_STREQ("Brevity is the soul of wit", s3.c_str());
+    s1 += "to be";
+    s1.push_back('!');
+    ASSERT_STREQ("to be!", s1.c_str());
+    s2 = "or not";
+    ASSERT_STREQ("or not", s2.c_str());
+    ASSERT_STREQ("", dynamic_string().c_str());
+}
+
+TEST(dynamic_string_tests, write_empty_strings) {
+    const dynamic_string other;
+    dynamic_string empty;
+    empty[0] = 'x';
+    ASSERT_STREQ("", other.c_str());
+    dynamic_string s1("Neither a borrower nor a lender be");
+    dynamic_string s2(move(s1));
+    s1.front() = 'y';
+    s1.back() = 'y';
+    s1.at(3) = 'y';
+    s1.c_str()[0] = 'z';
+    ASSERT_STREQ("", other.c_str());
+    ASSERT_STREQ("", dynamic_string().c_str());
+    // the written strings got buffers of their own
+    ASSERT_NE(other.c_str(), static_cast<const dynamic_string &>(s1).c_str());
+    ASSERT_EQ(0u, s1.length());
+    s1 = "lend";
+    ASSERT_STREQ("lend", s1.c_str());
+}
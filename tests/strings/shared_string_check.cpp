@@ -0,0 +1,130 @@
+/**
+ * @file shared_string_check.cpp
+ * @brief Unit testing for reference counted shared strings
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <gtest/gtest.h>
+#include <wlib/stl/HashMap.h>
+#include <wlib/stl/TreeMap.h>
+#include <wlib/strings/SharedString.h>
+
+using namespace wlp;
+
+TEST(shared_string_test, test_construct) {
+    shared_string empty;
+    ASSERT_TRUE(empty.empty());
+    ASSERT_EQ(0u, empty.length());
+    ASSERT_STREQ("", empty.c_str());
+    ASSERT_EQ(0u, empty.use_count());
+
+    dynamic_string d("dynamic");
+    shared_string sc("chars");
+    shared_string sb("buffer", 3);
+    shared_string sv(string_view("view"));
+    shared_string sd(d);
+    ASSERT_STREQ("chars", sc.c_str());
+    ASSERT_EQ(5u, sc.length());
+    ASSERT_STREQ("buf", sb.c_str());
+    ASSERT_EQ('u', sb[1]);
+    ASSERT_STREQ("view", sv.c_str());
+    ASSERT_STREQ("dynamic", sd.c_str());
+    ASSERT_EQ(7u, sd.size());
+    ASSERT_EQ(1u, sd.use_count());
+    ASSERT_STREQ("dynamic", sd.to_dynamic_string().c_str());
+    ASSERT_TRUE(shared_string("").empty());
+
+    string_view v = sc;
+    ASSERT_EQ(sc.c_str(), v.data());
+    ASSERT_EQ(5u, v.length());
+    size_t n = 0;
+    for (char c : sb) {
+        ASSERT_EQ("buf"[n++], c);
+    }
+    ASSERT_EQ(3u, n);
+}
+
+TEST(shared_string_test, test_copies_share_characters) {
+    shared_string s("telemetry.rate");
+    const char *chars = s.c_str();
+    {
+        shared_string c1(s);
+        shared_string c2;
+        c2 = c1;
+        ASSERT_EQ(chars, c1.c_str());
+        ASSERT_EQ(chars, c2.c_str());
+        ASSERT_EQ(3u, s.use_count());
+        c2 = c2;
+        ASSERT_EQ(3u, s.use_count());
+    }
+    ASSERT_EQ(1u, s.use_count());
+
+    shared_string m(move(s));
+    ASSERT_EQ(chars, m.c_str());
+    ASSERT_EQ(1u, m.use_count());
+    ASSERT_TRUE(s.empty());
+
+    shared_string other("other");
+    m = move(other);
+    ASSERT_STREQ("other", m.c_str());
+    ASSERT_TRUE(other.empty());
+
+    other = "again";
+    m.swap(other);
+    ASSERT_STREQ("again", m.c_str());
+    ASSERT_STREQ("other", other.c_str());
+}
+
+TEST(shared_string_test, test_compare_and_hash) {
+    shared_string a("alpha");
+    shared_string b("alpha");
+    shared_string c("alphabet");
+    shared_string d("beta");
+    ASSERT_NE(a.c_str(), b.c_str());
+    ASSERT_TRUE(a == b);
+    ASSERT_TRUE(a != c);
+    ASSERT_TRUE(a < c);
+    ASSERT_TRUE(c < d);
+    ASSERT_TRUE(d >= a);
+    ASSERT_EQ(0, a.compare(b));
+    ASSERT_TRUE(shared_string() < a);
+
+    hash<shared_string, uint16_t> h16;
+    hash<const char *, uint16_t> c16;
+    hash<dynamic_string, uint32_t> d32;
+    ASSERT_EQ(c16("alphabet"), h16(c));
+    ASSERT_EQ(d32(dynamic_string("alphabet")), c.hash());
+    ASSERT_EQ(0u, shared_string().hash());
+
+    equals<shared_string> eq;
+    comparator<shared_string> cmp;
+    ASSERT_TRUE(eq(a, b));
+    ASSERT_FALSE(eq(a, c));
+    ASSERT_TRUE(cmp.__lt__(a, d));
+    ASSERT_TRUE(cmp.__eq__(a, b));
+}
+
+TEST(shared_string_test, test_map_keys) {
+    const char *const names[] = {"eps.batt.v", "eps.batt.i", "imu.gyro.x", "imu.gyro.y", "adcs.mode"};
+    hash_map<shared_string, int> hmap(16);
+    tree_map<shared_string, int> tmap;
+    for (int i = 0; i < 5; ++i) {
+        shared_string key(names[i]);
+        hmap[key] = i;
+        tmap[key] = i;
+        ASSERT_EQ(3u, key.use_count());
+    }
+    ASSERT_EQ(5u, hmap.size());
+    ASSERT_EQ(5u, tmap.size());
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_EQ(i, *hmap.find(shared_string(names[i])));
+        ASSERT_EQ(i, *tmap.find(shared_string(names[i])));
+    }
+    ASSERT_EQ(hmap.end(), hmap.find(shared_string("imu.gyro.z")));
+    ASSERT_EQ(tmap.end(), tmap.find(shared_string("imu.gyro.z")));
+    ASSERT_EQ(4, *tmap.begin());
+    ASSERT_STREQ("adcs.mode", tmap.begin().key().c_str());
+}
@@ -261,3 +261,69 @@ TEST(static_string_test, substring) {
     ASSERT_STREQ("deep", string1.substr(15, 2).c_str());
     ASSERT_STREQ("ep", string1.substr(2, 8).c_str());
 }
+
+namespace {
+
+    constexpr String16 station_codes[] = {
+            String16("KIR"),
+            String16("SVALBARD"),
+            String16("a string longer than sixteen")
+    };
+
+    static_assert(station_codes[0].length() == 3, "length known at compile time");
+    static_assert(station_codes[1][4] == 'B', "characters known at compile time");
+    static_assert(station_codes[2].length() == 16, "literals are truncated to the capacity");
+    static_assert(__is_trivially_copyable(String16), "static strings are trivially copyable");
+
+}
+
+TEST(static_string_test, constexpr_table) {
+    ASSERT_STREQ("KIR", station_codes[0].c_str());
+    ASSERT_STREQ("SVALBARD", station_codes[1].c_str());
+    ASSERT_STREQ("a string longer ", station_codes[2].c_str());
+    char buffer[8] = "ab";
+    String16 from_array(buffer);
+    ASSERT_EQ(2u, from_array.length());
+    const char *pointer = buffer;
+    String16 from_pointer(pointer);
+    ASSERT_TRUE(from_array == from_pointer);
+}
+
+TEST(static_string_test, length_aware_compare) {
+    const char bytes[] = {'a', 'b', '\0', 'c'};
+    String16 with_null(bytes, 4);
+    String16 prefix("ab");
+    ASSERT_EQ(4u, with_null.length());
+    ASSERT_FALSE(with_null == prefix);
+    ASSERT_TRUE(with_null != prefix);
+    ASSERT_GT(with_null.compare(prefix), 0);
+    ASSERT_LT(prefix.compare(with_null), 0);
+    ASSERT_EQ(0, with_null.compare(String16(bytes, 4)));
+
+    String64 long1("a longer string that is compared with memcmp 1");
+    String64 long2("a longer string that is compared with memcmp 2");
+    ASSERT_FALSE(long1 == long2);
+    ASSERT_LT(long1.compare(long2), 0);
+    long2.pop_back();
+    long2.push_back('1');
+    ASSERT_TRUE(long1 == long2);
+}
+
+TEST(static_string_test, shrinking_keeps_equality) {
+    String16 s("a longer value");
+    s = "ab";
+    ASSERT_TRUE(s == String16("ab"));
+    s = 'x';
+    ASSERT_TRUE(s == String16("x"));
+    s = "telemetry";
+    s.clear();
+    ASSERT_TRUE(s == String16());
+    s = "telemetry";
+    s = dynamic_string("tm");
+    ASSERT_TRUE(s == String16("tm"));
+    String16 t("telemetry");
+    ASSERT_TRUE(t.substr(0, 2) == String16("te"));
+    ASSERT_EQ(2u, t.substr(0, 2).length());
+    t.erase(0);
+    ASSERT_TRUE(t == String16("elemetry"));
+}
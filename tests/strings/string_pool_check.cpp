@@ -0,0 +1,121 @@
+/**
+ * @file string_pool_check.cpp
+ * @brief Unit testing for the string buffer pool
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <gtest/gtest.h>
+#include <wlib/strings/StringPool.h>
+
+using namespace wlp;
+
+TEST(string_pool_test, test_size_classes) {
+    string_pool pool;
+    char *a = pool.allocate(1);
+    char *b = pool.allocate(15);
+    char *c = pool.allocate(16);
+    char *d = pool.allocate(511);
+    char *e = pool.allocate(512);
+    ASSERT_EQ(15u, pool.capacity(a));
+    ASSERT_EQ(15u, pool.capacity(b));
+    ASSERT_EQ(31u, pool.capacity(c));
+    ASSERT_EQ(511u, pool.capacity(d));
+    ASSERT_EQ(512u, pool.capacity(e));
+    memset(d, 'x', 511);
+    memset(e, 'y', 512);
+
+    const string_pool_stats &stats = pool.stats();
+    ASSERT_EQ(5u, stats.allocations);
+    ASSERT_EQ(1u, stats.large_allocations);
+    ASSERT_EQ(1u + 15u + 16u + 511u + 512u, stats.requested_bytes);
+    ASSERT_EQ(15u + 15u + 31u + 511u + 512u, stats.granted_bytes);
+    const size_t large = sizeof(size_t) + 1 + 512;
+    ASSERT_EQ(3 * string_pool::default_chunk_size + large, stats.reserved_bytes);
+    ASSERT_EQ(16u + 16u + 32u + 512u + large, stats.live_bytes);
+    ASSERT_GE(stats.reserved_bytes, stats.live_bytes + stats.free_bytes);
+
+    pool.deallocate(a);
+    pool.deallocate(b);
+    pool.deallocate(c);
+    pool.deallocate(d);
+    pool.deallocate(e);
+    ASSERT_EQ(0u, stats.live_bytes);
+    ASSERT_EQ(3 * string_pool::default_chunk_size, stats.reserved_bytes);
+}
+
+TEST(string_pool_test, test_reuse) {
+    string_pool pool;
+    char *a = pool.allocate(10);
+    char *b = pool.allocate(12);
+    const size_t reserved = pool.stats().reserved_bytes;
+    pool.deallocate(a);
+    pool.deallocate(b);
+    ASSERT_EQ(b, pool.allocate(3));
+    ASSERT_EQ(a, pool.allocate(14));
+    ASSERT_EQ(reserved, pool.stats().reserved_bytes);
+    ASSERT_EQ(2u * 16u, pool.stats().live_bytes);
+
+    // a full chunk makes the class take a new one
+    for (size_t i = 2; i < (string_pool::default_chunk_size - sizeof(char *)) / 16; ++i) {
+        pool.allocate(8);
+    }
+    ASSERT_EQ(reserved, pool.stats().reserved_bytes);
+    pool.allocate(8);
+    ASSERT_EQ(reserved + string_pool::default_chunk_size, pool.stats().reserved_bytes);
+}
+
+TEST(string_pool_test, test_dynamic_string_policy) {
+    string_pool pool;
+    const string_allocator *prev = dynamic_string::set_allocator(pool.allocator());
+    ASSERT_EQ(pool.allocator(), dynamic_string::allocator());
+    {
+        dynamic_string s("telemetry");
+        const char *buffer = s.c_str();
+        s += ".rat";
+        s.push_back('e');
+        ASSERT_STREQ("telemetry.rate", s.c_str());
+        ASSERT_EQ(buffer, s.c_str());
+        s += ".maximum";
+        ASSERT_STREQ("telemetry.rate.maximum", s.c_str());
+        ASSERT_NE(buffer, s.c_str());
+
+        dynamic_string copy(s);
+        ASSERT_STREQ("telemetry.rate.maximum", copy.c_str());
+        copy = "short";
+        ASSERT_STREQ("short", copy.c_str());
+        copy = s.substr(0, 9);
+        ASSERT_STREQ("telemetry", copy.c_str());
+        ASSERT_EQ(s, copy + ".rate.maximum");
+        ASSERT_LT(0u, pool.stats().live_bytes);
+    }
+    ASSERT_EQ(0u, pool.stats().live_bytes);
+    ASSERT_EQ(pool.allocator(), dynamic_string::set_allocator(prev));
+    ASSERT_EQ(prev, dynamic_string::allocator());
+}
+
+TEST(string_pool_test, test_switch_policy_with_live_strings) {
+    string_pool pool;
+    dynamic_string heap_string("allocated from the heap");
+    const string_allocator *prev = dynamic_string::set_allocator(pool.allocator());
+    dynamic_string pooled("pool");
+    ASSERT_LT(0u, pool.stats().live_bytes);
+    // each string frees its buffer through the policy that made it
+    dynamic_string::set_allocator(prev);
+    pooled += " moves to the heap";
+    ASSERT_STREQ("pool moves to the heap", pooled.c_str());
+    ASSERT_EQ(0u, pool.stats().live_bytes);
+    heap_string = dynamic_string("replaced on the heap");
+    pooled.swap(heap_string);
+    ASSERT_STREQ("pool moves to the heap", heap_string.c_str());
+    dynamic_string::set_allocator(pool.allocator());
+    pooled += " and is freed there";
+    ASSERT_STREQ("replaced on the heap and is freed there", pooled.c_str());
+    ASSERT_LT(0u, pool.stats().live_bytes);
+    heap_string = dynamic_string();
+    dynamic_string::set_allocator(prev);
+    pooled = dynamic_string();
+    ASSERT_EQ(0u, pool.stats().live_bytes);
+}
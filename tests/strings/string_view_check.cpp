@@ -0,0 +1,86 @@
+/**
+ * @file string_view_check.cpp
+ * @brief Unit testing for non-owning string views
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <gtest/gtest.h>
+#include <wlib/strings/StringView.h>
+
+using namespace wlp;
+
+TEST(string_view_test, test_construct_from_strings) {
+    string_view empty;
+    ASSERT_TRUE(empty.empty());
+    ASSERT_EQ(0u, empty.length());
+
+    static_string<16> s("static");
+    dynamic_string d("dynamic");
+    string_view vs(s);
+    string_view vd(d);
+    string_view vc("chars");
+    string_view vb("buffer", 3);
+    ASSERT_EQ(s.c_str(), vs.data());
+    ASSERT_EQ(6u, vs.length());
+    ASSERT_EQ(d.c_str(), vd.data());
+    ASSERT_EQ(7u, vd.size());
+    ASSERT_EQ(5u, vc.length());
+    ASSERT_EQ(3u, vb.length());
+    ASSERT_EQ('u', vb[1]);
+    ASSERT_EQ('b', vb.front());
+    ASSERT_EQ('f', vb.back());
+    size_t n = 0;
+    for (char c : vb) {
+        ASSERT_EQ("buf"[n++], c);
+    }
+    ASSERT_EQ(3u, n);
+}
+
+TEST(string_view_test, test_substr_and_trim) {
+    string_view v("telemetry/line");
+    ASSERT_TRUE(v.substr(0, 9) == "telemetry");
+    ASSERT_TRUE(v.substr(10) == "line");
+    ASSERT_TRUE(v.substr(10, 100) == "line");
+    ASSERT_TRUE(v.substr(14).empty());
+    ASSERT_TRUE(v.substr(99, 2).empty());
+    ASSERT_EQ(9u, v.find('/'));
+    ASSERT_EQ(v.length(), v.find('/', 10));
+    ASSERT_EQ(v.length(), v.find('x'));
+    ASSERT_TRUE(v.starts_with("tele"));
+    ASSERT_FALSE(v.starts_with("line"));
+    ASSERT_TRUE(v.ends_with("line"));
+    v.remove_prefix(10);
+    ASSERT_TRUE(v == "line");
+    v.remove_suffix(2);
+    ASSERT_TRUE(v == "li");
+    v.remove_suffix(5);
+    ASSERT_TRUE(v.empty());
+}
+
+TEST(string_view_test, test_compare) {
+    string_view a("abc");
+    string_view ab("ab");
+    string_view b("abd");
+    ASSERT_TRUE(ab < a);
+    ASSERT_TRUE(a < b);
+    ASSERT_TRUE(b > a);
+    ASSERT_TRUE(a <= a);
+    ASSERT_TRUE(a >= ab);
+    ASSERT_TRUE(a != ab);
+    ASSERT_EQ(0, a.compare(string_view("abcdef", 3)));
+    ASSERT_TRUE(string_view() == string_view(""));
+    const char bytes[] = {'x', '\0', 'y'};
+    ASSERT_TRUE(string_view(bytes, 3) != string_view(bytes, 1));
+    ASSERT_TRUE(string_view(bytes, 3) > string_view(bytes, 2));
+}
+
+TEST(string_view_test, test_to_dynamic_string) {
+    string_view v("field,rest", 5);
+    dynamic_string d = v.to_dynamic_string();
+    ASSERT_STREQ("field", d.c_str());
+    ASSERT_EQ(5u, d.length());
+    ASSERT_TRUE(string_view(d) == v);
+}
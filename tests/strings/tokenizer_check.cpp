@@ -0,0 +1,203 @@
+/**
+ * @file tokenizer_check.cpp
+ * @brief Unit testing for the zero-copy tokenizer
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <gtest/gtest.h>
+#include <wlib/strings/Tokenizer.h>
+
+using namespace wlp;
+
+namespace {
+
+    /**
+     * Split a text and join the fields with '|' for comparison.
+     */
+    void joined(const string_view &text, const delimiter_set &delims, char *out) {
+        tokenizer tok(text, delims);
+        string_view field;
+        size_t n = 0;
+        bool first = true;
+        while (tok.next(field)) {
+            if (!first) {
+                out[n++] = '|';
+            }
+            first = false;
+            memcpy(out + n, field.data(), field.length());
+            n += field.length();
+        }
+        out[n] = '\0';
+    }
+
+}
+
+TEST(tokenizer_test, test_single_delimiter) {
+    delimiter_set csv(",");
+    char out[128];
+    joined("a,bc,,d", csv, out);
+    ASSERT_STREQ("a|bc||d", out);
+    joined("a,", csv, out);
+    ASSERT_STREQ("a|", out);
+    joined(",", csv, out);
+    ASSERT_STREQ("|", out);
+    joined("plain", csv, out);
+    ASSERT_STREQ("plain", out);
+
+    tokenizer empty("", csv);
+    string_view field;
+    ASSERT_FALSE(empty.next(field));
+}
+
+TEST(tokenizer_test, test_fields_point_into_text) {
+    const char text[] = "sensor=12;temp=25.5;ok";
+    delimiter_set semi(";");
+    tokenizer tok(text, semi);
+    string_view field;
+    ASSERT_TRUE(tok.next(field));
+    ASSERT_EQ(text, field.data());
+    ASSERT_EQ(9u, field.length());
+    ASSERT_TRUE(tok.rest() == "temp=25.5;ok");
+    ASSERT_TRUE(tok.next(field));
+    ASSERT_EQ(text + 10, field.data());
+    ASSERT_TRUE(tok.next(field));
+    ASSERT_TRUE(field == "ok");
+    ASSERT_FALSE(tok.next(field));
+}
+
+TEST(tokenizer_test, test_multiple_delimiters_and_long_text) {
+    delimiter_set four(",; \t");
+    delimiter_set many(",; \t|");
+    char text[200];
+    char expected[200];
+    size_t n = 0;
+    size_t e = 0;
+    const char delims[] = ",; \t|";
+    for (int i = 0; i < 40; ++i) {
+        const char c = static_cast<char>('a' + i % 26);
+        text[n++] = c;
+        text[n++] = c;
+        text[n++] = delims[i % 4];
+        expected[e++] = c;
+        expected[e++] = c;
+        expected[e++] = '|';
+    }
+    text[n] = '\0';
+    expected[e] = '\0';
+    char out[200];
+    joined(text, four, out);
+    ASSERT_STREQ(expected, out);
+    joined(text, many, out);
+    ASSERT_STREQ(expected, out);
+    // a long field with the delimiter in the last word position
+    joined("0123456789abcdef012345;x", four, out);
+    ASSERT_STREQ("0123456789abcdef012345|x", out);
+    joined("0123456789abcdef012345|x", four, out);
+    ASSERT_STREQ("0123456789abcdef012345|x", out);
+    joined("0123456789abcdef012345|x", many, out);
+    ASSERT_STREQ("0123456789abcdef012345|x", out);
+}
+
+TEST(tokenizer_test, test_find_agrees_with_scalar) {
+    delimiter_set set(",\x80\xff");
+    char text[64];
+    for (int pos = 0; pos < 40; ++pos) {
+        for (int d = 0; d < 3; ++d) {
+            memset(text, 'a', sizeof(text));
+            text[pos] = ",\x80\xff"[d];
+            text[pos + 1 + d] = '\x7f';
+            ASSERT_EQ(set.find_scalar(text, text + sizeof(text)), set.find(text, text + sizeof(text)));
+            ASSERT_EQ(text + pos, set.find(text, text + sizeof(text)));
+        }
+    }
+    memset(text, 0, sizeof(text));
+    ASSERT_EQ(text + sizeof(text), set.find(text, text + sizeof(text)));
+}
+
+TEST(tokenizer_test, test_collapse_whitespace) {
+    delimiter_set ws(" \t", '\0', true);
+    char out[128];
+    joined("  12.5 \t 13.0   x ", ws, out);
+    ASSERT_STREQ("12.5|13.0|x", out);
+    joined("   ", ws, out);
+    ASSERT_STREQ("", out);
+    joined("one", ws, out);
+    ASSERT_STREQ("one", out);
+}
+
+TEST(tokenizer_test, test_quoted_fields) {
+    delimiter_set csv(",", '"');
+    char out[128];
+    joined("id,\"Smith, John\",\"\",42", csv, out);
+    ASSERT_STREQ("id|Smith, John||42", out);
+    joined("\"say \"\"hi\"\"\",x", csv, out);
+    ASSERT_STREQ("say \"\"hi\"\"|x", out);
+    joined("\"open, never closed", csv, out);
+    ASSERT_STREQ("open, never closed", out);
+    joined("\"a\"junk,b", csv, out);
+    ASSERT_STREQ("a|b", out);
+    joined("\"a\",", csv, out);
+    ASSERT_STREQ("a|", out);
+
+    tokenizer tok("plain,\"q\"", csv);
+    string_view field;
+    ASSERT_TRUE(tok.next(field));
+    ASSERT_FALSE(tok.quoted());
+    ASSERT_TRUE(tok.next(field));
+    ASSERT_TRUE(tok.quoted());
+
+    char buf[32];
+    string_view escaped("say \"\"hi\"\"");
+    size_t len = tokenizer::unescape(escaped, '"', buf);
+    ASSERT_EQ(8u, len);
+    ASSERT_EQ(0, memcmp("say \"hi\"", buf, len));
+}
+
+TEST(tokenizer_test, test_split_into_list) {
+    delimiter_set csv(",");
+    array_list<string_view> fields(8);
+    dynamic_string line("t,1,2,3");
+    static_string<16> other("x,y");
+    tokenizer tok(line, csv);
+    ASSERT_EQ(4u, tok.split(fields));
+    ASSERT_EQ(4u, fields.size());
+    ASSERT_TRUE(fields[0] == "t");
+    ASSERT_TRUE(fields[3] == "3");
+    ASSERT_EQ(line.c_str() + 6, fields[3].data());
+    tokenizer more(other, csv);
+    ASSERT_EQ(2u, more.split(fields));
+    ASSERT_EQ(6u, fields.size());
+    ASSERT_TRUE(fields[5] == "y");
+    ASSERT_EQ(8u, fields.capacity());
+    fields.clear();
+    ASSERT_EQ(0u, tokenizer("", csv).split(fields));
+}
+
+TEST(tokenizer_test, test_split_matches_next) {
+    const char *lines[] = {
+            "1718000000123,site07,dev0123,temperature,23.45,OK",
+            ",,,,,,,,,,,,,,,,,",
+            "no delimiters in this rather long line at all",
+            "a,b;c,d;e,f;g,h;i,j;k,l;m,n;o,p;",
+            "12345678,12345678;12345678,"
+    };
+    delimiter_set two(",;");
+    for (const char *line : lines) {
+        array_list<string_view> split(4);
+        const size_t count = tokenizer(line, two).split(split);
+        ASSERT_EQ(count, split.size());
+        tokenizer tok(line, two);
+        string_view field;
+        size_t i = 0;
+        while (tok.next(field)) {
+            ASSERT_LT(i, split.size());
+            ASSERT_EQ(field.data(), split[i].data());
+            ASSERT_EQ(field.length(), split[i].length());
+            ++i;
+        }
+        ASSERT_EQ(i, split.size());
+    }
+}
@@ -0,0 +1,99 @@
+/**
+ * @file utf8_check.cpp
+ * @brief Unit testing for UTF-8 validation
+ *
+ * @author Jeff Niu
+ * @date October 18, 2026
+ * @bug No known bugs
+ */
+
+#include <gtest/gtest.h>
+#include <wlib/strings/Utf8.h>
+
+using namespace wlp;
+
+namespace {
+
+    /**
+     * Validate a sequence placed after an ASCII run, so that it is
+     * reached both before and after the word skipping.
+     */
+    size_t valid_after(size_t run, const char *seq) {
+        char buf[64];
+        memset(buf, 'a', run);
+        const size_t len = strlen(seq);
+        memcpy(buf + run, seq, len);
+        const size_t valid = utf8_valid_length(buf, run + len);
+        return valid - run;
+    }
+
+}
+
+TEST(utf8_test, test_valid_text) {
+    ASSERT_TRUE(utf8_valid(""));
+    ASSERT_TRUE(utf8_valid("plain ascii telemetry line, long enough to skip words"));
+    ASSERT_TRUE(utf8_valid("caf\xc3\xa9"));
+    ASSERT_TRUE(utf8_valid("\xe2\x82\xac 12.50"));
+    ASSERT_TRUE(utf8_valid("\xf0\x9f\x9b\xb0 satellite"));
+    ASSERT_TRUE(utf8_valid("\x7f\xc2\x80\xdf\xbf\xe0\xa0\x80\xef\xbf\xbf\xf0\x90\x80\x80\xf4\x8f\xbf\xbf"));
+    ASSERT_TRUE(utf8_valid("\xed\x9f\xbf\xee\x80\x80"));
+    dynamic_string d("\xce\xb1\xce\xb2\xce\xb3");
+    ASSERT_TRUE(utf8_valid(d));
+    const char nul[] = {'a', '\0', 'b'};
+    ASSERT_TRUE(utf8_valid(nul, sizeof(nul)));
+}
+
+TEST(utf8_test, test_invalid_sequences) {
+    const char *const invalid[] = {
+            "\x80",             // stray continuation
+            "\xbf",
+            "\xc0\x80",         // overlong
+            "\xc1\xbf",
+            "\xe0\x9f\xbf",
+            "\xf0\x8f\xbf\xbf",
+            "\xed\xa0\x80",     // surrogates
+            "\xed\xbf\xbf",
+            "\xf4\x90\x80\x80", // above U+10FFFF
+            "\xf5\x80\x80\x80",
+            "\xff",
+            "\xc3",             // truncated
+            "\xe2\x82",
+            "\xf0\x9f\x9b",
+            "\xc3\x28",         // bad continuation
+            "\xe2\x28\xa1",
+            "\xe2\x82\x28",
+            "\xf0\x9f\x28\xb0"
+    };
+    for (size_t run = 0; run < 40; run += 3) {
+        for (const char *seq : invalid) {
+            ASSERT_EQ(0u, valid_after(run, seq)) << run << " " << seq;
+        }
+        ASSERT_EQ(2u, valid_after(run, "\xc3\xa9\xc3"));
+        ASSERT_EQ(4u, valid_after(run, "\xf0\x9f\x9b\xb0"));
+    }
+    ASSERT_FALSE(utf8_valid("valid prefix then \xc0\xaf"));
+    ASSERT_EQ(5u, utf8_valid_length("ab\xe2\x82\xac\xe2\x82", 7));
+}
+
+TEST(utf8_test, test_error_offset_in_long_text) {
+    const char *const seqs[] = {"a", "\xc3\xa9", "\xe2\x82\xac", "\xf0\x9f\x9b\xb0"};
+    char text[300];
+    size_t starts[300];
+    size_t count = 0;
+    size_t len = 0;
+    for (size_t i = 0; len < 280; ++i) {
+        const char *seq = seqs[(i * 7 + i / 5) % 4];
+        starts[count++] = len;
+        memcpy(text + len, seq, strlen(seq));
+        len += strlen(seq);
+    }
+    ASSERT_TRUE(utf8_valid(text, len));
+    for (size_t c = 0; c < count; c += 3) {
+        char bad[300];
+        memcpy(bad, text, len);
+        bad[starts[c]] = '\xff';
+        ASSERT_EQ(starts[c], utf8_valid_length(bad, len));
+        // cutting the text inside a sequence leaves the prefix valid
+        ASSERT_EQ(starts[c], utf8_valid_length(text, starts[c] + (text[starts[c]] & 0x80 ? 1 : 0)));
+    }
+}
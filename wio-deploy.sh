@@ -39,6 +39,10 @@ echo "Copying WLib files into wio package"
 cp -r lib/wlib/wlib wlib-wio/src/
 cp -r lib/wlib/include/wlib wlib-wio/include
 
+# The thread team runs on std::thread, which the targets do not have
+rm wlib-wio/src/wlib/stl/Parallel.h wlib-wio/src/wlib/stl/Parallel.cpp
+rm wlib-wio/include/wlib/parallel
+
 # Generate a dummy test
 printf "#include <wlib/array_list>\n\nint main(int argc, char *argv[]) {\n    wlp::array_list<int> int_list(12);\n    int_list.push_back(12);\n}\n" > wlib-wio/tests/main.cpp
 